@@ -0,0 +1,542 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "Base64.h"
+
+// Standard Library
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if defined(_M_ARM64) || defined(_M_ARM64EC)
+#define BASE64_NEON
+#include <arm_neon.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#define BASE64_X86
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+using std::optional;
+using std::string;
+using std::string_view;
+
+namespace Microsoft::React::Utilities {
+
+namespace {
+
+constexpr char Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+constexpr uint8_t InvalidValue = 0xFF;
+
+// The value of each character of the alphabet, InvalidValue for the others.
+constexpr std::array<uint8_t, 256> DecodeTable = [] {
+  std::array<uint8_t, 256> table{};
+  for (auto &value : table) {
+    value = InvalidValue;
+  }
+  for (uint8_t i = 0; i < 64; i++) {
+    table[static_cast<uint8_t>(Alphabet[i])] = i;
+  }
+  return table;
+}();
+
+// The SIMD kernels process the bulk of the data and return how much of it they
+// consumed: a multiple of 3 bytes when encoding, of 4 characters when decoding.
+// They stop at the first block that has padding or invalid characters, which is
+// left to the scalar implementation.
+// Decoding kernels may write past the bytes they decode, within
+// Base64DecodedMaxSize(size).
+struct Base64Kernels {
+  size_t (*Encode)(const uint8_t *src, size_t size, char *dst) noexcept;
+  size_t (*Decode)(const char *src, size_t size, uint8_t *dst) noexcept;
+};
+
+size_t EncodeNone(const uint8_t *, size_t, char *) noexcept {
+  return 0;
+}
+
+size_t DecodeNone(const char *, size_t, uint8_t *) noexcept {
+  return 0;
+}
+
+size_t EncodeScalar(const uint8_t *src, size_t size, char *dst) noexcept {
+  auto out = dst;
+  size_t i = 0;
+  for (; i + 3 <= size; i += 3) {
+    const uint32_t group = src[i] << 16 | src[i + 1] << 8 | src[i + 2];
+    *out++ = Alphabet[group >> 18];
+    *out++ = Alphabet[group >> 12 & 0x3F];
+    *out++ = Alphabet[group >> 6 & 0x3F];
+    *out++ = Alphabet[group & 0x3F];
+  }
+
+  if (i + 1 == size) {
+    const uint32_t group = src[i] << 16;
+    *out++ = Alphabet[group >> 18];
+    *out++ = Alphabet[group >> 12 & 0x3F];
+    *out++ = '=';
+    *out++ = '=';
+  } else if (i + 2 == size) {
+    const uint32_t group = src[i] << 16 | src[i + 1] << 8;
+    *out++ = Alphabet[group >> 18];
+    *out++ = Alphabet[group >> 12 & 0x3F];
+    *out++ = Alphabet[group >> 6 & 0x3F];
+    *out++ = '=';
+  }
+
+  return out - dst;
+}
+
+optional<size_t> DecodeScalar(const char *src, size_t size, uint8_t *dst) noexcept {
+  if (size % 4 == 0 && size > 0 && src[size - 1] == '=') {
+    size -= src[size - 2] == '=' ? 2 : 1;
+  }
+  if (size % 4 == 1) {
+    return std::nullopt;
+  }
+
+  auto value = [src](size_t i) noexcept -> uint32_t { return DecodeTable[static_cast<uint8_t>(src[i])]; };
+
+  auto out = dst;
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    const uint32_t a = value(i), b = value(i + 1), c = value(i + 2), d = value(i + 3);
+    if ((a | b | c | d) & 0x80) {
+      return std::nullopt;
+    }
+    const uint32_t group = a << 18 | b << 12 | c << 6 | d;
+    *out++ = static_cast<uint8_t>(group >> 16);
+    *out++ = static_cast<uint8_t>(group >> 8);
+    *out++ = static_cast<uint8_t>(group);
+  }
+
+  if (i + 2 <= size) {
+    const uint32_t a = value(i), b = value(i + 1), c = i + 3 == size ? value(i + 2) : 0;
+    if ((a | b | c) & 0x80) {
+      return std::nullopt;
+    }
+    const uint32_t group = a << 18 | b << 12 | c << 6;
+    *out++ = static_cast<uint8_t>(group >> 16);
+    if (i + 3 == size) {
+      *out++ = static_cast<uint8_t>(group >> 8);
+    }
+  }
+
+  return out - dst;
+}
+
+#ifdef BASE64_X86
+
+// Vectorized base64 after Wojciech Muła and Daniel Lemire,
+// "Faster Base64 Encoding and Decoding Using AVX2 Instructions" (2018).
+
+// Moves the 24 bits of each group of 3 bytes of the first 12 bytes of a 16 byte
+// lane into 32 bits, and splits them in 4 indices of 6 bits in separate bytes.
+inline __m128i SplitIndices(__m128i in) noexcept {
+  in = _mm_shuffle_epi8(in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+  const auto ac = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+  const auto bd = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+  return _mm_or_si128(ac, bd);
+}
+
+// Maps indices to the characters of the alphabet by adding the offset of their range.
+inline __m128i LookupCharacters(__m128i indices) noexcept {
+  auto ranges = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  ranges = _mm_or_si128(ranges, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+  const auto offsets = _mm_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '+' - 62, '/' - 63, 'A', 0, 0);
+  return _mm_add_epi8(_mm_shuffle_epi8(offsets, ranges), indices);
+}
+
+// Lookup tables of the validation and translation of characters, indexed by nibble.
+inline __m128i LowNibbleClasses() noexcept {
+  return _mm_setr_epi8(
+      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+}
+
+inline __m128i HighNibbleClasses() noexcept {
+  return _mm_setr_epi8(
+      0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+}
+
+inline __m128i RangeOffsets() noexcept {
+  return _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+
+// Packs the 3 bytes of each group of 4 values of 6 bits at the start of a 16 byte lane.
+inline __m128i PackLaneShuffle() noexcept {
+  return _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+}
+
+size_t EncodeSsse3(const uint8_t *src, size_t size, char *dst) noexcept {
+  size_t consumed = 0;
+  // Reads 16 bytes to encode 12.
+  for (; size - consumed >= 16; consumed += 12, dst += 16) {
+    const auto in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + consumed));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), LookupCharacters(SplitIndices(in)));
+  }
+  return consumed;
+}
+
+size_t DecodeSsse3(const char *src, size_t size, uint8_t *dst) noexcept {
+  size_t consumed = 0;
+  // Writes 16 bytes to decode 12, which the output holds while 24 characters remain.
+  for (; size - consumed >= 24; consumed += 16, dst += 12) {
+    const auto in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + consumed));
+    const auto highNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), _mm_set1_epi8(0x0F));
+    const auto lowNibbles = _mm_and_si128(in, _mm_set1_epi8(0x0F));
+    const auto lowClasses = _mm_shuffle_epi8(LowNibbleClasses(), lowNibbles);
+    const auto highClasses = _mm_shuffle_epi8(HighNibbleClasses(), highNibbles);
+    if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lowClasses, highClasses), _mm_setzero_si128()))) {
+      break;
+    }
+
+    const auto slashes = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+    const auto values = _mm_add_epi8(in, _mm_shuffle_epi8(RangeOffsets(), _mm_add_epi8(slashes, highNibbles)));
+    const auto pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    const auto groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_shuffle_epi8(groups, PackLaneShuffle()));
+  }
+  return consumed;
+}
+
+size_t EncodeAvx2(const uint8_t *src, size_t size, char *dst) noexcept {
+  const auto split = _mm256_setr_epi8(
+      1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+  const auto offsets = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '+' - 62, '/' - 63, 'A', 0, 0));
+
+  size_t consumed = 0;
+  // Reads 28 bytes to encode 24, 12 in each lane.
+  for (; size - consumed >= 28; consumed += 24, dst += 32) {
+    const auto low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + consumed));
+    const auto high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + consumed + 12));
+    auto in = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+    in = _mm256_shuffle_epi8(in, split);
+    const auto ac =
+        _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+    const auto bd =
+        _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+    const auto indices = _mm256_or_si256(ac, bd);
+
+    auto ranges = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    ranges = _mm256_or_si256(
+        ranges, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+    const auto out = _mm256_add_epi8(_mm256_shuffle_epi8(offsets, ranges), indices);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), out);
+  }
+  return consumed;
+}
+
+size_t DecodeAvx2(const char *src, size_t size, uint8_t *dst) noexcept {
+  const auto lowNibbleClasses = _mm256_broadcastsi128_si256(LowNibbleClasses());
+  const auto highNibbleClasses = _mm256_broadcastsi128_si256(HighNibbleClasses());
+  const auto rangeOffsets = _mm256_broadcastsi128_si256(RangeOffsets());
+  const auto packLanes = _mm256_broadcastsi128_si256(PackLaneShuffle());
+
+  size_t consumed = 0;
+  // Writes 32 bytes to decode 24, which the output holds while 44 characters remain.
+  for (; size - consumed >= 44; consumed += 32, dst += 24) {
+    const auto in = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + consumed));
+    const auto highNibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), _mm256_set1_epi8(0x0F));
+    const auto lowNibbles = _mm256_and_si256(in, _mm256_set1_epi8(0x0F));
+    const auto lowClasses = _mm256_shuffle_epi8(lowNibbleClasses, lowNibbles);
+    const auto highClasses = _mm256_shuffle_epi8(highNibbleClasses, highNibbles);
+    if (!_mm256_testz_si256(lowClasses, highClasses)) {
+      break;
+    }
+
+    const auto slashes = _mm256_cmpeq_epi8(in, _mm256_set1_epi8('/'));
+    const auto values = _mm256_add_epi8(in, _mm256_shuffle_epi8(rangeOffsets, _mm256_add_epi8(slashes, highNibbles)));
+    const auto pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    const auto groups = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+    const auto packed = _mm256_permutevar8x32_epi32(
+        _mm256_shuffle_epi8(groups, packLanes), _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), packed);
+  }
+  return consumed;
+}
+
+struct CpuFeatures {
+  bool HasSsse3{false};
+  bool HasAvx2{false};
+};
+
+CpuFeatures DetectCpuFeatures() noexcept {
+  int info[4];
+  __cpuid(info, 0);
+  const int maxLeaf = info[0];
+
+  __cpuid(info, 1);
+  const bool hasSsse3 = info[2] & (1 << 9);
+  const bool hasOsAvx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 0x6) == 0x6;
+
+  bool hasAvx2 = false;
+  if (hasOsAvx && maxLeaf >= 7) {
+    __cpuidex(info, 7, 0);
+    hasAvx2 = info[1] & (1 << 5);
+  }
+
+  return {hasSsse3, hasAvx2};
+}
+
+const CpuFeatures &Features() noexcept {
+  static const CpuFeatures features = DetectCpuFeatures();
+  return features;
+}
+
+#elif defined(BASE64_NEON)
+
+uint8x16x4_t LoadTable(const uint8_t *table) noexcept {
+  uint8x16x4_t result;
+  for (int i = 0; i < 4; i++) {
+    result.val[i] = vld1q_u8(table + 16 * i);
+  }
+  return result;
+}
+
+size_t EncodeNeon(const uint8_t *src, size_t size, char *dst) noexcept {
+  const auto alphabet = LoadTable(reinterpret_cast<const uint8_t *>(Alphabet));
+  const auto mask = vdupq_n_u8(0x3F);
+
+  size_t consumed = 0;
+  for (; size - consumed >= 48; consumed += 48, dst += 64) {
+    const auto in = vld3q_u8(src + consumed);
+    uint8x16x4_t out;
+    out.val[0] = vshrq_n_u8(in.val[0], 2);
+    out.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask);
+    out.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask);
+    out.val[3] = vandq_u8(in.val[2], mask);
+    for (int i = 0; i < 4; i++) {
+      out.val[i] = vqtbl4q_u8(alphabet, out.val[i]);
+    }
+    vst4q_u8(reinterpret_cast<uint8_t *>(dst), out);
+  }
+  return consumed;
+}
+
+size_t DecodeNeon(const char *src, size_t size, uint8_t *dst) noexcept {
+  // The values of the first 128 characters, looked up in two tables of 64.
+  const auto lowTable = LoadTable(DecodeTable.data());
+  const auto highTable = LoadTable(DecodeTable.data() + 64);
+  const auto high = vdupq_n_u8(0x40);
+
+  size_t consumed = 0;
+  for (; size - consumed >= 64; consumed += 64, dst += 48) {
+    const auto in = vld4q_u8(reinterpret_cast<const uint8_t *>(src + consumed));
+    uint8x16x4_t values;
+    auto invalid = vdupq_n_u8(0);
+    for (int i = 0; i < 4; i++) {
+      values.val[i] = vqtbx4q_u8(vqtbl4q_u8(lowTable, in.val[i]), highTable, veorq_u8(in.val[i], high));
+      // Invalid values and characters beyond 127 have their high bit set.
+      invalid = vorrq_u8(invalid, vorrq_u8(values.val[i], in.val[i]));
+    }
+    if (vmaxvq_u8(invalid) & 0x80) {
+      break;
+    }
+
+    uint8x16x3_t out;
+    out.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2), vshrq_n_u8(values.val[1], 4));
+    out.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4), vshrq_n_u8(values.val[2], 2));
+    out.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+    vst3q_u8(dst, out);
+  }
+  return consumed;
+}
+
+#endif
+
+bool IsSupported(Base64Kernel kernel) noexcept {
+  switch (kernel) {
+    case Base64Kernel::Scalar:
+      return true;
+#ifdef BASE64_X86
+    case Base64Kernel::Ssse3:
+      return Features().HasSsse3;
+    case Base64Kernel::Avx2:
+      return Features().HasAvx2;
+#elif defined(BASE64_NEON)
+    case Base64Kernel::Neon:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+Base64Kernels KernelsOf(Base64Kernel kernel) noexcept {
+  switch (kernel) {
+#ifdef BASE64_X86
+    case Base64Kernel::Ssse3:
+      return {EncodeSsse3, DecodeSsse3};
+    case Base64Kernel::Avx2:
+      return {EncodeAvx2, DecodeAvx2};
+#elif defined(BASE64_NEON)
+    case Base64Kernel::Neon:
+      return {EncodeNeon, DecodeNeon};
+#endif
+    default:
+      return {EncodeNone, DecodeNone};
+  }
+}
+
+// The fastest kernels this CPU supports.
+const Base64Kernels &Kernels() noexcept {
+  static const Base64Kernels kernels = [] {
+    for (auto kernel : {Base64Kernel::Avx2, Base64Kernel::Ssse3, Base64Kernel::Neon}) {
+      if (IsSupported(kernel)) {
+        return KernelsOf(kernel);
+      }
+    }
+    return KernelsOf(Base64Kernel::Scalar);
+  }();
+  return kernels;
+}
+
+size_t Encode(const Base64Kernels &kernels, string_view bytes, char *output) noexcept {
+  const auto src = reinterpret_cast<const uint8_t *>(bytes.data());
+  const auto consumed = kernels.Encode(src, bytes.size(), output);
+  const auto written = consumed / 3 * 4;
+  return written + EncodeScalar(src + consumed, bytes.size() - consumed, output + written);
+}
+
+optional<size_t> Decode(const Base64Kernels &kernels, string_view base64, char *output) noexcept {
+  const auto dst = reinterpret_cast<uint8_t *>(output);
+  const auto consumed = kernels.Decode(base64.data(), base64.size(), dst);
+  const auto written = consumed / 4 * 3;
+  const auto rest = DecodeScalar(base64.data() + consumed, base64.size() - consumed, dst + written);
+  if (!rest) {
+    return std::nullopt;
+  }
+  return written + *rest;
+}
+
+void AppendEncoding(string_view bytes, string &output) {
+  const auto offset = output.size();
+  output.resize(offset + Base64EncodedSize(bytes.size()));
+  EncodeBase64Into(bytes, output.data() + offset);
+}
+
+bool AppendDecoding(string_view base64, string &output) {
+  const auto offset = output.size();
+  output.resize(offset + Base64DecodedMaxSize(base64.size()));
+  const auto size = DecodeBase64Into(base64, output.data() + offset);
+  output.resize(offset + size.value_or(0));
+  return size.has_value();
+}
+
+} // namespace
+
+size_t EncodeBase64Into(string_view bytes, char *output) noexcept {
+  return Encode(Kernels(), bytes, output);
+}
+
+optional<size_t> DecodeBase64Into(string_view base64, char *output) noexcept {
+  return Decode(Kernels(), base64, output);
+}
+
+std::vector<Base64Kernel> SupportedBase64Kernels() {
+  std::vector<Base64Kernel> kernels;
+  for (auto kernel : {Base64Kernel::Scalar, Base64Kernel::Ssse3, Base64Kernel::Avx2, Base64Kernel::Neon}) {
+    if (IsSupported(kernel)) {
+      kernels.push_back(kernel);
+    }
+  }
+  return kernels;
+}
+
+size_t EncodeBase64Into(string_view bytes, char *output, Base64Kernel kernel) noexcept {
+  return Encode(KernelsOf(kernel), bytes, output);
+}
+
+optional<size_t> DecodeBase64Into(string_view base64, char *output, Base64Kernel kernel) noexcept {
+  return Decode(KernelsOf(kernel), base64, output);
+}
+
+#pragma region Base64Encoder
+
+void Base64Encoder::Update(string_view chunk, string &output) {
+  if (m_pendingSize + chunk.size() < 3) {
+    std::memcpy(m_pending + m_pendingSize, chunk.data(), chunk.size());
+    m_pendingSize += chunk.size();
+    return;
+  }
+
+  if (m_pendingSize > 0) {
+    char group[3];
+    std::memcpy(group, m_pending, m_pendingSize);
+    std::memcpy(group + m_pendingSize, chunk.data(), 3 - m_pendingSize);
+    chunk.remove_prefix(3 - m_pendingSize);
+    AppendEncoding(string_view(group, 3), output);
+  }
+
+  const auto size = chunk.size() / 3 * 3;
+  AppendEncoding(chunk.substr(0, size), output);
+  m_pendingSize = chunk.size() - size;
+  std::memcpy(m_pending, chunk.data() + size, m_pendingSize);
+}
+
+void Base64Encoder::Finish(string &output) {
+  AppendEncoding(string_view(m_pending, m_pendingSize), output);
+  m_pendingSize = 0;
+}
+
+#pragma endregion Base64Encoder
+
+#pragma region Base64Decoder
+
+bool Base64Decoder::Update(string_view chunk, string &output) {
+  if (chunk.empty()) {
+    return true;
+  }
+  if (m_isPadded) {
+    return false;
+  }
+
+  if (m_pendingSize > 0) {
+    const auto count = std::min(4 - m_pendingSize, chunk.size());
+    std::memcpy(m_pending + m_pendingSize, chunk.data(), count);
+    m_pendingSize += count;
+    chunk.remove_prefix(count);
+    if (m_pendingSize < 4) {
+      return true;
+    }
+
+    m_pendingSize = 0;
+    m_isPadded = m_pending[3] == '=';
+    if (!AppendDecoding(string_view(m_pending, 4), output) || (m_isPadded && !chunk.empty())) {
+      return false;
+    }
+  }
+
+  const auto size = chunk.size() / 4 * 4;
+  if (size > 0) {
+    m_isPadded = chunk[size - 1] == '=';
+    if (!AppendDecoding(chunk.substr(0, size), output)) {
+      return false;
+    }
+  }
+
+  m_pendingSize = chunk.size() - size;
+  std::memcpy(m_pending, chunk.data() + size, m_pendingSize);
+  return true;
+}
+
+bool Base64Decoder::Finish(string &output) {
+  const auto pendingSize = m_pendingSize;
+  m_pendingSize = 0;
+  if (pendingSize == 0) {
+    return true;
+  }
+  if (m_isPadded) {
+    return false;
+  }
+  return AppendDecoding(string_view(m_pending, pendingSize), output);
+}
+
+#pragma endregion Base64Decoder
+
+} // namespace Microsoft::React::Utilities
@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Microsoft::React::Utilities {
+
+// Base64 (RFC 4648, standard alphabet) codec.
+//
+// The bulk of the data is processed by SIMD kernels (AVX2 or SSSE3 on x86/x64,
+// selected at run time from the CPU features, and NEON on ARM64), and the rest
+// by a scalar implementation. Encoding always pads. Decoding accepts padded and
+// unpadded input, but no whitespace or other characters out of the alphabet.
+
+// The number of characters of the encoding of size bytes.
+constexpr size_t Base64EncodedSize(size_t size) noexcept {
+  return (size + 2) / 3 * 4;
+}
+
+// The most bytes the decoding of size characters can have.
+constexpr size_t Base64DecodedMaxSize(size_t size) noexcept {
+  return (size + 3) / 4 * 3;
+}
+
+// Writes the encoding of bytes into output, which must hold
+// Base64EncodedSize(bytes.size()) characters.
+// Returns the number of characters written.
+size_t EncodeBase64Into(std::string_view bytes, char *output) noexcept;
+
+// Writes the decoding of base64 into output, which must hold
+// Base64DecodedMaxSize(base64.size()) bytes.
+// Returns the number of bytes written, or std::nullopt when base64 is not valid.
+std::optional<size_t> DecodeBase64Into(std::string_view base64, char *output) noexcept;
+
+// The implementations the codec selects from. The SIMD kernels process the bulk
+// of the data, and the scalar implementation the rest.
+enum class Base64Kernel {
+  Scalar,
+  Ssse3,
+  Avx2,
+  Neon,
+};
+
+// The kernels this CPU supports, the one EncodeBase64Into and DecodeBase64Into
+// use last.
+std::vector<Base64Kernel> SupportedBase64Kernels();
+
+// EncodeBase64Into with the given kernel, which must be supported.
+size_t EncodeBase64Into(std::string_view bytes, char *output, Base64Kernel kernel) noexcept;
+
+// DecodeBase64Into with the given kernel, which must be supported.
+std::optional<size_t> DecodeBase64Into(std::string_view base64, char *output, Base64Kernel kernel) noexcept;
+
+// Encodes data received in chunks of any size.
+class Base64Encoder {
+ public:
+  // Appends the encoding of chunk to output. The last bytes that do not make a
+  // group of three are kept for the next chunk.
+  void Update(std::string_view chunk, std::string &output);
+
+  // Appends the encoding of the bytes kept, with padding, to output.
+  void Finish(std::string &output);
+
+ private:
+  char m_pending[2]{};
+  size_t m_pendingSize{0};
+};
+
+// Decodes data received in chunks of any size.
+class Base64Decoder {
+ public:
+  // Appends the decoding of chunk to output. The last characters that do not
+  // make a group of four are kept for the next chunk.
+  // Returns false when the data is not valid; the decoder must not be used afterwards.
+  bool Update(std::string_view chunk, std::string &output);
+
+  // Appends the decoding of the characters kept to output.
+  // Returns false when the data is not valid.
+  bool Finish(std::string &output);
+
+ private:
+  char m_pending[4]{};
+  size_t m_pendingSize{0};
+  bool m_isPadded{false}; // Padding was decoded, no more data is expected
+};
+
+} // namespace Microsoft::React::Utilities
@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "Utf8.h"
+
+// Standard Library
+#include <cstdint>
+#include <cstring>
+
+using std::string;
+using std::string_view;
+
+namespace {
+
+// Encoding of U+FFFD REPLACEMENT CHARACTER.
+constexpr char s_replacement[]{"\xEF\xBF\xBD"};
+
+// The length of the sequence started by lead, or 0 if lead can not start one.
+size_t SequenceLength(uint8_t lead) noexcept {
+  if (lead < 0x80)
+    return 1;
+  if (lead >= 0xC2 && lead <= 0xDF)
+    return 2;
+  if (lead >= 0xE0 && lead <= 0xEF)
+    return 3;
+  if (lead >= 0xF0 && lead <= 0xF4)
+    return 4;
+
+  return 0;
+}
+
+// Returns the size of the valid sequence at the start of data, or, when it is
+// not valid, the size of its maximal subpart (at least 1).
+size_t DecodeSequence(const uint8_t *data, size_t size, bool &isValid) noexcept {
+  const auto lead = data[0];
+  const auto length = SequenceLength(lead);
+  isValid = length != 0;
+  if (length <= 1) {
+    return 1;
+  }
+
+  // The second byte is restricted further, to exclude overlong forms, surrogates and code points above U+10FFFF.
+  uint8_t lower = 0x80;
+  uint8_t upper = 0xBF;
+  if (lead == 0xE0)
+    lower = 0xA0;
+  else if (lead == 0xED)
+    upper = 0x9F;
+  else if (lead == 0xF0)
+    lower = 0x90;
+  else if (lead == 0xF4)
+    upper = 0x8F;
+
+  for (size_t i = 1; i < length; i++) {
+    if (i >= size || data[i] < lower || data[i] > upper) {
+      isValid = false;
+      return i;
+    }
+
+    lower = 0x80;
+    upper = 0xBF;
+  }
+
+  return length;
+}
+
+size_t SkipAscii(const uint8_t *data, size_t size, size_t position) noexcept {
+  constexpr uint64_t highBits = 0x8080808080808080ull;
+  while (position + sizeof(uint64_t) <= size) {
+    uint64_t word;
+    std::memcpy(&word, data + position, sizeof(word));
+    if (word & highBits) {
+      break;
+    }
+    position += sizeof(word);
+  }
+
+  while (position < size && data[position] < 0x80) {
+    position++;
+  }
+
+  return position;
+}
+
+} // namespace
+
+namespace Microsoft::React::Utilities {
+
+size_t ValidUtf8PrefixSize(string_view text) noexcept {
+  const auto data = reinterpret_cast<const uint8_t *>(text.data());
+  const auto size = text.size();
+
+  size_t position = 0;
+  while ((position = SkipAscii(data, size, position)) < size) {
+    bool isValid;
+    const auto sequenceSize = DecodeSequence(data + position, size - position, isValid);
+    if (!isValid) {
+      break;
+    }
+    position += sequenceSize;
+  }
+
+  return position;
+}
+
+size_t IncompleteUtf8SuffixSize(string_view text) noexcept {
+  // Look back over the continuation bytes for the lead byte of the last sequence.
+  for (size_t i = 1; i <= 3 && i <= text.size(); i++) {
+    const auto byte = static_cast<uint8_t>(text[text.size() - i]);
+    if ((byte & 0xC0) != 0x80) {
+      return SequenceLength(byte) > i ? i : 0;
+    }
+  }
+
+  return 0;
+}
+
+string ToValidUtf8(string_view text) {
+  const auto data = reinterpret_cast<const uint8_t *>(text.data());
+  const auto size = text.size();
+
+  string result;
+  result.reserve(size);
+
+  size_t position = 0;
+  while (position < size) {
+    const auto validSize = ValidUtf8PrefixSize(text.substr(position));
+    result.append(text.data() + position, validSize);
+    position += validSize;
+    if (position == size) {
+      break;
+    }
+
+    bool isValid;
+    position += DecodeSequence(data + position, size - position, isValid);
+    result.append(s_replacement, sizeof(s_replacement) - 1);
+  }
+
+  return result;
+}
+
+} // namespace Microsoft::React::Utilities
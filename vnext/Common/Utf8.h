@@ -0,0 +1,32 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Standard Library
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace Microsoft::React::Utilities {
+
+// UTF-8 validation, as in https://encoding.spec.whatwg.org/#utf-8-decoder.
+//
+// Overlong encodings, surrogates and code points above U+10FFFF are invalid.
+// Runs of ASCII are checked eight bytes at a time.
+
+// The length of the longest prefix of text made of whole, valid sequences.
+size_t ValidUtf8PrefixSize(std::string_view text) noexcept;
+
+inline bool IsValidUtf8(std::string_view text) noexcept {
+  return ValidUtf8PrefixSize(text) == text.size();
+}
+
+// The number of bytes at the end of text that start a sequence text does not
+// finish. Splitting text there keeps the sequence whole.
+size_t IncompleteUtf8SuffixSize(std::string_view text) noexcept;
+
+// A copy of text with each maximal invalid subpart replaced by U+FFFD.
+std::string ToValidUtf8(std::string_view text);
+
+} // namespace Microsoft::React::Utilities
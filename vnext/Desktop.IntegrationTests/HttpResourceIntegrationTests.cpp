@@ -11,6 +11,7 @@
 // Standard Library
 #include <chrono>
 #include <future>
+#include <thread>
 
 using namespace Microsoft::React;
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -574,6 +575,49 @@ TEST_CLASS (HttpResourceIntegrationTest) {
     Assert::AreEqual(200, statusCode);
     Assert::AreEqual({"123444"}, result);
   }
+
+  TEST_METHOD(PreconnectWarmsRequests) {
+    string url = MakeHttpResourceUrl("/get");
+
+    promise<void> resPromise;
+    string error;
+
+    auto resource = IHttpResource::Make();
+    resource->SetOnData([&resPromise](int64_t, string &&) { resPromise.set_value(); });
+    resource->SetOnError([&resPromise, &error](int64_t, string &&message, bool) {
+      error = std::move(message);
+      resPromise.set_value();
+    });
+
+    resource->Preconnect({url, kHttpResourceBaseUrl});
+
+    // Wait for the connection to the local server.
+    for (int i = 0; i < 100 && resource->GetConnectionMetrics().PreconnectsSucceeded == 0; i++) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    resource->SendRequest(
+        "GET",
+        std::move(url),
+        0, /*requestId*/
+        {}, /*headers*/
+        {}, /*data*/
+        "text",
+        false, /*incremental*/
+        0 /*timeout*/,
+        false /*withCredentials*/,
+        [](int64_t) {});
+
+    resPromise.get_future().wait();
+
+    auto metrics = resource->GetConnectionMetrics();
+    Assert::AreEqual({}, error);
+    Assert::AreEqual(size_t{2}, metrics.PreconnectsRequested);
+    Assert::AreEqual(size_t{1}, metrics.PreconnectsSkipped);
+    Assert::AreEqual(size_t{1}, metrics.PreconnectsSucceeded);
+    Assert::AreEqual(size_t{1}, metrics.WarmRequests);
+    Assert::AreEqual(size_t{0}, metrics.ColdRequests);
+  }
 };
 
 } // namespace Microsoft::React::Test
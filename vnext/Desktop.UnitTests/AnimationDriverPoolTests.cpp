@@ -0,0 +1,143 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <Modules/Animated/AnimationDriverPool.h>
+#include <Modules/Animated/AnimationUtils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace Microsoft::ReactNative;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+// Tolerance for comparing against the analytic rest value
+bool AreClose(double expected, double actual) {
+  return std::abs(expected - actual) <= 1e-6 * std::max(1.0, std::abs(expected));
+}
+
+SpringParameters MakeSpring(double stiffness, double damping, double mass, double initialVelocity) {
+  SpringParameters spring;
+  spring.stiffness = stiffness;
+  spring.damping = damping;
+  spring.mass = mass;
+  spring.initialVelocity = initialVelocity;
+  spring.restSpeedThreshold = 0.001;
+  spring.displacementFromRestThreshold = 0.001;
+  return spring;
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (AnimationDriverPoolTests) {
+  TEST_METHOD(SpringsMatchScalarPath) {
+    const std::vector<SpringParameters> springs = {
+        MakeSpring(100, 10, 1, 0), // Underdamped
+        MakeSpring(170, 26, 1, 2), // Close to critically damped
+        MakeSpring(40, 60, 2, -1), // Overdamped
+    };
+
+    AnimationDriverPool pool;
+    std::vector<double> times;
+    for (int frame = 1; frame <= 120; frame++) {
+      for (const auto &spring : springs) {
+        const auto time = frame / 60.0;
+        Assert::AreEqual(times.size(), pool.AddSpring(spring, 0, 100, 100, time));
+        times.push_back(time);
+      }
+    }
+    pool.Evaluate();
+
+    Assert::AreEqual(times.size(), pool.SpringCount());
+    for (size_t lane = 0; lane < times.size(); lane++) {
+      float value;
+      double velocity;
+      EvaluateSpring(springs[lane % springs.size()], 0, 100, 100, times[lane], value, velocity);
+      // The batched loop runs the same kernel as the scalar path, so the results are identical
+      Assert::AreEqual(value, pool.SpringValue(lane));
+      Assert::AreEqual(velocity, pool.SpringVelocity(lane));
+    }
+  }
+
+  TEST_METHOD(DecaysMatchScalarPath) {
+    AnimationDriverPool pool;
+    for (int frame = 1; frame <= 120; frame++) {
+      Assert::AreEqual(static_cast<size_t>(frame - 1), pool.AddDecay(10, 2, 0.998, frame / 60.0));
+    }
+    pool.Evaluate();
+
+    Assert::AreEqual(size_t{120}, pool.DecayCount());
+    for (int frame = 1; frame <= 120; frame++) {
+      Assert::AreEqual(EvaluateDecay(10, 2, 0.998, frame / 60.0), pool.DecayValue(frame - 1));
+    }
+  }
+
+  TEST_METHOD(ClearStartsNewFrame) {
+    AnimationDriverPool pool;
+    pool.AddSpring(MakeSpring(100, 10, 1, 0), 0, 1, 1, 0.5);
+    pool.AddDecay(0, 1, 0.998, 0.5);
+    pool.Evaluate();
+
+    pool.Clear();
+    Assert::AreEqual(size_t{0}, pool.SpringCount());
+    Assert::AreEqual(size_t{0}, pool.DecayCount());
+
+    Assert::AreEqual(size_t{0}, pool.AddSpring(MakeSpring(100, 10, 1, 0), 0, 1, 1, 10));
+    pool.Evaluate();
+    Assert::IsTrue(AreClose(1, pool.SpringValue(0)));
+  }
+
+  TEST_METHOD(SpringDoneAtRestOrWhenClampedPastEnd) {
+    auto spring = MakeSpring(100, 10, 1, 0);
+    Assert::IsTrue(IsSpringDone(spring, 0, 100, 100, 0));
+    Assert::IsFalse(IsSpringDone(spring, 0, 100, 50, 0));
+    Assert::IsFalse(IsSpringDone(spring, 0, 100, 101, 1));
+
+    spring.overshootClamping = true;
+    Assert::IsTrue(IsSpringDone(spring, 0, 100, 101, 1));
+    Assert::IsTrue(IsSpringDone(spring, 100, 0, -1, 1));
+  }
+
+  TEST_METHOD(InterpolateValuesMatchesInterpolate) {
+    const std::vector<std::vector<double>> inputRanges = {{0, 1}, {0, 0.5, 1}, {-10, 0, 10, 20}};
+    const std::vector<std::vector<double>> outputRanges = {{0, 100}, {1, 0, 1}, {0, 5, 5, 0}};
+    const ExtrapolationType types[] = {
+        ExtrapolationType::Identity, ExtrapolationType::Clamp, ExtrapolationType::Extend};
+
+    std::vector<double> values;
+    for (double value = -30; value <= 30; value += 0.25) {
+      values.push_back(value);
+    }
+    std::vector<double> results(values.size());
+
+    for (size_t range = 0; range < inputRanges.size(); range++) {
+      const auto &inputs = inputRanges[range];
+      const auto &outputs = outputRanges[range];
+      for (auto left : types) {
+        for (auto right : types) {
+          InterpolateValues(values.data(), results.data(), values.size(), inputs, outputs, left, right);
+          for (size_t i = 0; i < values.size(); i++) {
+            const auto index = InterpolationSegment(values[i], inputs);
+            const auto expected = Interpolate(
+                values[i], inputs[index], inputs[index + 1], outputs[index], outputs[index + 1], left, right);
+            Assert::AreEqual(expected, results[i]);
+          }
+        }
+      }
+    }
+  }
+
+  TEST_METHOD(InterpolateExtrapolationNames) {
+    Assert::AreEqual(-5.0, Interpolate(-5, 0, 1, 0, 10, "identity", "identity"));
+    Assert::AreEqual(0.0, Interpolate(-5, 0, 1, 0, 10, "clamp", "clamp"));
+    Assert::AreEqual(-50.0, Interpolate(-5, 0, 1, 0, 10, "extend", "extend"));
+    Assert::AreEqual(10.0, Interpolate(5, 0, 1, 0, 10, "identity", "clamp"));
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,226 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <Base64.h>
+#include <CppUnitTest.h>
+#include <utilities.h>
+
+// Standard Library
+#include <chrono>
+#include <random>
+#include <string>
+
+using namespace Microsoft::React::Utilities;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using std::string;
+using std::string_view;
+
+namespace {
+
+string RandomBytes(size_t size, uint32_t seed) {
+  std::mt19937 engine{seed};
+  string bytes(size, '\0');
+  for (auto &byte : bytes) {
+    byte = static_cast<char>(engine());
+  }
+  return bytes;
+}
+
+// Bit by bit reference of the encoding.
+string ReferenceEncode(string_view bytes) {
+  constexpr char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  string result;
+  uint32_t bits = 0;
+  int bitCount = 0;
+  for (const auto byte : bytes) {
+    bits = bits << 8 | static_cast<uint8_t>(byte);
+    bitCount += 8;
+    while (bitCount >= 6) {
+      bitCount -= 6;
+      result += alphabet[bits >> bitCount & 0x3F];
+    }
+  }
+  if (bitCount > 0) {
+    result += alphabet[bits << (6 - bitCount) & 0x3F];
+  }
+  while (result.size() % 4 != 0) {
+    result += '=';
+  }
+  return result;
+}
+
+const wchar_t *KernelName(Base64Kernel kernel) {
+  switch (kernel) {
+    case Base64Kernel::Scalar:
+      return L"Scalar";
+    case Base64Kernel::Ssse3:
+      return L"SSSE3";
+    case Base64Kernel::Avx2:
+      return L"AVX2";
+    case Base64Kernel::Neon:
+      return L"NEON";
+  }
+  return L"Unknown";
+}
+
+string Encode(string_view bytes, Base64Kernel kernel) {
+  string result(Base64EncodedSize(bytes.size()), '\0');
+  result.resize(EncodeBase64Into(bytes, result.data(), kernel));
+  return result;
+}
+
+std::optional<string> Decode(string_view base64, Base64Kernel kernel) {
+  string result(Base64DecodedMaxSize(base64.size()), '\0');
+  const auto size = DecodeBase64Into(base64, result.data(), kernel);
+  if (!size) {
+    return std::nullopt;
+  }
+  result.resize(*size);
+  return result;
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (Base64Test) {
+  TEST_METHOD(SupportsScalarKernel) {
+    const auto kernels = SupportedBase64Kernels();
+    Assert::IsFalse(kernels.empty());
+    Assert::IsTrue(Base64Kernel::Scalar == kernels.front());
+  }
+
+  // Covers the SIMD blocks and the scalar remainder at every offset.
+  TEST_METHOD(EncodesAndDecodesAllSizes) {
+    for (const auto kernel : SupportedBase64Kernels()) {
+      for (size_t size = 0; size <= 300; size++) {
+        const auto bytes = RandomBytes(size, static_cast<uint32_t>(size));
+        const auto expected = ReferenceEncode(bytes);
+
+        const auto encoded = Encode(bytes, kernel);
+        Assert::AreEqual(expected, encoded, KernelName(kernel));
+        Assert::IsTrue(bytes == Decode(encoded, kernel), KernelName(kernel));
+      }
+    }
+  }
+
+  // The codec uses the fastest supported kernel.
+  TEST_METHOD(EncodesAndDecodesWithDefaultKernel) {
+    for (size_t size = 0; size <= 100; size++) {
+      const auto bytes = RandomBytes(size, static_cast<uint32_t>(size));
+      const auto expected = ReferenceEncode(bytes);
+
+      string encoded(Base64EncodedSize(size), '\0');
+      Assert::AreEqual(expected.size(), EncodeBase64Into(bytes, encoded.data()));
+      Assert::AreEqual(expected, encoded);
+      Assert::AreEqual(expected, EncodeBase64(bytes));
+      Assert::IsTrue(bytes == DecodeBase64(encoded));
+    }
+  }
+
+  TEST_METHOD(DecodesEveryCharacter) {
+    constexpr char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    string base64;
+    for (int i = 0; i < 8; i++) {
+      // Shifted so that each character lands at each position of a group.
+      base64 += string_view(alphabet + i, 64 - i);
+      base64 += string_view(alphabet, i);
+    }
+
+    for (const auto kernel : SupportedBase64Kernels()) {
+      const auto decoded = Decode(base64, kernel);
+      Assert::IsTrue(decoded.has_value(), KernelName(kernel));
+      Assert::AreEqual(base64, ReferenceEncode(*decoded), KernelName(kernel));
+    }
+  }
+
+  TEST_METHOD(DecodesUnpaddedInput) {
+    for (const auto kernel : SupportedBase64Kernels()) {
+      Assert::IsTrue(string{"ab"} == Decode("YWI", kernel), KernelName(kernel));
+      Assert::IsTrue(string{"a"} == Decode("YQ", kernel), KernelName(kernel));
+    }
+  }
+
+  TEST_METHOD(RejectsInvalidInput) {
+    const auto valid = ReferenceEncode(RandomBytes(120, 42));
+    for (const auto kernel : SupportedBase64Kernels()) {
+      for (const char invalid : {'=', '*', ' ', '\n', '\0', '\x80', '\xFF'}) {
+        for (size_t i = 0; i < valid.size(); i++) {
+          if (invalid == '=' && i + 2 >= valid.size()) {
+            continue; // Valid padding
+          }
+          auto base64 = valid;
+          base64[i] = invalid;
+          Assert::IsFalse(Decode(base64, kernel).has_value(), KernelName(kernel));
+        }
+      }
+
+      Assert::IsFalse(Decode("YWJjZ", kernel).has_value(), KernelName(kernel));
+      Assert::IsFalse(Decode("YQ=", kernel).has_value(), KernelName(kernel));
+      Assert::IsFalse(Decode("Y===", kernel).has_value(), KernelName(kernel));
+      Assert::IsFalse(Decode("YQ==YQ==", kernel).has_value(), KernelName(kernel));
+    }
+  }
+
+  TEST_METHOD(StreamsChunksOfAnySize) {
+    const auto bytes = RandomBytes(1000, 7);
+    const auto expected = ReferenceEncode(bytes);
+
+    for (size_t chunkSize = 1; chunkSize <= 70; chunkSize++) {
+      Base64Encoder encoder;
+      string encoded;
+      for (size_t i = 0; i < bytes.size(); i += chunkSize) {
+        encoder.Update(string_view(bytes).substr(i, chunkSize), encoded);
+      }
+      encoder.Finish(encoded);
+      Assert::AreEqual(expected, encoded);
+
+      Base64Decoder decoder;
+      string decoded;
+      for (size_t i = 0; i < encoded.size(); i += chunkSize) {
+        Assert::IsTrue(decoder.Update(string_view(encoded).substr(i, chunkSize), decoded));
+      }
+      Assert::IsTrue(decoder.Finish(decoded));
+      Assert::IsTrue(bytes == decoded);
+    }
+  }
+
+  TEST_METHOD(StreamingDecoderRejectsDataAfterPadding) {
+    Base64Decoder decoder;
+    string decoded;
+    Assert::IsTrue(decoder.Update("YQ", decoded));
+    Assert::IsTrue(decoder.Update("==", decoded));
+    Assert::IsFalse(decoder.Update("YQ==", decoded));
+
+    Base64Decoder unpadded;
+    decoded.clear();
+    Assert::IsTrue(unpadded.Update("YWJjZA", decoded));
+    Assert::IsTrue(unpadded.Finish(decoded));
+    Assert::AreEqual(string{"abcd"}, decoded);
+  }
+
+  // Logs the throughput on a payload the size of a large WebSocket message or blob.
+  TEST_METHOD(EncodesAndDecodesLargePayloads) {
+    constexpr size_t size = 16 * 1024 * 1024;
+    const auto bytes = RandomBytes(size, 1);
+
+    const auto encodeStart = std::chrono::steady_clock::now();
+    const auto encoded = EncodeBase64(bytes);
+    const auto encodeEnd = std::chrono::steady_clock::now();
+    const auto decoded = DecodeBase64(encoded);
+    const auto decodeEnd = std::chrono::steady_clock::now();
+
+    Assert::IsTrue(bytes == decoded);
+
+    auto megabytesPerSecond = [](std::chrono::steady_clock::duration elapsed) {
+      const auto seconds = std::chrono::duration<double>(elapsed).count();
+      return std::to_string(static_cast<int64_t>(size / (1024 * 1024) / (seconds > 0 ? seconds : 1e-9)));
+    };
+    const auto message = "Base64 of 16 MB: encodes " + megabytesPerSecond(encodeEnd - encodeStart) +
+        " MB/s, decodes " + megabytesPerSecond(decodeEnd - encodeEnd) + " MB/s\n";
+    Logger::WriteMessage(message.c_str());
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -13,7 +13,6 @@ using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using std::shared_ptr;
 using std::string;
 using std::vector;
-using winrt::array_view;
 
 namespace Microsoft::React::Test {
 
@@ -25,7 +24,7 @@ TEST_CLASS (BaseFileReaderResourceUnitTest) {
      public:
 #pragma region IBlobPersistor
 
-      array_view<uint8_t const> ResolveMessage(string &&blobId, int64_t offset, int64_t size) override {
+      BlobView ResolveMessage(string &&blobId, int64_t offset, int64_t size) override {
         auto dataItr = m_blobs.find(std::move(blobId));
         // Not found.
         if (dataItr == m_blobs.cend())
@@ -37,7 +36,7 @@ TEST_CLASS (BaseFileReaderResourceUnitTest) {
         if (endBound > bytes.size() || offset >= static_cast<int64_t>(bytes.size()) || offset < 0)
           throw std::out_of_range("Offset or size out of range");
 
-        return array_view<uint8_t const>(bytes.data() + offset, bytes.data() + endBound);
+        return BlobView::FromBytes(vector<uint8_t>(bytes.begin() + offset, bytes.begin() + endBound));
       }
 
       void RemoveMessage(string && /*blobId*/) noexcept override {
@@ -0,0 +1,106 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <BlobChunkReader.h>
+#include <CppUnitTest.h>
+#include <Utf8.h>
+
+// Standard Library
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using Microsoft::React::BlobChunkReader;
+using Microsoft::React::BlobView;
+using std::string;
+using std::vector;
+
+namespace {
+
+// Splits text into one segment per part, to cross segment boundaries.
+BlobView Blob(vector<string> &&parts) {
+  BlobView result;
+  for (const auto &part : parts) {
+    result.Append(BlobView::FromBytes(vector<uint8_t>(part.cbegin(), part.cend())));
+  }
+  return result;
+}
+
+vector<string> ReadAll(BlobChunkReader &reader) {
+  vector<string> result;
+  while (auto chunk = reader.Next()) {
+    result.push_back(std::move(*chunk));
+  }
+  return result;
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (BlobChunkReaderTest) {
+  TEST_METHOD(ReadsTextInChunks) {
+    BlobChunkReader reader{Blob({"abc", "defgh"}), BlobChunkReader::Format::Text, {}, 3};
+
+    Assert::AreEqual(string{"abc"}, *reader.Next());
+    Assert::AreEqual(size_t{3}, reader.Loaded());
+    Assert::IsFalse(reader.Done());
+    Assert::AreEqual(string{"def"}, *reader.Next());
+    Assert::AreEqual(string{"gh"}, *reader.Next());
+    Assert::AreEqual(size_t{8}, reader.Loaded());
+    Assert::AreEqual(size_t{8}, reader.Total());
+    Assert::IsTrue(reader.Done());
+    Assert::IsFalse(reader.Next().has_value());
+  }
+
+  TEST_METHOD(KeepsSplitSequencesWhole) {
+    // U+20AC and U+1F600 cut by chunk and segment boundaries.
+    BlobChunkReader reader{Blob({"a\xE2", "\x82\xAC" "b\xF0\x9F", "\x98\x80"}), BlobChunkReader::Format::Text, {}, 2};
+
+    auto chunks = ReadAll(reader);
+
+    string text;
+    for (const auto &chunk : chunks) {
+      Assert::AreEqual(size_t{0}, Microsoft::React::Utilities::IncompleteUtf8SuffixSize(chunk));
+      text += chunk;
+    }
+    Assert::AreEqual(string{"a\xE2\x82\xAC" "b\xF0\x9F\x98\x80"}, text);
+  }
+
+  TEST_METHOD(ReplacesInvalidSequences) {
+    // An invalid byte, a surrogate, then U+20AC cut short by the end of the blob.
+    BlobChunkReader reader{Blob({"a\xFF" "b\xED\xA0\x80", "c\xE2\x82"}), BlobChunkReader::Format::Text, {}, 4};
+
+    auto chunks = ReadAll(reader);
+
+    string text;
+    for (const auto &chunk : chunks) {
+      Assert::IsTrue(Microsoft::React::Utilities::IsValidUtf8(chunk));
+      text += chunk;
+    }
+    Assert::AreEqual(string{"a\xEF\xBF\xBD" "b\xEF\xBF\xBD\xEF\xBF\xBD\xEF\xBF\xBD" "c\xEF\xBF\xBD"}, text);
+  }
+
+  TEST_METHOD(ReadsDataUrlInChunks) {
+    BlobChunkReader reader{Blob({"ab", "cde"}), BlobChunkReader::Format::DataUrl, "string", 2};
+
+    string dataUrl;
+    for (const auto &chunk : ReadAll(reader)) {
+      dataUrl += chunk;
+    }
+
+    Assert::AreEqual(string{"data:string;base64,YWJjZGU="}, dataUrl);
+  }
+
+  TEST_METHOD(ReadsEmptyBlobOnce) {
+    BlobChunkReader text{BlobView{}, BlobChunkReader::Format::Text, {}, 0};
+    BlobChunkReader dataUrl{BlobView{}, BlobChunkReader::Format::DataUrl, "text/plain", 0};
+
+    Assert::IsTrue(vector<string>{""} == ReadAll(text));
+    Assert::IsTrue(vector<string>{"data:text/plain;base64,"} == ReadAll(dataUrl));
+    Assert::IsTrue(text.Done());
+  }
+};
+
+} // namespace Microsoft::React::Test
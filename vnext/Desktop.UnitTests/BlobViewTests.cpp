@@ -0,0 +1,96 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <BlobView.h>
+#include <CppUnitTest.h>
+
+// Standard Library
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using std::string;
+using std::vector;
+
+namespace {
+
+vector<uint8_t> Bytes(const string &text) {
+  return vector<uint8_t>(text.cbegin(), text.cend());
+}
+
+string Text(const Microsoft::React::BlobView &view) {
+  const auto bytes = view.ToVector();
+  return string(bytes.cbegin(), bytes.cend());
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (BlobViewTest) {
+  TEST_METHOD(SlicesShareTheChunk) {
+    const auto blob = BlobView::FromBytes(Bytes("abcdefghij"));
+    const auto slice = blob.Slice(2, 5);
+
+    Assert::AreEqual(string{"cdefg"}, Text(slice));
+    Assert::AreEqual(size_t{1}, slice.Segments().size());
+    Assert::IsTrue(blob.Segments()[0].Chunk == slice.Segments()[0].Chunk);
+    Assert::AreEqual(string{"cd"}, Text(slice.Slice(0, 2)));
+    Assert::IsTrue(slice.Slice(5, 0).Empty());
+  }
+
+  TEST_METHOD(ComposesWithoutCopying) {
+    const auto first = BlobView::FromBytes(Bytes("Hello, "));
+    const auto second = BlobView::FromBytes(Bytes("big world!"));
+
+    BlobView composed;
+    composed.Append(first);
+    composed.Append(second.Slice(4, 6));
+    composed.Append(BlobView{});
+
+    Assert::AreEqual(size_t{13}, composed.Size());
+    Assert::AreEqual(size_t{2}, composed.Segments().size());
+    Assert::IsTrue(composed.Segments()[1].Chunk == second.Segments()[0].Chunk);
+    Assert::AreEqual(string{"Hello, world!"}, Text(composed));
+
+    // Slices across segments.
+    const auto slice = composed.Slice(5, 4);
+    Assert::AreEqual(size_t{2}, slice.Segments().size());
+    Assert::AreEqual(string{", wo"}, Text(slice));
+  }
+
+  TEST_METHOD(JoinsAdjacentSlicesOfAChunk) {
+    const auto blob = BlobView::FromBytes(Bytes("abcdefghij"));
+
+    BlobView joined;
+    joined.Append(blob.Slice(0, 3));
+    joined.Append(blob.Slice(3, 4));
+    Assert::AreEqual(size_t{1}, joined.Segments().size());
+    Assert::AreEqual(string{"abcdefg"}, Text(joined));
+
+    joined.Append(blob.Slice(0, 1));
+    Assert::AreEqual(size_t{2}, joined.Segments().size());
+  }
+
+  TEST_METHOD(OutlivesTheBlob) {
+    BlobView slice;
+    {
+      const auto blob = BlobView::FromBytes(Bytes("abcdefghij"));
+      slice = blob.Slice(6, 4);
+    }
+
+    Assert::AreEqual(string{"ghij"}, Text(slice));
+  }
+
+  TEST_METHOD(RejectsRangesOutOfBounds) {
+    const auto blob = BlobView::FromBytes(Bytes("abc"));
+
+    Assert::ExpectException<std::out_of_range>([&blob]() { blob.Slice(2, 2); });
+    Assert::ExpectException<std::out_of_range>([&blob]() { blob.Slice(4, 0); });
+    Assert::ExpectException<std::out_of_range>([&blob]() { blob.Slice(1, SIZE_MAX); });
+  }
+};
+
+} // namespace Microsoft::React::Test
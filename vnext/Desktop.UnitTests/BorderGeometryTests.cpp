@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <Fabric/Composition/BorderGeometry.h>
+
+#include <memory>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace winrt::Microsoft::ReactNative::Composition::implementation;
+
+namespace {
+
+facebook::react::LayoutMetrics MakeLayoutMetrics(float width, float height, float scale) {
+  facebook::react::LayoutMetrics layoutMetrics;
+  layoutMetrics.frame.size = {width, height};
+  layoutMetrics.pointScaleFactor = scale;
+  return layoutMetrics;
+}
+
+facebook::react::BorderMetrics MakeBorderMetrics(float width, float radius) {
+  facebook::react::BorderMetrics borderMetrics;
+  borderMetrics.borderWidths = {width, width, width, width};
+  borderMetrics.borderRadii.topLeft = {radius, radius};
+  borderMetrics.borderRadii.topRight = {radius, radius};
+  borderMetrics.borderRadii.bottomLeft = {radius, radius};
+  borderMetrics.borderRadii.bottomRight = {radius, radius};
+  return borderMetrics;
+}
+
+BorderGeometryKey MakeKey(
+    float width,
+    float radius = 6.f,
+    BorderGeometryKind kind = BorderGeometryKind::FilledRing,
+    const void *factory = nullptr) {
+  return BorderGeometryKey::Create(kind, MakeLayoutMetrics(width, 40.f, 1.f), MakeBorderMetrics(2.f, radius), factory);
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (BorderGeometryTests) {
+  TEST_METHOD(BorderWidthRoundsToWholePixels) {
+    Assert::AreEqual(0.f, pixelRoundAndScaleBorderWidth(0.f, 1.5f));
+    Assert::AreEqual(1.f, pixelRoundAndScaleBorderWidth(0.2f, 1.f));
+    Assert::AreEqual(2.f, pixelRoundAndScaleBorderWidth(1.f, 1.5f));
+    Assert::AreEqual(4.f, pixelRoundAndScaleBorderWidth(3.f, 1.25f));
+  }
+
+  TEST_METHOD(BorderRadiiRoundDown) {
+    auto borderMetrics = MakeBorderMetrics(1.f, 5.f);
+    pixelRoundBorderRadii(borderMetrics.borderRadii, 1.5f);
+
+    Assert::AreEqual(7.f, borderMetrics.borderRadii.topLeft.horizontal);
+    Assert::AreEqual(7.f, borderMetrics.borderRadii.bottomRight.vertical);
+  }
+
+  TEST_METHOD(BorderWidthsDoNotExceedFrame) {
+    auto layoutMetrics = MakeLayoutMetrics(1.f, 1.f, 1.f);
+    auto borderMetrics = MakeBorderMetrics(0.6f, 0.f);
+    scaleAndPixelRoundBorderWidths(layoutMetrics, borderMetrics, layoutMetrics.pointScaleFactor);
+
+    Assert::AreEqual(1.f, borderMetrics.borderWidths.left);
+    Assert::AreEqual(0.f, borderMetrics.borderWidths.right);
+    Assert::AreEqual(1.f, borderMetrics.borderWidths.top);
+    Assert::AreEqual(0.f, borderMetrics.borderWidths.bottom);
+  }
+
+  TEST_METHOD(RoundedPathParametersSubtractInset) {
+    auto borderMetrics = MakeBorderMetrics(1.f, 8.f);
+    auto params = GenerateRoundedPathParameters(borderMetrics.borderRadii, {2.f, 3.f, 10.f, 0.f}, {100.f, 100.f});
+
+    Assert::AreEqual(6.f, params.topLeftRadiusX);
+    Assert::AreEqual(5.f, params.topLeftRadiusY);
+    Assert::AreEqual(0.f, params.topRightRadiusX);
+    Assert::AreEqual(8.f, params.bottomRightRadiusY);
+  }
+
+  TEST_METHOD(RoundedPathParametersEmptyForZeroSize) {
+    auto borderMetrics = MakeBorderMetrics(1.f, 8.f);
+    auto params = GenerateRoundedPathParameters(borderMetrics.borderRadii, {0, 0, 0, 0}, {0.f, 100.f});
+
+    Assert::AreEqual(0.f, params.topLeftRadiusX);
+    Assert::AreEqual(0.f, params.bottomLeftRadiusY);
+  }
+
+  TEST_METHOD(GeometryKeyIgnoresColors) {
+    auto layoutMetrics = MakeLayoutMetrics(100.f, 40.f, 1.5f);
+    auto red = MakeBorderMetrics(2.f, 6.f);
+    auto blue = red;
+    red.borderColors.left = facebook::react::colorFromRGBA(255, 0, 0, 255);
+    blue.borderColors.left = facebook::react::colorFromRGBA(0, 0, 255, 255);
+
+    auto redKey = BorderGeometryKey::Create(BorderGeometryKind::FilledRing, layoutMetrics, red, nullptr);
+    auto blueKey = BorderGeometryKey::Create(BorderGeometryKind::FilledRing, layoutMetrics, blue, nullptr);
+
+    Assert::IsTrue(redKey == blueKey);
+    Assert::AreEqual(BorderGeometryKeyHash{}(redKey), BorderGeometryKeyHash{}(blueKey));
+  }
+
+  TEST_METHOD(GeometryKeyDistinguishesShape) {
+    auto key = MakeKey(100.f);
+    int otherFactory;
+
+    Assert::IsTrue(key == MakeKey(100.f));
+    Assert::IsTrue(key != MakeKey(100.f, 6.f, BorderGeometryKind::StrokedPath));
+    Assert::IsTrue(key != MakeKey(101.f));
+    Assert::IsTrue(key != MakeKey(100.f, 7.f));
+    Assert::IsTrue(key != MakeKey(100.f, 6.f, BorderGeometryKind::FilledRing, &otherFactory));
+  }
+
+  TEST_METHOD(GeometryCacheSharesGeometry) {
+    BorderGeometryCache<std::shared_ptr<int>> cache{4};
+    auto key = MakeKey(100.f);
+
+    int creations = 0;
+    auto create = [&creations]() {
+      creations++;
+      return std::make_shared<int>(creations);
+    };
+
+    auto first = cache.GetOrCreate(key, create);
+    auto second = cache.GetOrCreate(key, create);
+
+    Assert::AreEqual(1, creations);
+    Assert::IsTrue(first == second);
+    Assert::AreEqual(uint64_t{1}, cache.Hits());
+    Assert::AreEqual(uint64_t{1}, cache.Misses());
+  }
+
+  TEST_METHOD(GeometryCacheDoesNotCacheFailures) {
+    BorderGeometryCache<std::shared_ptr<int>> cache{4};
+    auto key = MakeKey(100.f);
+
+    Assert::IsFalse(static_cast<bool>(cache.GetOrCreate(key, []() { return std::shared_ptr<int>{}; })));
+    Assert::AreEqual(size_t{0}, cache.Size());
+  }
+
+  TEST_METHOD(GeometryCacheEvictsLeastRecentlyUsed) {
+    BorderGeometryCache<std::shared_ptr<int>> cache{2};
+    auto keyA = MakeKey(10.f);
+    auto keyB = MakeKey(20.f);
+    auto keyC = MakeKey(30.f);
+
+    int creations = 0;
+    auto create = [&creations]() {
+      creations++;
+      return std::make_shared<int>(creations);
+    };
+
+    cache.GetOrCreate(keyA, create);
+    cache.GetOrCreate(keyB, create);
+    cache.GetOrCreate(keyA, create); // A is now most recently used
+    cache.GetOrCreate(keyC, create); // Evicts B
+
+    Assert::AreEqual(size_t{2}, cache.Size());
+    Assert::AreEqual(3, creations);
+
+    cache.GetOrCreate(keyA, create);
+    Assert::AreEqual(3, creations);
+
+    cache.GetOrCreate(keyB, create);
+    Assert::AreEqual(4, creations);
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,210 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <ConstantsSnapshot.h>
+#include <CppUnitTest.h>
+
+// Standard Library
+#include <cstring>
+#include <map>
+
+using namespace Microsoft::ReactNative;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+class StringBuffer : public facebook::jsi::Buffer {
+ public:
+  StringBuffer(std::string data) : m_data(std::move(data)) {}
+
+  size_t size() const override {
+    return m_data.size();
+  }
+
+  const uint8_t *data() const override {
+    return reinterpret_cast<const uint8_t *>(m_data.data());
+  }
+
+ private:
+  std::string m_data;
+};
+
+struct InMemoryBufferStore : facebook::react::BufferStore {
+  std::unique_ptr<const facebook::jsi::Buffer> getBuffer(const std::string &bufferId) noexcept override {
+    auto it = buffers.find(bufferId);
+    return it != buffers.end() ? std::make_unique<StringBuffer>(it->second) : nullptr;
+  }
+
+  bool persistBuffer(const std::string &bufferId, std::unique_ptr<const facebook::jsi::Buffer> buffer) noexcept
+      override {
+    buffers[bufferId] = std::string{reinterpret_cast<const char *>(buffer->data()), buffer->size()};
+    return true;
+  }
+
+  bool persistBufferChunks(
+      const std::string &bufferId,
+      const std::vector<facebook::react::BufferChunk> &chunks) noexcept override {
+    std::string buffer;
+    for (const auto &[data, size] : chunks) {
+      buffer.append(reinterpret_cast<const char *>(data), size);
+    }
+    buffers[bufferId] = std::move(buffer);
+    return true;
+  }
+
+  std::map<std::string, std::string> buffers;
+};
+
+// {"name": "Windows", "version": 10.5, "features": [true, false, null], "empty": {}}
+std::string MakeSnapshot() {
+  ConstantsSnapshotBuilder builder;
+  builder.WriteObjectBegin();
+  builder.WritePropertyName("name");
+  builder.WriteString("Windows");
+  builder.WritePropertyName("version");
+  builder.WriteNumber(10.5);
+  builder.WritePropertyName("features");
+  builder.WriteArrayBegin();
+  builder.WriteBoolean(true);
+  builder.WriteBoolean(false);
+  builder.WriteNull();
+  builder.WriteArrayEnd();
+  builder.WritePropertyName("empty");
+  builder.WriteObjectBegin();
+  builder.WriteObjectEnd();
+  builder.WriteObjectEnd();
+  return builder.TakeSnapshot();
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (ConstantsSnapshotTest) {
+  TEST_METHOD(ReadsBackWhatWasWritten) {
+    const auto snapshot = MakeSnapshot();
+    ConstantsSnapshotReader reader(snapshot);
+    ConstantsSnapshotTag tag;
+    std::string_view text;
+    double number{0};
+
+    Assert::IsTrue(reader.ReadTag(tag) && tag == ConstantsSnapshotTag::ObjectBegin);
+    Assert::IsTrue(reader.ReadTag(tag) && tag == ConstantsSnapshotTag::String && reader.ReadString(text));
+    Assert::AreEqual(std::string{"name"}, std::string{text});
+    Assert::IsTrue(reader.ReadTag(tag) && tag == ConstantsSnapshotTag::String && reader.ReadString(text));
+    Assert::AreEqual(std::string{"Windows"}, std::string{text});
+    Assert::IsTrue(reader.ReadTag(tag) && tag == ConstantsSnapshotTag::String && reader.ReadString(text));
+    Assert::AreEqual(std::string{"version"}, std::string{text});
+    Assert::IsTrue(reader.ReadTag(tag) && tag == ConstantsSnapshotTag::Number && reader.ReadNumber(number));
+    Assert::AreEqual(10.5, number);
+    Assert::IsTrue(reader.ReadTag(tag) && tag == ConstantsSnapshotTag::String && reader.ReadString(text));
+    Assert::AreEqual(std::string{"features"}, std::string{text});
+    Assert::IsTrue(reader.ReadTag(tag) && tag == ConstantsSnapshotTag::ArrayBegin);
+    Assert::IsTrue(reader.ReadTag(tag) && tag == ConstantsSnapshotTag::True);
+    Assert::IsTrue(reader.ReadTag(tag) && tag == ConstantsSnapshotTag::False);
+    Assert::IsTrue(reader.ReadTag(tag) && tag == ConstantsSnapshotTag::Null);
+    Assert::IsTrue(reader.ReadTag(tag) && tag == ConstantsSnapshotTag::End);
+    Assert::IsTrue(reader.ReadTag(tag) && tag == ConstantsSnapshotTag::String && reader.ReadString(text));
+    Assert::AreEqual(std::string{"empty"}, std::string{text});
+    Assert::IsTrue(reader.ReadTag(tag) && tag == ConstantsSnapshotTag::ObjectBegin);
+    Assert::IsTrue(reader.ReadTag(tag) && tag == ConstantsSnapshotTag::End);
+    Assert::IsTrue(reader.ReadTag(tag) && tag == ConstantsSnapshotTag::End);
+    Assert::IsTrue(reader.IsAtEnd());
+    Assert::IsFalse(reader.ReadTag(tag));
+  }
+
+  TEST_METHOD(WritesLongStringSizesAsVarints) {
+    const std::string value(300, 'x');
+    ConstantsSnapshotBuilder builder;
+    builder.WriteString(value);
+    const auto snapshot = builder.TakeSnapshot();
+
+    // Tag, 2 bytes of size, then the string.
+    Assert::AreEqual(size_t{3} + value.size(), snapshot.size());
+    ConstantsSnapshotReader reader(snapshot);
+    ConstantsSnapshotTag tag;
+    std::string_view text;
+    Assert::IsTrue(reader.ReadTag(tag) && reader.ReadString(text));
+    Assert::AreEqual(std::string{value}, std::string{text});
+  }
+
+  TEST_METHOD(ValidatesSnapshots) {
+    const auto snapshot = MakeSnapshot();
+    Assert::IsTrue(IsValidConstantsSnapshot(snapshot));
+
+    // Every truncation is rejected.
+    for (size_t size = 0; size < snapshot.size(); size++) {
+      Assert::IsFalse(IsValidConstantsSnapshot(std::string_view{snapshot}.substr(0, size)));
+    }
+
+    Assert::IsFalse(IsValidConstantsSnapshot(snapshot + snapshot));
+    Assert::IsFalse(IsValidConstantsSnapshot(std::string(1, static_cast<char>(0x7F))));
+    // Property names must be strings.
+    Assert::IsFalse(IsValidConstantsSnapshot({"\x05\x00\x07", 3}));
+    // Too deeply nested.
+    Assert::IsFalse(IsValidConstantsSnapshot(std::string(100, '\x06') + std::string(100, '\x07')));
+  }
+
+  TEST_METHOD(KeysDependOnVersionAndInputs) {
+    const auto key = ConstantsCache::MakeKey("1.0", {"en-US", "10.0.22621"});
+    Assert::AreEqual(key, ConstantsCache::MakeKey("1.0", {"en-US", "10.0.22621"}));
+    Assert::AreNotEqual(key, ConstantsCache::MakeKey("1.1", {"en-US", "10.0.22621"}));
+    Assert::AreNotEqual(key, ConstantsCache::MakeKey("1.0", {"fr-FR", "10.0.22621"}));
+    Assert::AreNotEqual(key, ConstantsCache::MakeKey("1.0", {"en-US"}));
+    Assert::AreNotEqual(ConstantsCache::MakeKey("1.0", {"ab", "c"}), ConstantsCache::MakeKey("1.0", {"a", "bc"}));
+  }
+
+  TEST_METHOD(CacheLoadsSnapshotsStoredWithTheSameKey) {
+    auto bufferStore = std::make_shared<InMemoryBufferStore>();
+    ConstantsCache cache(bufferStore);
+    const auto snapshot = MakeSnapshot();
+
+    Assert::IsFalse(cache.Load("PlatformConstants", 1).has_value());
+    Assert::IsTrue(cache.Store("PlatformConstants", 1, snapshot));
+    Assert::AreEqual(snapshot, cache.Load("PlatformConstants", 1).value());
+    Assert::IsFalse(cache.Load("PlatformConstants", 2).has_value());
+    Assert::IsFalse(cache.Load("DeviceInfo", 1).has_value());
+  }
+
+  TEST_METHOD(CacheLoadsSnapshotsStoredWithTheSameCacheVersion) {
+    auto bufferStore = std::make_shared<InMemoryBufferStore>();
+    const auto snapshot = MakeSnapshot();
+    Assert::IsTrue(ConstantsCache(bufferStore, 10).Store("PlatformConstants", 1, snapshot));
+
+    Assert::AreEqual(snapshot, ConstantsCache(bufferStore, 10).Load("PlatformConstants", 1).value());
+    Assert::IsFalse(ConstantsCache(bufferStore, 11).Load("PlatformConstants", 1).has_value());
+    Assert::IsFalse(ConstantsCache(bufferStore).Load("PlatformConstants", 1).has_value());
+  }
+
+  TEST_METHOD(CacheUsesFileNameSafeBufferIds) {
+    auto bufferStore = std::make_shared<InMemoryBufferStore>();
+    ConstantsCache cache(bufferStore);
+    Assert::IsTrue(cache.Store("..\\My/Module", 1, MakeSnapshot()));
+
+    Assert::AreEqual(size_t{1}, bufferStore->buffers.size());
+    Assert::AreEqual(std::string{"___My_Module.constants"}, bufferStore->buffers.begin()->first);
+  }
+
+  TEST_METHOD(CacheIgnoresCorruptedSnapshots) {
+    auto bufferStore = std::make_shared<InMemoryBufferStore>();
+    ConstantsCache cache(bufferStore);
+    Assert::IsTrue(cache.Store("PlatformConstants", 1, MakeSnapshot()));
+    auto &buffer = bufferStore->buffers.begin()->second;
+    const auto stored = buffer;
+
+    buffer.back() ^= 1;
+    Assert::IsFalse(cache.Load("PlatformConstants", 1).has_value());
+
+    buffer = stored.substr(0, stored.size() - 1);
+    Assert::IsFalse(cache.Load("PlatformConstants", 1).has_value());
+
+    buffer = stored;
+    buffer[0] = 'X';
+    Assert::IsFalse(cache.Load("PlatformConstants", 1).has_value());
+
+    buffer = stored;
+    Assert::IsTrue(cache.Load("PlatformConstants", 1).has_value());
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,144 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <Networking/CaseInsensitiveNameSet.h>
+#include <Networking/CorsPreflightCache.h>
+
+// Standard Library
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using Microsoft::React::Networking::CaseInsensitiveNames;
+using Microsoft::React::Networking::CaseInsensitiveNameSet;
+using Microsoft::React::Networking::CorsPreflightCache;
+using std::vector;
+using std::wstring;
+using std::wstring_view;
+
+namespace {
+
+constexpr wchar_t s_origin[]{L"http://example.rnw"};
+constexpr wchar_t s_url[]{L"http://mockserver.rnw/api"};
+
+struct TestCache {
+  int64_t Now{0};
+  CorsPreflightCache Cache;
+
+  TestCache(size_t maxEntries = 256) : Cache{CorsPreflightCache::Options{maxEntries, 600, [this]() { return Now; }}} {}
+
+  void Insert(const wstring &url, int64_t maxAge, CaseInsensitiveNames &&methods, CaseInsensitiveNames &&headers) {
+    Cache.Insert(s_origin, url, false /*withCredentials*/, maxAge, std::move(methods), std::move(headers));
+  }
+
+  bool Matches(const wstring &url, wstring_view method, vector<wstring_view> &&headerNames = {}) {
+    return Cache.Matches(s_origin, url, false /*withCredentials*/, method, headerNames);
+  }
+};
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (CorsPreflightCacheTest) {
+  TEST_METHOD(NameSetIgnoresCase) {
+    CaseInsensitiveNameSet names{L"Content-Type", L"X-Custom", L"x-custom", L"Accept"};
+
+    Assert::AreEqual(size_t{3}, names.Size());
+    Assert::IsTrue(names.Contains(L"content-type"));
+    Assert::IsTrue(names.Contains(L"X-CUSTOM"));
+    Assert::IsTrue(names.Contains(L"Accept"));
+    Assert::IsFalse(names.Contains(L"Accept-Language"));
+    Assert::IsFalse(names.Contains(L"Accep"));
+    Assert::IsFalse(names.Contains(L""));
+    Assert::IsFalse(CaseInsensitiveNameSet{}.Contains(L"Accept"));
+  }
+
+  TEST_METHOD(NameSetFindsEveryName) {
+    vector<wstring> names;
+    for (int i = 0; i < 500; i++) {
+      names.push_back(L"X-Header-" + std::to_wstring(i));
+    }
+    CaseInsensitiveNameSet set{vector<wstring>{names}};
+
+    for (const auto &name : names) {
+      Assert::IsTrue(set.Contains(name));
+    }
+    Assert::IsFalse(set.Contains(L"X-Header-500"));
+  }
+
+  TEST_METHOD(NamesIgnoreCase) {
+    CaseInsensitiveNames names{L"Content-Type", L"X-Custom", L"x-custom"};
+
+    Assert::AreEqual(size_t{2}, names.size());
+    Assert::IsTrue(names.contains(L"content-type"));
+    Assert::IsTrue(names.contains(wstring_view{L"X-CUSTOM"}));
+    Assert::IsFalse(names.contains(L"X-Custom2"));
+    Assert::IsFalse(names.contains(L""));
+  }
+
+  TEST_METHOD(MatchesAllowedMethodsAndHeaders) {
+    TestCache test;
+    test.Insert(s_url, 60, {L"PATCH"}, {L"X-Custom", L"Authorization"});
+
+    Assert::IsTrue(test.Matches(s_url, L"patch", {L"x-custom"}));
+    Assert::IsTrue(test.Matches(s_url, L"GET", {L"Authorization", L"X-Custom"}));
+    Assert::IsFalse(test.Matches(s_url, L"DELETE"));
+    Assert::IsFalse(test.Matches(s_url, L"PATCH", {L"X-Other"}));
+    Assert::IsFalse(test.Matches(L"http://mockserver.rnw/other", L"PATCH"));
+    Assert::IsFalse(test.Cache.Matches(L"http://other.rnw", s_url, false, L"PATCH", {}));
+    Assert::IsFalse(test.Cache.Matches(s_origin, s_url, true, L"PATCH", {}));
+  }
+
+  TEST_METHOD(WildcardsExcludeAuthorizationAndCredentials) {
+    TestCache test;
+    test.Insert(s_url, 60, {L"*"}, {L"*"});
+    test.Cache.Insert(s_origin, s_url, true, 60, {L"*"}, {L"*"});
+
+    Assert::IsTrue(test.Matches(s_url, L"DELETE", {L"X-Custom"}));
+    Assert::IsFalse(test.Matches(s_url, L"GET", {L"Authorization"}));
+    Assert::IsFalse(test.Cache.Matches(s_origin, s_url, true, L"DELETE", {}));
+    Assert::IsFalse(test.Cache.Matches(s_origin, s_url, true, L"GET", {L"X-Custom"}));
+  }
+
+  TEST_METHOD(EntriesExpireAfterMaxAge) {
+    TestCache test;
+    test.Insert(s_url, 5, {L"PATCH"}, {});
+    test.Insert(L"http://mockserver.rnw/long", 3600, {L"PATCH"}, {});
+    test.Insert(L"http://mockserver.rnw/none", 0, {L"PATCH"}, {});
+
+    test.Now = 4999;
+    Assert::IsTrue(test.Matches(s_url, L"PATCH"));
+
+    test.Now = 5000;
+    Assert::IsFalse(test.Matches(s_url, L"PATCH"));
+    Assert::IsFalse(test.Matches(L"http://mockserver.rnw/none", L"PATCH"));
+
+    // Capped to the 600 seconds of the options.
+    test.Now = 599999;
+    Assert::IsTrue(test.Matches(L"http://mockserver.rnw/long", L"PATCH"));
+    test.Now = 600000;
+    Assert::IsFalse(test.Matches(L"http://mockserver.rnw/long", L"PATCH"));
+  }
+
+  TEST_METHOD(EvictsExpiredThenOldestEntries) {
+    TestCache test{2};
+    test.Insert(L"http://mockserver.rnw/a", 10, {L"PATCH"}, {});
+    test.Insert(L"http://mockserver.rnw/b", 20, {L"PATCH"}, {});
+    test.Insert(L"http://mockserver.rnw/c", 30, {L"PATCH"}, {});
+
+    Assert::AreEqual(size_t{2}, test.Cache.Size());
+    Assert::IsFalse(test.Matches(L"http://mockserver.rnw/a", L"PATCH"));
+    Assert::IsTrue(test.Matches(L"http://mockserver.rnw/b", L"PATCH"));
+
+    test.Now = 20000;
+    test.Insert(L"http://mockserver.rnw/d", 5, {L"PATCH"}, {});
+    Assert::IsTrue(test.Matches(L"http://mockserver.rnw/c", L"PATCH"));
+    Assert::IsTrue(test.Matches(L"http://mockserver.rnw/d", L"PATCH"));
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <GenerationalHandleTable.h>
+
+// Standard Library
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::ReactNative;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (GenerationalHandleTableTest) {
+  TEST_METHOD(AddsAndTakesValues) {
+    GenerationalHandleTable<std::string> table;
+    const auto first = table.Add("first");
+    const auto second = table.Add("second");
+
+    Assert::AreNotEqual(uint64_t{0}, first);
+    Assert::AreNotEqual(first, second);
+    Assert::AreEqual(size_t{2}, table.Size());
+    Assert::AreEqual(std::string{"second"}, *table.Get(second));
+
+    Assert::AreEqual(std::string{"first"}, table.Take(first).value());
+    Assert::IsFalse(table.Take(first).has_value());
+    Assert::IsNull(table.Get(first));
+    Assert::AreEqual(size_t{1}, table.Size());
+
+    Assert::IsTrue(table.Release(second));
+    Assert::IsFalse(table.Release(second));
+    Assert::AreEqual(size_t{0}, table.Size());
+  }
+
+  TEST_METHOD(StaleHandlesDoNotReachReusedSlots) {
+    GenerationalHandleTable<std::string> table;
+    const auto stale = table.Add("stale");
+    table.Release(stale);
+
+    const auto reused = table.Add("reused");
+    Assert::AreEqual(static_cast<uint32_t>(stale), static_cast<uint32_t>(reused));
+    Assert::AreNotEqual(stale, reused);
+    Assert::IsNull(table.Get(stale));
+    Assert::IsFalse(table.Release(stale));
+    Assert::AreEqual(std::string{"reused"}, *table.Get(reused));
+  }
+
+  TEST_METHOD(IgnoresInvalidHandles) {
+    GenerationalHandleTable<std::string> table;
+    table.Add("value");
+
+    Assert::IsNull(table.Get(0));
+    Assert::IsNull(table.Get(uint64_t{1} << 32 | 5));
+    Assert::IsFalse(table.Take(0).has_value());
+  }
+
+  TEST_METHOD(ClearReleasesAllValues) {
+    GenerationalHandleTable<std::shared_ptr<int>> table;
+    auto value = std::make_shared<int>(42);
+    std::vector<uint64_t> handles;
+    for (int i = 0; i < 10; i++) {
+      handles.push_back(table.Add(std::shared_ptr<int>{value}));
+    }
+    table.Release(handles[3]);
+
+    table.Clear();
+    Assert::AreEqual(size_t{0}, table.Size());
+    Assert::AreEqual(long{1}, value.use_count());
+    for (const auto handle : handles) {
+      Assert::IsNull(table.Get(handle));
+    }
+
+    // The slots are reused after a clear.
+    const auto handle = table.Add(std::shared_ptr<int>{value});
+    Assert::IsTrue(static_cast<uint32_t>(handle) < 10);
+    Assert::AreEqual(42, **table.Get(handle));
+  }
+
+  // Adds and releases as many handles as a high rate module would in a few seconds. The slots are reused, and the
+  // budget is an order of magnitude above the typical timing.
+  TEST_METHOD(ChurnsHandlesWithoutGrowing) {
+    constexpr size_t pendingCount = 16;
+    constexpr size_t callCount = 100000;
+    GenerationalHandleTable<std::string> table;
+    table.Reserve(pendingCount);
+
+    std::vector<uint64_t> pending;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < callCount; i++) {
+      if (pending.size() == pendingCount) {
+        table.Release(pending[i % pendingCount]);
+        pending[i % pendingCount] = table.Add("callback");
+      } else {
+        pending.push_back(table.Add("callback"));
+      }
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    Assert::AreEqual(pendingCount, table.Size());
+    for (const auto handle : pending) {
+      Assert::IsTrue(static_cast<uint32_t>(handle) < pendingCount);
+    }
+    Assert::IsTrue(elapsed < std::chrono::seconds(1));
+  }
+};
+
+} // namespace Microsoft::React::Test
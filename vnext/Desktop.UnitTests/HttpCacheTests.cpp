@@ -0,0 +1,363 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <Networking/DiskHttpCacheStore.h>
+#include <Networking/HttpCache.h>
+
+// Standard Library
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using Microsoft::React::BlobView;
+using Microsoft::React::Networking::DiskHttpCacheStore;
+using Microsoft::React::Networking::HttpCache;
+using Microsoft::React::Networking::HttpCacheEntry;
+using Microsoft::React::Networking::HttpCacheRequest;
+using Microsoft::React::Networking::HttpCacheResponse;
+using Microsoft::React::Networking::HttpHeaders;
+using Microsoft::React::Networking::IHttpCacheTransport;
+using std::string;
+using std::vector;
+
+namespace {
+
+// "Sun, 06 Nov 1994 08:49:37 GMT"
+constexpr int64_t startTime = 784111777;
+
+// Records the requests sent to the network, and answers them when told to.
+class FakeTransport final : public IHttpCacheTransport {
+ public:
+  struct SentRequest {
+    HttpCacheRequest Request;
+    std::function<void(HttpCacheResponse &&response)> OnResponse;
+    std::function<void(string &&errorMessage)> OnError;
+  };
+
+  vector<SentRequest> Sent;
+  vector<int64_t> Canceled;
+
+  // When set, answers every request right away.
+  std::function<HttpCacheResponse(const HttpCacheRequest &request)> Server;
+
+  void Send(
+      HttpCacheRequest &&request,
+      std::function<void(HttpCacheResponse &&response)> &&onResponse,
+      std::function<void(string &&errorMessage)> &&onError) noexcept override {
+    Sent.push_back({request, onResponse, onError});
+    if (Server) {
+      onResponse(Server(request));
+    }
+  }
+
+  void Cancel(int64_t requestId) noexcept override {
+    Canceled.push_back(requestId);
+  }
+
+  void Respond(size_t index, HttpCacheResponse &&response) {
+    Sent[index].OnResponse(std::move(response));
+  }
+};
+
+HttpCacheResponse Response(int64_t statusCode, HttpHeaders &&headers, const string &body = {}) {
+  return {statusCode, "http://localhost/", std::move(headers), BlobView::FromBytes({body.cbegin(), body.cend()})};
+}
+
+string Text(const BlobView &view) {
+  auto bytes = view.ToVector();
+  return string(bytes.cbegin(), bytes.cend());
+}
+
+struct TestCache {
+  std::shared_ptr<FakeTransport> Transport{std::make_shared<FakeTransport>()};
+  std::shared_ptr<DiskHttpCacheStore> Store;
+  int64_t Now{startTime};
+  std::shared_ptr<HttpCache> Cache;
+
+  TestCache(const std::filesystem::path &directory) {
+    Store = std::make_shared<DiskHttpCacheStore>(DiskHttpCacheStore::Options{directory, 1024 * 1024});
+    Cache = std::make_shared<HttpCache>(Transport, Store, HttpCache::Options{[this]() { return Now; }});
+  }
+
+  HttpCacheResponse Get(HttpHeaders &&headers = {}) {
+    HttpCacheResponse result;
+    Cache->Send(
+        HttpCacheRequest{1, "GET", "http://localhost/", std::move(headers)},
+        [&result](HttpCacheResponse &&response) { result = std::move(response); },
+        [](string &&errorMessage) { Assert::Fail(L"Unexpected error"); });
+
+    return result;
+  }
+};
+
+std::filesystem::path TestDirectory(const string &name) {
+  auto directory = std::filesystem::temp_directory_path() / ("rnw-http-cache-test-" + name);
+  std::filesystem::remove_all(directory);
+  return directory;
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (HttpCacheTest) {
+  TEST_METHOD(ServesFreshResponsesFromTheStore) {
+    TestCache test{TestDirectory("fresh")};
+    test.Transport->Server = [](const HttpCacheRequest &) {
+      return Response(200, {{"Cache-Control", "max-age=60"}}, "fresh body");
+    };
+
+    Assert::AreEqual(string{"fresh body"}, Text(test.Get().Body));
+    test.Now += 30;
+    auto cached = test.Get();
+
+    Assert::AreEqual(size_t{1}, test.Transport->Sent.size());
+    Assert::AreEqual(int64_t{200}, cached.StatusCode);
+    Assert::AreEqual(string{"fresh body"}, Text(cached.Body));
+    Assert::AreEqual(string{"30"}, cached.Headers["Age"]);
+
+    test.Now += 31;
+    test.Get();
+    Assert::AreEqual(size_t{2}, test.Transport->Sent.size());
+
+    auto metrics = test.Cache->Metrics();
+    Assert::AreEqual(uint64_t{1}, metrics.Hits);
+    Assert::AreEqual(uint64_t{2}, metrics.Misses);
+  }
+
+  TEST_METHOD(RevalidatesStaleResponses) {
+    TestCache test{TestDirectory("revalidate")};
+    test.Transport->Server = [](const HttpCacheRequest &request) {
+      if (request.Headers.count("If-None-Match") > 0) {
+        Assert::AreEqual(string{"\"v1\""}, request.Headers.at("If-None-Match"));
+        return Response(304, {{"Cache-Control", "max-age=100"}});
+      }
+      return Response(200, {{"Cache-Control", "max-age=10"}, {"ETag", "\"v1\""}}, "validated body");
+    };
+
+    test.Get();
+    test.Now += 20;
+    auto revalidated = test.Get();
+
+    Assert::AreEqual(size_t{2}, test.Transport->Sent.size());
+    Assert::AreEqual(int64_t{200}, revalidated.StatusCode);
+    Assert::AreEqual(string{"validated body"}, Text(revalidated.Body));
+
+    // Freshened by the 304.
+    test.Now += 50;
+    Assert::AreEqual(string{"validated body"}, Text(test.Get().Body));
+    Assert::AreEqual(size_t{2}, test.Transport->Sent.size());
+
+    auto metrics = test.Cache->Metrics();
+    Assert::AreEqual(uint64_t{1}, metrics.Revalidations);
+    Assert::AreEqual(uint64_t{1}, metrics.NotModified);
+    Assert::AreEqual(uint64_t{1}, metrics.Hits);
+  }
+
+  TEST_METHOD(UsesHeuristicFreshnessFromLastModified) {
+    TestCache test{TestDirectory("heuristic")};
+    test.Transport->Server = [](const HttpCacheRequest &request) {
+      if (request.Headers.count("If-Modified-Since") > 0) {
+        return Response(304, {});
+      }
+      // Modified 1000 seconds before the response: fresh for 100 seconds.
+      return Response(
+          200, {{"Date", "Sun, 06 Nov 1994 08:49:37 GMT"}, {"Last-Modified", "Sunday, 06-Nov-94 08:32:57 GMT"}}, "x");
+    };
+
+    test.Get();
+    test.Now += 99;
+    test.Get();
+    Assert::AreEqual(size_t{1}, test.Transport->Sent.size());
+
+    test.Now += 2;
+    test.Get();
+    Assert::AreEqual(size_t{2}, test.Transport->Sent.size());
+    Assert::AreEqual(
+        string{"Sunday, 06-Nov-94 08:32:57 GMT"}, test.Transport->Sent[1].Request.Headers.at("If-Modified-Since"));
+  }
+
+  TEST_METHOD(HonorsNoStoreAndNoCache) {
+    TestCache test{TestDirectory("directives")};
+    test.Transport->Server = [](const HttpCacheRequest &) {
+      return Response(200, {{"Cache-Control", "no-store, max-age=60"}});
+    };
+
+    test.Get();
+    test.Get();
+    Assert::AreEqual(size_t{2}, test.Transport->Sent.size());
+    Assert::AreEqual(size_t{0}, test.Store->Size());
+
+    test.Transport->Server = [](const HttpCacheRequest &) {
+      return Response(200, {{"Cache-Control", "max-age=60"}, {"ETag", "\"a\""}});
+    };
+    test.Get();
+    test.Get({{"Cache-Control", "no-cache"}});
+    Assert::AreEqual(size_t{4}, test.Transport->Sent.size());
+    Assert::AreEqual(string{"\"a\""}, test.Transport->Sent[3].Request.Headers.at("If-None-Match"));
+  }
+
+  TEST_METHOD(CoalescesIdenticalRequestsInFlight) {
+    TestCache test{TestDirectory("coalesce")};
+    vector<string> bodies;
+    auto send = [&](HttpHeaders &&headers) {
+      test.Cache->Send(
+          HttpCacheRequest{1, "GET", "http://localhost/", std::move(headers)},
+          [&bodies](HttpCacheResponse &&response) { bodies.push_back(Text(response.Body)); },
+          [](string &&) {});
+    };
+
+    send({{"Accept", "text/plain"}});
+    send({{"Accept", "text/plain"}});
+    send({{"accept", "text/plain"}});
+    send({{"Accept", "application/json"}});
+    Assert::AreEqual(size_t{2}, test.Transport->Sent.size());
+    Assert::AreEqual(uint64_t{2}, test.Cache->Metrics().Coalesced);
+
+    test.Transport->Respond(0, Response(200, {}, "shared"));
+    Assert::AreEqual(size_t{3}, bodies.size());
+    for (const auto &body : bodies) {
+      Assert::AreEqual(string{"shared"}, body);
+    }
+
+    // Not coalesced once answered.
+    send({{"Accept", "text/plain"}});
+    Assert::AreEqual(size_t{3}, test.Transport->Sent.size());
+  }
+
+  TEST_METHOD(AbortsCoalescedRequestsSeparately) {
+    TestCache test{TestDirectory("abort")};
+    vector<string> results;
+    auto send = [&](int64_t requestId) {
+      test.Cache->Send(
+          HttpCacheRequest{requestId, "GET", "http://localhost/", {}},
+          [&results, requestId](HttpCacheResponse &&response) {
+            results.push_back(std::to_string(requestId) + ":" + Text(response.Body));
+          },
+          [&results, requestId](string &&) { results.push_back(std::to_string(requestId) + ":error"); });
+    };
+
+    send(1);
+    send(2);
+    send(3);
+    Assert::AreEqual(size_t{1}, test.Transport->Sent.size());
+
+    // The first request does not own the request sent to the network.
+    Assert::IsTrue(test.Cache->Abort(1));
+    Assert::IsFalse(test.Cache->Abort(1));
+    Assert::IsTrue(test.Cache->Abort(3));
+    Assert::IsTrue(test.Transport->Canceled.empty());
+
+    test.Transport->Respond(0, Response(200, {}, "shared"));
+    Assert::IsTrue(vector<string>{"1:error", "3:error", "2:shared"} == results);
+    Assert::IsFalse(test.Cache->Abort(2));
+
+    // The network request is canceled along with the last request waiting for it.
+    send(4);
+    send(5);
+    Assert::IsTrue(test.Cache->Abort(5));
+    Assert::IsTrue(test.Cache->Abort(4));
+    Assert::AreEqual(size_t{1}, test.Transport->Canceled.size());
+    Assert::AreEqual(test.Transport->Sent[1].Request.Id, test.Transport->Canceled[0]);
+
+    // Later identical requests are sent again, and the canceled one no longer answers them.
+    send(6);
+    test.Transport->Sent[1].OnError("Canceled");
+    Assert::AreEqual(size_t{3}, test.Transport->Sent.size());
+    Assert::AreEqual(string{"5:error"}, results[3]);
+    Assert::AreEqual(size_t{5}, results.size());
+  }
+
+  TEST_METHOD(AbortsBypassingRequests) {
+    TestCache test{TestDirectory("abort-bypass")};
+    string error;
+    test.Cache->Send(
+        HttpCacheRequest{7, "POST", "http://localhost/", {}},
+        [](HttpCacheResponse &&) { Assert::Fail(L"Unexpected response"); },
+        [&error](string &&errorMessage) { error = std::move(errorMessage); });
+
+    Assert::IsTrue(test.Cache->Abort(7));
+    Assert::IsFalse(error.empty());
+    Assert::AreEqual(size_t{1}, test.Transport->Canceled.size());
+
+    test.Transport->Respond(0, Response(200, {}));
+  }
+
+  TEST_METHOD(InvalidatesOnUnsafeMethods) {
+    TestCache test{TestDirectory("invalidate")};
+    test.Transport->Server = [](const HttpCacheRequest &) {
+      return Response(200, {{"Cache-Control", "max-age=60"}});
+    };
+
+    test.Get();
+    test.Cache->Send(
+        HttpCacheRequest{2, "POST", "http://localhost/", {}}, [](HttpCacheResponse &&) {}, [](string &&) {});
+    test.Get();
+
+    Assert::AreEqual(size_t{3}, test.Transport->Sent.size());
+    Assert::AreEqual(uint64_t{1}, test.Cache->Metrics().Bypassed);
+  }
+
+  TEST_METHOD(MatchesVaryingHeaders) {
+    TestCache test{TestDirectory("vary")};
+    test.Transport->Server = [](const HttpCacheRequest &) {
+      return Response(200, {{"Cache-Control", "max-age=60"}, {"Vary", "Accept-Language"}});
+    };
+
+    test.Get({{"Accept-Language", "en"}});
+    test.Get({{"accept-language", "en"}});
+    Assert::AreEqual(size_t{1}, test.Transport->Sent.size());
+
+    test.Get({{"Accept-Language", "fr"}});
+    Assert::AreEqual(size_t{2}, test.Transport->Sent.size());
+  }
+
+  TEST_METHOD(DiskStorePersistsAndEvicts) {
+    const auto directory = TestDirectory("disk");
+    const auto body = string(300 * 1024, 'b');
+    const auto bodyView = BlobView::FromBytes({body.cbegin(), body.cend()});
+    {
+      DiskHttpCacheStore store{{directory, 1024 * 1024}};
+      for (auto key : {"a", "b", "c"}) {
+        store.Put(key, HttpCacheEntry{200, key, {{"ETag", key}}, {}, 1, 2, bodyView});
+      }
+      // Uses a, making b the least recently used.
+      Assert::IsTrue(store.Get("a").has_value());
+    }
+
+    DiskHttpCacheStore store{{directory, 1024 * 1024}};
+    auto entry = store.Get("b");
+    Assert::IsTrue(entry.has_value());
+    Assert::AreEqual(string{"b"}, entry->Headers["ETag"]);
+    Assert::AreEqual(int64_t{2}, entry->ResponseTime);
+    Assert::AreEqual(body, Text(entry->Body));
+
+    // Over the size bound: evicts the least recently used.
+    store.Put("d", HttpCacheEntry{200, "d", {}, {}, 1, 2, bodyView});
+    Assert::IsFalse(store.Get("a").has_value());
+    Assert::IsTrue(store.Get("b").has_value());
+    Assert::IsTrue(store.Get("d").has_value());
+    Assert::IsTrue(store.Size() <= 1024 * 1024);
+
+    store.Remove("b");
+    Assert::IsFalse(store.Get("b").has_value());
+    std::filesystem::remove_all(directory);
+  }
+
+  TEST_METHOD(DiskStoreLoadsOnFirstUse) {
+    const auto directory = TestDirectory("lazy");
+    DiskHttpCacheStore store{{directory, 1024 * 1024}};
+    Assert::IsFalse(std::filesystem::exists(directory));
+
+    Assert::AreEqual(size_t{0}, store.Size());
+    Assert::IsTrue(std::filesystem::exists(directory));
+    std::filesystem::remove_all(directory);
+  }
+};
+
+} // namespace Microsoft::React::Test
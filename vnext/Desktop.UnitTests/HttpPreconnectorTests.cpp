@@ -0,0 +1,151 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <Networking/HttpPreconnector.h>
+
+// Standard Library
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using Microsoft::React::Networking::HttpPreconnector;
+using std::function;
+using std::string;
+using std::vector;
+
+namespace {
+
+// Stands in for servers on the loopback interface. Connections stay pending until Accept or Refuse is called.
+struct LoopbackServers {
+  int64_t Now{0};
+  vector<std::pair<string, function<void(bool)>>> Pending;
+  vector<string> Connected;
+  HttpPreconnector Preconnector;
+
+  LoopbackServers(size_t maxConnects)
+      : Preconnector{
+            [this](const string &origin, function<void(bool)> &&done) {
+              Connected.push_back(origin);
+              Pending.emplace_back(origin, std::move(done));
+            },
+            HttpPreconnector::Options{maxConnects, 1000, [this]() { return Now; }}} {}
+
+  void Accept(size_t index = 0) {
+    Complete(index, true);
+  }
+
+  void Refuse(size_t index = 0) {
+    Complete(index, false);
+  }
+
+ private:
+  void Complete(size_t index, bool succeeded) {
+    auto done = std::move(Pending[index].second);
+    Pending.erase(Pending.begin() + index);
+    done(succeeded);
+  }
+};
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (HttpPreconnectorTest) {
+  TEST_METHOD(ConnectsOncePerOrigin) {
+    LoopbackServers servers{4};
+
+    servers.Preconnector.Preconnect(
+        {"http://localhost:5555/rnw/http/get",
+         "HTTP://LOCALHOST:5555/other",
+         "https://localhost:5556",
+         "http://user@localhost:5555/?query",
+         "ws://localhost:5555"});
+
+    Assert::IsTrue(vector<string>{"http://localhost:5555", "https://localhost:5556"} == servers.Connected);
+    auto metrics = servers.Preconnector.Metrics();
+    Assert::AreEqual(size_t{5}, metrics.PreconnectsRequested);
+    Assert::AreEqual(size_t{2}, metrics.PreconnectsSkipped);
+    Assert::AreEqual(size_t{1}, metrics.PreconnectsFailed);
+  }
+
+  TEST_METHOD(LimitsConcurrentConnects) {
+    LoopbackServers servers{2};
+
+    servers.Preconnector.Preconnect(
+        {"http://localhost:5551", "http://localhost:5552", "http://localhost:5553", "http://localhost:5554"});
+    Assert::AreEqual(size_t{2}, servers.Preconnector.ActiveCount());
+    Assert::AreEqual(size_t{2}, servers.Preconnector.QueuedCount());
+
+    servers.Now = 30;
+    servers.Refuse(1);
+    servers.Accept(0);
+    Assert::IsTrue(
+        vector<string>{
+            "http://localhost:5551", "http://localhost:5552", "http://localhost:5553", "http://localhost:5554"} ==
+        servers.Connected);
+    Assert::AreEqual(size_t{0}, servers.Preconnector.QueuedCount());
+
+    auto metrics = servers.Preconnector.Metrics();
+    Assert::AreEqual(size_t{1}, metrics.PreconnectsSucceeded);
+    Assert::AreEqual(size_t{1}, metrics.PreconnectsFailed);
+    Assert::AreEqual(int64_t{30}, metrics.PreconnectTime);
+    Assert::IsTrue(servers.Preconnector.IsWarm("http://localhost:5551"));
+    Assert::IsFalse(servers.Preconnector.IsWarm("http://localhost:5552"));
+  }
+
+  TEST_METHOD(CountsWarmRequests) {
+    LoopbackServers servers{4};
+    servers.Preconnector.Preconnect({"http://localhost:5555"});
+    servers.Accept();
+
+    servers.Preconnector.NoteRequest("http://localhost:5555/rnw/http/get");
+    servers.Preconnector.NoteRequest("http://localhost:5556/rnw/http/get");
+
+    servers.Now = 999;
+    servers.Preconnector.NoteRequest("http://localhost:5556/rnw/http/get");
+
+    // The first origin was last used at 0 and is idle for too long.
+    servers.Now = 1000;
+    servers.Preconnector.NoteRequest("http://localhost:5555/rnw/http/get");
+
+    auto metrics = servers.Preconnector.Metrics();
+    Assert::AreEqual(size_t{2}, metrics.WarmRequests);
+    Assert::AreEqual(size_t{2}, metrics.ColdRequests);
+  }
+
+  TEST_METHOD(ReconnectsAfterIdleTimeout) {
+    LoopbackServers servers{4};
+    servers.Preconnector.Preconnect({"http://localhost:5555"});
+    servers.Preconnector.Preconnect({"http://localhost:5555"});
+    servers.Accept();
+    servers.Preconnector.Preconnect({"http://localhost:5555"});
+    Assert::AreEqual(size_t{1}, servers.Connected.size());
+
+    servers.Now = 1000;
+    servers.Preconnector.Preconnect({"http://localhost:5555"});
+    Assert::AreEqual(size_t{2}, servers.Connected.size());
+    Assert::AreEqual(size_t{2}, servers.Preconnector.Metrics().PreconnectsSkipped);
+  }
+
+  TEST_METHOD(ConnectsSynchronously) {
+    vector<string> connected;
+    HttpPreconnector preconnector{[&connected](const string &origin, function<void(bool)> &&done) {
+                                    connected.push_back(origin);
+                                    done(true);
+                                  },
+                                  HttpPreconnector::Options{1, 1000, []() { return int64_t{0}; }}};
+
+    preconnector.Preconnect({"http://localhost:5551", "http://localhost:5552", "http://localhost:5553"});
+
+    Assert::AreEqual(size_t{3}, connected.size());
+    Assert::AreEqual(size_t{0}, preconnector.ActiveCount());
+    Assert::AreEqual(size_t{3}, preconnector.Metrics().PreconnectsSucceeded);
+  }
+};
+
+} // namespace Microsoft::React::Test
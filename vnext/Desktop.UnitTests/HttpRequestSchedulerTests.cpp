@@ -0,0 +1,131 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <Networking/HttpRequestScheduler.h>
+
+// Standard Library
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using Microsoft::React::Networking::GetRequestHost;
+using Microsoft::React::Networking::GetRequestPriority;
+using Microsoft::React::Networking::HttpRequestPriority;
+using Microsoft::React::Networking::HttpRequestScheduler;
+using std::string;
+using std::vector;
+
+namespace {
+
+struct TestScheduler {
+  int64_t Now{0};
+  vector<int64_t> Sent;
+  HttpRequestScheduler Scheduler;
+
+  TestScheduler(size_t maxRequests, size_t maxRequestsPerHost, size_t reservedHighPriorityRequests = 0)
+      : Scheduler{HttpRequestScheduler::Options{
+            maxRequests, maxRequestsPerHost, reservedHighPriorityRequests, [this]() { return Now; }}} {}
+
+  void Enqueue(int64_t requestId, string &&host, HttpRequestPriority priority = HttpRequestPriority::Normal) {
+    Scheduler.Enqueue(requestId, std::move(host), priority, [this, requestId]() { Sent.push_back(requestId); });
+  }
+};
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (HttpRequestSchedulerTest) {
+  TEST_METHOD(LimitsRequestsPerHostAndInTotal) {
+    TestScheduler test{3, 2};
+    test.Enqueue(1, "a");
+    test.Enqueue(2, "a");
+    test.Enqueue(3, "a");
+    test.Enqueue(4, "b");
+    test.Enqueue(5, "b");
+
+    Assert::IsTrue(vector<int64_t>{1, 2, 4} == test.Sent);
+    Assert::AreEqual(size_t{2}, test.Scheduler.QueuedCount());
+
+    // Host a is still at its limit.
+    test.Scheduler.Complete(4);
+    Assert::IsTrue(vector<int64_t>{1, 2, 4, 5} == test.Sent);
+
+    test.Scheduler.Complete(1);
+    test.Scheduler.Complete(1);
+    Assert::IsTrue(vector<int64_t>{1, 2, 4, 5, 3} == test.Sent);
+    Assert::AreEqual(size_t{3}, test.Scheduler.ActiveCount());
+  }
+
+  TEST_METHOD(SendsHigherPrioritiesFirst) {
+    TestScheduler test{1, 1};
+    test.Enqueue(1, "a");
+    test.Enqueue(2, "b", HttpRequestPriority::Low);
+    test.Enqueue(3, "c", HttpRequestPriority::Normal);
+    test.Enqueue(4, "d", HttpRequestPriority::High);
+
+    for (int64_t requestId : {1, 4, 3}) {
+      test.Scheduler.Complete(requestId);
+    }
+    Assert::IsTrue(vector<int64_t>{1, 4, 3, 2} == test.Sent);
+  }
+
+  TEST_METHOD(HostsTakeTurns) {
+    TestScheduler test{1, 1};
+    test.Enqueue(1, "a");
+    test.Enqueue(2, "a");
+    test.Enqueue(3, "a");
+    test.Enqueue(4, "b");
+    test.Enqueue(5, "c");
+
+    for (int64_t requestId : {1, 2, 4, 5}) {
+      test.Scheduler.Complete(requestId);
+    }
+    Assert::IsTrue(vector<int64_t>{1, 2, 4, 5, 3} == test.Sent);
+  }
+
+  TEST_METHOD(ReservesSlotsForHighPriority) {
+    TestScheduler test{2, 2, 1};
+    test.Enqueue(1, "a", HttpRequestPriority::Low);
+    test.Enqueue(2, "a", HttpRequestPriority::Low);
+    test.Enqueue(3, "a", HttpRequestPriority::High);
+
+    Assert::IsTrue(vector<int64_t>{1, 3} == test.Sent);
+  }
+
+  TEST_METHOD(CancelsQueuedRequestsAndReportsQueueTime) {
+    TestScheduler test{1, 1};
+    test.Enqueue(1, "a");
+    test.Enqueue(2, "a");
+    test.Enqueue(3, "a");
+
+    Assert::IsTrue(test.Scheduler.Cancel(2));
+    Assert::IsFalse(test.Scheduler.Cancel(2));
+    Assert::IsFalse(test.Scheduler.Cancel(1));
+
+    test.Now += 250;
+    test.Scheduler.Complete(1);
+    Assert::IsTrue(vector<int64_t>{1, 3} == test.Sent);
+    Assert::AreEqual(int64_t{0}, test.Scheduler.QueueTime(1));
+    Assert::AreEqual(int64_t{250}, test.Scheduler.QueueTime(3));
+    Assert::AreEqual(size_t{0}, test.Scheduler.QueuedCount());
+  }
+
+  TEST_METHOD(ClassifiesRequests) {
+    Assert::IsTrue(HttpRequestPriority::High == GetRequestPriority({{"priority", "i, u=1"}}, "base64"));
+    Assert::IsTrue(HttpRequestPriority::Normal == GetRequestPriority({{"Priority", "u=4"}}, "text"));
+    Assert::IsTrue(HttpRequestPriority::Low == GetRequestPriority({{"Priority", "u=7"}}, "text"));
+    Assert::IsTrue(HttpRequestPriority::Normal == GetRequestPriority({{"Priority", "i"}}, "base64"));
+    Assert::IsTrue(HttpRequestPriority::Low == GetRequestPriority({}, "base64"));
+    Assert::IsTrue(HttpRequestPriority::Normal == GetRequestPriority({}, "blob"));
+
+    Assert::AreEqual(string{"https://example.com:8443"}, GetRequestHost("HTTPS://user@Example.COM:8443/a?b#c"));
+    Assert::AreEqual(string{"http://example.com"}, GetRequestHost("http://example.com"));
+  }
+};
+
+} // namespace Microsoft::React::Test
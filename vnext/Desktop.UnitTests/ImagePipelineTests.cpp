@@ -0,0 +1,419 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <Fabric/Composition/ImagePipeline.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace winrt::Microsoft::ReactNative::Composition::implementation;
+
+namespace {
+
+using FakeImage = std::shared_ptr<std::string>;
+using FakeError = std::shared_ptr<std::string>;
+using FakePipeline = ImagePipeline<FakeImage, FakeError>;
+
+// Runs scheduled decodes when asked to, instead of on a background thread
+struct FakeScheduler {
+  std::vector<FakePipeline::Task> tasks;
+
+  void RunAll() {
+    auto pending = std::move(tasks);
+    for (auto &task : pending) {
+      task();
+    }
+  }
+};
+
+// Records fetches and completes them when asked to, with a fake decoder
+struct FakeFetcher {
+  int fetches{0};
+  int decodes{0};
+  FakePipeline::ProgressCallback progress;
+  FakePipeline::FetchCompletion complete;
+
+  FakePipeline::Fetcher Fetcher() {
+    return [this](FakePipeline::ProgressCallback &&progressCallback, FakePipeline::FetchCompletion &&completion) {
+      fetches++;
+      progress = std::move(progressCallback);
+      complete = std::move(completion);
+    };
+  }
+
+  void Succeed(const std::string &pixels) {
+    complete([this, pixels]() {
+      decodes++;
+      return FakePipeline::DecodeResult{std::make_shared<std::string>(pixels), pixels.size(), nullptr};
+    });
+  }
+
+  void Fail(const std::string &message) {
+    complete([this, message]() {
+      decodes++;
+      return FakePipeline::DecodeResult{nullptr, 0, std::make_shared<std::string>(message)};
+    });
+  }
+};
+
+std::shared_ptr<FakePipeline>
+MakePipeline(FakeScheduler &scheduler, size_t byteBudget = 100, size_t maxConcurrentDecodes = 2) {
+  return std::make_shared<FakePipeline>(
+      byteBudget,
+      [&scheduler](FakePipeline::Task &&task) { scheduler.tasks.push_back(std::move(task)); },
+      maxConcurrentDecodes);
+}
+
+FakePipeline::Requester MakeRequester(
+    FakePipeline::CompletionCallback completion,
+    ImageRequestPriority priority = ImageRequestPriority::Visible,
+    const void *owner = nullptr) {
+  FakePipeline::Requester requester;
+  requester.owner = owner;
+  requester.priority = priority;
+  requester.completion = std::move(completion);
+  return requester;
+}
+
+void IgnoreResult(const FakeImage &, const FakeError &) {}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (ImagePipelineTests) {
+  TEST_METHOD(CacheKeyIncludesTargetSize) {
+    ImageCacheKey key{"https://example.com/a.png", 100, 50};
+
+    Assert::IsTrue(key == ImageCacheKey{"https://example.com/a.png", 100, 50});
+    Assert::IsTrue(key != ImageCacheKey{"https://example.com/a.png", 200, 100});
+    Assert::IsTrue(key != ImageCacheKey{"https://example.com/b.png", 100, 50});
+    Assert::AreEqual(
+        ImageCacheKeyHash{}(key), ImageCacheKeyHash{}(ImageCacheKey{"https://example.com/a.png", 100, 50}));
+  }
+
+  TEST_METHOD(CacheEvictsLeastRecentlyUsedWithinByteBudget) {
+    DecodedImageCache<FakeImage> cache{100};
+    cache.Put({"a"}, std::make_shared<std::string>("a"), 40);
+    cache.Put({"b"}, std::make_shared<std::string>("b"), 40);
+    cache.Get({"a"}); // a is now most recently used
+    cache.Put({"c"}, std::make_shared<std::string>("c"), 40); // Evicts b
+
+    Assert::AreEqual(size_t{80}, cache.BytesUsed());
+    Assert::IsTrue(cache.Contains({"a"}));
+    Assert::IsFalse(cache.Contains({"b"}));
+    Assert::IsTrue(cache.Contains({"c"}));
+  }
+
+  TEST_METHOD(CacheSkipsImagesLargerThanBudget) {
+    DecodedImageCache<FakeImage> cache{100};
+    cache.Put({"a"}, std::make_shared<std::string>("a"), 40);
+    cache.Put({"huge"}, std::make_shared<std::string>("huge"), 101);
+
+    Assert::IsTrue(cache.Contains({"a"}));
+    Assert::IsFalse(cache.Contains({"huge"}));
+    Assert::AreEqual(size_t{40}, cache.BytesUsed());
+  }
+
+  TEST_METHOD(CacheReplacesExistingEntry) {
+    DecodedImageCache<FakeImage> cache{100};
+    cache.Put({"a"}, std::make_shared<std::string>("old"), 40);
+    cache.Put({"a"}, std::make_shared<std::string>("new"), 30);
+
+    Assert::AreEqual(size_t{1}, cache.Size());
+    Assert::AreEqual(size_t{30}, cache.BytesUsed());
+    Assert::AreEqual(std::string{"new"}, *cache.Get({"a"}));
+  }
+
+  TEST_METHOD(CacheShrinksWithBudget) {
+    DecodedImageCache<FakeImage> cache{100};
+    cache.Put({"a"}, std::make_shared<std::string>("a"), 40);
+    cache.Put({"b"}, std::make_shared<std::string>("b"), 40);
+    cache.SetByteBudget(50);
+
+    Assert::AreEqual(size_t{1}, cache.Size());
+    Assert::IsTrue(cache.Contains({"b"}));
+  }
+
+  TEST_METHOD(CacheTracksUrisAtAnySize) {
+    DecodedImageCache<FakeImage> cache{100};
+    cache.Put({"a", 10, 10}, std::make_shared<std::string>("a"), 40);
+    cache.Put({"a", 20, 20}, std::make_shared<std::string>("a"), 40);
+
+    Assert::IsTrue(cache.ContainsUri("a"));
+    Assert::IsFalse(cache.ContainsUri("b"));
+
+    cache.Trim(0);
+    Assert::IsFalse(cache.ContainsUri("a"));
+  }
+
+  TEST_METHOD(ConcurrentRequestsShareOneFetchAndDecode) {
+    FakeScheduler scheduler;
+    FakeFetcher fetcher;
+    auto pipeline = MakePipeline(scheduler);
+
+    std::vector<FakeImage> results;
+    auto completion = [&results](const FakeImage &image, const FakeError &) { results.push_back(image); };
+    pipeline->Request({"a", 10, 10}, fetcher.Fetcher(), MakeRequester(completion));
+    pipeline->Request({"a", 10, 10}, fetcher.Fetcher(), MakeRequester(completion));
+
+    Assert::AreEqual(1, fetcher.fetches);
+    Assert::AreEqual(size_t{1}, pipeline->InFlight());
+
+    fetcher.Succeed("pixels");
+    // Decoding only happens on the scheduler
+    Assert::AreEqual(0, fetcher.decodes);
+    Assert::IsTrue(results.empty());
+
+    scheduler.RunAll();
+    Assert::AreEqual(1, fetcher.decodes);
+    Assert::AreEqual(size_t{2}, results.size());
+    Assert::IsTrue(results[0] == results[1]);
+    Assert::AreEqual(size_t{0}, pipeline->InFlight());
+    Assert::AreEqual(uint64_t{1}, pipeline->GetStats().coalesced);
+  }
+
+  TEST_METHOD(DifferentTargetSizesDecodeSeparately) {
+    FakeScheduler scheduler;
+    FakeFetcher small;
+    FakeFetcher large;
+    auto pipeline = MakePipeline(scheduler);
+
+    pipeline->Request({"a", 10, 10}, small.Fetcher(), MakeRequester(IgnoreResult));
+    pipeline->Request({"a", 20, 20}, large.Fetcher(), MakeRequester(IgnoreResult));
+
+    Assert::AreEqual(1, small.fetches);
+    Assert::AreEqual(1, large.fetches);
+  }
+
+  TEST_METHOD(CompletedRequestsAreServedFromCache) {
+    FakeScheduler scheduler;
+    FakeFetcher fetcher;
+    auto pipeline = MakePipeline(scheduler);
+
+    pipeline->Request({"a"}, fetcher.Fetcher(), MakeRequester(IgnoreResult));
+    fetcher.Succeed("pixels");
+    scheduler.RunAll();
+
+    FakeImage cached;
+    auto cache = [&cached](const FakeImage &image, const FakeError &) { cached = image; };
+    bool synchronous = pipeline->Request({"a"}, fetcher.Fetcher(), MakeRequester(cache));
+
+    Assert::IsTrue(synchronous);
+    Assert::AreEqual(1, fetcher.fetches);
+    Assert::AreEqual(std::string{"pixels"}, *cached);
+    Assert::AreEqual(uint64_t{1}, pipeline->GetStats().cacheHits);
+  }
+
+  TEST_METHOD(PrefetchedImagesServeSizedRequests) {
+    FakeScheduler scheduler;
+    FakeFetcher fetcher;
+    auto pipeline = MakePipeline(scheduler);
+
+    // Prefetches decode at the natural size, since the display size is not known yet
+    pipeline->Request({"a"}, fetcher.Fetcher(), MakeRequester(IgnoreResult, ImageRequestPriority::Prefetch));
+    FakeImage joined;
+    auto join = [&joined](const FakeImage &image, const FakeError &) { joined = image; };
+    pipeline->Request({"a", 10, 10}, fetcher.Fetcher(), MakeRequester(join));
+    fetcher.Succeed("pixels");
+    scheduler.RunAll();
+
+    Assert::AreEqual(1, fetcher.fetches);
+    Assert::AreEqual(std::string{"pixels"}, *joined);
+
+    bool synchronous = pipeline->Request({"a", 20, 20}, fetcher.Fetcher(), MakeRequester(IgnoreResult));
+    Assert::IsTrue(synchronous);
+    Assert::AreEqual(1, fetcher.fetches);
+  }
+
+  TEST_METHOD(FailuresAreReportedToAllWaitersAndNotCached) {
+    FakeScheduler scheduler;
+    FakeFetcher fetcher;
+    auto pipeline = MakePipeline(scheduler);
+
+    int failures = 0;
+    auto completion = [&failures](const FakeImage &image, const FakeError &error) {
+      Assert::IsFalse(static_cast<bool>(image));
+      Assert::AreEqual(std::string{"bad image"}, *error);
+      failures++;
+    };
+    pipeline->Request({"a"}, fetcher.Fetcher(), MakeRequester(completion));
+    pipeline->Request({"a"}, fetcher.Fetcher(), MakeRequester(completion));
+    fetcher.Fail("bad image");
+    scheduler.RunAll();
+
+    Assert::AreEqual(2, failures);
+    Assert::AreEqual(size_t{0}, pipeline->Cache().Size());
+
+    pipeline->Request({"a"}, fetcher.Fetcher(), MakeRequester(completion));
+    Assert::AreEqual(2, fetcher.fetches);
+  }
+
+  TEST_METHOD(ProgressIsReportedToAllWaiters) {
+    FakeScheduler scheduler;
+    FakeFetcher fetcher;
+    auto pipeline = MakePipeline(scheduler);
+
+    int64_t progressA = 0;
+    int64_t progressB = 0;
+    auto requesterA = MakeRequester(IgnoreResult);
+    requesterA.progress = [&progressA](int64_t loaded, int64_t) { progressA = loaded; };
+    auto requesterB = MakeRequester(IgnoreResult);
+    requesterB.progress = [&progressB](int64_t loaded, int64_t) { progressB = loaded; };
+    pipeline->Request({"a"}, fetcher.Fetcher(), std::move(requesterA));
+    pipeline->Request({"a"}, fetcher.Fetcher(), std::move(requesterB));
+    fetcher.progress(50, 100);
+
+    Assert::AreEqual(int64_t{50}, progressA);
+    Assert::AreEqual(int64_t{50}, progressB);
+  }
+
+  TEST_METHOD(VisibleDecodesRunBeforeOffscreenAndPrefetch) {
+    FakeScheduler scheduler;
+    FakeFetcher prefetch;
+    FakeFetcher offscreen;
+    FakeFetcher visible;
+    FakeFetcher blocker;
+    auto pipeline = MakePipeline(scheduler, 100, 1);
+
+    std::vector<std::string> order;
+    auto record = [&order](const FakeImage &image, const FakeError &) { order.push_back(*image); };
+
+    // Occupy the only decode slot so the others queue up
+    pipeline->Request({"blocker"}, blocker.Fetcher(), MakeRequester(record));
+    blocker.Succeed("blocker");
+
+    pipeline->Request({"prefetch"}, prefetch.Fetcher(), MakeRequester(record, ImageRequestPriority::Prefetch));
+    pipeline->Request({"offscreen"}, offscreen.Fetcher(), MakeRequester(record, ImageRequestPriority::Offscreen));
+    pipeline->Request({"visible"}, visible.Fetcher(), MakeRequester(record, ImageRequestPriority::Visible));
+    prefetch.Succeed("prefetch");
+    offscreen.Succeed("offscreen");
+    visible.Succeed("visible");
+
+    while (!scheduler.tasks.empty()) {
+      scheduler.RunAll();
+    }
+
+    Assert::AreEqual(size_t{4}, order.size());
+    Assert::AreEqual(std::string{"blocker"}, order[0]);
+    Assert::AreEqual(std::string{"visible"}, order[1]);
+    Assert::AreEqual(std::string{"offscreen"}, order[2]);
+    Assert::AreEqual(std::string{"prefetch"}, order[3]);
+  }
+
+  TEST_METHOD(SetPriorityReordersQueuedDecodes) {
+    FakeScheduler scheduler;
+    FakeFetcher a;
+    FakeFetcher b;
+    FakeFetcher blocker;
+    auto pipeline = MakePipeline(scheduler, 100, 1);
+
+    std::vector<std::string> order;
+    auto record = [&order](const FakeImage &image, const FakeError &) { order.push_back(*image); };
+    int ownerA;
+    int ownerB;
+
+    pipeline->Request({"blocker"}, blocker.Fetcher(), MakeRequester(record));
+    blocker.Succeed("blocker");
+    pipeline->Request({"a"}, a.Fetcher(), MakeRequester(record, ImageRequestPriority::Visible, &ownerA));
+    pipeline->Request({"b"}, b.Fetcher(), MakeRequester(record, ImageRequestPriority::Offscreen, &ownerB));
+    a.Succeed("a");
+    b.Succeed("b");
+
+    // a scrolled off screen while b scrolled on
+    pipeline->SetPriority(&ownerA, ImageRequestPriority::Offscreen);
+    pipeline->SetPriority(&ownerB, ImageRequestPriority::Visible);
+
+    while (!scheduler.tasks.empty()) {
+      scheduler.RunAll();
+    }
+
+    Assert::AreEqual(std::string{"b"}, order[1]);
+    Assert::AreEqual(std::string{"a"}, order[2]);
+  }
+
+  TEST_METHOD(CancelledRequestsAreNotDecoded) {
+    FakeScheduler scheduler;
+    FakeFetcher fetcher;
+    auto pipeline = MakePipeline(scheduler);
+
+    int completions = 0;
+    int owner;
+    auto completion = [&completions](const FakeImage &, const FakeError &) { completions++; };
+    pipeline->Request({"a"}, fetcher.Fetcher(), MakeRequester(completion, ImageRequestPriority::Visible, &owner));
+    pipeline->Cancel(&owner);
+    fetcher.Succeed("pixels");
+    scheduler.RunAll();
+
+    Assert::AreEqual(0, completions);
+    Assert::AreEqual(0, fetcher.decodes);
+    Assert::AreEqual(size_t{0}, pipeline->InFlight());
+    Assert::AreEqual(uint64_t{1}, pipeline->GetStats().cancelledDecodes);
+  }
+
+  TEST_METHOD(CancelKeepsDecodeForOtherWaiters) {
+    FakeScheduler scheduler;
+    FakeFetcher fetcher;
+    auto pipeline = MakePipeline(scheduler);
+
+    int completions = 0;
+    auto completion = [&completions](const FakeImage &, const FakeError &) { completions++; };
+    int owner;
+    pipeline->Request({"a"}, fetcher.Fetcher(), MakeRequester(completion, ImageRequestPriority::Visible, &owner));
+    pipeline->Request({"a"}, fetcher.Fetcher(), MakeRequester(completion));
+    pipeline->Cancel(&owner);
+    fetcher.Succeed("pixels");
+    scheduler.RunAll();
+
+    Assert::AreEqual(1, completions);
+    Assert::AreEqual(1, fetcher.decodes);
+  }
+
+  TEST_METHOD(UnwantedRequestsAreDroppedBeforeDecoding) {
+    FakeScheduler scheduler;
+    FakeFetcher fetcher;
+    auto pipeline = MakePipeline(scheduler);
+
+    bool wanted = true;
+    auto requester = MakeRequester(IgnoreResult);
+    requester.isWanted = [&wanted]() { return wanted; };
+    pipeline->Request({"a"}, fetcher.Fetcher(), std::move(requester));
+
+    // ex: the view that requested the image was destroyed while it was downloading
+    wanted = false;
+    fetcher.Succeed("pixels");
+    scheduler.RunAll();
+
+    Assert::AreEqual(0, fetcher.decodes);
+    Assert::AreEqual(size_t{0}, pipeline->InFlight());
+  }
+
+  TEST_METHOD(MemoryPressureTrimsCache) {
+    FakeScheduler scheduler;
+    auto pipeline = MakePipeline(scheduler, 100);
+    pipeline->Cache().Put({"a"}, std::make_shared<std::string>("a"), 30);
+    pipeline->Cache().Put({"b"}, std::make_shared<std::string>("b"), 30);
+
+    pipeline->OnMemoryPressure(ImageMemoryPressure::Moderate);
+    Assert::AreEqual(size_t{30}, pipeline->Cache().BytesUsed());
+    Assert::IsTrue(pipeline->Cache().Contains({"b"}));
+
+    pipeline->OnMemoryPressure(ImageMemoryPressure::Critical);
+    Assert::AreEqual(size_t{0}, pipeline->Cache().BytesUsed());
+  }
+
+  TEST_METHOD(MemoryChecksAreThrottled) {
+    MemoryCheckThrottle throttle{1000};
+
+    Assert::IsTrue(throttle.TryStart(0));
+    Assert::IsFalse(throttle.TryStart(0));
+    Assert::IsFalse(throttle.TryStart(999));
+    Assert::IsTrue(throttle.TryStart(1000));
+    Assert::IsFalse(throttle.TryStart(1500));
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,354 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <BaseScriptStoreImpl.h>
+#include <BundleFilePath.h>
+#include <CppUnitTest.h>
+#include <IndexedBundle.h>
+#include <SegmentedBundleRegistry.h>
+
+// Standard Library
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <unordered_map>
+
+using namespace facebook::jsi;
+using namespace Microsoft::ReactNative;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using std::make_shared;
+
+namespace {
+
+void Append32(std::string &bundle, uint32_t value) {
+  bundle.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+// Lays out an indexed bundle the same way as Scripts/make-indexed-bundle.js.
+std::string MakeIndexedBundle(const std::string &startupCode, const std::map<uint32_t, std::string> &modules) {
+  const uint32_t moduleCount = modules.empty() ? 0 : modules.rbegin()->first + 1;
+
+  std::string header;
+  Append32(header, IndexedBundleMagic);
+  Append32(header, moduleCount);
+  Append32(header, static_cast<uint32_t>(startupCode.size() + 1));
+
+  std::string code = startupCode + '\0';
+  for (uint32_t moduleId = 0; moduleId < moduleCount; moduleId++) {
+    auto it = modules.find(moduleId);
+    if (it == modules.end()) {
+      Append32(header, 0);
+      Append32(header, 0);
+    } else {
+      Append32(header, static_cast<uint32_t>(code.size()));
+      Append32(header, static_cast<uint32_t>(it->second.size() + 1));
+      code += it->second + '\0';
+    }
+  }
+
+  return header + code;
+}
+
+std::string BufferToString(const std::shared_ptr<const Buffer> &buffer) {
+  return std::string(reinterpret_cast<const char *>(buffer->data()), buffer->size());
+}
+
+class StringBuffer : public Buffer {
+ public:
+  StringBuffer(std::string value) : m_value(std::move(value)) {}
+
+  size_t size() const override {
+    return m_value.size();
+  }
+
+  const uint8_t *data() const override {
+    return reinterpret_cast<const uint8_t *>(m_value.data());
+  }
+
+ private:
+  std::string m_value;
+};
+
+// Serves scripts from memory and counts how many times each was loaded.
+class InMemoryScriptStore : public ScriptStore {
+ public:
+  VersionedBuffer getVersionedScript(const std::string &url) noexcept override {
+    loads[url]++;
+    auto it = scripts.find(url);
+    if (it == scripts.end()) {
+      return {nullptr, 0};
+    }
+    return {make_shared<StringBuffer>(it->second), 1};
+  }
+
+  ScriptVersion_t getScriptVersion(const std::string &url) noexcept override {
+    return scripts.count(url) ? 1 : 0;
+  }
+
+  std::unordered_map<std::string, std::string> scripts;
+  std::unordered_map<std::string, int> loads;
+};
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (IndexedBundleTest) {
+  TEST_METHOD(ParsesStartupCodeAndModules) {
+    const auto bundle = MakeIndexedBundle("__r(0);", {{0, "__d(function () {}, 0, []);"}, {2, "__d(x, 2, []);"}});
+
+    IndexedBundle indexedBundle;
+    Assert::IsTrue(indexedBundle.Parse(reinterpret_cast<const uint8_t *>(bundle.data()), bundle.size()));
+    Assert::AreEqual(3u, indexedBundle.ModuleCount());
+    Assert::AreEqual(std::string{"__r(0);"}, std::string{indexedBundle.StartupCode()});
+    Assert::AreEqual('\0', indexedBundle.StartupCode().data()[indexedBundle.StartupCode().size()]);
+    Assert::AreEqual(std::string{"__d(function () {}, 0, []);"}, std::string{indexedBundle.Module(0)});
+    Assert::AreEqual(std::string{"__d(x, 2, []);"}, std::string{indexedBundle.Module(2)});
+  }
+
+  TEST_METHOD(MissingModulesAreEmpty) {
+    const auto bundle = MakeIndexedBundle("", {{1, "__d(x, 1, []);"}});
+
+    IndexedBundle indexedBundle;
+    Assert::IsTrue(indexedBundle.Parse(reinterpret_cast<const uint8_t *>(bundle.data()), bundle.size()));
+    Assert::IsTrue(indexedBundle.StartupCode().empty());
+    Assert::IsTrue(indexedBundle.Module(0).empty());
+    Assert::IsFalse(indexedBundle.Module(1).empty());
+    Assert::IsTrue(indexedBundle.Module(2).empty());
+  }
+
+  TEST_METHOD(RejectsMalformedBundles) {
+    const auto bundle = MakeIndexedBundle("__r(0);", {{0, "__d(x, 0, []);"}});
+    auto parses = [](const std::string &value) {
+      IndexedBundle indexedBundle;
+      return indexedBundle.Parse(reinterpret_cast<const uint8_t *>(value.data()), value.size());
+    };
+
+    Assert::IsTrue(parses(bundle));
+    Assert::IsFalse(parses("var x = 1;"));
+    Assert::IsFalse(parses(bundle.substr(0, IndexedBundle::HeaderSize + 4)));
+    Assert::IsFalse(parses(bundle.substr(0, bundle.size() - 1)));
+
+    auto unterminated = bundle;
+    unterminated[IndexedBundle::HeaderSize + IndexedBundle::TableEntrySize + 7] = ';';
+    Assert::IsFalse(parses(unterminated));
+  }
+
+  TEST_METHOD(ParsesModuleRangesPastThePrefix) {
+    const auto bundle = MakeIndexedBundle("__r(0);", {{0, "__d(x, 0, []);"}, {2, "__d(y, 2, []);"}});
+    const auto data = reinterpret_cast<const uint8_t *>(bundle.data());
+    const auto prefixSize = static_cast<size_t>(IndexedBundle::PrefixSize(data));
+    Assert::AreEqual(IndexedBundle::HeaderSize + 3 * IndexedBundle::TableEntrySize + 8, prefixSize);
+
+    IndexedBundle indexedBundle;
+    Assert::IsTrue(indexedBundle.Parse(data, prefixSize, bundle.size()));
+    Assert::AreEqual(std::string{"__r(0);"}, std::string{indexedBundle.StartupCode()});
+
+    // Module bodies are not in the parsed data, only their ranges are known
+    Assert::IsTrue(indexedBundle.Module(0).empty());
+    uint64_t offset;
+    uint32_t length;
+    Assert::IsTrue(indexedBundle.ModuleRange(2, offset, length));
+    Assert::AreEqual(std::string{"__d(y, 2, []);"}, bundle.substr(static_cast<size_t>(offset), length - 1));
+    Assert::IsFalse(indexedBundle.ModuleRange(1, offset, length));
+    Assert::IsFalse(indexedBundle.ModuleRange(3, offset, length));
+
+    // The module table still has to fit in the bundle
+    Assert::IsFalse(indexedBundle.Parse(data, prefixSize, bundle.size() - 1));
+  }
+
+  TEST_METHOD(DefaultSegmentUrlIsNextToMainBundle) {
+    Assert::AreEqual(
+        std::string{"C:\\app\\index.windows.2.bundle"},
+        SegmentedBundleRegistry::GetDefaultSegmentUrl("C:\\app\\index.windows.bundle", 2));
+    Assert::AreEqual(
+        std::string{"C:\\app.v1\\index.1"}, SegmentedBundleRegistry::GetDefaultSegmentUrl("C:\\app.v1\\index", 1));
+  }
+};
+
+TEST_CLASS (BundleRootFolderTest) {
+  static std::filesystem::path ApplicationFolderPath(ApplicationFolder folder) {
+    switch (folder) {
+      case ApplicationFolder::Installed:
+        return L"C:\\Program Files\\WindowsApps\\App";
+      case ApplicationFolder::Local:
+        return L"C:\\Users\\user\\AppData\\Local\\Packages\\App\\LocalState";
+      default:
+        // The application has no such folder
+        return {};
+    }
+  }
+
+  TEST_METHOD(ResolvesAppxRoot) {
+    // The default bundle root path
+    const auto folder = BundleRootFolder("ms-appx:///Bundle/", ApplicationFolderPath);
+    Assert::AreEqual(
+        std::wstring{L"C:\\Program Files\\WindowsApps\\App\\Bundle\\index.windows.bundle"},
+        (folder / "index.windows.bundle").make_preferred().wstring());
+
+    Assert::AreEqual(
+        std::wstring{L"C:\\Program Files\\WindowsApps\\App\\My Bundles\\"},
+        BundleRootFolder("MS-APPX:///My%20Bundles/", ApplicationFolderPath).make_preferred().wstring());
+  }
+
+  TEST_METHOD(ResolvesAppDataRoot) {
+    Assert::AreEqual(
+        std::wstring{L"C:\\Users\\user\\AppData\\Local\\Packages\\App\\LocalState\\bundles\\"},
+        BundleRootFolder("ms-appdata:///local/bundles/", ApplicationFolderPath).make_preferred().wstring());
+
+    // Folders the application does not have are not resolved
+    Assert::IsTrue(BundleRootFolder("ms-appdata:///roaming/bundles/", ApplicationFolderPath).empty());
+  }
+
+  TEST_METHOD(KeepsFolderPathsAndSkipsOtherSchemes) {
+    Assert::AreEqual(
+        std::wstring{L"C:\\app\\Bundle"}, BundleRootFolder("C:\\app\\Bundle", ApplicationFolderPath).wstring());
+    Assert::IsTrue(BundleRootFolder("resource://app.exe/", ApplicationFolderPath).empty());
+    Assert::IsTrue(BundleRootFolder("https://example.com/", ApplicationFolderPath).empty());
+  }
+};
+
+TEST_CLASS (SegmentedBundleRegistryTest) {
+  TEST_METHOD(LoadsSegmentsOnFirstRequire) {
+    auto scriptStore = make_shared<InMemoryScriptStore>();
+    scriptStore->scripts["app/index.1.bundle"] = MakeIndexedBundle("", {{3, "__d(y, 65539, []);"}});
+    SegmentedBundleRegistry registry(scriptStore);
+
+    auto startupCode = registry.LoadMainSegment(
+        make_shared<StringBuffer>(MakeIndexedBundle("__r(0);", {{0, "__d(x, 0, []);"}})), "app/index.bundle");
+    Assert::IsNotNull(startupCode.get());
+    Assert::AreEqual(std::string{"__r(0);"}, std::string(startupCode->c_str(), startupCode->size()));
+
+    Assert::AreEqual(std::string{"__d(x, 0, []);"}, BufferToString(registry.GetModule(0, 0)));
+    Assert::IsNull(registry.GetModule(0, 1).get());
+    Assert::AreEqual(0, scriptStore->loads["app/index.1.bundle"]);
+
+    Assert::AreEqual(std::string{"__d(y, 65539, []);"}, BufferToString(registry.GetModule(1, 3)));
+    Assert::IsNull(registry.GetModule(1, 0).get());
+    Assert::AreEqual(1, scriptStore->loads["app/index.1.bundle"]);
+  }
+
+  TEST_METHOD(LoadsRegisteredSegments) {
+    auto scriptStore = make_shared<InMemoryScriptStore>();
+    scriptStore->scripts["lazy/feature.bundle"] = MakeIndexedBundle("", {{0, "__d(z, 131072, []);"}});
+    SegmentedBundleRegistry registry(scriptStore);
+    registry.LoadMainSegment(make_shared<StringBuffer>(MakeIndexedBundle("", {})), "app/index.bundle");
+    registry.RegisterSegment(2, "lazy/feature.bundle");
+
+    Assert::AreEqual(std::string{"__d(z, 131072, []);"}, BufferToString(registry.GetModule(2, 0)));
+
+    auto threw = false;
+    try {
+      registry.GetModule(3, 0);
+    } catch (const std::runtime_error &) {
+      threw = true;
+    }
+    Assert::IsTrue(threw);
+  }
+
+  TEST_METHOD(MapsSegmentsTheScriptStoreDoesNotLoad) {
+    const auto bundlePath = (std::filesystem::temp_directory_path() / "IndexedBundleWindows.bundle").string();
+    std::map<uint32_t, std::string> modules;
+    modules[0] = "__d(x, 0, []);";
+    // Past the allocation granularity, so that its window does not start at the start of the file
+    modules[1] = std::string(128 * 1024, ' ') + "__d(y, 1, []);";
+    std::ofstream(bundlePath, std::ios::binary | std::ios::trunc) << MakeIndexedBundle("__r(0);", modules);
+
+    {
+      // The in memory store has no scripts, like the script store with files too large for the address space
+      auto scriptStore = make_shared<InMemoryScriptStore>();
+      SegmentedBundleRegistry registry(scriptStore);
+
+      auto startupCode = registry.LoadMainSegment(bundlePath);
+      Assert::IsNotNull(startupCode.get());
+      Assert::AreEqual(std::string{"__r(0);"}, std::string(startupCode->c_str(), startupCode->size()));
+      Assert::AreEqual(modules[0], BufferToString(registry.GetModule(0, 0)));
+      Assert::AreEqual(modules[1], BufferToString(registry.GetModule(0, 1)));
+      Assert::IsNull(registry.GetModule(0, 2).get());
+      Assert::AreEqual(1, scriptStore->loads[bundlePath]);
+    }
+
+    std::filesystem::remove(bundlePath);
+  }
+
+  TEST_METHOD(IgnoresRegularBundles) {
+    auto scriptStore = make_shared<InMemoryScriptStore>();
+    SegmentedBundleRegistry registry(scriptStore);
+
+    Assert::IsNull(registry.LoadMainSegment(make_shared<StringBuffer>("__r(0);"), "app/index.bundle").get());
+    Assert::IsNull(registry.GetModule(0, 0).get());
+    Assert::IsNull(registry.GetModule(1, 0).get());
+    Assert::IsTrue(scriptStore->loads.empty());
+  }
+
+  // Do not run this test in parallel with others.
+  // Compares the time to first eval of regular and indexed bundles of growing size, memory mapped by the script store:
+  // a regular bundle is read whole before it is evaluated, an indexed bundle only needs its startup code and the
+  // modules required during startup, here a fixed set of 200 modules.
+  TEST_METHOD(BenchmarkStartupAgainstBundleSize) {
+    constexpr size_t moduleSize = 4 * 1024;
+    constexpr uint32_t startupModuleCount = 200;
+    const auto bundleDirectory = std::filesystem::temp_directory_path();
+
+    std::string message;
+    for (const size_t bundleSizeInMB : {4, 16, 64}) {
+      const auto moduleCount = static_cast<uint32_t>(bundleSizeInMB * 1024 * 1024 / moduleSize);
+
+      std::map<uint32_t, std::string> modules;
+      std::string regularBundle = "__r(0);\n";
+      for (uint32_t moduleId = 0; moduleId < moduleCount; moduleId++) {
+        auto &body = modules[moduleId];
+        body.assign(moduleSize, static_cast<char>('a' + moduleId % 26));
+        regularBundle += body + '\n';
+      }
+
+      const auto regularPath = (bundleDirectory / "IndexedBundleBenchmark.regular.bundle").string();
+      const auto indexedPath = (bundleDirectory / "IndexedBundleBenchmark.indexed.bundle").string();
+      std::ofstream(regularPath, std::ios::binary | std::ios::trunc) << regularBundle;
+      std::ofstream(indexedPath, std::ios::binary | std::ios::trunc) << MakeIndexedBundle("__r(0);", modules);
+
+      const auto regularStart = std::chrono::steady_clock::now();
+      {
+        auto script = facebook::react::BaseScriptStoreImpl().getVersionedScript(regularPath);
+        // Stands in for the parser, touch every page of the bundle
+        uint64_t checksum = 0;
+        for (size_t i = 0; i < script.buffer->size(); i += 64) {
+          checksum += script.buffer->data()[i];
+        }
+        Assert::AreNotEqual(uint64_t{0}, checksum);
+      }
+      const auto regularMs =
+          std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - regularStart).count();
+
+      const auto indexedStart = std::chrono::steady_clock::now();
+      {
+        SegmentedBundleRegistry registry(make_shared<facebook::react::BaseScriptStoreImpl>());
+        auto startupCode = registry.LoadMainSegment(indexedPath);
+        Assert::IsNotNull(startupCode.get());
+        uint64_t checksum = 0;
+        for (uint32_t moduleId = 0; moduleId < startupModuleCount; moduleId++) {
+          auto body = registry.GetModule(0, moduleId * (moduleCount / startupModuleCount));
+          for (size_t i = 0; i < body->size(); i += 64) {
+            checksum += body->data()[i];
+          }
+        }
+        Assert::AreNotEqual(uint64_t{0}, checksum);
+      }
+      const auto indexedMs =
+          std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - indexedStart).count();
+
+      std::filesystem::remove(regularPath);
+      std::filesystem::remove(indexedPath);
+
+      message += std::to_string(bundleSizeInMB) + " MB bundle: regular " + std::to_string(regularMs) +
+          "ms to first eval, indexed " + std::to_string(indexedMs) + "ms\n";
+    }
+
+    Logger::WriteMessage(message.c_str());
+  }
+};
+
+} // namespace Microsoft::React::Test
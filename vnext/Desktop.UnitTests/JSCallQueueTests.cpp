@@ -0,0 +1,194 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <JSCallQueue.h>
+
+// Standard Library
+#include <string>
+#include <vector>
+
+using namespace Microsoft::ReactNative;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using PushResult = JSCallQueue::PushResult;
+
+namespace {
+
+std::vector<std::string> PopSources(JSCallQueue &queue, size_t maxCount) {
+  std::vector<std::string> sources;
+  for (const auto &call : queue.PopBatch(maxCount)) {
+    sources.push_back(call.ModuleName + "." + call.MethodName);
+  }
+  return sources;
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (JSCallQueueTest) {
+  TEST_METHOD(DispatchesCallsOfASourceInOrder) {
+    JSCallQueue queue;
+    for (int i = 0; i < 3; i++) {
+      queue.Push("JSTimers", "callTimers", folly::dynamic::array(i));
+    }
+
+    const auto calls = queue.PopBatch(10);
+    Assert::AreEqual(size_t{3}, calls.size());
+    for (int i = 0; i < 3; i++) {
+      Assert::AreEqual(static_cast<int64_t>(i), calls[i].Args[0].getInt());
+    }
+    Assert::IsTrue(queue.IsEmpty());
+  }
+
+  TEST_METHOD(DispatchesCallsOfAllSourcesInOrder) {
+    JSCallQueue queue;
+    queue.Push("RCTDeviceEventEmitter", "emit", folly::dynamic::array("sensorChanged", 1));
+    queue.Push("JSTimers", "callTimers", folly::dynamic::array());
+    queue.Push("RCTDeviceEventEmitter", "emit", folly::dynamic::array("url", "app://home"));
+    queue.Push("RCTEventEmitter", "receiveEvent", folly::dynamic::array(1, "topClick", folly::dynamic::object()));
+    queue.Push("RCTDeviceEventEmitter", "emit", folly::dynamic::array("sensorChanged", 2));
+
+    Assert::IsTrue(
+        std::vector<std::string>{
+            "RCTDeviceEventEmitter.emit",
+            "JSTimers.callTimers",
+            "RCTDeviceEventEmitter.emit",
+            "RCTEventEmitter.receiveEvent"} == PopSources(queue, 4));
+    Assert::AreEqual(size_t{1}, queue.Metrics().Depth);
+    Assert::AreEqual(int64_t{2}, queue.PopBatch(1)[0].Args[1].getInt());
+  }
+
+  TEST_METHOD(DropsTheCallsOfABurstRatherThanOtherSources) {
+    JSCallQueue queue{JSCallQueue::Options{/*MaxDepth:*/ 100, /*MaxDepthPerSource:*/ 10}};
+    for (int i = 0; i < 50; i++) {
+      queue.Push("ChattyModule", "update", folly::dynamic::array(i));
+    }
+
+    Assert::IsTrue(
+        PushResult::Queued ==
+        queue.Push("RCTEventEmitter", "receiveEvent", folly::dynamic::array(1, "topClick", folly::dynamic::object())));
+    Assert::AreEqual(uint64_t{40}, queue.Metrics().DroppedCount);
+
+    // The source has room again once its calls are dispatched.
+    queue.PopBatch(5);
+    Assert::IsTrue(PushResult::Queued == queue.Push("ChattyModule", "update", folly::dynamic::array(50)));
+  }
+
+  TEST_METHOD(DropsCallsOverQuota) {
+    JSCallQueue queue{JSCallQueue::Options{/*MaxDepth:*/ 5, /*MaxDepthPerSource:*/ 3}};
+    for (int i = 0; i < 3; i++) {
+      Assert::IsTrue(PushResult::Queued == queue.Push("ChattyModule", "update", folly::dynamic::array(i)));
+    }
+    Assert::IsTrue(PushResult::Dropped == queue.Push("ChattyModule", "update", folly::dynamic::array(3)));
+
+    Assert::IsTrue(PushResult::Queued == queue.Push("AppRegistry", "runApplication", folly::dynamic::array()));
+    Assert::IsTrue(PushResult::Queued == queue.Push("JSTimers", "callTimers", folly::dynamic::array()));
+    Assert::IsTrue(PushResult::Dropped == queue.Push("HMRClient", "setup", folly::dynamic::array()));
+
+    Assert::AreEqual(uint64_t{2}, queue.Metrics().DroppedCount);
+    Assert::AreEqual(size_t{5}, queue.Metrics().Depth);
+  }
+
+  TEST_METHOD(DoesNotDropLifecycleCalls) {
+    JSCallQueue queue{JSCallQueue::Options{/*MaxDepth:*/ 2, /*MaxDepthPerSource:*/ 1}};
+    queue.Push("ChattyModule", "update", folly::dynamic::array());
+    queue.Push("JSTimers", "callTimers", folly::dynamic::array());
+
+    Assert::IsTrue(PushResult::Queued == queue.Push("AppRegistry", "runApplication", folly::dynamic::array()));
+    Assert::IsTrue(
+        PushResult::Queued ==
+        queue.Push("AppRegistry", "unmountApplicationComponentAtRootTag", folly::dynamic::array(1)));
+
+    Assert::AreEqual(uint64_t{0}, queue.Metrics().DroppedCount);
+    Assert::IsTrue(
+        std::vector<std::string>{
+            "ChattyModule.update",
+            "JSTimers.callTimers",
+            "AppRegistry.runApplication",
+            "AppRegistry.unmountApplicationComponentAtRootTag"} == PopSources(queue, 10));
+  }
+
+  TEST_METHOD(CoalescesIdempotentCalls) {
+    JSCallQueue queue;
+    queue.Push("RCTDeviceEventEmitter", "emit", folly::dynamic::array("didUpdateDimensions", 100), true);
+    queue.Push("RCTDeviceEventEmitter", "emit", folly::dynamic::array("url", "app://home"), true);
+    Assert::IsTrue(
+        PushResult::Coalesced ==
+        queue.Push("RCTDeviceEventEmitter", "emit", folly::dynamic::array("didUpdateDimensions", 200), true));
+    // Calls that are not idempotent are not coalesced.
+    Assert::IsTrue(
+        PushResult::Queued ==
+        queue.Push("RCTDeviceEventEmitter", "emit", folly::dynamic::array("didUpdateDimensions", 300)));
+
+    const auto calls = queue.PopBatch(10);
+    Assert::AreEqual(size_t{3}, calls.size());
+    Assert::AreEqual(int64_t{200}, calls[0].Args[1].getInt());
+    Assert::AreEqual(int64_t{300}, calls[2].Args[1].getInt());
+    Assert::AreEqual(uint64_t{1}, queue.Metrics().CoalescedCount);
+
+    // Dispatched calls are no longer coalesced.
+    Assert::IsTrue(
+        PushResult::Queued ==
+        queue.Push("RCTDeviceEventEmitter", "emit", folly::dynamic::array("didUpdateDimensions", 400), true));
+  }
+
+  TEST_METHOD(CoalescesEventsPerView) {
+    JSCallQueue queue;
+    queue.Push("RCTEventEmitter", "receiveEvent", folly::dynamic::array(1, "topScroll", 10), true);
+    queue.Push("RCTEventEmitter", "receiveEvent", folly::dynamic::array(2, "topScroll", 10), true);
+    queue.Push("RCTEventEmitter", "receiveEvent", folly::dynamic::array(1, "topScroll", 20), true);
+
+    const auto calls = queue.PopBatch(10);
+    Assert::AreEqual(size_t{2}, calls.size());
+    Assert::AreEqual(int64_t{20}, calls[0].Args[2].getInt());
+  }
+
+  TEST_METHOD(RecordsMetrics) {
+    JSCallQueue queue;
+    for (int i = 0; i < 4; i++) {
+      queue.Push("JSTimers", "callTimers", folly::dynamic::array(i));
+    }
+    queue.PopBatch(3);
+
+    const auto &metrics = queue.Metrics();
+    Assert::AreEqual(size_t{1}, metrics.Depth);
+    Assert::AreEqual(size_t{4}, metrics.MaxDepth);
+    Assert::AreEqual(uint64_t{4}, metrics.QueuedCount);
+    Assert::AreEqual(uint64_t{3}, metrics.DispatchedCount);
+    Assert::IsTrue(metrics.TotalLatencyMs >= 0);
+    Assert::IsTrue(metrics.MaxLatencyMs <= metrics.TotalLatencyMs);
+  }
+
+  TEST_METHOD(DispatchesDirectlyWhileEmptyAndUnderQuota) {
+    JSCallQueue queue{JSCallQueue::Options{/*MaxDepth:*/ 100, /*MaxDepthPerSource:*/ 10, /*MaxDirectDispatches:*/ 2}};
+    Assert::IsTrue(queue.TryDispatchDirectly());
+    Assert::IsTrue(queue.TryDispatchDirectly());
+    // Over quota until the next batch.
+    Assert::IsFalse(queue.TryDispatchDirectly());
+    queue.Push("JSTimers", "callTimers", folly::dynamic::array());
+
+    // Calls wait behind the queued calls.
+    queue.PopBatch(0);
+    Assert::IsFalse(queue.TryDispatchDirectly());
+
+    Assert::AreEqual(size_t{1}, queue.PopBatch(10).size());
+    Assert::IsTrue(queue.TryDispatchDirectly());
+    Assert::AreEqual(uint64_t{3}, queue.Metrics().DirectDispatchCount);
+    Assert::AreEqual(uint64_t{4}, queue.Metrics().DispatchedCount);
+  }
+
+  TEST_METHOD(TakeAllEmptiesTheQueue) {
+    JSCallQueue queue;
+    queue.Push("JSTimers", "callTimers", folly::dynamic::array(), true);
+    queue.Push("AppRegistry", "runApplication", folly::dynamic::array());
+
+    Assert::AreEqual(size_t{2}, queue.TakeAll().size());
+    Assert::IsTrue(queue.IsEmpty());
+    Assert::AreEqual(uint64_t{0}, queue.Metrics().DispatchedCount);
+    Assert::IsTrue(PushResult::Queued == queue.Push("JSTimers", "callTimers", folly::dynamic::array(), true));
+  }
+};
+
+} // namespace Microsoft::React::Test
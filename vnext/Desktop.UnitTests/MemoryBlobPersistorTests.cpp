@@ -0,0 +1,98 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <Networking/DefaultBlobResource.h>
+
+// Standard Library
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using Microsoft::React::BlobView;
+using Microsoft::React::Networking::MemoryBlobPersistor;
+using std::string;
+using std::vector;
+
+namespace {
+
+vector<uint8_t> Pattern(size_t size, uint8_t seed) {
+  vector<uint8_t> bytes(size);
+  for (size_t i = 0; i < size; i++) {
+    bytes[i] = static_cast<uint8_t>(seed + i * 7);
+  }
+  return bytes;
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (MemoryBlobPersistorTest) {
+  TEST_METHOD(StoresAndResolvesBlobs) {
+    MemoryBlobPersistor persistor;
+    vector<string> blobIds;
+    for (uint8_t i = 0; i < 100; i++) {
+      blobIds.push_back(persistor.StoreMessage(Pattern(64, i)));
+    }
+
+    for (uint8_t i = 0; i < 100; i++) {
+      const auto expected = Pattern(64, i);
+      const auto slice = persistor.ResolveMessage(string{blobIds[i]}, 8, 16);
+      Assert::IsTrue(vector<uint8_t>(expected.cbegin() + 8, expected.cbegin() + 24) == slice.ToVector());
+    }
+
+    persistor.RemoveMessage(string{blobIds[0]});
+    Assert::ExpectException<std::invalid_argument>([&]() { persistor.ResolveMessage(string{blobIds[0]}, 0, 1); });
+    Assert::ExpectException<std::out_of_range>([&]() { persistor.ResolveMessage(string{blobIds[1]}, 60, 8); });
+    Assert::IsTrue(persistor.ResolveMessage(string{blobIds[1]}, 0, 0).Empty());
+  }
+
+  TEST_METHOD(ComposedBlobsShareChunks) {
+    MemoryBlobPersistor persistor;
+    const auto blobId = persistor.StoreMessage(Pattern(1000, 1));
+
+    BlobView composed;
+    composed.Append(persistor.ResolveMessage(string{blobId}, 500, 500));
+    composed.Append(persistor.ResolveMessage(string{blobId}, 0, 500));
+    persistor.StoreView(std::move(composed), "composed");
+
+    const auto resolved = persistor.ResolveMessage("composed", 0, 1000);
+    Assert::AreEqual(size_t{2}, resolved.Segments().size());
+    Assert::IsTrue(
+        resolved.Segments()[0].Chunk == persistor.ResolveMessage(string{blobId}, 0, 1).Segments()[0].Chunk);
+    Assert::AreEqual(size_t{1000}, persistor.MemoryUsage());
+  }
+
+  TEST_METHOD(ViewsKeepReleasedBlobsAlive) {
+    MemoryBlobPersistor persistor;
+    const auto blobId = persistor.StoreMessage(Pattern(100, 3));
+
+    auto view = persistor.ResolveMessage(string{blobId}, 0, 100);
+    persistor.RemoveMessage(string{blobId});
+    Assert::AreEqual(size_t{100}, persistor.MemoryUsage());
+    Assert::IsTrue(Pattern(100, 3) == view.ToVector());
+
+    view = {};
+    Assert::AreEqual(size_t{0}, persistor.MemoryUsage());
+  }
+
+  TEST_METHOD(SpillsLargeMessagesOverBudget) {
+    MemoryBlobPersistor persistor{MemoryBlobPersistor::Options{/*MemoryBudget:*/ 1024, /*SpillThreshold:*/ 4096}};
+
+    const auto smallId = persistor.StoreMessage(Pattern(1000, 5));
+    const auto largeId = persistor.StoreMessage(Pattern(64 * 1024, 9));
+    Assert::AreEqual(size_t{1000}, persistor.MemoryUsage());
+
+    Assert::IsTrue(Pattern(64 * 1024, 9) == persistor.ResolveMessage(string{largeId}, 0, 64 * 1024).ToVector());
+    Assert::IsTrue(Pattern(1000, 5) == persistor.ResolveMessage(string{smallId}, 0, 1000).ToVector());
+
+    persistor.RemoveMessage(string{largeId});
+    Assert::AreEqual(size_t{1000}, persistor.MemoryUsage());
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -16,6 +16,7 @@ using facebook::jsi::Buffer;
 using facebook::jsi::JSINativeException;
 using Microsoft::Common::Utilities::CheckedReinterpretCast;
 using Microsoft::JSI::MakeMemoryMappedBuffer;
+using Microsoft::JSI::MakeMemoryMappedWindow;
 using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
 
 namespace {
@@ -40,6 +41,12 @@ uint32_t GetPageSize() noexcept {
   return systemInfo.dwPageSize;
 }
 
+uint32_t GetAllocationGranularity() noexcept {
+  SYSTEM_INFO systemInfo;
+  GetSystemInfo(&systemInfo);
+  return systemInfo.dwAllocationGranularity;
+}
+
 } // anonymous namespace
 
 namespace Microsoft::JSI::Test {
@@ -128,6 +135,26 @@ TEST_CLASS (MemoryMappedBufferUnitTests) {
     Assert::IsTrue(strcmp(CheckedReinterpretCast<const char *>(buffer->data()), content.c_str() + fileOffset) == 0);
   }
 
+  TEST_METHOD(WindowTest_UnalignedOffset) {
+    std::string content(2 * GetAllocationGranularity(), 'a');
+    content.replace(GetAllocationGranularity() + 7, 11, "interesting");
+    WriteTestFile(content.c_str(), content.length());
+
+    std::shared_ptr<Buffer> buffer = MakeMemoryMappedWindow(m_testFileName.c_str(), GetAllocationGranularity() + 7, 11);
+
+    Assert::IsTrue(buffer->size() == 11);
+    Assert::IsTrue(memcmp(buffer->data(), "interesting", 11) == 0);
+  }
+
+  TEST_METHOD(ErrorTest_WindowPastEndOfFile) {
+    WriteTestFile("abc", 3);
+
+    Assert::ExpectException<JSINativeException>(
+        [this] { std::shared_ptr<Buffer> buffer = MakeMemoryMappedWindow(m_testFileName.c_str(), 1, 3); });
+    Assert::ExpectException<JSINativeException>(
+        [this] { std::shared_ptr<Buffer> buffer = MakeMemoryMappedWindow(m_testFileName.c_str(), 1, 0); });
+  }
+
   TEST_METHOD(ErrorTest_NullptrFileName) {
     Assert::ExpectException<JSINativeException>(
         [] { std::shared_ptr<Buffer> buffer = MakeMemoryMappedBuffer(nullptr); });
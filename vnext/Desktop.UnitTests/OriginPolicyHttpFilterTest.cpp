@@ -22,6 +22,7 @@
 #include <winrt/Windows.Web.Http.h>
 
 // Standard Library
+#include <chrono>
 #include <map>
 #include <string>
 #include <utility>
@@ -402,6 +403,31 @@ TEST_CLASS (OriginPolicyHttpFilterTest) {
     }
   }
 
+  TEST_METHOD(ExtractAccessControlValuesOfLongLists) {
+    constexpr size_t count = 10000;
+    wstring allowHeaders;
+    for (size_t i = 0; i < count; ++i) {
+      allowHeaders += (i ? L", X-Header-" : L"X-Header-") + std::to_wstring(i);
+    }
+
+    HttpResponseMessage response{};
+    response.Headers().Insert(s_accessControlAllowHeaders, allowHeaders);
+    response.Headers().Insert(s_accessControlAllowMethods, L"GET, PATCH, patch");
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto values = OriginPolicyHttpFilter::ExtractAccessControlValues(response.Headers());
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    Assert::AreEqual(count, values.AllowedHeaders.size());
+    Assert::IsTrue(values.AllowedHeaders.contains(L"x-header-9999"));
+    Assert::IsFalse(values.AllowedHeaders.contains(L"X-Header-10000"));
+    Assert::AreEqual(size_t{2}, values.AllowedMethods.size());
+
+    const auto message = "Access-Control-Allow-Headers of " + std::to_string(count) + " names: extracted in " +
+        std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()) + " us\n";
+    Logger::WriteMessage(message.c_str());
+  }
+
   //
   // The tests below were migrated from the HttpOriginPolicyIntegrationTest, which exercised the
   // origin policy against an in-process HTTP server (Microsoft::React::Test::HttpServer). Here the
@@ -1046,6 +1072,54 @@ TEST_CLASS (OriginPolicyHttpFilterTest) {
     TestOriginPolicy(serverArgs, clientArgs, true /*shouldSucceed*/);
   } // FullCorsPreflightSucceeds
 
+  /// <summary>
+  /// Sends the same cross-origin request through one filter, and counts the preflight round-trips.
+  /// </summary>
+  size_t CountPreflights(const wchar_t *maxAge, size_t requestCount) {
+    size_t preflights = 0;
+    auto mockFilter = winrt::make<MockHttpBaseFilter>();
+    mockFilter.as<MockHttpBaseFilter>()->Mocks.SendRequestAsync =
+        [&preflights, maxAge](HttpRequestMessage const &request) -> ResponseOperation {
+      HttpResponseMessage response{};
+      response.RequestMessage(request);
+      response.StatusCode(HttpStatusCode::Ok);
+      response.Headers().Insert(s_accessControlAllowOrigin, s_crossOriginUrlW);
+
+      if (request.Method().ToString() == L"OPTIONS") {
+        preflights++;
+        response.Headers().Insert(s_accessControlAllowMethods, L"PATCH");
+        response.Headers().Insert(s_accessControlAllowHeaders, L"x-custom");
+        response.Headers().Insert(L"Access-Control-Max-Age", maxAge);
+      }
+
+      co_return response;
+    };
+
+    SetRuntimeOptionString("Http.GlobalOrigin", s_crossOriginUrl);
+    SetRuntimeOptionInt("Http.OriginPolicy", static_cast<int32_t>(OriginPolicy::CrossOriginResourceSharing));
+
+    IHttpFilter filter = winrt::make<OriginPolicyHttpFilter>(string{s_crossOriginUrl}, mockFilter);
+    ClientParams clientArgs(L"PATCH", {{L"X-Custom", L"Value"}});
+    for (size_t i = 0; i < requestCount; ++i) {
+      try {
+        auto sendOp = filter.SendRequestAsync(BuildRequest(clientArgs, "http://mockserver.rnw/api"));
+        sendOp.get();
+      } catch (const winrt::hresult_error &e) {
+        Assert::Fail(e.message().c_str());
+      }
+    }
+
+    return preflights;
+  }
+
+  TEST_METHOD(FullCorsPreflightCacheSkipsRepeatedPreflights) {
+    Assert::AreEqual(size_t{1}, CountPreflights(L"600", 10));
+  } // FullCorsPreflightCacheSkipsRepeatedPreflights
+
+  TEST_METHOD(FullCorsPreflightCacheHonorsZeroMaxAge) {
+    Assert::AreEqual(size_t{10}, CountPreflights(L"0", 10));
+  } // FullCorsPreflightCacheHonorsZeroMaxAge
+
   // The current implementation omits the withCredentials flag from the request and always sets it to false.
   BEGIN_TEST_METHOD_ATTRIBUTE(FullCorsCrossOriginWithCredentialsSucceeds)
   END_TEST_METHOD_ATTRIBUTE()
@@ -0,0 +1,286 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <Networking/ResponseBodySinks.h>
+#include <Networking/WinRTHttpResource.h>
+#include <Networking/WinRTTypes.h>
+#include "WinRTNetworkingMocks.h"
+
+// Windows API
+#include <winrt/Windows.Web.Http.Headers.h>
+
+// Standard Library
+#include <functional>
+#include <future>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace winrt::Windows::Web::Http;
+
+using Microsoft::React::BlobView;
+using Microsoft::React::IBlobPersistor;
+using Microsoft::React::IResponseBodySink;
+using Microsoft::React::Networking::Base64ResponseBodySink;
+using Microsoft::React::Networking::BlobResponseBodySink;
+using Microsoft::React::Networking::ResponseOperation;
+using Microsoft::React::Networking::ResponseSegmentSize;
+using Microsoft::React::Networking::TextResponseBodySink;
+using Microsoft::React::Networking::WinRTHttpResource;
+using winrt::Windows::Web::Http::Headers::HttpContentCodingHeaderValue;
+using std::string;
+using std::vector;
+
+namespace {
+
+// Writes body into sink in chunks of the given sizes, the way WinRTHttpResource writes the
+// segments it reads from the response stream. Returns the number of writes.
+size_t WriteChunks(IResponseBodySink &sink, const string &body, const vector<size_t> &chunkSizes) {
+  size_t offset = 0;
+  for (auto size : chunkSizes) {
+    sink.Write(reinterpret_cast<const uint8_t *>(body.data() + offset), size);
+    offset += size;
+  }
+
+  return chunkSizes.size();
+}
+
+// Keeps blobs as the views they are stored as, so that tests can look at their chunks.
+class ViewBlobPersistor final : public IBlobPersistor {
+  std::map<string, BlobView> m_blobs;
+
+ public:
+  BlobView ResolveMessage(string &&blobId, int64_t offset, int64_t size) override {
+    auto blob = m_blobs.find(blobId);
+    if (blob == m_blobs.cend())
+      throw std::invalid_argument("Blob object not found");
+
+    return blob->second.Slice(static_cast<size_t>(offset), static_cast<size_t>(size));
+  }
+
+  void RemoveMessage(string &&blobId) noexcept override {
+    m_blobs.erase(blobId);
+  }
+
+  void StoreMessage(vector<uint8_t> &&message, string &&blobId) noexcept override {
+    StoreView(BlobView::FromBytes(std::move(message)), std::move(blobId));
+  }
+
+  string StoreMessage(vector<uint8_t> &&message) noexcept override {
+    return StoreView(BlobView::FromBytes(std::move(message)));
+  }
+
+  void StoreView(BlobView &&view, string &&blobId) noexcept override {
+    m_blobs[std::move(blobId)] = std::move(view);
+  }
+
+  string StoreView(BlobView &&view) noexcept override {
+    auto blobId = std::to_string(m_blobs.size());
+    StoreView(std::move(view), string{blobId});
+
+    return blobId;
+  }
+};
+
+string Body(size_t size) {
+  string body(size, '\0');
+  for (size_t i = 0; i < size; i++) {
+    body[i] = static_cast<char>('a' + i % 26 + (i / 26) % 3);
+  }
+  return body;
+}
+
+string Base64(const string &text) {
+  string encoded(Microsoft::React::Utilities::Base64EncodedSize(text.size()), '\0');
+  Microsoft::React::Utilities::EncodeBase64Into(text, encoded.data());
+  return encoded;
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (ResponseBodySinkTest) {
+  TEST_METHOD(GathersText) {
+    const auto body = Body(1000);
+    TextResponseBodySink sink;
+
+    Assert::AreEqual(size_t{5}, WriteChunks(sink, body, {1, 7, 500, 3, 489}));
+    Assert::AreEqual(body, sink.TakeText());
+  }
+
+  TEST_METHOD(PassesTextOnIncrementally) {
+    const auto body = Body(1000);
+    vector<string> increments;
+    TextResponseBodySink sink{[&increments](string &&data) { increments.push_back(std::move(data)); }};
+
+    WriteChunks(sink, body, {128, 128, 128, 616});
+
+    Assert::AreEqual(size_t{4}, increments.size());
+    Assert::AreEqual(body.substr(0, 128), increments[0]);
+    Assert::AreEqual(body.substr(384), increments[3]);
+    Assert::IsTrue(sink.TakeText().empty());
+  }
+
+  TEST_METHOD(EncodesBase64AcrossChunks) {
+    const auto body = Body(1000);
+    const vector<vector<size_t>> splits{{1000}, {1, 999}, {2, 2, 996}, {333, 334, 333}, {10, 20, 40, 80, 850}};
+
+    for (const auto &chunkSizes : splits) {
+      Base64ResponseBodySink sink;
+      WriteChunks(sink, body, chunkSizes);
+      Assert::AreEqual(Base64(body), sink.TakeBase64());
+    }
+
+    Base64ResponseBodySink empty;
+    Assert::AreEqual(string{}, empty.TakeBase64());
+  }
+
+  TEST_METHOD(StoresBlobFromChunks) {
+    const auto body = Body(1000);
+    auto persistor = std::make_shared<ViewBlobPersistor>();
+    BlobResponseBodySink sink{persistor};
+
+    WriteChunks(sink, body, {100, 400, 500});
+    Assert::AreEqual(size_t{1000}, sink.Size());
+
+    const auto blob = persistor->ResolveMessage(sink.Store(), 0, 1000);
+    Assert::AreEqual(size_t{3}, blob.Segments().size());
+
+    const auto bytes = blob.ToVector();
+    Assert::AreEqual(body, string(bytes.cbegin(), bytes.cend()));
+  }
+
+  TEST_METHOD(SegmentSizeIsBoundedByUnencodedContentLength) {
+    Assert::AreEqual(uint32_t{1000}, ResponseSegmentSize(128 * 1024, 1000, false));
+    Assert::AreEqual(uint32_t{1}, ResponseSegmentSize(128 * 1024, 0, false));
+    Assert::AreEqual(uint32_t{128 * 1024}, ResponseSegmentSize(128 * 1024, 1000000, false));
+    Assert::AreEqual(uint32_t{128 * 1024}, ResponseSegmentSize(128 * 1024, std::nullopt, false));
+
+    // Decompressed reads return more than the encoded Content-Length.
+    Assert::AreEqual(uint32_t{128 * 1024}, ResponseSegmentSize(128 * 1024, 1000, true));
+  }
+};
+
+// Reads responses through WinRTHttpResource, over a client whose filter answers every request with the given content.
+TEST_CLASS (ResponseBodyReadTest) {
+  struct ReadResult {
+    string Data;
+    vector<string> Increments;
+    string Error;
+  };
+
+  static ReadResult ReadResponse(
+      std::function<IHttpContent()> makeContent,
+      string &&responseType,
+      bool useIncrementalUpdates) {
+    auto mockFilter = winrt::make<MockHttpBaseFilter>();
+    mockFilter.as<MockHttpBaseFilter>()->Mocks.SendRequestAsync =
+        [makeContent](HttpRequestMessage const &request) -> ResponseOperation {
+      HttpResponseMessage response{HttpStatusCode::Ok};
+      response.RequestMessage(request);
+      response.Content(makeContent());
+
+      co_return response;
+    };
+
+    auto resource = std::make_shared<WinRTHttpResource>(HttpClient{mockFilter});
+    ReadResult result;
+    std::promise<void> completed;
+    resource->SetOnData([&result](int64_t, string &&data) { result.Data = std::move(data); });
+    resource->SetOnIncrementalData([&result](int64_t, string &&data, int64_t, int64_t) {
+      result.Increments.push_back(std::move(data));
+    });
+    resource->SetOnResponseComplete([&completed](int64_t) { completed.set_value(); });
+    resource->SetOnError([&result, &completed](int64_t, string &&message, bool) {
+      result.Error = std::move(message);
+      completed.set_value();
+    });
+
+    resource->SendRequest(
+        "GET",
+        "http://localhost/body",
+        0, /*requestId*/
+        {}, /*headers*/
+        {}, /*data*/
+        std::move(responseType),
+        useIncrementalUpdates,
+        0 /*timeout*/,
+        false /*withCredentials*/,
+        [](int64_t) {});
+    completed.get_future().wait();
+
+    return result;
+  }
+
+  static IHttpContent TextContent(const string &body) {
+    return HttpStringContent{winrt::to_hstring(body)};
+  }
+
+  TEST_CLASS_INITIALIZE(Initialize) {
+    winrt::uninit_apartment();
+  }
+
+  TEST_METHOD(ReadsTextResponse) {
+    const auto body = Body(300000);
+    auto result = ReadResponse([&body]() { return TextContent(body); }, "text", false);
+
+    Assert::AreEqual(string{}, result.Error);
+    Assert::AreEqual(body, result.Data);
+  }
+
+  TEST_METHOD(ReadsBase64Response) {
+    const auto body = Body(300000);
+    auto result = ReadResponse([&body]() { return TextContent(body); }, "base64", false);
+
+    Assert::AreEqual(string{}, result.Error);
+    Assert::AreEqual(Base64(body), result.Data);
+  }
+
+  TEST_METHOD(PassesIncrementalTextOnInSegments) {
+    const auto body = Body(300000);
+    auto result = ReadResponse([&body]() { return TextContent(body); }, "text", true);
+
+    Assert::AreEqual(string{}, result.Error);
+    Assert::IsTrue(result.Data.empty());
+    Assert::IsTrue(result.Increments.size() > 1);
+
+    string received;
+    for (const auto &increment : result.Increments) {
+      Assert::IsTrue(increment.size() <= 128 * 1024);
+      received += increment;
+    }
+    Assert::AreEqual(body, received);
+  }
+
+  TEST_METHOD(ReadsEncodedBodyPastItsContentLength) {
+    // The stream of a content-encoded response returns the decompressed body, which is larger than its Content-Length.
+    const auto body = Body(300000);
+    auto result = ReadResponse(
+        [&body]() {
+          auto content = TextContent(body);
+          content.Headers().ContentEncoding().Append(HttpContentCodingHeaderValue{L"gzip"});
+          content.Headers().ContentLength(1000);
+          return content;
+        },
+        "text",
+        true);
+
+    Assert::AreEqual(string{}, result.Error);
+
+    // Not segments of the 1000 bytes of the Content-Length.
+    Assert::IsTrue(result.Increments.size() < body.size() / 1000);
+
+    string received;
+    for (const auto &increment : result.Increments) {
+      received += increment;
+    }
+    Assert::AreEqual(body, received);
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -4,14 +4,19 @@
 #include <BaseScriptStoreImpl.h>
 #include <CppRuntimeOptions.h>
 #include <CppUnitTest.h>
+#include <XXHash64.h>
 
 // Windows API
 #include <Windows.h>
+#include <psapi.h>
 #include <winrt/Windows.System.Diagnostics.h>
 
 // Standard Library
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
+#include <filesystem>
+#include <fstream>
 
 using namespace facebook::jsi;
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -21,11 +26,43 @@ using std::make_unique;
 using std::unique_ptr;
 using winrt::Windows::System::Diagnostics::ProcessDiagnosticInfo;
 
+namespace {
+
+PROCESS_MEMORY_COUNTERS_EX GetMemoryCounters() {
+  PROCESS_MEMORY_COUNTERS_EX counters{};
+  GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS *>(&counters), sizeof(counters));
+  return counters;
+}
+
+// A new empty directory under the temporary folder, with a trailing path delimiter.
+std::string MakeStoreDirectory(const char *name) {
+  auto directory = std::filesystem::temp_directory_path() / name;
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory);
+  return directory.string() + "\\";
+}
+
+std::string BufferToString(const Buffer &buffer) {
+  return std::string{reinterpret_cast<const char *>(buffer.data()), buffer.size()};
+}
+
+std::vector<std::filesystem::path> GetPreparedScriptFiles(const std::string &storeDirectory) {
+  std::vector<std::filesystem::path> files;
+  for (const auto &entry : std::filesystem::directory_iterator(storeDirectory)) {
+    if (entry.path().extension() == ".cache") {
+      files.push_back(entry.path());
+    }
+  }
+  return files;
+}
+
+} // namespace
+
 namespace Microsoft::JSI::Test {
 
 TEST_CLASS (ScriptStoreIntegrationTest) {
   TEST_CLASS_INITIALIZE(Init) {
-    React::SetRuntimeOptionBool("JSI.MemoryMappedScriptStore", true);
+    React::SetRuntimeOptionBool("JSI.DisableMemoryMappedScriptStore", false);
   }
 
   // Do not run this test in parallel with others.
@@ -68,5 +105,165 @@ TEST_CLASS (ScriptStoreIntegrationTest) {
     // plus 10% to account for memory used by hashing
     Assert::IsTrue(endWorkingSet - startWorkingSet < fileSize * 1.1);
   }
+
+  // Do not run this test in parallel with others.
+  // Compares loading a 32 MB bundle memory mapped (the default) with reading it into memory: the time until the whole
+  // bundle has been read once, as the runtime does before the first evaluation, and the memory it costs. The peak
+  // working set of a process only ever grows: the mapped load runs first and reports how much it raised the peak, the
+  // load reading the bundle then reports how far it raised the peak past that.
+  TEST_METHOD(BenchmarkBundleStartup) {
+    char tempPath[MAX_PATH];
+    if (!GetTempPathA(MAX_PATH, tempPath)) {
+      Assert::Fail(L"Could not get temporary folder");
+    }
+    const std::string bundlePath = std::string{tempPath} + "ScriptStoreBenchmark.bundle";
+
+    constexpr size_t bundleSize = 32 * 1024 * 1024;
+    {
+      std::string bundle(bundleSize, ' ');
+      for (size_t i = 0; i < bundle.size(); i++) {
+        bundle[i] = static_cast<char>('a' + i % 26);
+      }
+      std::ofstream file(bundlePath, std::ios::binary | std::ios::trunc);
+      file.write(bundle.data(), bundle.size());
+    }
+
+    struct Measurement {
+      double firstEvalMs;
+      int64_t peakWorkingSetBytes;
+      int64_t privateBytes;
+    };
+    auto measure = [&bundlePath](bool memoryMapped) {
+      React::SetRuntimeOptionBool("JSI.DisableMemoryMappedScriptStore", !memoryMapped);
+      facebook::react::BaseScriptStoreImpl scriptStore;
+
+      const auto startCounters = GetMemoryCounters();
+      const auto start = std::chrono::steady_clock::now();
+
+      auto script = scriptStore.getVersionedScript(bundlePath);
+      Assert::AreEqual(bundleSize, script.buffer->size());
+
+      // Stands in for the parser, touch every page of the bundle
+      uint64_t checksum = 0;
+      for (size_t i = 0; i < script.buffer->size(); i += 64) {
+        checksum += script.buffer->data()[i];
+      }
+      Assert::AreNotEqual(uint64_t{0}, checksum);
+
+      const auto end = std::chrono::steady_clock::now();
+      const auto endCounters = GetMemoryCounters();
+      return Measurement{
+          std::chrono::duration<double, std::milli>(end - start).count(),
+          static_cast<int64_t>(endCounters.PeakWorkingSetSize) - static_cast<int64_t>(startCounters.PeakWorkingSetSize),
+          static_cast<int64_t>(endCounters.PrivateUsage) - static_cast<int64_t>(startCounters.PrivateUsage)};
+    };
+
+    const auto mapped = measure(true);
+    const auto read = measure(false);
+    React::SetRuntimeOptionBool("JSI.DisableMemoryMappedScriptStore", false);
+    DeleteFileA(bundlePath.c_str());
+
+    auto describe = [](const Measurement &measurement) {
+      return std::to_string(measurement.firstEvalMs) + "ms to first eval, peak working set +" +
+          std::to_string(measurement.peakWorkingSetBytes / 1024) + " KB, private bytes +" +
+          std::to_string(measurement.privateBytes / 1024) + " KB";
+    };
+    const auto message = "Memory mapped: " + describe(mapped) + "\nRead into memory: " + describe(read) + "\n";
+    Logger::WriteMessage(message.c_str());
+
+    // Mapped pages are shared with the file cache, only the read path copies the bundle into private memory
+    Assert::IsTrue(mapped.privateBytes < static_cast<int64_t>(bundleSize / 2));
+    Assert::IsTrue(read.privateBytes > static_cast<int64_t>(bundleSize / 2));
+  }
+};
+
+TEST_CLASS (PreparedScriptStoreTest) {
+  TEST_METHOD(RetrievesPersistedScript) {
+    const auto storeDirectory = MakeStoreDirectory("PreparedScriptStoreTest_Retrieve");
+    facebook::react::BasePreparedScriptStoreImpl store(storeDirectory);
+
+    const auto scriptSignature = ScriptSignature{"myscheme://my/path.js", 1};
+    const auto runtimeSignature = JSRuntimeSignature{"V8", 8};
+    store.persistPreparedScript(make_shared<StringBuffer>("prepared"), scriptSignature, runtimeSignature, "tag");
+
+    auto prepared = store.tryGetPreparedScript(scriptSignature, runtimeSignature, "tag");
+    Assert::IsTrue(prepared != nullptr);
+    Assert::AreEqual(std::string{"prepared"}, BufferToString(*prepared));
+    prepared.reset();
+
+    // Any change to the signatures or the tag is a different script
+    Assert::IsTrue(!store.tryGetPreparedScript(ScriptSignature{"myscheme://my/path.js", 2}, runtimeSignature, "tag"));
+    Assert::IsTrue(!store.tryGetPreparedScript(ScriptSignature{"myscheme://my/other.js", 1}, runtimeSignature, "tag"));
+    Assert::IsTrue(!store.tryGetPreparedScript(scriptSignature, JSRuntimeSignature{"V8", 9}, "tag"));
+    Assert::IsTrue(!store.tryGetPreparedScript(scriptSignature, runtimeSignature, "other"));
+
+    // Persisting again replaces the stored script
+    store.persistPreparedScript(make_shared<StringBuffer>("replaced"), scriptSignature, runtimeSignature, "tag");
+    prepared = store.tryGetPreparedScript(scriptSignature, runtimeSignature, "tag");
+    Assert::AreEqual(std::string{"replaced"}, BufferToString(*prepared));
+    prepared.reset();
+    Assert::AreEqual(size_t{1}, GetPreparedScriptFiles(storeDirectory).size());
+
+    std::filesystem::remove_all(storeDirectory);
+  }
+
+  TEST_METHOD(RejectsCorruptedScript) {
+    const auto storeDirectory = MakeStoreDirectory("PreparedScriptStoreTest_Corrupted");
+    facebook::react::BasePreparedScriptStoreImpl store(storeDirectory);
+
+    const auto scriptSignature = ScriptSignature{"myscheme://my/path.js", 1};
+    const auto runtimeSignature = JSRuntimeSignature{"V8", 8};
+    store.persistPreparedScript(
+        make_shared<StringBuffer>(std::string(4096, 'x')), scriptSignature, runtimeSignature, "tag");
+
+    const auto files = GetPreparedScriptFiles(storeDirectory);
+    Assert::AreEqual(size_t{1}, files.size());
+    {
+      std::fstream file(files[0], std::ios::binary | std::ios::in | std::ios::out);
+      file.seekp(2048);
+      file.put('y');
+    }
+
+    Assert::IsTrue(!store.tryGetPreparedScript(scriptSignature, runtimeSignature, "tag"));
+
+    std::filesystem::remove_all(storeDirectory);
+  }
+
+  TEST_METHOD(EvictsLeastRecentlyUsedScripts) {
+    const auto storeDirectory = MakeStoreDirectory("PreparedScriptStoreTest_Eviction");
+    constexpr size_t scriptSize = 1024 * 1024;
+    // Room for two scripts and their headers
+    facebook::react::BasePreparedScriptStoreImpl store(storeDirectory, 2 * scriptSize + 4096);
+
+    const auto runtimeSignature = JSRuntimeSignature{"V8", 8};
+    const auto first = ScriptSignature{"first.js", 1};
+    const auto second = ScriptSignature{"second.js", 1};
+    const auto third = ScriptSignature{"third.js", 1};
+    auto script = make_shared<StringBuffer>(std::string(scriptSize, 'x'));
+
+    store.persistPreparedScript(script, first, runtimeSignature, nullptr);
+    Sleep(20);
+    store.persistPreparedScript(script, second, runtimeSignature, nullptr);
+    Sleep(20);
+
+    // Using the first script makes the second one the least recently used
+    Assert::IsTrue(store.tryGetPreparedScript(first, runtimeSignature, nullptr) != nullptr);
+    Sleep(20);
+
+    store.persistPreparedScript(script, third, runtimeSignature, nullptr);
+
+    Assert::AreEqual(size_t{2}, GetPreparedScriptFiles(storeDirectory).size());
+    Assert::IsTrue(store.tryGetPreparedScript(first, runtimeSignature, nullptr) != nullptr);
+    Assert::IsTrue(!store.tryGetPreparedScript(second, runtimeSignature, nullptr));
+    Assert::IsTrue(store.tryGetPreparedScript(third, runtimeSignature, nullptr) != nullptr);
+
+    std::filesystem::remove_all(storeDirectory);
+  }
+
+  TEST_METHOD(XXHash64MatchesReference) {
+    using Microsoft::ReactNative::XXHash64;
+    Assert::AreEqual(0xEF46DB3751D8E999ULL, XXHash64("", 0));
+    Assert::AreEqual(0x44BC2CF5AD770999ULL, XXHash64("abc", 3));
+  }
 };
 } // namespace Microsoft::JSI::Test
@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <StartupTimeline.h>
+
+// Standard Library
+#include <chrono>
+#include <string>
+#include <thread>
+
+using namespace Microsoft::ReactNative;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+const StartupPhase *FindPhase(const std::vector<StartupPhase> &phases, std::string_view name) {
+  for (const auto &phase : phases) {
+    if (phase.name == name) {
+      return &phase;
+    }
+  }
+  return nullptr;
+}
+
+void Spin(std::chrono::milliseconds duration) {
+  const auto end = std::chrono::steady_clock::now() + duration;
+  while (std::chrono::steady_clock::now() < end) {
+  }
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (StartupTimelineTest) {
+  TEST_METHOD(RecordsPhasesInStartOrder) {
+    StartupTimeline timeline;
+    timeline.BeginPhase("Outer");
+    {
+      StartupTimeline::Scope scope(&timeline, "Inner");
+      Spin(std::chrono::milliseconds(5));
+    }
+    timeline.Mark("Loaded");
+    timeline.EndPhase("Outer");
+    timeline.EndPhase("NeverBegun");
+
+    const auto phases = timeline.Phases();
+    Assert::AreEqual(size_t{3}, phases.size());
+    Assert::AreEqual(std::string{"Outer"}, phases[0].name);
+    Assert::AreEqual(std::string{"Inner"}, phases[1].name);
+    Assert::AreEqual(std::string{"Loaded"}, phases[2].name);
+
+    Assert::IsTrue(phases[1].wallTimeMs >= 5);
+    Assert::IsTrue(phases[0].wallTimeMs >= phases[1].wallTimeMs);
+    // Thread times have the granularity of the scheduler tick on Windows
+    Assert::IsTrue(phases[1].cpuTimeMs >= 0);
+    Assert::IsFalse(phases[1].spansThreads);
+    Assert::IsTrue(phases[2].isMarker);
+  }
+
+  TEST_METHOD(PhasesCanEndOnAnotherThread) {
+    StartupTimeline timeline;
+    timeline.BeginPhase("EvaluateBundle");
+    std::thread([&timeline]() { timeline.EndPhase("EvaluateBundle"); }).join();
+
+    const auto phases = timeline.Phases();
+    Assert::AreEqual(size_t{1}, phases.size());
+    Assert::IsTrue(phases[0].spansThreads);
+  }
+
+  TEST_METHOD(NullScopeDoesNothing) {
+    StartupTimeline::Scope scope(nullptr, "Phase");
+  }
+
+  TEST_METHOD(ExportsChromeTraceJson) {
+    StartupTimeline timeline;
+    { StartupTimeline::Scope scope(&timeline, "Load \"modules\""); }
+    timeline.Mark("Loaded");
+
+    const auto json = timeline.ToChromeTraceJson();
+    Assert::AreEqual(
+        size_t{0}, json.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[{\"name\":\"Load \\\"modules\\\"\""));
+    Assert::AreNotEqual(std::string::npos, json.find("\"ph\":\"X\""));
+    Assert::AreNotEqual(std::string::npos, json.find("{\"name\":\"Loaded\""));
+    Assert::AreNotEqual(std::string::npos, json.find("\"ph\":\"i\""));
+    Assert::AreEqual(std::string{"]}"}, json.substr(json.size() - 2));
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <Fabric/Composition/TextRedraw.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace winrt::Microsoft::ReactNative::Composition::implementation;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (TextRedrawTests) {
+  TEST_METHOD(ClipRectIsScaledAfterOffset) {
+    // A 30x12 pixel update at (6, 18) of a surface whose update starts 3 pixels from the left and 9 from the top.
+    const auto clip = PartialRedrawClipRect(3, 9, 6, 18, 36, 30, 1.5f);
+
+    Assert::AreEqual(6.f, clip.left);
+    Assert::AreEqual(18.f, clip.top);
+    Assert::AreEqual(26.f, clip.right);
+    Assert::AreEqual(26.f, clip.bottom);
+  }
+
+  TEST_METHOD(ClipRectAtScaleOneIsUpdateRect) {
+    const auto clip = PartialRedrawClipRect(0, 0, 4, 8, 20, 16, 1.f);
+
+    Assert::AreEqual(4.f, clip.left);
+    Assert::AreEqual(8.f, clip.top);
+    Assert::AreEqual(20.f, clip.right);
+    Assert::AreEqual(16.f, clip.bottom);
+  }
+
+  TEST_METHOD(CountersResetWhenTaken) {
+    TextRedrawCounters counters;
+    counters.CountFullRedraw(100);
+    counters.CountPartialRedraw(20);
+    counters.CountPartialRedraw(5);
+
+    const auto stats = counters.Take();
+    Assert::AreEqual(uint64_t{1}, stats.fullRedraws);
+    Assert::AreEqual(uint64_t{2}, stats.partialRedraws);
+    Assert::AreEqual(uint64_t{125}, stats.pixelsRedrawn);
+
+    const auto next = counters.Take();
+    Assert::AreEqual(uint64_t{0}, next.fullRedraws);
+    Assert::AreEqual(uint64_t{0}, next.partialRedraws);
+    Assert::AreEqual(uint64_t{0}, next.pixelsRedrawn);
+  }
+};
+
+} // namespace Microsoft::React::Test
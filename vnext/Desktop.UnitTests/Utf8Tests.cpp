@@ -0,0 +1,62 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <Utf8.h>
+
+// Standard Library
+#include <string>
+
+using namespace Microsoft::React::Utilities;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using std::string;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (Utf8Test) {
+  TEST_METHOD(AcceptsValidSequences) {
+    Assert::IsTrue(IsValidUtf8(""));
+    Assert::IsTrue(IsValidUtf8("plain ASCII text, longer than one word"));
+    Assert::IsTrue(IsValidUtf8("\xC2\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80"));
+    Assert::IsTrue(IsValidUtf8("\xED\x9F\xBF"));     // U+D7FF
+    Assert::IsTrue(IsValidUtf8("\xEE\x80\x80"));     // U+E000
+    Assert::IsTrue(IsValidUtf8("\xF4\x8F\xBF\xBF")); // U+10FFFF
+  }
+
+  TEST_METHOD(RejectsInvalidSequences) {
+    Assert::IsFalse(IsValidUtf8("\x80"));
+    Assert::IsFalse(IsValidUtf8("\xC0\xAF"));         // Overlong
+    Assert::IsFalse(IsValidUtf8("\xE0\x80\xAF"));     // Overlong
+    Assert::IsFalse(IsValidUtf8("\xED\xA0\x80"));     // Surrogate
+    Assert::IsFalse(IsValidUtf8("\xF4\x90\x80\x80")); // Above U+10FFFF
+    Assert::IsFalse(IsValidUtf8("\xF5\x80\x80\x80"));
+    Assert::IsFalse(IsValidUtf8("text\xE2\x82"));
+
+    Assert::AreEqual(size_t{12}, ValidUtf8PrefixSize("ASCII words \xFF more"));
+  }
+
+  TEST_METHOD(FindsIncompleteSuffix) {
+    Assert::AreEqual(size_t{0}, IncompleteUtf8SuffixSize(""));
+    Assert::AreEqual(size_t{0}, IncompleteUtf8SuffixSize("abc"));
+    Assert::AreEqual(size_t{0}, IncompleteUtf8SuffixSize("a\xE2\x82\xAC"));
+    Assert::AreEqual(size_t{1}, IncompleteUtf8SuffixSize("a\xE2"));
+    Assert::AreEqual(size_t{2}, IncompleteUtf8SuffixSize("a\xE2\x82"));
+    Assert::AreEqual(size_t{3}, IncompleteUtf8SuffixSize("a\xF0\x9F\x98"));
+    Assert::AreEqual(size_t{0}, IncompleteUtf8SuffixSize("a\x80\x80\x80\x80"));
+  }
+
+  TEST_METHOD(ReplacesMaximalSubparts) {
+    // Examples of https://encoding.spec.whatwg.org/#utf-8-decoder and the Unicode standard, table 3-8.
+    Assert::AreEqual(string{"a\xEF\xBF\xBD" "b"}, ToValidUtf8("a\xE2\x82" "b"));
+    string replacements;
+    for (int i = 0; i < 5; i++) {
+      replacements += "\xEF\xBF\xBD";
+    }
+    Assert::AreEqual(replacements + "A", ToValidUtf8("\xC0\xAF\xE0\x80\xBF" "A"));
+    Assert::AreEqual(string{"\xEF\xBF\xBD\xEF\xBF\xBD" "A"}, ToValidUtf8("\xF1\x80\x80\xE1\x80" "A"));
+    Assert::AreEqual(string{"valid \xC2\xA9"}, ToValidUtf8("valid \xC2\xA9"));
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,114 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <Modules/WebSocketArrayBufferMessages.h>
+#include <Modules/WebSocketTurboModuleProxy.h>
+#include "WebSocketMocks.h"
+
+// Standard Library
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using Microsoft::React::WebSocketArrayBufferMessages;
+using Microsoft::React::WebSocketTurboModuleProxy;
+using Microsoft::React::Networking::IWebSocketResource;
+using std::shared_ptr;
+using std::vector;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (WebSocketArrayBufferTest) {
+  TEST_METHOD(SendsBytesToTheSocket) {
+    auto socket = std::make_shared<MockWebSocketResource>();
+    vector<vector<uint8_t>> sent;
+    socket->Mocks.SendBytes = [&sent](vector<uint8_t> &&data) { sent.push_back(std::move(data)); };
+
+    std::unordered_map<double, shared_ptr<IWebSocketResource>> resourceMap{{1, socket}};
+    WebSocketTurboModuleProxy proxy{resourceMap};
+
+    proxy.SendBinary(vector<uint8_t>{0, 1, 0xFF}, 1);
+    proxy.SendBinary(vector<uint8_t>{2}, 2); // Unknown socket
+
+    Assert::AreEqual(size_t{1}, sent.size());
+    Assert::IsTrue(vector<uint8_t>{0, 1, 0xFF} == sent[0]);
+  }
+
+  TEST_METHOD(ReceivesOnlyForOptedInSockets) {
+    WebSocketArrayBufferMessages messages;
+    Assert::IsFalse(messages.IsReceiving(1));
+
+    messages.SetReceiving(1, true);
+    Assert::IsTrue(messages.IsReceiving(1));
+    Assert::IsFalse(messages.IsReceiving(2));
+
+    messages.SetReceiving(1, false);
+    Assert::IsFalse(messages.IsReceiving(1));
+  }
+
+  TEST_METHOD(TakesEachMessageOnce) {
+    WebSocketArrayBufferMessages messages;
+    messages.SetReceiving(1, true);
+    auto first = messages.Add(1, {1, 2, 3});
+    auto second = messages.Add(1, {});
+    Assert::AreNotEqual(first, second);
+
+    auto bytes = messages.Take(first);
+    Assert::IsTrue(bytes.has_value());
+    Assert::IsTrue(vector<uint8_t>{1, 2, 3} == *bytes);
+    Assert::IsFalse(messages.Take(first).has_value());
+
+    // Empty messages are taken as empty ArrayBuffers.
+    bytes = messages.Take(second);
+    Assert::IsTrue(bytes.has_value());
+    Assert::IsTrue(bytes->empty());
+    Assert::AreEqual(size_t{0}, messages.Count());
+  }
+
+  TEST_METHOD(DropsMessagesOfClosedSockets) {
+    WebSocketArrayBufferMessages messages;
+    messages.SetReceiving(1, true);
+    messages.SetReceiving(2, true);
+    auto closed = messages.Add(1, {1});
+    auto open = messages.Add(2, {2});
+
+    messages.Close(1);
+
+    Assert::IsFalse(messages.IsReceiving(1));
+    Assert::IsFalse(messages.Take(closed).has_value());
+    Assert::IsTrue(messages.IsReceiving(2));
+    Assert::IsTrue(vector<uint8_t>{2} == messages.Take(open));
+    Assert::AreEqual(size_t{0}, messages.Count());
+  }
+
+  TEST_METHOD(DropsOldestUntakenMessagesOverBounds) {
+    WebSocketArrayBufferMessages messages{{3 /*MaxMessages*/, 10 /*MaxBytes*/}};
+    messages.SetReceiving(1, true);
+    messages.SetReceiving(2, true);
+    auto first = messages.Add(1, {1});
+    auto second = messages.Add(1, {2});
+    auto other = messages.Add(2, {3});
+    auto third = messages.Add(1, {3});
+    auto fourth = messages.Add(1, {4});
+
+    // Over MaxMessages for socket 1 only.
+    Assert::AreEqual(size_t{1}, messages.DroppedCount());
+    Assert::IsFalse(messages.Take(first).has_value());
+    Assert::IsTrue(vector<uint8_t>{2} == messages.Take(second));
+    Assert::IsTrue(vector<uint8_t>{3} == messages.Take(other));
+
+    // Over MaxBytes: keeps the newest message, even when it is larger than MaxBytes alone.
+    auto large = messages.Add(1, vector<uint8_t>(12));
+    Assert::AreEqual(size_t{3}, messages.DroppedCount());
+    Assert::IsFalse(messages.Take(third).has_value());
+    Assert::IsFalse(messages.Take(fourth).has_value());
+    Assert::AreEqual(size_t{12}, messages.Take(large)->size());
+    Assert::AreEqual(size_t{0}, messages.Count());
+  }
+};
+
+} // namespace Microsoft::React::Test
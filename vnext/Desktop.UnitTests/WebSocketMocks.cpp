@@ -3,6 +3,7 @@
 using std::exception;
 using std::function;
 using std::string;
+using std::vector;
 
 namespace Microsoft::React::Test {
 
@@ -37,6 +38,12 @@ void MockWebSocketResource::SendBinary(string &&message) noexcept /*override*/
     return Mocks.SendBinary(std::move(message));
 }
 
+void MockWebSocketResource::SendBytes(vector<uint8_t> &&data) noexcept /*override*/
+{
+  if (Mocks.SendBytes)
+    return Mocks.SendBytes(std::move(data));
+}
+
 void MockWebSocketResource::Close(CloseCode code, const string &reason) noexcept /*override*/
 {
   if (Mocks.Close)
@@ -51,6 +58,14 @@ Networking::IWebSocketResource::ReadyState MockWebSocketResource::GetReadyState(
   return ReadyState::Connecting;
 }
 
+size_t MockWebSocketResource::GetBufferedAmount() const noexcept /*override*/
+{
+  if (Mocks.GetBufferedAmount)
+    return Mocks.GetBufferedAmount();
+
+  return 0;
+}
+
 void MockWebSocketResource::SetOnConnect(function<void()> &&handler) noexcept /*override*/
 {
   if (Mocks.SetOnConnect)
@@ -83,6 +98,14 @@ void MockWebSocketResource::SetOnMessage(function<void(size_t, const string &, b
   m_readHandler = std::move(handler);
 }
 
+void MockWebSocketResource::SetOnBinaryMessage(function<void(vector<uint8_t> &&)> &&handler) noexcept /*override*/
+{
+  if (Mocks.SetOnBinaryMessage)
+    return Mocks.SetOnBinaryMessage(std::move(handler));
+
+  m_binaryReadHandler = std::move(handler);
+}
+
 void MockWebSocketResource::SetOnClose(function<void(CloseCode, const string &)> &&handler) noexcept /*override*/
 {
   if (Mocks.SetOnClose)
@@ -99,6 +122,14 @@ void MockWebSocketResource::SetOnError(function<void(Error &&)> &&handler) noexc
   m_errorHandler = std::move(handler);
 }
 
+void MockWebSocketResource::SetOnBackpressure(function<void(bool)> &&handler) noexcept /*override*/
+{
+  if (Mocks.SetOnBackpressure)
+    return Mocks.SetOnBackpressure(std::move(handler));
+
+  m_backpressureHandler = std::move(handler);
+}
+
 #pragma endregion IWebSocketResource overrides
 
 void MockWebSocketResource::OnConnect() {
@@ -121,6 +152,11 @@ void MockWebSocketResource::OnMessage(size_t size, const string &message, bool i
     m_readHandler(size, message, isBinary);
 }
 
+void MockWebSocketResource::OnBinaryMessage(vector<uint8_t> &&message) {
+  if (m_binaryReadHandler)
+    m_binaryReadHandler(std::move(message));
+}
+
 void MockWebSocketResource::OnClose(CloseCode code, const string &reason) {
   if (m_closeHandler)
     m_closeHandler(code, reason);
@@ -131,4 +167,9 @@ void MockWebSocketResource::OnError(Error &&error) {
     m_errorHandler(std::move(error));
 }
 
+void MockWebSocketResource::OnBackpressure(bool isPaused) {
+  if (m_backpressureHandler)
+    m_backpressureHandler(isPaused);
+}
+
 } // namespace Microsoft::React::Test
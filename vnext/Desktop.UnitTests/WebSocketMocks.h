@@ -11,14 +11,18 @@ struct MockWebSocketResource : public Networking::IWebSocketResource {
     std::function<void()> Ping;
     std::function<void(const std::string &)> Send;
     std::function<void(const std::string &)> SendBinary;
+    std::function<void(std::vector<uint8_t> &&)> SendBytes;
     std::function<void(CloseCode, const std::string &)> Close;
     std::function<ReadyState() /*const*/> GetReadyState;
+    std::function<std::size_t() /*const*/> GetBufferedAmount;
     std::function<void(std::function<void()> &&)> SetOnConnect;
     std::function<void(std::function<void()> &&)> SetOnPing;
     std::function<void(std::function<void(std::size_t)> &&)> SetOnSend;
     std::function<void(std::function<void(std::size_t, const std::string &, bool)> &&)> SetOnMessage;
+    std::function<void(std::function<void(std::vector<uint8_t> &&)> &&)> SetOnBinaryMessage;
     std::function<void(std::function<void(CloseCode, const std::string &)> &&)> SetOnClose;
     std::function<void(std::function<void(Error &&)> &&)> SetOnError;
+    std::function<void(std::function<void(bool)> &&)> SetOnBackpressure;
   };
 
   Mocks Mocks;
@@ -33,10 +37,14 @@ struct MockWebSocketResource : public Networking::IWebSocketResource {
 
   void SendBinary(std::string &&) noexcept override;
 
+  void SendBytes(std::vector<uint8_t> &&) noexcept override;
+
   void Close(CloseCode, const std::string &) noexcept override;
 
   ReadyState GetReadyState() const noexcept override;
 
+  std::size_t GetBufferedAmount() const noexcept override;
+
   void SetOnConnect(std::function<void()> &&onConnect) noexcept override;
 
   void SetOnPing(std::function<void()> &&) noexcept override;
@@ -45,26 +53,34 @@ struct MockWebSocketResource : public Networking::IWebSocketResource {
 
   void SetOnMessage(std::function<void(std::size_t, const std::string &, bool)> &&) noexcept override;
 
+  void SetOnBinaryMessage(std::function<void(std::vector<uint8_t> &&)> &&) noexcept override;
+
   void SetOnClose(std::function<void(CloseCode, const std::string &)> &&) noexcept override;
 
   void SetOnError(std::function<void(Error &&)> &&) noexcept override;
 
+  void SetOnBackpressure(std::function<void(bool)> &&) noexcept override;
+
 #pragma endregion IWebSocketResource overrides
 
   void OnConnect();
   void OnPing();
   void OnSend(std::size_t size);
   void OnMessage(std::size_t, const std::string &message, bool isBinary);
+  void OnBinaryMessage(std::vector<uint8_t> &&message);
   void OnClose(CloseCode code, const std::string &reason);
   void OnError(Error &&error);
+  void OnBackpressure(bool isPaused);
 
  private:
   std::function<void()> m_connectHandler;
   std::function<void()> m_pingHandler;
   std::function<void(std::size_t)> m_writeHandler;
   std::function<void(std::size_t, const std::string &, bool)> m_readHandler;
+  std::function<void(std::vector<uint8_t> &&)> m_binaryReadHandler;
   std::function<void(CloseCode, const std::string &)> m_closeHandler;
   std::function<void(Error &&)> m_errorHandler;
+  std::function<void(bool)> m_backpressureHandler;
 };
 
 } // namespace Microsoft::React::Test
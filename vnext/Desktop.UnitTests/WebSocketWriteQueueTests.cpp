@@ -0,0 +1,135 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <Networking/WebSocketWriteQueue.h>
+
+// Standard Library
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using Microsoft::React::Networking::WebSocketWriteQueue;
+using std::string;
+using std::vector;
+
+namespace {
+
+WebSocketWriteQueue::Message Text(const string &text) {
+  return {false, text, {}};
+}
+
+WebSocketWriteQueue::Message Binary(size_t size) {
+  return {true, {}, vector<uint8_t>(size, 0xAB)};
+}
+
+// Writes the batches of a queue the way a socket does: one at a time, completing when told to.
+struct FakeSocket {
+  WebSocketWriteQueue Queue;
+  vector<vector<WebSocketWriteQueue::Message>> Batches;
+  vector<bool> Backpressure;
+  bool IsWriting{false};
+
+  FakeSocket(WebSocketWriteQueue::Options options) : Queue{options} {}
+
+  void Send(WebSocketWriteQueue::Message &&message) {
+    Handle(Queue.Push(std::move(message)));
+  }
+
+  void FinishWrite() {
+    Assert::IsTrue(IsWriting);
+    IsWriting = false;
+    Handle(Queue.Complete());
+  }
+
+  void Handle(WebSocketWriteQueue::Update &&update) {
+    if (update.Backpressure) {
+      Backpressure.push_back(*update.Backpressure);
+    }
+    if (!update.Batch.empty()) {
+      Assert::IsFalse(IsWriting);
+      IsWriting = true;
+      Batches.push_back(std::move(update.Batch));
+    }
+  }
+};
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (WebSocketWriteQueueTest) {
+  TEST_METHOD(BatchesMessagesQueuedDuringAWrite) {
+    FakeSocket socket{{1024, 1 << 20, 1 << 19}};
+    socket.Send(Text("a"));
+    socket.Send(Text("b"));
+    socket.Send(Text("c"));
+    socket.Send(Binary(10));
+
+    Assert::AreEqual(size_t{1}, socket.Batches.size());
+    Assert::AreEqual(size_t{13}, socket.Queue.BufferedAmount());
+
+    socket.FinishWrite();
+    Assert::AreEqual(size_t{2}, socket.Batches.size());
+    Assert::AreEqual(size_t{3}, socket.Batches[1].size());
+    Assert::AreEqual(string{"b"}, socket.Batches[1][0].Text);
+    Assert::AreEqual(string{"c"}, socket.Batches[1][1].Text);
+    Assert::IsTrue(socket.Batches[1][2].IsBinary);
+    Assert::AreEqual(size_t{12}, socket.Queue.BufferedAmount());
+
+    socket.FinishWrite();
+    Assert::IsFalse(socket.IsWriting);
+    Assert::AreEqual(size_t{0}, socket.Queue.BufferedAmount());
+  }
+
+  TEST_METHOD(ClosesBatchesAtMaxBatchSize) {
+    FakeSocket socket{{100, 1 << 20, 1 << 19}};
+    socket.Send(Binary(1));
+    for (int i = 0; i < 5; i++) {
+      socket.Send(Binary(60));
+    }
+    socket.Send(Binary(500));
+
+    socket.FinishWrite();
+    socket.FinishWrite();
+    socket.FinishWrite();
+    Assert::AreEqual(size_t{4}, socket.Batches.size());
+    Assert::AreEqual(size_t{2}, socket.Batches[1].size());
+    Assert::AreEqual(size_t{2}, socket.Batches[2].size());
+    Assert::AreEqual(size_t{2}, socket.Batches[3].size());
+    Assert::AreEqual(size_t{500}, socket.Batches[3][1].Size());
+  }
+
+  TEST_METHOD(SignalsBackpressureBetweenWatermarks) {
+    FakeSocket socket{{100, 250, 100}};
+    socket.Send(Binary(100));
+    socket.Send(Binary(100));
+    socket.Send(Binary(100));
+    Assert::IsTrue(vector<bool>{true} == socket.Backpressure);
+    Assert::IsTrue(socket.Queue.IsUnderBackpressure());
+
+    socket.FinishWrite();
+    Assert::IsTrue(vector<bool>{true} == socket.Backpressure);
+
+    socket.FinishWrite();
+    Assert::IsTrue(vector<bool>{true, false} == socket.Backpressure);
+    Assert::AreEqual(size_t{100}, socket.Queue.BufferedAmount());
+  }
+
+  TEST_METHOD(ClearDropsQueuedMessagesOnly) {
+    FakeSocket socket{{100, 150, 50}};
+    socket.Send(Binary(100));
+    socket.Send(Binary(100));
+    socket.Handle(socket.Queue.Clear());
+    Assert::AreEqual(size_t{100}, socket.Queue.BufferedAmount());
+
+    socket.FinishWrite();
+    Assert::AreEqual(size_t{1}, socket.Batches.size());
+    Assert::AreEqual(size_t{0}, socket.Queue.BufferedAmount());
+    Assert::IsTrue(vector<bool>{true, false} == socket.Backpressure);
+  }
+};
+
+} // namespace Microsoft::React::Test
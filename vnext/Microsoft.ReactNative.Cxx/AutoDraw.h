@@ -22,6 +22,33 @@ class AutoDrawDrawingSurface {
     }
   }
 
+  // Only the pixels within updateRect (in surface pixels) are redrawn; the rest of the surface keeps its content.
+  // offset is adjusted so that it is always the location of the surface's top-left corner, matching the full surface
+  // constructor. Falls back to drawing the full surface if the surface does not support partial updates.
+  AutoDrawDrawingSurface(
+      winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush &drawingSurface,
+      float scaleFactor,
+      const RECT &updateRect,
+      POINT *offset) noexcept {
+    drawingSurface.as(m_drawingSurfaceInterop);
+    auto dpi = scaleFactor * 96.0f;
+    HRESULT hr = E_NOINTERFACE;
+    if (auto updateRectInterop = drawingSurface.try_as<Experimental::ICompositionDrawingSurfaceUpdateRectInterop>()) {
+      hr = updateRectInterop->BeginDrawRect(updateRect, m_d2dDeviceContext.put(), dpi, dpi, offset);
+      if (SUCCEEDED(hr)) {
+        m_isPartial = true;
+        offset->x -= updateRect.left;
+        offset->y -= updateRect.top;
+      }
+    }
+    if (FAILED(hr)) {
+      hr = m_drawingSurfaceInterop->BeginDraw(m_d2dDeviceContext.put(), dpi, dpi, offset);
+    }
+    if (FAILED(hr)) {
+      m_d2dDeviceContext = nullptr;
+    }
+  }
+
   ~AutoDrawDrawingSurface() noexcept {
     if (m_d2dDeviceContext) {
       m_d2dDeviceContext = nullptr;
@@ -42,9 +69,15 @@ class AutoDrawDrawingSurface {
     return m_d2dDeviceContext != nullptr;
   }
 
+  // Returns true if only the requested update rect is being drawn, rather than the whole surface
+  bool IsPartial() const noexcept {
+    return m_isPartial;
+  }
+
  private:
   winrt::com_ptr<Experimental::ICompositionDrawingSurfaceInterop> m_drawingSurfaceInterop;
   winrt::com_ptr<ID2D1DeviceContext> m_d2dDeviceContext;
+  bool m_isPartial{false};
 };
 
 } // namespace Microsoft::ReactNative::Composition
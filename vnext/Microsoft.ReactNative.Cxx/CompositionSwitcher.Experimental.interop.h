@@ -19,6 +19,19 @@ struct __declspec(uuid("941FDD90-ED27-49CE-A1CD-86ECB2D4A0FA")) ICompositionDraw
   virtual HRESULT EndDraw() noexcept = 0;
 };
 
+// Optional interface on drawing surfaces that support updating only a sub-rectangle of the surface.
+// Content outside of updateRect is preserved. The returned offset is the location of updateRect's top-left corner
+// within the device context.
+struct __declspec(uuid("6C0E5A2B-7F4D-4C8E-9B3A-2D1F0E8C7A51")) ICompositionDrawingSurfaceUpdateRectInterop
+    : public IUnknown {
+  virtual HRESULT BeginDrawRect(
+      const RECT &updateRect,
+      ID2D1DeviceContext **deviceContextOut,
+      float xDpi,
+      float yDpi,
+      POINT *offset) noexcept = 0;
+};
+
 struct __declspec(uuid("93A6d34A-0A09-4BE3-94FC-FA3A79D0E0E9")) IRenderingDeviceReplacedListener : IUnknown {
   virtual void OnRenderingDeviceLost() = 0;
 };
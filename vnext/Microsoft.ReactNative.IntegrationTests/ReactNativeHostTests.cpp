@@ -7,6 +7,9 @@
 #include "TestEventService.h"
 #include "TestReactNativeHostHolder.h"
 
+#include <algorithm>
+#include <cstdio>
+
 using namespace winrt;
 using namespace Microsoft::ReactNative;
 
@@ -45,6 +48,17 @@ struct TestPackageProvider : winrt::implements<TestPackageProvider, IReactPackag
   }
 };
 
+// A module without members, constructed on a background thread while the instance starts.
+REACT_MODULE(StartupTimelineModule)
+struct StartupTimelineModule {};
+
+struct StartupTimelinePackageProvider : winrt::implements<StartupTimelinePackageProvider, IReactPackageProvider> {
+  void CreatePackage(IReactPackageBuilder const &packageBuilder) noexcept {
+    packageBuilder.as<IReactPackageBuilderEagerInit>().AddThreadAgnosticEagerInitTurboModule(
+        L"StartupTimelineModule", MakeTurboModuleProvider<StartupTimelineModule>());
+  }
+};
+
 } // namespace
 
 TEST_CLASS (ReactNativeHostTests) {
@@ -131,6 +145,56 @@ TEST_CLASS (ReactNativeHostTests) {
     TestEventService::ObserveEvents({TestEvent{"InstanceLoaded::Success", nullptr}});
   }
 
+  // Startup benchmark: checks that a headless startup records every phase of the startup timeline, and prints their
+  // times to compare startups across changes. The times are not checked, they depend on the machine.
+  TEST_METHOD(LoadInstance_RecordsStartupTimeline) {
+    TestEventService::Initialize();
+
+    auto reactNativeHost = TestReactNativeHostHolder(L"ReactNativeHostTests", [](ReactNativeHost const &host) noexcept {
+      host.PackageProviders().Append(winrt::make<StartupTimelinePackageProvider>());
+      host.InstanceSettings().EnableParallelModuleInit(true);
+      host.InstanceSettings().InstanceLoaded(
+          [](auto const &, winrt::Microsoft::ReactNative::IInstanceLoadedEventArgs args) noexcept {
+            if (args.Failed()) {
+              TestEventService::LogEvent("InstanceLoaded::Failed", nullptr);
+            } else {
+              TestEventService::LogEvent("InstanceLoaded::Success", nullptr);
+            }
+          });
+    });
+
+    TestEventService::ObserveEvents({TestEvent{"InstanceLoaded::Success", nullptr}});
+
+    const auto timeline = reactNativeHost.Host().GetStartupTimeline();
+    for (const auto &phase : timeline) {
+      std::printf(
+          "%-40ls start %8.2f ms, wall %8.2f ms, cpu %8.2f ms\n",
+          phase.Name.c_str(),
+          phase.StartMs,
+          phase.WallTimeMs,
+          phase.CpuTimeMs);
+    }
+
+    for (const wchar_t *name :
+         {L"CreatePackages",
+          L"InitializeBridgeless",
+          L"InitUIDependentCalls",
+          L"LoadModules",
+          L"InitModule:StartupTimelineModule",
+          L"CreatePreparedScriptStore",
+          L"CreateRuntime",
+          L"InitializeRuntime",
+          L"LoadBundle",
+          L"EvaluateBundle",
+          L"InstanceLoaded"}) {
+      const auto isRecorded =
+          std::any_of(timeline.begin(), timeline.end(), [name](const auto &phase) { return phase.Name == name; });
+      if (!isRecorded) {
+        TestCheckFail("Startup phase %ls is not recorded", name);
+      }
+    }
+  }
+
   TEST_METHOD(LoadInstance_FiresInstanceCreatedHasJsiAccess) {
     TestEventService::Initialize();
 
@@ -6,10 +6,12 @@
 #include <ReactCommon/TurboModule.h>
 #include <ReactCommon/TurboModuleUtils.h>
 #include <TurboModuleProvider.h> // It is RNW specific
+#include <atomic>
 #include <dispatchQueue/dispatchQueue.h>
 #include <future/future.h>
 #include <sstream>
 #include <string>
+#include <thread>
 #include "TestEventService.h"
 #include "TestReactNativeHostHolder.h"
 
@@ -555,6 +557,21 @@ struct CppTurboModulePackageProvider : winrt::implements<CppTurboModulePackagePr
   }
 };
 
+// Registers CppTurboModule as a thread agnostic eager init module, and records the thread it is provided on. The
+// thread id is atomic since it is written on the thread that provides the module and read on the test thread.
+struct ThreadAgnosticCppTurboModulePackageProvider
+    : winrt::implements<ThreadAgnosticCppTurboModulePackageProvider, IReactPackageProvider> {
+  void CreatePackage(IReactPackageBuilder const &packageBuilder) noexcept {
+    packageBuilder.as<IReactPackageBuilderEagerInit>().AddThreadAgnosticEagerInitTurboModule(
+        L"CppTurboModule", [](IReactModuleBuilder const &moduleBuilder) {
+          ProviderThreadId.store(std::this_thread::get_id());
+          return MakeTurboModuleProvider<CppTurboModule>()(moduleBuilder);
+        });
+  }
+
+  static inline std::atomic<std::thread::id> ProviderThreadId{};
+};
+
 } // namespace
 
 TEST_CLASS (TurboModuleTests) {
@@ -688,6 +705,38 @@ TEST_CLASS (TurboModuleTests) {
     TestCheck(!callbackIsCalled);
   }
 
+  TEST_METHOD(ParallelEagerInitTurboModule) {
+    TestEventService::Initialize();
+
+    std::atomic<std::thread::id> jsThreadId{};
+    ThreadAgnosticCppTurboModulePackageProvider::ProviderThreadId.store({});
+
+    auto reactNativeHost = TestReactNativeHostHolder(L"TurboModuleTests", [&](ReactNativeHost const &host) noexcept {
+      host.PackageProviders().Append(winrt::make<ThreadAgnosticCppTurboModulePackageProvider>());
+      host.InstanceSettings().EnableParallelModuleInit(true);
+      ReactPropertyBag(host.InstanceSettings().Properties())
+          .Set(CppTurboModule::TestName, L"ParallelEagerInitTurboModule");
+      host.InstanceSettings().InstanceCreated(
+          [&](winrt::Windows::Foundation::IInspectable const & /*sender*/, InstanceCreatedEventArgs const & /*args*/) {
+            jsThreadId.store(std::this_thread::get_id());
+          });
+    });
+
+    TestEventService::ObserveEvents({
+        TestEvent{"addSync", 42},
+    });
+
+    // The module was provided on a background thread, and its construction time was recorded.
+    const auto providerThreadId = ThreadAgnosticCppTurboModulePackageProvider::ProviderThreadId.load();
+    TestCheck(providerThreadId != std::thread::id{});
+    TestCheck(providerThreadId != jsThreadId.load());
+    bool hasInitPhase = false;
+    for (const auto &phase : reactNativeHost.Host().GetStartupTimeline()) {
+      hasInitPhase |= phase.Name == L"InitModule:CppTurboModule";
+    }
+    TestCheck(hasInitPhase);
+  }
+
   TEST_METHOD(DeferCallbackAfterInstanceUnload) {
     TestNotificationService::Initialize();
 
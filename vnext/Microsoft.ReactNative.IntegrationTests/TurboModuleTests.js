@@ -127,6 +127,8 @@ const promisify2 = fn =>
       CppTurboModule.logAction("sayHelloSync", CppTurboModule.sayHelloSync());
     } else if (testName === "JSDispatcherAfterInstanceUnload") {
       CppTurboModule.logAction("addSync", CppTurboModule.addSync(40, 2));
+    } else if (testName === "ParallelEagerInitTurboModule") {
+      CppTurboModule.logAction("addSync", CppTurboModule.addSync(40, 2));
     } else if (testName === "DeferCallbackAfterInstanceUnload") {
       CppTurboModule.negateDeferredCallback(4, _ => { });
     } else if (testName === "DeferResolveCallbackAfterInstanceUnload") {
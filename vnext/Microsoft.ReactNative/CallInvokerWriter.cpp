@@ -19,12 +19,6 @@ CallInvokerWriter::CallInvokerWriter(
       m_jsiRuntimeHolder(std::move(jsiRuntimeHolder)),
       m_threadId(std::this_thread::get_id()) {}
 
-CallInvokerWriter::~CallInvokerWriter() {
-  if (auto jsiRuntimeHolder = m_jsiRuntimeHolder.lock()) {
-    jsiRuntimeHolder->allowRelease();
-  }
-}
-
 void CallInvokerWriter::WithResultArgs(
     Mso::Functor<void(facebook::jsi::Runtime &rt, facebook::jsi::Value const *args, size_t argCount)>
         handler) noexcept {
@@ -14,8 +14,8 @@ namespace winrt::Microsoft::ReactNative {
 // IJSValueWriter to ensure that JsiWriter is always used from a RuntimeExecutor.
 // In case if writing is done outside of RuntimeExecutor, it uses DynamicWriter to create
 // folly::dynamic which then is written to JsiWriter in RuntimeExecutor.
+// The runtime holder is shared by the calls made in the runtime, and is not released by the writer.
 struct CallInvokerWriter : winrt::implements<CallInvokerWriter, IJSValueWriter> {
-  ~CallInvokerWriter();
   CallInvokerWriter(
       const std::shared_ptr<facebook::react::CallInvoker> &jsInvoker,
       std::weak_ptr<LongLivedJsiRuntime> jsiRuntimeHolder) noexcept;
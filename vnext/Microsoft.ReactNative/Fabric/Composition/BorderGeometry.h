@@ -0,0 +1,241 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Platform independent parts of BorderPrimitive: the pixel rounding of border metrics, the corner radii used to build
+// rounded border paths and a content addressed cache for the generated geometry. Nothing in here depends on Direct2D
+// or composition, so it can be unit tested in isolation.
+
+#include <react/renderer/components/view/primitives.h>
+#include <react/renderer/core/LayoutMetrics.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace winrt::Microsoft::ReactNative::Composition::implementation {
+
+// We don't want half pixel borders, or border radii - they lead to blurry borders
+// Also apply scale factor to the radii at this point
+inline void pixelRoundBorderRadii(facebook::react::BorderRadii &borderRadii, float scaleFactor) noexcept {
+  // Always round radii down to avoid spikey circles
+  borderRadii.topLeft = {
+      .vertical = std::floor(borderRadii.topLeft.vertical * scaleFactor),
+      .horizontal = std::floor(borderRadii.topLeft.horizontal * scaleFactor)};
+  borderRadii.topRight = {
+      .vertical = std::floor(borderRadii.topRight.vertical * scaleFactor),
+      .horizontal = std::floor(borderRadii.topRight.horizontal * scaleFactor)};
+  borderRadii.bottomLeft = {
+      .vertical = std::floor(borderRadii.bottomLeft.vertical * scaleFactor),
+      .horizontal = std::floor(borderRadii.bottomLeft.horizontal * scaleFactor)};
+  borderRadii.bottomRight = {
+      .vertical = std::floor(borderRadii.bottomRight.vertical * scaleFactor),
+      .horizontal = std::floor(borderRadii.bottomRight.horizontal * scaleFactor),
+  };
+}
+
+inline float pixelRoundAndScaleBorderWidth(float width, float scaleFactor) noexcept {
+  if (width == 0)
+    return width = 0;
+  return std::max(1.f, std::round(width * scaleFactor));
+}
+
+inline void scaleAndPixelRoundBorderWidths(
+    facebook::react::LayoutMetrics const &layoutMetrics,
+    facebook::react::BorderMetrics &borderMetrics,
+    float scaleFactor) noexcept {
+  borderMetrics.borderWidths.left = pixelRoundAndScaleBorderWidth(borderMetrics.borderWidths.left, scaleFactor);
+  borderMetrics.borderWidths.top = pixelRoundAndScaleBorderWidth(borderMetrics.borderWidths.top, scaleFactor);
+  borderMetrics.borderWidths.right = pixelRoundAndScaleBorderWidth(borderMetrics.borderWidths.right, scaleFactor);
+  borderMetrics.borderWidths.bottom = pixelRoundAndScaleBorderWidth(borderMetrics.borderWidths.bottom, scaleFactor);
+
+  // If we rounded both sides of the borderWidths up, we may have made the borderWidths larger than the total
+  if (layoutMetrics.frame.size.width * scaleFactor <
+      (borderMetrics.borderWidths.left + borderMetrics.borderWidths.right)) {
+    borderMetrics.borderWidths.right--;
+  }
+  if (layoutMetrics.frame.size.height * scaleFactor <
+      (borderMetrics.borderWidths.top + borderMetrics.borderWidths.bottom)) {
+    borderMetrics.borderWidths.bottom--;
+  }
+}
+
+struct RoundedPathParameters {
+  float topLeftRadiusX = 0;
+  float topLeftRadiusY = 0;
+  float topRightRadiusX = 0;
+  float topRightRadiusY = 0;
+  float bottomRightRadiusX = 0;
+  float bottomRightRadiusY = 0;
+  float bottomLeftRadiusX = 0;
+  float bottomLeftRadiusY = 0;
+};
+
+inline RoundedPathParameters GenerateRoundedPathParameters(
+    const facebook::react::RectangleCorners<facebook::react::CornerRadii> &baseRadius,
+    const facebook::react::RectangleEdges<float> &inset,
+    const facebook::react::Size &pathSize) noexcept {
+  RoundedPathParameters result;
+
+  if (pathSize.width == 0 || pathSize.height == 0) {
+    return result;
+  }
+
+  result.topLeftRadiusX = std::max(0.0f, baseRadius.topLeft.horizontal - inset.left);
+  result.topLeftRadiusY = std::max(0.0f, baseRadius.topLeft.vertical - inset.top);
+  result.topRightRadiusX = std::max(0.0f, baseRadius.topRight.horizontal - inset.right);
+  result.topRightRadiusY = std::max(0.0f, baseRadius.topRight.vertical - inset.top);
+  result.bottomRightRadiusX = std::max(0.0f, baseRadius.bottomRight.horizontal - inset.right);
+  result.bottomRightRadiusY = std::max(0.0f, baseRadius.bottomRight.vertical - inset.bottom);
+  result.bottomLeftRadiusX = std::max(0.0f, baseRadius.bottomLeft.horizontal - inset.left);
+  result.bottomLeftRadiusY = std::max(0.0f, baseRadius.bottomLeft.vertical - inset.bottom);
+
+  return result;
+}
+
+// Which geometry a BorderPrimitive builds for a rounded border
+enum class BorderGeometryKind : uint8_t {
+  // Outer and inner rounded paths combined into a filled geometry group (solid borders)
+  FilledRing,
+  // A single rounded path, stroked along the center of the border (dotted and dashed borders)
+  StrokedPath,
+};
+
+// Identifies the geometry of a rounded border. Two views with the same (already resolved and pixel rounded) widths,
+// radii, size and scale produce identical geometry, regardless of their colors.
+struct BorderGeometryKey {
+  BorderGeometryKind kind{BorderGeometryKind::FilledRing};
+  float width{0};
+  float height{0};
+  float scale{1};
+  facebook::react::BorderWidths borderWidths{};
+  facebook::react::BorderRadii borderRadii{};
+  // Geometry can only be used with resources from the factory that created it
+  const void *factory{nullptr};
+
+  static BorderGeometryKey Create(
+      BorderGeometryKind kind,
+      facebook::react::LayoutMetrics const &layoutMetrics,
+      const facebook::react::BorderMetrics &borderMetrics,
+      const void *factory) noexcept {
+    BorderGeometryKey key;
+    key.kind = kind;
+    key.width = layoutMetrics.frame.size.width * layoutMetrics.pointScaleFactor;
+    key.height = layoutMetrics.frame.size.height * layoutMetrics.pointScaleFactor;
+    key.scale = layoutMetrics.pointScaleFactor;
+    key.borderWidths = borderMetrics.borderWidths;
+    key.borderRadii = borderMetrics.borderRadii;
+    key.factory = factory;
+    return key;
+  }
+
+  bool operator==(const BorderGeometryKey &rhs) const noexcept {
+    return kind == rhs.kind && width == rhs.width && height == rhs.height && scale == rhs.scale &&
+        borderWidths == rhs.borderWidths && borderRadii == rhs.borderRadii && factory == rhs.factory;
+  }
+
+  bool operator!=(const BorderGeometryKey &rhs) const noexcept {
+    return !(*this == rhs);
+  }
+};
+
+struct BorderGeometryKeyHash {
+  size_t operator()(const BorderGeometryKey &key) const noexcept {
+    size_t seed = std::hash<uint8_t>{}(static_cast<uint8_t>(key.kind));
+    auto combine = [&seed](float value) noexcept {
+      seed ^= std::hash<float>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    };
+    combine(key.width);
+    combine(key.height);
+    combine(key.scale);
+    combine(key.borderWidths.left);
+    combine(key.borderWidths.top);
+    combine(key.borderWidths.right);
+    combine(key.borderWidths.bottom);
+    for (const auto &corner :
+         {key.borderRadii.topLeft, key.borderRadii.topRight, key.borderRadii.bottomLeft, key.borderRadii.bottomRight}) {
+      combine(corner.horizontal);
+      combine(corner.vertical);
+    }
+    seed ^= std::hash<const void *>{}(key.factory) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+  }
+};
+
+// Bounded, least recently used cache of border geometry shared between all views.
+// TGeometry must be cheap to copy (ex: a com_ptr).
+template <typename TGeometry>
+class BorderGeometryCache {
+ public:
+  explicit BorderGeometryCache(size_t capacity) noexcept : m_capacity(capacity) {}
+
+  // Returns the cached geometry for key, calling create to build it on a miss.
+  // Empty results from create are not cached.
+  template <typename TCreate>
+  TGeometry GetOrCreate(const BorderGeometryKey &key, TCreate &&create) {
+    {
+      std::scoped_lock lock{m_mutex};
+      auto it = m_entries.find(key);
+      if (it != m_entries.end()) {
+        m_lru.splice(m_lru.begin(), m_lru, it->second);
+        m_hits++;
+        return it->second->second;
+      }
+      m_misses++;
+    }
+
+    // Build outside of the lock; racing builders for the same key produce equivalent geometry.
+    TGeometry geometry = create();
+    if (!geometry) {
+      return geometry;
+    }
+
+    std::scoped_lock lock{m_mutex};
+    if (m_entries.find(key) == m_entries.end()) {
+      m_lru.emplace_front(key, geometry);
+      m_entries.emplace(key, m_lru.begin());
+      while (m_entries.size() > m_capacity) {
+        m_entries.erase(m_lru.back().first);
+        m_lru.pop_back();
+      }
+    }
+    return geometry;
+  }
+
+  void Clear() noexcept {
+    std::scoped_lock lock{m_mutex};
+    m_entries.clear();
+    m_lru.clear();
+  }
+
+  size_t Size() const noexcept {
+    std::scoped_lock lock{m_mutex};
+    return m_entries.size();
+  }
+
+  uint64_t Hits() const noexcept {
+    std::scoped_lock lock{m_mutex};
+    return m_hits;
+  }
+
+  uint64_t Misses() const noexcept {
+    std::scoped_lock lock{m_mutex};
+    return m_misses;
+  }
+
+ private:
+  using Entry = std::pair<BorderGeometryKey, TGeometry>;
+
+  const size_t m_capacity;
+  mutable std::mutex m_mutex;
+  std::list<Entry> m_lru;
+  std::unordered_map<BorderGeometryKey, typename std::list<Entry>::iterator, BorderGeometryKeyHash> m_entries;
+  uint64_t m_hits{0};
+  uint64_t m_misses{0};
+};
+
+} // namespace winrt::Microsoft::ReactNative::Composition::implementation
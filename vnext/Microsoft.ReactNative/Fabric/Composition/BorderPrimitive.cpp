@@ -9,49 +9,19 @@
 
 namespace winrt::Microsoft::ReactNative::Composition::implementation {
 
-// We don't want half pixel borders, or border radii - they lead to blurry borders
-// Also apply scale factor to the radii at this point
-void pixelRoundBorderRadii(facebook::react::BorderRadii &borderRadii, float scaleFactor) noexcept {
-  // Always round radii down to avoid spikey circles
-  borderRadii.topLeft = {
-      .vertical = std::floor(borderRadii.topLeft.vertical * scaleFactor),
-      .horizontal = std::floor(borderRadii.topLeft.horizontal * scaleFactor)};
-  borderRadii.topRight = {
-      .vertical = std::floor(borderRadii.topRight.vertical * scaleFactor),
-      .horizontal = std::floor(borderRadii.topRight.horizontal * scaleFactor)};
-  borderRadii.bottomLeft = {
-      .vertical = std::floor(borderRadii.bottomLeft.vertical * scaleFactor),
-      .horizontal = std::floor(borderRadii.bottomLeft.horizontal * scaleFactor)};
-  borderRadii.bottomRight = {
-      .vertical = std::floor(borderRadii.bottomRight.vertical * scaleFactor),
-      .horizontal = std::floor(borderRadii.bottomRight.horizontal * scaleFactor),
-  };
-}
+// Maximum number of distinct rounded border geometries kept alive for reuse across views
+constexpr size_t BorderGeometryCacheCapacity = 256;
 
-float pixelRoundAndScaleBorderWidth(float width, float scaleFactor) noexcept {
-  if (width == 0)
-    return width = 0;
-  return std::max(1.f, std::round(width * scaleFactor));
+static BorderGeometryCache<winrt::com_ptr<ID2D1Geometry>> &SharedBorderGeometryCache() noexcept {
+  static BorderGeometryCache<winrt::com_ptr<ID2D1Geometry>> cache{BorderGeometryCacheCapacity};
+  return cache;
 }
 
-void scaleAndPixelRoundBorderWidths(
-    facebook::react::LayoutMetrics const &layoutMetrics,
-    facebook::react::BorderMetrics &borderMetrics,
-    float scaleFactor) noexcept {
-  borderMetrics.borderWidths.left = pixelRoundAndScaleBorderWidth(borderMetrics.borderWidths.left, scaleFactor);
-  borderMetrics.borderWidths.top = pixelRoundAndScaleBorderWidth(borderMetrics.borderWidths.top, scaleFactor);
-  borderMetrics.borderWidths.right = pixelRoundAndScaleBorderWidth(borderMetrics.borderWidths.right, scaleFactor);
-  borderMetrics.borderWidths.bottom = pixelRoundAndScaleBorderWidth(borderMetrics.borderWidths.bottom, scaleFactor);
-
-  // If we rounded both sides of the borderWidths up, we may have made the borderWidths larger than the total
-  if (layoutMetrics.frame.size.width * scaleFactor <
-      (borderMetrics.borderWidths.left + borderMetrics.borderWidths.right)) {
-    borderMetrics.borderWidths.right--;
-  }
-  if (layoutMetrics.frame.size.height * scaleFactor <
-      (borderMetrics.borderWidths.top + borderMetrics.borderWidths.bottom)) {
-    borderMetrics.borderWidths.bottom--;
-  }
+template <typename TGeometry>
+static winrt::com_ptr<ID2D1Geometry> AsGeometry(const winrt::com_ptr<TGeometry> &geometry) noexcept {
+  winrt::com_ptr<ID2D1Geometry> result;
+  result.copy_from(geometry.get());
+  return result;
 }
 
 // react-native uses black as a default color when none is specified.
@@ -81,17 +51,6 @@ facebook::react::BorderMetrics BorderPrimitive::resolveAndAlignBorderMetrics(
   return borderMetrics;
 }
 
-struct RoundedPathParameters {
-  float topLeftRadiusX = 0;
-  float topLeftRadiusY = 0;
-  float topRightRadiusX = 0;
-  float topRightRadiusY = 0;
-  float bottomRightRadiusX = 0;
-  float bottomRightRadiusY = 0;
-  float bottomLeftRadiusX = 0;
-  float bottomLeftRadiusY = 0;
-};
-
 /*
  * Creates and returns a PathGeometry object used to clip the visuals of an element when a BorderRadius is set.
  * Can also be used as part of a GeometryGroup for drawing a rounded border / innerstroke when called from
@@ -246,28 +205,6 @@ static winrt::com_ptr<ID2D1PathGeometry> GenerateRoundedRectPathGeometry(
   return pathGeometry;
 }
 
-RoundedPathParameters GenerateRoundedPathParameters(
-    const facebook::react::RectangleCorners<facebook::react::CornerRadii> &baseRadius,
-    const facebook::react::RectangleEdges<float> &inset,
-    const facebook::react::Size &pathSize) noexcept {
-  RoundedPathParameters result;
-
-  if (pathSize.width == 0 || pathSize.height == 0) {
-    return result;
-  }
-
-  result.topLeftRadiusX = std::max(0.0f, baseRadius.topLeft.horizontal - inset.left);
-  result.topLeftRadiusY = std::max(0.0f, baseRadius.topLeft.vertical - inset.top);
-  result.topRightRadiusX = std::max(0.0f, baseRadius.topRight.horizontal - inset.right);
-  result.topRightRadiusY = std::max(0.0f, baseRadius.topRight.vertical - inset.top);
-  result.bottomRightRadiusX = std::max(0.0f, baseRadius.bottomRight.horizontal - inset.right);
-  result.bottomRightRadiusY = std::max(0.0f, baseRadius.bottomRight.vertical - inset.bottom);
-  result.bottomLeftRadiusX = std::max(0.0f, baseRadius.bottomLeft.horizontal - inset.left);
-  result.bottomLeftRadiusY = std::max(0.0f, baseRadius.bottomLeft.vertical - inset.bottom);
-
-  return result;
-}
-
 winrt::com_ptr<ID2D1PathGeometry> BorderPrimitive::GenerateRoundedRectPathGeometry(
     winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext &compContext,
     const facebook::react::RectangleCorners<facebook::react::CornerRadii> &baseRadius,
@@ -765,6 +702,7 @@ void BorderPrimitive::finalize(
   auto spBorderLayers = FindSpecialBorderLayers();
 
   if (!TryUpdateSpecialBorderLayers(m_outer->theme(), spBorderLayers, layoutMetrics, borderMetrics)) {
+    m_brushOnlyGeometryKey.reset();
     for (auto &spBorderLayer : spBorderLayers) {
       if (spBorderLayer) {
         spBorderLayer.as<winrt::Microsoft::ReactNative::Composition::Experimental::ISpriteVisual>().Brush(nullptr);
@@ -826,6 +764,7 @@ bool BorderPrimitive::TryUpdateSpecialBorderLayers(
 
   // Create the special border layers if they don't exist yet
   if (!spBorderVisuals[0]) {
+    m_brushOnlyGeometryKey.reset();
     auto borderInsertAtIndex = m_ownsRootVisual ? 0 : m_outer->borderInsertAtIndex();
     for (uint8_t i = 0; i < SpecialBorderLayerCount; i++) {
       auto visual = m_outer->CompositionContext().CreateSpriteVisual();
@@ -843,17 +782,32 @@ bool BorderPrimitive::TryUpdateSpecialBorderLayers(
       borderMetrics.borderRadii.topLeft.vertical != 0 || borderMetrics.borderRadii.topRight.vertical != 0 ||
       borderMetrics.borderRadii.bottomLeft.vertical != 0 || borderMetrics.borderRadii.bottomRight.vertical != 0) {
     auto compContext = m_outer->CompositionContext();
-    if (borderStyle == facebook::react::BorderStyle::Dotted || borderStyle == facebook::react::BorderStyle::Dashed) {
-      // Because in DirectX geometry starts at the center of the stroke, we need to deflate
-      // rectangle by half the stroke width to render correctly.
-      facebook::react::RectangleEdges<float> rectPathGeometry = {
-          borderMetrics.borderWidths.left / 2.0f,
-          borderMetrics.borderWidths.top / 2.0f,
-          extentWidth - borderMetrics.borderWidths.right / 2.0f,
-          extentHeight - borderMetrics.borderWidths.bottom / 2.0f};
+    winrt::com_ptr<ID2D1Factory1> spD2dFactory;
+    compContext.as<::Microsoft::ReactNative::Composition::Experimental::ICompositionContextInterop>()->D2DFactory(
+        spD2dFactory.put());
 
-      winrt::com_ptr<ID2D1PathGeometry> pathGeometry =
-          GenerateRoundedRectPathGeometry(compContext, borderMetrics.borderRadii, {0, 0, 0, 0}, rectPathGeometry);
+    if (borderStyle == facebook::react::BorderStyle::Dotted || borderStyle == facebook::react::BorderStyle::Dashed) {
+      // The dotted/dashed layers draw the border color into their surfaces, so they are redrawn on any change.
+      m_brushOnlyGeometryKey.reset();
+
+      auto geometry = SharedBorderGeometryCache().GetOrCreate(
+          BorderGeometryKey::Create(BorderGeometryKind::StrokedPath, layoutMetrics, borderMetrics, spD2dFactory.get()),
+          [&]() noexcept -> winrt::com_ptr<ID2D1Geometry> {
+            // Because in DirectX geometry starts at the center of the stroke, we need to deflate
+            // rectangle by half the stroke width to render correctly.
+            facebook::react::RectangleEdges<float> rectPathGeometry = {
+                borderMetrics.borderWidths.left / 2.0f,
+                borderMetrics.borderWidths.top / 2.0f,
+                extentWidth - borderMetrics.borderWidths.right / 2.0f,
+                extentHeight - borderMetrics.borderWidths.bottom / 2.0f};
+
+            return AsGeometry(GenerateRoundedRectPathGeometry(
+                compContext, borderMetrics.borderRadii, {0, 0, 0, 0}, rectPathGeometry));
+          });
+      winrt::com_ptr<ID2D1PathGeometry> pathGeometry;
+      if (geometry) {
+        geometry.as(pathGeometry);
+      }
 
       if (pathGeometry) {
         DrawAllBorderLayers(
@@ -871,15 +825,38 @@ bool BorderPrimitive::TryUpdateSpecialBorderLayers(
         assert(false);
       }
     } else {
-      facebook::react::RectangleEdges<float> rectPathGeometry = {0, 0, extentWidth, extentHeight};
+      auto geometryKey =
+          BorderGeometryKey::Create(BorderGeometryKind::FilledRing, layoutMetrics, borderMetrics, spD2dFactory.get());
+
+      // The layers are clipped to the shared geometry and filled with a color brush, so when only the colors changed
+      // there is no need to touch the geometry, clipping paths or layer positions.
+      if (m_brushOnlyGeometryKey == geometryKey) {
+        UpdateSpecialBorderLayerBrushes(theme, spBorderVisuals, borderMetrics.borderColors);
+        return true;
+      }
 
-      winrt::com_ptr<ID2D1GeometryGroup> pathGeometry = GetGeometryForRoundedBorder(
-          compContext,
-          borderMetrics.borderRadii,
-          {0, 0, 0, 0}, // inset
-          borderMetrics.borderWidths,
-          rectPathGeometry);
+      auto geometry =
+          SharedBorderGeometryCache().GetOrCreate(geometryKey, [&]() noexcept -> winrt::com_ptr<ID2D1Geometry> {
+            facebook::react::RectangleEdges<float> rectPathGeometry = {0, 0, extentWidth, extentHeight};
+
+            return AsGeometry(GetGeometryForRoundedBorder(
+                compContext,
+                borderMetrics.borderRadii,
+                {0, 0, 0, 0}, // inset
+                borderMetrics.borderWidths,
+                rectPathGeometry));
+          });
+      winrt::com_ptr<ID2D1GeometryGroup> pathGeometry;
+      if (geometry) {
+        geometry.as(pathGeometry);
+      }
+      if (!pathGeometry) {
+        assert(false);
+        m_brushOnlyGeometryKey.reset();
+        return false;
+      }
 
+      m_brushOnlyGeometryKey = geometryKey;
       DrawAllBorderLayers(
           theme,
           compContext,
@@ -893,6 +870,7 @@ bool BorderPrimitive::TryUpdateSpecialBorderLayers(
           borderStyle);
     }
   } else {
+    m_brushOnlyGeometryKey.reset();
     auto compContext = m_outer->CompositionContext();
     // Because in DirectX geometry starts at the center of the stroke, we need to deflate rectangle by half the stroke
     // width / height to render correctly.
@@ -916,4 +894,26 @@ bool BorderPrimitive::TryUpdateSpecialBorderLayers(
   return true;
 }
 
+void BorderPrimitive::UpdateSpecialBorderLayerBrushes(
+    winrt::Microsoft::ReactNative::Composition::implementation::Theme *theme,
+    std::array<winrt::Microsoft::ReactNative::Composition::Experimental::ISpriteVisual, SpecialBorderLayerCount>
+        &spBorderVisuals,
+    const facebook::react::BorderColors &borderColors) noexcept {
+  // Same layer order and corner color fallbacks as DrawAllBorderLayers
+  const facebook::react::SharedColor *layerColors[SpecialBorderLayerCount] = {
+      borderColors.left ? &borderColors.left : &borderColors.top, // Top Left Corner
+      &borderColors.top, // Top Edge
+      borderColors.right ? &borderColors.right : &borderColors.top, // Top Right Corner
+      &borderColors.right, // Right Edge
+      borderColors.right ? &borderColors.right : &borderColors.bottom, // Bottom Right Corner
+      &borderColors.bottom, // Bottom Edge
+      borderColors.left ? &borderColors.left : &borderColors.bottom, // Bottom Left Corner
+      &borderColors.left, // Left Edge
+  };
+
+  for (size_t i = 0; i < SpecialBorderLayerCount; i++) {
+    spBorderVisuals[i].Brush(theme->Brush(**layerColors[i]));
+  }
+}
+
 } // namespace winrt::Microsoft::ReactNative::Composition::implementation
@@ -8,14 +8,13 @@
 #include <Microsoft.ReactNative.Cxx/ReactContext.h>
 #include <react/renderer/components/view/ViewEventEmitter.h>
 #include <react/renderer/components/view/ViewProps.h>
+#include "BorderGeometry.h"
 #include "CompositionHelpers.h"
 
 namespace winrt::Microsoft::ReactNative::Composition::implementation {
 
 struct ComponentView;
 
-float pixelRoundAndScaleBorderWidth(float width, float scaleFactor) noexcept;
-
 // Controls adding/removing appropriate visuals to a parent to render a specific border without requiring
 struct BorderPrimitive {
   static constexpr size_t SpecialBorderLayerCount = 8;
@@ -73,7 +72,15 @@ struct BorderPrimitive {
       facebook::react::LayoutMetrics const &layoutMetrics,
       const facebook::react::BorderMetrics &borderMetrics) noexcept;
 
+  void UpdateSpecialBorderLayerBrushes(
+      winrt::Microsoft::ReactNative::Composition::implementation::Theme *theme,
+      std::array<winrt::Microsoft::ReactNative::Composition::Experimental::ISpriteVisual, SpecialBorderLayerCount>
+          &spBorderVisuals,
+      const facebook::react::BorderColors &borderColors) noexcept;
+
   uint8_t m_numBorderVisuals{0};
+  // Geometry the border layers currently use, when the layers only need a new brush if colors change
+  std::optional<BorderGeometryKey> m_brushOnlyGeometryKey;
   winrt::Microsoft::ReactNative::Composition::implementation::ComponentView *m_outer;
   winrt::Microsoft::ReactNative::Composition::Experimental::IVisual m_rootVisual{nullptr};
   bool m_needsUpdate : 1 {true};
@@ -266,6 +266,7 @@ struct CompDrawingSurfaceBrush : public winrt::implements<
                                      winrt::Microsoft::ReactNative::Composition::Experimental::IBrush,
                                      typename TTypeRedirects::IInnerCompositionBrush,
                                      ICompositionDrawingSurfaceInterop,
+                                     ICompositionDrawingSurfaceUpdateRectInterop,
                                      typename TTypeRedirects::IInnerCompositionDrawingSurface> {
   CompDrawingSurfaceBrush(
       const typename TTypeRedirects::Compositor &compositor,
@@ -289,6 +290,22 @@ struct CompDrawingSurfaceBrush : public winrt::implements<
     return hr;
   }
 
+  HRESULT BeginDrawRect(
+      const RECT &updateRect,
+      ID2D1DeviceContext **deviceContextOut,
+      float xDpi,
+      float yDpi,
+      POINT *offset) noexcept {
+    assert(updateRect.right > updateRect.left && updateRect.bottom > updateRect.top);
+
+    auto hr = m_drawingSurfaceInterop->BeginDraw(
+        &updateRect, __uuidof(ID2D1DeviceContext), (void **)deviceContextOut, offset);
+    if (SUCCEEDED(hr)) {
+      (*deviceContextOut)->SetDpi(xDpi, yDpi);
+    }
+    return hr;
+  }
+
   HRESULT EndDraw() noexcept {
     return m_drawingSurfaceInterop->EndDraw();
   }
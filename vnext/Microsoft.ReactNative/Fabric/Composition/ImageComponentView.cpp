@@ -15,6 +15,7 @@
 #include <AutoDraw.h>
 #include <Fabric/AbiViewProps.h>
 #include <Fabric/FabricUIManagerModule.h>
+#include <Fabric/WindowsImageManager.h>
 #include <Utils/ImageUtils.h>
 #include <shcore.h>
 #include <winrt/Windows.Graphics.Effects.h>
@@ -23,6 +24,7 @@
 #include <winrt/Windows.Web.Http.h>
 #include "CompositionHelpers.h"
 #include "RootComponentView.h"
+#include "ScrollViewComponentView.h"
 
 extern "C" HRESULT WINAPI WICCreateImagingFactory_Proxy(UINT SDKVersion, IWICImagingFactory **ppIWICImagingFactory);
 
@@ -190,13 +192,24 @@ void ImageComponentView::setStateAndResubscribeImageResponseObserver(
   if (m_state) {
     auto &observerCoordinator = m_state->getData().getImageRequest().getObserverCoordinator();
     observerCoordinator.removeObserver(m_imageResponseObserver);
+
+    auto pipeline = ::Microsoft::ReactNative::GetImagePipeline(m_reactContext.Properties());
+    if (!state) {
+      // The view is being recycled, but the same state may be mounted again soon, so keep loading its image quietly
+      pipeline->SetPriority(&observerCoordinator, ImageRequestPriority::Prefetch);
+    } else if (&state->getData().getImageRequest().getObserverCoordinator() != &observerCoordinator) {
+      // The source changed, nobody is going to display the previous image
+      pipeline->Cancel(&observerCoordinator);
+    }
   }
 
   m_state = state;
+  m_offscreen = false;
 
   if (m_state) {
     auto &observerCoordinator = m_state->getData().getImageRequest().getObserverCoordinator();
     observerCoordinator.addObserver(m_imageResponseObserver);
+    updateRequestPriority();
   }
 }
 
@@ -204,6 +217,79 @@ void ImageComponentView::prepareForRecycle() noexcept {
   setStateAndResubscribeImageResponseObserver(nullptr);
 }
 
+void ImageComponentView::onMounted() noexcept {
+  Super::onMounted();
+
+  auto view = Parent();
+  while (view) {
+    if (auto scrollView = view.try_as<winrt::Microsoft::ReactNative::Composition::ScrollViewComponentView>()) {
+      auto token =
+          scrollView.ViewChanged([wkThis = get_weak()](const winrt::IInspectable &, const winrt::IInspectable &) {
+            if (auto strongThis = wkThis.get()) {
+              strongThis->updateRequestPriority();
+            }
+          });
+      m_viewChangedSubscriptions.push_back({scrollView, token});
+    }
+    view = view.Parent();
+  }
+
+  updateRequestPriority();
+}
+
+void ImageComponentView::onUnmounted() noexcept {
+  Super::onUnmounted();
+
+  for (auto &subscription : m_viewChangedSubscriptions) {
+    if (auto scrollView = subscription.scrollView.get()) {
+      scrollView.ViewChanged(subscription.token);
+    }
+  }
+  m_viewChangedSubscriptions.clear();
+}
+
+// Whether the image is within (about half a viewport of) the visible part of every ScrollView it is in
+bool ImageComponentView::isNearViewport() const noexcept {
+  auto frame = m_layoutMetrics.frame;
+  auto view = Parent();
+  while (view) {
+    if (auto scrollView = view.try_as<winrt::Microsoft::ReactNative::Composition::ScrollViewComponentView>()) {
+      auto visible = winrt::get_self<ScrollViewComponentView>(scrollView)->visibleContentRect();
+      auto marginX = visible.size.width / 2;
+      auto marginY = visible.size.height / 2;
+      if (frame.getMaxX() < visible.getMinX() - marginX || frame.getMinX() > visible.getMaxX() + marginX ||
+          frame.getMaxY() < visible.getMinY() - marginY || frame.getMinY() > visible.getMaxY() + marginY) {
+        return false;
+      }
+      frame.origin.x -= visible.origin.x;
+      frame.origin.y -= visible.origin.y;
+    }
+
+    auto parentFrame = view.LayoutMetrics().Frame;
+    frame.origin.x += parentFrame.X;
+    frame.origin.y += parentFrame.Y;
+    view = view.Parent();
+  }
+  return true;
+}
+
+void ImageComponentView::updateRequestPriority() noexcept {
+  if (!m_state || !isMounted()) {
+    return;
+  }
+
+  bool offscreen = !isNearViewport();
+  if (offscreen == m_offscreen) {
+    return;
+  }
+  m_offscreen = offscreen;
+
+  ::Microsoft::ReactNative::GetImagePipeline(m_reactContext.Properties())
+      ->SetPriority(
+          &m_state->getData().getImageRequest().getObserverCoordinator(),
+          offscreen ? ImageRequestPriority::Offscreen : ImageRequestPriority::Visible);
+}
+
 winrt::Microsoft::ReactNative::ImageProps ImageComponentView::ImageProps() noexcept {
   // We do not currently support custom ImageComponentView's
   // If we did we would need to create a AbiImageProps and possibly return them here
@@ -229,6 +315,27 @@ bool ImageComponentView::themeEffectsImage() const noexcept {
   return viewProps()->backgroundColor || isColorMeaningful(imageProps().tintColor);
 }
 
+// The size in pixels to draw the current image at. Images are downsampled to their display size when decoded, which
+// the stretching resize modes don't notice, but the modes that draw the image at its natural size need to scale the
+// bitmap back up to that size.
+void ImageComponentView::imageDrawSize(UINT &width, UINT &height) const noexcept {
+  width = height = 0;
+  if (!m_imageResponseImage || !m_imageResponseImage->m_wicbmp) {
+    return;
+  }
+
+  winrt::check_hresult(m_imageResponseImage->m_wicbmp->GetSize(&width, &height));
+
+  const auto resizeMode = imageProps().resizeMode;
+  if (m_imageResponseImage->m_naturalWidth && m_imageResponseImage->m_naturalHeight &&
+      (resizeMode == facebook::react::ImageResizeMode::Center ||
+       resizeMode == facebook::react::ImageResizeMode::Repeat ||
+       resizeMode == facebook::react::ImageResizeMode::None)) {
+    width = m_imageResponseImage->m_naturalWidth;
+    height = m_imageResponseImage->m_naturalHeight;
+  }
+}
+
 void ImageComponentView::onThemeChanged() noexcept {
   if (themeEffectsImage()) {
     m_drawingSurface = nullptr;
@@ -251,9 +358,7 @@ void ImageComponentView::ensureDrawingSurface() noexcept {
   }
 
   UINT width = 0, height = 0;
-  if (m_imageResponseImage->m_wicbmp) {
-    winrt::check_hresult(m_imageResponseImage->m_wicbmp->GetSize(&width, &height));
-  }
+  imageDrawSize(width, height);
 
   if (!m_drawingSurface && m_imageResponseImage->m_wicbmp) {
     winrt::Windows::Foundation::Size drawingSurfaceSize{static_cast<float>(width), static_cast<float>(height)};
@@ -361,6 +466,17 @@ void ImageComponentView::DrawImage() noexcept {
       winrt::check_hresult(
           bitmapEffects->SetValue(D2D1_BITMAPSOURCE_PROP_WIC_BITMAP_SOURCE, m_imageResponseImage->m_wicbmp.get()));
 
+      UINT bitmapWidth, bitmapHeight, drawWidth, drawHeight;
+      winrt::check_hresult(m_imageResponseImage->m_wicbmp->GetSize(&bitmapWidth, &bitmapHeight));
+      imageDrawSize(drawWidth, drawHeight);
+      if (drawWidth != bitmapWidth || drawHeight != bitmapHeight) {
+        winrt::check_hresult(bitmapEffects->SetValue(
+            D2D1_BITMAPSOURCE_PROP_SCALE,
+            D2D1::Vector2F(
+                static_cast<float>(drawWidth) / static_cast<float>(bitmapWidth),
+                static_cast<float>(drawHeight) / static_cast<float>(bitmapHeight))));
+      }
+
       if (imgProps.blurRadius > 0) {
         winrt::com_ptr<ID2D1Effect> gaussianBlurEffect;
         winrt::check_hresult(d2dDeviceContext->CreateEffect(CLSID_D2D1GaussianBlur, gaussianBlurEffect.put()));
@@ -407,7 +523,7 @@ void ImageComponentView::DrawImage() noexcept {
       }
     } else {
       UINT width, height;
-      winrt::check_hresult(m_imageResponseImage->m_wicbmp->GetSize(&width, &height));
+      imageDrawSize(width, height);
 
       D2D1_RECT_F rect = D2D1::RectF(
           static_cast<float>(offset.x),
@@ -47,6 +47,8 @@ struct ImageComponentView : ImageComponentViewT<ImageComponentView, ViewComponen
   void updateState(facebook::react::State::Shared const &state, facebook::react::State::Shared const &oldState) noexcept
       override;
   void prepareForRecycle() noexcept override;
+  void onMounted() noexcept override;
+  void onUnmounted() noexcept override;
   void OnRenderingDeviceLost() noexcept override;
   void onThemeChanged() noexcept override;
 
@@ -94,12 +96,23 @@ struct ImageComponentView : ImageComponentViewT<ImageComponentView, ViewComponen
   void setStateAndResubscribeImageResponseObserver(
       facebook::react::ImageShadowNode::ConcreteState::Shared const &state) noexcept;
   bool themeEffectsImage() const noexcept;
+  void imageDrawSize(UINT &width, UINT &height) const noexcept;
+  bool isNearViewport() const noexcept;
+  void updateRequestPriority() noexcept;
 
   winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush m_drawingSurface;
   std::shared_ptr<ImageResponseImage> m_imageResponseImage;
   std::shared_ptr<WindowsImageResponseObserver> m_imageResponseObserver;
   bool m_requiresImageRedraw{true};
   facebook::react::ImageShadowNode::ConcreteState::Shared m_state;
+  bool m_offscreen{false};
+
+  // Scrolling an ancestor ScrollView can move the image on or off screen, which changes how urgently it is decoded
+  struct ViewChangedSubscription {
+    winrt::weak_ref<winrt::Microsoft::ReactNative::Composition::ScrollViewComponentView> scrollView;
+    winrt::event_token token;
+  };
+  std::vector<ViewChangedSubscription> m_viewChangedSubscriptions;
 };
 
 } // namespace winrt::Microsoft::ReactNative::Composition::implementation
@@ -0,0 +1,539 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Platform independent core of the shared image pipeline: a byte budgeted cache of decoded images and the scheduling
+// logic that coalesces concurrent requests for the same image and runs decodes on a background queue. The platform
+// specific fetching and decoding (WIC) is supplied by WindowsImageManager, so this can be unit tested with a fake
+// decoder.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace winrt::Microsoft::ReactNative::Composition::implementation {
+
+// Identifies a decoded image. The same uri decoded for two different display sizes produces two entries, since the
+// pipeline downsamples to the size the image is displayed at.
+struct ImageCacheKey {
+  std::string uri;
+  // Target decode size in physical pixels, 0 if the image should be decoded at its natural size
+  uint32_t width{0};
+  uint32_t height{0};
+
+  bool operator==(const ImageCacheKey &rhs) const noexcept {
+    return width == rhs.width && height == rhs.height && uri == rhs.uri;
+  }
+
+  bool operator!=(const ImageCacheKey &rhs) const noexcept {
+    return !(*this == rhs);
+  }
+};
+
+struct ImageCacheKeyHash {
+  size_t operator()(const ImageCacheKey &key) const noexcept {
+    size_t seed = std::hash<std::string>{}(key.uri);
+    seed ^= std::hash<uint32_t>{}(key.width) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= std::hash<uint32_t>{}(key.height) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+  }
+};
+
+enum class ImageMemoryPressure : uint8_t {
+  // Drop the least recently used half of the budget
+  Moderate,
+  // Drop all cached images; images still displayed stay alive through their views
+  Critical,
+};
+
+// Lets the system memory be checked at most once per interval, however many images complete meanwhile
+class MemoryCheckThrottle {
+ public:
+  explicit MemoryCheckThrottle(int64_t intervalMs) noexcept : m_intervalMs{intervalMs} {}
+
+  // Whether a check is due at now (in milliseconds). If so, the next one is due an interval later.
+  bool TryStart(int64_t now) noexcept {
+    auto due = m_due.load();
+    return now >= due && m_due.compare_exchange_strong(due, now + m_intervalMs);
+  }
+
+ private:
+  const int64_t m_intervalMs;
+  std::atomic<int64_t> m_due{std::numeric_limits<int64_t>::min()};
+};
+
+// Least recently used cache of decoded images, bounded by the total size of the decoded pixels rather than the number
+// of entries. TImage must be cheap to copy (ex: a shared_ptr).
+template <typename TImage>
+class DecodedImageCache {
+ public:
+  explicit DecodedImageCache(size_t byteBudget) noexcept : m_byteBudget(byteBudget) {}
+
+  // Returns the cached image, or an empty TImage on a miss
+  TImage Get(const ImageCacheKey &key) noexcept {
+    std::scoped_lock lock{m_mutex};
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+      m_misses++;
+      return TImage{};
+    }
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+    m_hits++;
+    return it->second->image;
+  }
+
+  bool Contains(const ImageCacheKey &key) const noexcept {
+    std::scoped_lock lock{m_mutex};
+    return m_entries.find(key) != m_entries.end();
+  }
+
+  // True if the uri is cached at any size
+  bool ContainsUri(const std::string &uri) const noexcept {
+    std::scoped_lock lock{m_mutex};
+    return m_uriCounts.find(uri) != m_uriCounts.end();
+  }
+
+  // Images larger than the whole budget are not cached
+  void Put(const ImageCacheKey &key, const TImage &image, size_t byteSize) noexcept {
+    std::scoped_lock lock{m_mutex};
+    if (byteSize > m_byteBudget) {
+      return;
+    }
+
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+      m_bytesUsed -= it->second->byteSize;
+      m_lru.erase(it->second);
+      m_entries.erase(it);
+    } else {
+      m_uriCounts[key.uri]++;
+    }
+
+    m_lru.push_front({key, image, byteSize});
+    m_entries.emplace(key, m_lru.begin());
+    m_bytesUsed += byteSize;
+    TrimLocked(m_byteBudget);
+  }
+
+  // Evicts least recently used images until no more than targetBytes are used
+  void Trim(size_t targetBytes) noexcept {
+    std::scoped_lock lock{m_mutex};
+    TrimLocked(targetBytes);
+  }
+
+  void SetByteBudget(size_t byteBudget) noexcept {
+    std::scoped_lock lock{m_mutex};
+    m_byteBudget = byteBudget;
+    TrimLocked(m_byteBudget);
+  }
+
+  void Clear() noexcept {
+    std::scoped_lock lock{m_mutex};
+    m_entries.clear();
+    m_uriCounts.clear();
+    m_lru.clear();
+    m_bytesUsed = 0;
+  }
+
+  size_t ByteBudget() const noexcept {
+    std::scoped_lock lock{m_mutex};
+    return m_byteBudget;
+  }
+
+  size_t BytesUsed() const noexcept {
+    std::scoped_lock lock{m_mutex};
+    return m_bytesUsed;
+  }
+
+  size_t Size() const noexcept {
+    std::scoped_lock lock{m_mutex};
+    return m_entries.size();
+  }
+
+  uint64_t Hits() const noexcept {
+    std::scoped_lock lock{m_mutex};
+    return m_hits;
+  }
+
+  uint64_t Misses() const noexcept {
+    std::scoped_lock lock{m_mutex};
+    return m_misses;
+  }
+
+ private:
+  struct Entry {
+    ImageCacheKey key;
+    TImage image;
+    size_t byteSize;
+  };
+
+  void TrimLocked(size_t targetBytes) noexcept {
+    while (m_bytesUsed > targetBytes && !m_lru.empty()) {
+      const auto &entry = m_lru.back();
+      m_bytesUsed -= entry.byteSize;
+      if (--m_uriCounts[entry.key.uri] == 0) {
+        m_uriCounts.erase(entry.key.uri);
+      }
+      m_entries.erase(entry.key);
+      m_lru.pop_back();
+    }
+  }
+
+  mutable std::mutex m_mutex;
+  size_t m_byteBudget;
+  size_t m_bytesUsed{0};
+  std::list<Entry> m_lru;
+  std::unordered_map<ImageCacheKey, typename std::list<Entry>::iterator, ImageCacheKeyHash> m_entries;
+  std::unordered_map<std::string, size_t> m_uriCounts;
+  uint64_t m_hits{0};
+  uint64_t m_misses{0};
+};
+
+// How urgently a requester needs an image. Decodes for higher priorities are started first.
+enum class ImageRequestPriority : uint8_t {
+  // Warming the cache for images that are not displayed yet (Image.prefetch)
+  Prefetch,
+  // Displayed by a view that is scrolled out of its ScrollView's viewport
+  Offscreen,
+  // Displayed on screen, or about to be
+  Visible,
+};
+
+// Shares fetches and decodes between all requests for the same ImageCacheKey and caches the decoded results.
+//
+// A request is served in one of three ways:
+//  - synchronously from the decoded image cache
+//  - by joining a fetch or decode already in flight for the same key
+//  - by starting a new fetch. When the fetch completes it hands back a decoder, which is queued and run on the
+//    background scheduler so that decoding never happens on the thread that completed the fetch (possibly the UI
+//    thread). At most maxConcurrentDecodes decodes run at once, the highest priority first.
+//
+// A request for a specific target size is also served by an image decoded at its natural size (ex: prefetched).
+//
+// Requests can be reprioritized or cancelled by their owner. Decodes nobody is waiting for any more are dropped
+// before they start.
+//
+// Must be owned by a std::shared_ptr; requests in flight keep the pipeline alive until they complete.
+template <typename TImage, typename TError>
+class ImagePipeline : public std::enable_shared_from_this<ImagePipeline<TImage, TError>> {
+ public:
+  struct DecodeResult {
+    TImage image{};
+    // Size of the decoded pixels, used for the cache budget. Results with a byteSize of 0 are not cached.
+    size_t byteSize{0};
+    TError error{};
+  };
+
+  using Task = std::function<void()>;
+  using Scheduler = std::function<void(Task &&task)>;
+  using Decoder = std::function<DecodeResult()>;
+  using ProgressCallback = std::function<void(int64_t loaded, int64_t total)>;
+  using FetchCompletion = std::function<void(Decoder &&decoder)>;
+  using Fetcher = std::function<void(ProgressCallback &&progress, FetchCompletion &&complete)>;
+  using CompletionCallback = std::function<void(const TImage &image, const TError &error)>;
+
+  struct Requester {
+    // Identifies the request for SetPriority and Cancel, may be null if the request is never updated
+    const void *owner{nullptr};
+    ImageRequestPriority priority{ImageRequestPriority::Visible};
+    ProgressCallback progress;
+    CompletionCallback completion;
+    // Optional, returns false once the result is no longer needed (ex: whatever would display it was destroyed)
+    std::function<bool()> isWanted;
+  };
+
+  struct Stats {
+    uint64_t cacheHits{0};
+    uint64_t coalesced{0};
+    uint64_t fetches{0};
+    uint64_t decodes{0};
+    uint64_t cancelledDecodes{0};
+  };
+
+  ImagePipeline(size_t byteBudget, Scheduler scheduler, size_t maxConcurrentDecodes = 2) noexcept
+      : m_cache(byteBudget),
+        m_scheduler(std::move(scheduler)),
+        m_maxConcurrentDecodes(maxConcurrentDecodes > 0 ? maxConcurrentDecodes : 1) {}
+
+  // Returns true if the request was completed synchronously from the cache.
+  // fetch is only called if there is no cached image and no request in flight for the same key.
+  bool Request(const ImageCacheKey &key, Fetcher &&fetch, Requester &&requester) noexcept {
+    auto image = m_cache.Get(key);
+    if (!image && (key.width || key.height)) {
+      image = m_cache.Get(NaturalSizeKey(key));
+    }
+    if (image) {
+      {
+        std::scoped_lock lock{m_mutex};
+        m_stats.cacheHits++;
+      }
+      requester.completion(image, TError{});
+      return true;
+    }
+
+    {
+      std::scoped_lock lock{m_mutex};
+      if (requester.owner) {
+        RemoveOwnerLocked(requester.owner);
+      }
+
+      auto it = m_jobs.find(key);
+      if (it == m_jobs.end() && (key.width || key.height)) {
+        it = m_jobs.find(NaturalSizeKey(key));
+      }
+      if (it != m_jobs.end()) {
+        if (requester.owner) {
+          m_owners[requester.owner] = it->first;
+        }
+        it->second.waiters.push_back(std::move(requester));
+        m_stats.coalesced++;
+        return false;
+      }
+
+      if (requester.owner) {
+        m_owners[requester.owner] = key;
+      }
+      m_jobs[key].waiters.push_back(std::move(requester));
+      m_stats.fetches++;
+    }
+
+    auto self = this->shared_from_this();
+    fetch(
+        [self, key](int64_t loaded, int64_t total) noexcept { self->NotifyProgress(key, loaded, total); },
+        [self, key](Decoder &&decoder) noexcept { self->OnFetched(key, std::move(decoder)); });
+    return false;
+  }
+
+  // Changes the priority of a pending request, ex: when the view displaying it scrolls on or off screen
+  void SetPriority(const void *owner, ImageRequestPriority priority) noexcept {
+    std::scoped_lock lock{m_mutex};
+    auto owned = m_owners.find(owner);
+    if (owned == m_owners.end()) {
+      return;
+    }
+    auto it = m_jobs.find(owned->second);
+    if (it == m_jobs.end()) {
+      return;
+    }
+    for (auto &waiter : it->second.waiters) {
+      if (waiter.owner == owner) {
+        waiter.priority = priority;
+      }
+    }
+  }
+
+  // Stops delivering the result of a pending request. The decode is dropped if nobody else is waiting for it and it
+  // has not started yet.
+  void Cancel(const void *owner) noexcept {
+    std::scoped_lock lock{m_mutex};
+    RemoveOwnerLocked(owner);
+  }
+
+  // Called when the system reports memory pressure, or when the app is suspended
+  void OnMemoryPressure(ImageMemoryPressure level) noexcept {
+    m_cache.Trim(level == ImageMemoryPressure::Critical ? 0 : m_cache.ByteBudget() / 2);
+  }
+
+  DecodedImageCache<TImage> &Cache() noexcept {
+    return m_cache;
+  }
+
+  size_t InFlight() const noexcept {
+    std::scoped_lock lock{m_mutex};
+    return m_jobs.size();
+  }
+
+  Stats GetStats() const noexcept {
+    std::scoped_lock lock{m_mutex};
+    return m_stats;
+  }
+
+ private:
+  struct Job {
+    std::vector<Requester> waiters;
+    // Set once the fetch completes
+    Decoder decoder;
+    bool fetched{false};
+    bool decoding{false};
+  };
+
+  static ImageCacheKey NaturalSizeKey(const ImageCacheKey &key) noexcept {
+    return ImageCacheKey{key.uri, 0, 0};
+  }
+
+  static ImageRequestPriority JobPriority(const Job &job) noexcept {
+    auto priority = ImageRequestPriority::Prefetch;
+    for (const auto &waiter : job.waiters) {
+      priority = std::max(priority, waiter.priority);
+    }
+    return priority;
+  }
+
+  void RemoveOwnerLocked(const void *owner) noexcept {
+    auto owned = m_owners.find(owner);
+    if (owned == m_owners.end()) {
+      return;
+    }
+
+    auto it = m_jobs.find(owned->second);
+    m_owners.erase(owned);
+    if (it == m_jobs.end()) {
+      return;
+    }
+
+    auto &waiters = it->second.waiters;
+    waiters.erase(
+        std::remove_if(
+            waiters.begin(), waiters.end(), [owner](const Requester &waiter) { return waiter.owner == owner; }),
+        waiters.end());
+    if (waiters.empty() && !it->second.decoding) {
+      // A fetch still in flight completes into nothing
+      m_jobs.erase(it);
+      m_stats.cancelledDecodes++;
+    }
+  }
+
+  void NotifyProgress(const ImageCacheKey &key, int64_t loaded, int64_t total) noexcept {
+    std::vector<ProgressCallback> callbacks;
+    {
+      std::scoped_lock lock{m_mutex};
+      auto it = m_jobs.find(key);
+      if (it == m_jobs.end()) {
+        return;
+      }
+      for (const auto &waiter : it->second.waiters) {
+        if (waiter.progress) {
+          callbacks.push_back(waiter.progress);
+        }
+      }
+    }
+
+    for (const auto &callback : callbacks) {
+      callback(loaded, total);
+    }
+  }
+
+  void OnFetched(const ImageCacheKey &key, Decoder &&decoder) noexcept {
+    {
+      std::scoped_lock lock{m_mutex};
+      auto it = m_jobs.find(key);
+      if (it == m_jobs.end() || it->second.fetched) {
+        return;
+      }
+      it->second.decoder = std::move(decoder);
+      it->second.fetched = true;
+    }
+    ScheduleDecodes();
+  }
+
+  // Starts the highest priority fetched jobs, up to m_maxConcurrentDecodes at a time
+  void ScheduleDecodes() noexcept {
+    std::vector<ImageCacheKey> toStart;
+    {
+      std::scoped_lock lock{m_mutex};
+      while (m_runningDecodes < m_maxConcurrentDecodes) {
+        auto best = m_jobs.end();
+        for (auto it = m_jobs.begin(); it != m_jobs.end();) {
+          auto &job = it->second;
+          if (!job.fetched || job.decoding) {
+            ++it;
+            continue;
+          }
+
+          job.waiters.erase(
+              std::remove_if(
+                  job.waiters.begin(),
+                  job.waiters.end(),
+                  [](const Requester &waiter) { return waiter.isWanted && !waiter.isWanted(); }),
+              job.waiters.end());
+          if (job.waiters.empty()) {
+            it = m_jobs.erase(it);
+            m_stats.cancelledDecodes++;
+            continue;
+          }
+
+          if (best == m_jobs.end() || JobPriority(job) > JobPriority(best->second)) {
+            best = it;
+          }
+          ++it;
+        }
+
+        if (best == m_jobs.end()) {
+          break;
+        }
+        best->second.decoding = true;
+        m_runningDecodes++;
+        toStart.push_back(best->first);
+      }
+    }
+
+    auto self = this->shared_from_this();
+    for (auto &key : toStart) {
+      m_scheduler([self, key = std::move(key)]() noexcept { self->Decode(key); });
+    }
+  }
+
+  void Decode(const ImageCacheKey &key) noexcept {
+    Decoder decoder;
+    {
+      std::scoped_lock lock{m_mutex};
+      auto it = m_jobs.find(key);
+      if (it != m_jobs.end()) {
+        decoder = std::move(it->second.decoder);
+      }
+    }
+
+    DecodeResult result;
+    if (decoder) {
+      result = decoder();
+    }
+
+    if (result.image && result.byteSize > 0) {
+      m_cache.Put(key, result.image, result.byteSize);
+    }
+
+    std::vector<Requester> waiters;
+    {
+      std::scoped_lock lock{m_mutex};
+      m_stats.decodes++;
+      m_runningDecodes--;
+      auto it = m_jobs.find(key);
+      if (it != m_jobs.end()) {
+        waiters = std::move(it->second.waiters);
+        m_jobs.erase(it);
+      }
+      for (const auto &waiter : waiters) {
+        if (waiter.owner) {
+          m_owners.erase(waiter.owner);
+        }
+      }
+    }
+
+    for (const auto &waiter : waiters) {
+      waiter.completion(result.image, result.error);
+    }
+
+    ScheduleDecodes();
+  }
+
+  DecodedImageCache<TImage> m_cache;
+  const Scheduler m_scheduler;
+  const size_t m_maxConcurrentDecodes;
+  mutable std::mutex m_mutex;
+  std::unordered_map<ImageCacheKey, Job, ImageCacheKeyHash> m_jobs;
+  std::unordered_map<const void *, ImageCacheKey> m_owners;
+  size_t m_runningDecodes{0};
+  Stats m_stats;
+};
+
+} // namespace winrt::Microsoft::ReactNative::Composition::implementation
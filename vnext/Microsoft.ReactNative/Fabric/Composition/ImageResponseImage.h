@@ -11,6 +11,9 @@ namespace winrt::Microsoft::ReactNative::Composition::implementation {
 
 struct ImageResponseImage {
   winrt::com_ptr<IWICBitmap> m_wicbmp;
+  // Size of the source image before it was downsampled to its display size, 0 if it was not downsampled
+  UINT m_naturalWidth{0};
+  UINT m_naturalHeight{0};
   winrt::Microsoft::ReactNative::Composition::Experimental::UriBrushFactory m_brushFactory{nullptr};
 };
 
@@ -23,6 +23,8 @@
 
 namespace winrt::Microsoft::ReactNative::Composition::implementation {
 
+static TextRedrawCounters g_redrawCounters;
+
 // Automatically restores the original DPI of a render target
 struct DpiRestorer {
   ID2D1RenderTarget *renderTarget = nullptr;
@@ -424,6 +426,7 @@ const facebook::react::ParagraphProps &ParagraphComponentView::paragraphProps()
 }
 
 void ParagraphComponentView::onThemeChanged() noexcept {
+  // Theme changes only affect colors, so the existing text layout is reused and only repainted.
   DrawText();
   Super::onThemeChanged();
 }
@@ -505,6 +508,10 @@ void ParagraphComponentView::DrawSelectionHighlight(
 }
 
 void ParagraphComponentView::DrawText() noexcept {
+  DrawText(std::nullopt);
+}
+
+void ParagraphComponentView::DrawText(const std::optional<RECT> &updateRect) noexcept {
   if (!m_drawingSurface || theme()->IsEmpty())
     return;
 
@@ -515,9 +522,30 @@ void ParagraphComponentView::DrawText() noexcept {
 
   POINT offset;
   {
-    ::Microsoft::ReactNative::Composition::AutoDrawDrawingSurface autoDraw(
-        m_drawingSurface, m_layoutMetrics.pointScaleFactor, &offset);
-    if (auto d2dDeviceContext = autoDraw.GetRenderTarget()) {
+    std::optional<::Microsoft::ReactNative::Composition::AutoDrawDrawingSurface> autoDraw;
+    if (updateRect) {
+      autoDraw.emplace(m_drawingSurface, m_layoutMetrics.pointScaleFactor, *updateRect, &offset);
+    } else {
+      autoDraw.emplace(m_drawingSurface, m_layoutMetrics.pointScaleFactor, &offset);
+    }
+
+    if (auto d2dDeviceContext = autoDraw->GetRenderTarget()) {
+      // The device context may cover more than updateRect, so a partial update is clipped to it. Clear respects the
+      // clip too. Like the text below, the clip is placed relative to offset, the surface's top-left corner.
+      const auto isPartial = autoDraw->IsPartial();
+      if (isPartial) {
+        const auto clip = PartialRedrawClipRect(
+            offset.x,
+            offset.y,
+            updateRect->left,
+            updateRect->top,
+            updateRect->right,
+            updateRect->bottom,
+            m_layoutMetrics.pointScaleFactor);
+        d2dDeviceContext->PushAxisAlignedClip(
+            D2D1::RectF(clip.left, clip.top, clip.right, clip.bottom), D2D1_ANTIALIAS_MODE_ALIASED);
+      }
+
       d2dDeviceContext->Clear(
           viewProps()->backgroundColor ? theme()->D2DColor(*viewProps()->backgroundColor)
                                        : D2D1::ColorF(D2D1::ColorF::Black, 0.0f));
@@ -542,11 +570,129 @@ void ParagraphComponentView::DrawText() noexcept {
       if (!isnan(props.opacity)) {
         Visual().Opacity(props.opacity);
       }
+
+      if (isPartial) {
+        d2dDeviceContext->PopAxisAlignedClip();
+        g_redrawCounters.CountPartialRedraw(
+            static_cast<uint64_t>(updateRect->right - updateRect->left) *
+            static_cast<uint64_t>(updateRect->bottom - updateRect->top));
+      } else {
+        g_redrawCounters.CountFullRedraw(static_cast<uint64_t>(
+            std::ceil(m_layoutMetrics.frame.size.width * m_layoutMetrics.pointScaleFactor) *
+            std::ceil(m_layoutMetrics.frame.size.height * m_layoutMetrics.pointScaleFactor)));
+      }
+      m_drawnSelection = GetNormalizedSelection();
     }
     m_requireRedraw = false;
   }
 }
 
+std::optional<std::pair<int32_t, int32_t>> ParagraphComponentView::GetNormalizedSelection() const noexcept {
+  if (!m_selectionStart || !m_selectionEnd || *m_selectionStart == *m_selectionEnd) {
+    return std::nullopt;
+  }
+  return std::make_pair(std::min(*m_selectionStart, *m_selectionEnd), std::max(*m_selectionStart, *m_selectionEnd));
+}
+
+// Returns the surface pixel rect covering every line whose selection highlight differs between oldSelection and
+// newSelection, or nullopt if there is nothing to repaint.
+std::optional<RECT> ParagraphComponentView::GetSelectionDirtyRect(
+    const std::optional<std::pair<int32_t, int32_t>> &oldSelection,
+    const std::optional<std::pair<int32_t, int32_t>> &newSelection) const noexcept {
+  if (!m_textLayout) {
+    return std::nullopt;
+  }
+
+  // Character ranges whose selected state may have changed.
+  std::pair<int32_t, int32_t> changedRanges[2];
+  size_t changedRangeCount = 0;
+  if (oldSelection && newSelection) {
+    changedRanges[changedRangeCount++] = {
+        std::min(oldSelection->first, newSelection->first), std::max(oldSelection->first, newSelection->first)};
+    changedRanges[changedRangeCount++] = {
+        std::min(oldSelection->second, newSelection->second), std::max(oldSelection->second, newSelection->second)};
+  } else if (oldSelection) {
+    changedRanges[changedRangeCount++] = *oldSelection;
+  } else if (newSelection) {
+    changedRanges[changedRangeCount++] = *newSelection;
+  }
+
+  float top = std::numeric_limits<float>::max();
+  float bottom = std::numeric_limits<float>::lowest();
+  std::vector<DWRITE_HIT_TEST_METRICS> hitTestMetrics;
+  for (size_t i = 0; i < changedRangeCount; i++) {
+    const auto &[start, end] = changedRanges[i];
+    if (end <= start) {
+      continue;
+    }
+
+    UINT32 actualCount = 0;
+    m_textLayout->HitTestTextRange(
+        static_cast<UINT32>(start), static_cast<UINT32>(end - start), 0, 0, nullptr, 0, &actualCount);
+    if (actualCount == 0) {
+      continue;
+    }
+    hitTestMetrics.resize(actualCount);
+    if (FAILED(m_textLayout->HitTestTextRange(
+            static_cast<UINT32>(start),
+            static_cast<UINT32>(end - start),
+            0,
+            0,
+            hitTestMetrics.data(),
+            actualCount,
+            &actualCount))) {
+      continue;
+    }
+
+    for (UINT32 j = 0; j < actualCount; j++) {
+      top = std::min(top, hitTestMetrics[j].top);
+      bottom = std::max(bottom, hitTestMetrics[j].top + hitTestMetrics[j].height);
+    }
+  }
+
+  if (bottom <= top) {
+    return std::nullopt;
+  }
+
+  // Repaint whole lines, inflated by a pixel to cover antialiased edges and glyph overhang.
+  const float scale = m_layoutMetrics.pointScaleFactor;
+  const LONG surfaceWidth = static_cast<LONG>(std::ceil(m_layoutMetrics.frame.size.width * scale));
+  const LONG surfaceHeight = static_cast<LONG>(std::ceil(m_layoutMetrics.frame.size.height * scale));
+  RECT rect;
+  rect.left = 0;
+  rect.right = surfaceWidth;
+  rect.top = std::max<LONG>(0, static_cast<LONG>(std::floor(m_layoutMetrics.contentInsets.top + top * scale)) - 1);
+  rect.bottom =
+      std::min(surfaceHeight, static_cast<LONG>(std::ceil(m_layoutMetrics.contentInsets.top + bottom * scale)) + 1);
+
+  if (rect.bottom <= rect.top || rect.right <= rect.left) {
+    return std::nullopt;
+  }
+  return rect;
+}
+
+void ParagraphComponentView::DrawSelectionChange() noexcept {
+  if (m_requireRedraw) {
+    DrawText();
+    return;
+  }
+
+  const auto newSelection = GetNormalizedSelection();
+  if (newSelection == m_drawnSelection) {
+    return;
+  }
+
+  if (auto dirtyRect = GetSelectionDirtyRect(m_drawnSelection, newSelection)) {
+    DrawText(dirtyRect);
+  } else {
+    m_drawnSelection = newSelection;
+  }
+}
+
+/*static*/ TextRedrawStats ParagraphComponentView::TakeRedrawStats() noexcept {
+  return g_redrawCounters.Take();
+}
+
 void ParagraphComponentView::ClearSelection() noexcept {
   const bool hadSelection = (m_selectionStart || m_selectionEnd || m_isSelecting);
   m_selectionStart = std::nullopt;
@@ -555,7 +701,7 @@ void ParagraphComponentView::ClearSelection() noexcept {
   m_isWordSelecting = false;
   if (hadSelection) {
     // Clears selection highlight
-    DrawText();
+    DrawSelectionChange();
   }
 }
 
@@ -669,11 +815,11 @@ void ParagraphComponentView::OnPointerMoved(
         m_selectionStart = m_wordAnchorStart;
         m_selectionEnd = m_wordAnchorEnd;
       }
-      DrawText();
+      DrawSelectionChange();
       args.Handled(true);
     } else if (charPosition != m_selectionEnd) {
       m_selectionEnd = charPosition;
-      DrawText();
+      DrawSelectionChange();
       args.Handled(true);
     }
   }
@@ -826,7 +972,7 @@ void ParagraphComponentView::SelectWordAtPosition(int32_t charPosition) noexcept
 
   if (wordEnd > wordStart) {
     SetSelection(wordStart, wordEnd);
-    DrawText();
+    DrawSelectionChange();
   }
 }
 
@@ -863,7 +1009,7 @@ void ParagraphComponentView::ShowContextMenu() noexcept {
     CopySelectionToClipboard();
   } else if (cmd == 2) {
     SetSelection(0, static_cast<int32_t>(utf16Text.length()));
-    DrawText();
+    DrawSelectionChange();
   }
 
   DestroyMenu(menu);
@@ -898,7 +1044,7 @@ void ParagraphComponentView::OnKeyDown(
         root->SetViewWithTextSelection(*get_strong());
       }
 
-      DrawText();
+      DrawSelectionChange();
       args.Handled(true);
       return;
     }
@@ -15,6 +15,7 @@
 #include <chrono>
 #include "CompositionHelpers.h"
 #include "CompositionViewComponentView.h"
+#include "TextRedraw.h"
 
 namespace winrt::Microsoft::ReactNative::Composition::implementation {
 
@@ -76,6 +77,10 @@ struct ParagraphComponentView : ParagraphComponentViewT<ParagraphComponentView,
   // Keyboard event handler for copy
   void OnKeyDown(const winrt::Microsoft::ReactNative::Composition::Input::KeyRoutedEventArgs &args) noexcept override;
 
+  // Returns the counters of the pixels redrawn into text surfaces across all paragraphs, accumulated since the
+  // previous call, and resets them. Calling this once per frame gives the surface pixels redrawn during that frame.
+  static TextRedrawStats TakeRedrawStats() noexcept;
+
   ParagraphComponentView(
       const winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext &compContext,
       facebook::react::Tag tag,
@@ -84,6 +89,14 @@ struct ParagraphComponentView : ParagraphComponentViewT<ParagraphComponentView,
  private:
   void updateVisualBrush() noexcept;
   void DrawText() noexcept;
+  // Redraws the text, limited to updateRect (in surface pixels) when provided
+  void DrawText(const std::optional<RECT> &updateRect) noexcept;
+  // Repaints only the lines whose selection state changed since the selection was last drawn
+  void DrawSelectionChange() noexcept;
+  std::optional<std::pair<int32_t, int32_t>> GetNormalizedSelection() const noexcept;
+  std::optional<RECT> GetSelectionDirtyRect(
+      const std::optional<std::pair<int32_t, int32_t>> &oldSelection,
+      const std::optional<std::pair<int32_t, int32_t>> &newSelection) const noexcept;
   void DrawSelectionHighlight(
       ID2D1RenderTarget &renderTarget,
       float offsetX,
@@ -117,6 +130,8 @@ struct ParagraphComponentView : ParagraphComponentViewT<ParagraphComponentView,
 
   std::optional<int32_t> m_selectionStart;
   std::optional<int32_t> m_selectionEnd;
+  // Selection range currently painted onto m_drawingSurface
+  std::optional<std::pair<int32_t, int32_t>> m_drawnSelection;
   bool m_isSelecting{false};
 
   // Double click + drag selection
@@ -1492,6 +1492,17 @@ int ScrollViewComponentView::getScrollPositionY() noexcept {
   return int((m_scrollVisual.ScrollPosition().y / m_verticalScrollbarComponent->getScrollRange()) * 100);
 }
 
+facebook::react::Rect ScrollViewComponentView::visibleContentRect() const noexcept {
+  if (!m_scrollVisual) {
+    return {{0, 0}, m_layoutMetrics.frame.size};
+  }
+
+  // ScrollPosition is in physical pixels, see updateStateWithContentOffset
+  auto scrollPosition = m_scrollVisual.ScrollPosition();
+  const float pointScaleFactor = m_layoutMetrics.pointScaleFactor > 0.0f ? m_layoutMetrics.pointScaleFactor : 1.0f;
+  return {{scrollPosition.x / pointScaleFactor, scrollPosition.y / pointScaleFactor}, m_layoutMetrics.frame.size};
+}
+
 double ScrollViewComponentView::getVerticalSize() noexcept {
   return std::min((m_layoutMetrics.frame.size.height / m_contentSize.height * 100.0), 100.0);
 }
@@ -118,6 +118,9 @@ struct ScrollInteractionTrackerOwner : public winrt::implements<
   double getVerticalSize() noexcept;
   double getHorizontalSize() noexcept;
 
+  // The part of the content that is currently scrolled into view, in the content's DIPs
+  facebook::react::Rect visibleContentRect() const noexcept;
+
   // Issue #15557: Event accessors for ViewChanged (used by ContentIslandComponentView for transform update)
   winrt::event_token ViewChanged(
       winrt::Windows::Foundation::EventHandler<winrt::Windows::Foundation::IInspectable> const &handler) noexcept;
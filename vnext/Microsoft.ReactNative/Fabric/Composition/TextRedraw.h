@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Platform independent parts of the partial redraws of ParagraphComponentView: the clip of a partial update and the
+// counters of the surface pixels redrawn. Nothing in here depends on Direct2D or composition, so it can be unit tested
+// in isolation.
+
+#include <atomic>
+#include <cstdint>
+
+namespace winrt::Microsoft::ReactNative::Composition::implementation {
+
+struct TextRedrawRect {
+  float left{0};
+  float top{0};
+  float right{0};
+  float bottom{0};
+};
+
+// The clip of a partial update, in the DIPs the render target draws in. offset, the top-left corner of the update in
+// the drawing surface, and the update rect are both in surface pixels, so they are added before being scaled.
+inline TextRedrawRect PartialRedrawClipRect(
+    int32_t offsetX,
+    int32_t offsetY,
+    int32_t left,
+    int32_t top,
+    int32_t right,
+    int32_t bottom,
+    float scale) noexcept {
+  return {
+      static_cast<float>(offsetX + left) / scale,
+      static_cast<float>(offsetY + top) / scale,
+      static_cast<float>(offsetX + right) / scale,
+      static_cast<float>(offsetY + bottom) / scale};
+}
+
+// Counters for the pixels redrawn into text surfaces.
+struct TextRedrawStats {
+  uint64_t fullRedraws{0};
+  uint64_t partialRedraws{0};
+  uint64_t pixelsRedrawn{0};
+};
+
+class TextRedrawCounters {
+ public:
+  void CountFullRedraw(uint64_t pixels) noexcept {
+    m_fullRedraws++;
+    m_pixelsRedrawn += pixels;
+  }
+
+  void CountPartialRedraw(uint64_t pixels) noexcept {
+    m_partialRedraws++;
+    m_pixelsRedrawn += pixels;
+  }
+
+  // Returns the counters accumulated since the previous call and resets them.
+  TextRedrawStats Take() noexcept {
+    TextRedrawStats stats;
+    stats.fullRedraws = m_fullRedraws.exchange(0);
+    stats.partialRedraws = m_partialRedraws.exchange(0);
+    stats.pixelsRedrawn = m_pixelsRedrawn.exchange(0);
+    return stats;
+  }
+
+ private:
+  std::atomic<uint64_t> m_fullRedraws{0};
+  std::atomic<uint64_t> m_partialRedraws{0};
+  std::atomic<uint64_t> m_pixelsRedrawn{0};
+};
+
+} // namespace winrt::Microsoft::ReactNative::Composition::implementation
@@ -223,10 +223,12 @@ struct BlobImageHandler
         int64_t offset = _atoi64(winrt::to_string(queryParsed.GetFirstValueByName(L"offset")).c_str());
         int64_t size = _atoi64(winrt::to_string(queryParsed.GetFirstValueByName(L"size")).c_str());
 
-        auto arr = persistor->ResolveMessage(std::move(guid), offset, size);
+        auto blob = persistor->ResolveMessage(std::move(guid), offset, size);
         winrt::Windows::Storage::Streams::InMemoryRandomAccessStream memoryStream;
         winrt::Windows::Storage::Streams::DataWriter dataWriter{memoryStream};
-        dataWriter.WriteBytes(arr);
+        for (const auto &segment : blob.Segments()) {
+          dataWriter.WriteBytes({segment.Data(), segment.Data() + segment.Size});
+        }
         co_await dataWriter.StoreAsync();
         memoryStream.Seek(0);
 
@@ -288,6 +290,10 @@ ImageResponseOrImageErrorInfo ImageResponse::ResolveImage() {
   winrt::throw_hresult(E_NOTIMPL);
 }
 
+ImageResponseOrImageErrorInfo ImageResponse::ResolveImage(uint32_t /*targetWidth*/, uint32_t /*targetHeight*/) {
+  return ResolveImage();
+}
+
 ImageResponseOrImageErrorInfo ImageFailedResponse::ResolveImage() {
   ImageResponseOrImageErrorInfo imageOrError;
   imageOrError.errorInfo = std::make_shared<facebook::react::ImageErrorInfo>();
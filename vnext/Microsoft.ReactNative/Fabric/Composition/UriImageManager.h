@@ -47,6 +47,9 @@ struct ImageResponseOrImageErrorInfo {
 struct ImageResponse : ImageResponseT<ImageResponse /*, IResolveImage*/> {
   ImageResponse() noexcept = default;
   virtual ImageResponseOrImageErrorInfo ResolveImage();
+  // Resolves the image, downsampling bitmaps larger than the target size (in physical pixels) when supported.
+  // A target size of 0 resolves the image at its natural size.
+  virtual ImageResponseOrImageErrorInfo ResolveImage(uint32_t targetWidth, uint32_t targetHeight);
 };
 
 struct ImageFailedResponse : ImageFailedResponseT<ImageFailedResponse, ImageResponse /*, IResolveImage*/> {
@@ -69,6 +72,7 @@ struct StreamImageResponse : StreamImageResponseT<StreamImageResponse, ImageResp
   StreamImageResponse(const winrt::Windows::Storage::Streams::IRandomAccessStream &stream) noexcept
       : base_type(), m_stream(stream) {}
   virtual ImageResponseOrImageErrorInfo ResolveImage();
+  virtual ImageResponseOrImageErrorInfo ResolveImage(uint32_t targetWidth, uint32_t targetHeight);
 
  private:
   const winrt::Windows::Storage::Streams::IRandomAccessStream m_stream;
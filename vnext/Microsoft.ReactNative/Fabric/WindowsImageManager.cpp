@@ -12,6 +12,7 @@
 #include <Networking/NetworkPropertyIds.h>
 #include <Utils/CppWinrtLessExceptions.h>
 #include <Utils/ImageUtils.h>
+#include <chrono>
 #include <fmt/format.h>
 #include <functional/functor.h>
 #include <shcore.h>
@@ -32,6 +33,7 @@ WindowsImageManager::WindowsImageManager(winrt::Microsoft::ReactNative::ReactCon
     : m_reactContext(reactContext) {
   m_uriImageManager =
       winrt::Microsoft::ReactNative::Composition::implementation::UriImageManager::Get(reactContext.Properties());
+  m_imagePipeline = GetImagePipeline(reactContext.Properties());
 
   // Ideally we'd just set m_httpClient.DefaultRequestHeaders().UserAgent().ParseAdd(m_defaultUserAgent), but when we do
   // we start hitting E_STATE_CHANGED errors. Which appears to be this issue
@@ -178,14 +180,87 @@ WindowsImageManager::GetImageRandomAccessStreamAsync(
   co_return winrt::Microsoft::ReactNative::Composition::StreamImageResponse(memoryStream.CloneStream());
 }
 
-facebook::react::ImageRequest WindowsImageManager::requestImage(
-    const facebook::react::ImageSource &imageSource,
-    facebook::react::SurfaceId surfaceId) const {
-  auto imageRequest = facebook::react::ImageRequest(imageSource, nullptr, {});
+namespace {
 
-  auto weakObserverCoordinator = (std::weak_ptr<const facebook::react::ImageResponseObserverCoordinator>)
-                                     imageRequest.getSharedObserverCoordinator();
+using winrt::Microsoft::ReactNative::Composition::implementation::ImageCacheKey;
+using winrt::Microsoft::ReactNative::Composition::implementation::ImageMemoryPressure;
+using winrt::Microsoft::ReactNative::Composition::implementation::ImageRequestPriority;
+using winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage;
+using winrt::Microsoft::ReactNative::Composition::implementation::MemoryCheckThrottle;
+
+// Decoded images are cached up to this many bytes unless overridden with the Image.DecodedCacheSizeMB runtime option
+constexpr size_t DefaultDecodedImageCacheBytes = 64 * 1024 * 1024;
+
+const winrt::Microsoft::ReactNative::ReactPropertyId<
+    winrt::Microsoft::ReactNative::ReactNonAbiValue<std::shared_ptr<WindowsImagePipeline>>>
+    &ImagePipelinePropertyId() noexcept {
+  static const winrt::Microsoft::ReactNative::ReactPropertyId<
+      winrt::Microsoft::ReactNative::ReactNonAbiValue<std::shared_ptr<WindowsImagePipeline>>>
+      prop{L"ReactNative", L"ImagePipeline"};
+  return prop;
+}
 
+winrt::fire_and_forget RunOnBackground(WindowsImagePipeline::Task task) noexcept {
+  co_await winrt::resume_background();
+  task();
+}
+
+// The low memory notification is polled at most this often, however many images complete
+constexpr int64_t LowMemoryCheckIntervalMs = 2000;
+
+bool IsSystemMemoryLow() noexcept {
+  static const HANDLE lowMemoryNotification = CreateMemoryResourceNotification(LowMemoryResourceNotification);
+  static MemoryCheckThrottle throttle{LowMemoryCheckIntervalMs};
+  const auto now =
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+          .count();
+  if (!throttle.TryStart(now)) {
+    return false;
+  }
+
+  BOOL isLow = FALSE;
+  return lowMemoryNotification && QueryMemoryResourceNotification(lowMemoryNotification, &isLow) && isLow;
+}
+
+// Images are decoded at the size they will be displayed at (in physical pixels), when that size is known
+ImageCacheKey MakeImageCacheKey(const facebook::react::ImageSource &imageSource) noexcept {
+  ImageCacheKey key;
+  key.uri = imageSource.uri;
+  if (imageSource.size.width > 0 && imageSource.size.height > 0) {
+    const float scale = imageSource.scale > 0 ? imageSource.scale : 1.0f;
+    key.width = static_cast<uint32_t>(std::ceil(imageSource.size.width * scale));
+    key.height = static_cast<uint32_t>(std::ceil(imageSource.size.height * scale));
+  }
+  return key;
+}
+
+size_t DecodedByteSize(const std::shared_ptr<ImageResponseImage> &image) noexcept {
+  UINT width = 0, height = 0;
+  if (image && image->m_wicbmp && SUCCEEDED(image->m_wicbmp->GetSize(&width, &height))) {
+    return static_cast<size_t>(width) * height * 4;
+  }
+  // Brush factories are cheap to keep, but have no size to budget against, so they are not cached
+  return 0;
+}
+
+} // namespace
+
+std::shared_ptr<WindowsImagePipeline> GetImagePipeline(
+    const winrt::Microsoft::ReactNative::ReactPropertyBag &properties) noexcept {
+  return *properties.GetOrCreate(ImagePipelinePropertyId(), []() -> std::shared_ptr<WindowsImagePipeline> {
+    auto cacheSizeMB = Microsoft::React::GetRuntimeOptionInt("Image.DecodedCacheSizeMB");
+    size_t byteBudget =
+        cacheSizeMB > 0 ? static_cast<size_t>(cacheSizeMB) * 1024 * 1024 : DefaultDecodedImageCacheBytes;
+    return std::make_shared<WindowsImagePipeline>(
+        byteBudget, [](WindowsImagePipeline::Task &&task) { RunOnBackground(std::move(task)); });
+  });
+}
+
+void WindowsImageManager::FetchImage(
+    const facebook::react::ImageSource &imageSource,
+    const ImageCacheKey &key,
+    WindowsImagePipeline::ProgressCallback &&progress,
+    WindowsImagePipeline::FetchCompletion &&complete) const {
   auto rnImageSource = winrt::Microsoft::ReactNative::Composition::implementation::MakeImageSource(imageSource);
   auto provider = m_uriImageManager->TryGetUriImageProvider(m_reactContext.Handle(), rnImageSource);
 
@@ -202,52 +277,141 @@ facebook::react::ImageRequest WindowsImageManager::requestImage(
     source.sourceType = ImageSourceType::Download;
     source.body = imageSource.body;
 
-    auto progressCallback = [weakObserverCoordinator](int64_t loaded, int64_t total) {
-      if (auto observerCoordinator = weakObserverCoordinator.lock()) {
-        float progress = total > 0 ? static_cast<float>(loaded) / static_cast<float>(total) : 1.0f;
-        observerCoordinator->nativeImageResponseProgress(progress, loaded, total);
-      }
+    auto progressCallback = [progress = std::move(progress)](uint64_t loaded, uint64_t total) {
+      progress(static_cast<int64_t>(loaded), static_cast<int64_t>(total));
     };
     imageResponseTask = GetImageRandomAccessStreamAsync(source, progressCallback);
   }
 
-  imageResponseTask.Completed([weakObserverCoordinator](auto asyncOp, auto status) {
+  // The decode itself is handed back to the pipeline, which runs it on a background thread
+  imageResponseTask.Completed([complete = std::move(complete), targetWidth = key.width, targetHeight = key.height](
+                                  auto asyncOp, auto status) {
+    complete([asyncOp, status, targetWidth, targetHeight]() noexcept {
+      WindowsImagePipeline::DecodeResult result;
+      try {
+        if (status == winrt::Windows::Foundation::AsyncStatus::Completed && asyncOp.GetResults()) {
+          auto selfImageResponse =
+              winrt::get_self<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponse>(
+                  asyncOp.GetResults());
+          auto imageResultOrError = selfImageResponse->ResolveImage(targetWidth, targetHeight);
+          result.image = imageResultOrError.image;
+          result.error = imageResultOrError.errorInfo;
+          result.byteSize = DecodedByteSize(result.image);
+        } else {
+          result.error = std::make_shared<facebook::react::ImageErrorInfo>();
+          result.error->error = status == winrt::Windows::Foundation::AsyncStatus::Completed
+              ? "Failed to load image."
+              : FormatHResultError(winrt::hresult_error(asyncOp.ErrorCode()));
+        }
+      } catch (winrt::hresult_error const &ex) {
+        result.image = nullptr;
+        result.error = std::make_shared<facebook::react::ImageErrorInfo>();
+        result.error->error = FormatHResultError(ex);
+      }
+      return result;
+    });
+  });
+}
+
+facebook::react::ImageRequest WindowsImageManager::requestImage(
+    const facebook::react::ImageSource &imageSource,
+    facebook::react::SurfaceId surfaceId) const {
+  auto imageRequest = facebook::react::ImageRequest(imageSource, nullptr, {});
+
+  auto weakObserverCoordinator = (std::weak_ptr<const facebook::react::ImageResponseObserverCoordinator>)
+                                     imageRequest.getSharedObserverCoordinator();
+
+  auto progressCallback = [weakObserverCoordinator](int64_t loaded, int64_t total) {
+    if (auto observerCoordinator = weakObserverCoordinator.lock()) {
+      float progress = total > 0 ? static_cast<float>(loaded) / static_cast<float>(total) : 1.0f;
+      observerCoordinator->nativeImageResponseProgress(progress, loaded, total);
+    }
+  };
+
+  auto completionCallback = [weakObserverCoordinator, weakPipeline = std::weak_ptr(m_imagePipeline)](
+                                const std::shared_ptr<ImageResponseImage> &image,
+                                const std::shared_ptr<facebook::react::ImageErrorInfo> &errorInfo) {
+    if (image && IsSystemMemoryLow()) {
+      if (auto pipeline = weakPipeline.lock()) {
+        // Trims the cache down to half its budget. Images still displayed stay alive through their views.
+        pipeline->OnMemoryPressure(ImageMemoryPressure::Moderate);
+      }
+    }
+
     auto observerCoordinator = weakObserverCoordinator.lock();
     if (!observerCoordinator) {
       return;
     }
 
-    switch (status) {
-      case winrt::Windows::Foundation::AsyncStatus::Completed: {
-        auto imageResponse = asyncOp.GetResults();
-        auto selfImageResponse =
-            winrt::get_self<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponse>(imageResponse);
-        auto imageResultOrError = selfImageResponse->ResolveImage();
-        if (imageResultOrError.image) {
-          observerCoordinator->nativeImageResponseComplete(
-              facebook::react::ImageResponse(imageResultOrError.image, nullptr /*metadata*/));
-        } else {
-          observerCoordinator->nativeImageResponseFailed(facebook::react::ImageLoadError(imageResultOrError.errorInfo));
-        }
-        break;
-      }
-      case winrt::Windows::Foundation::AsyncStatus::Canceled: {
-        auto errorInfo = std::make_shared<facebook::react::ImageErrorInfo>();
-        errorInfo->error = FormatHResultError(winrt::hresult_error(asyncOp.ErrorCode()));
-        observerCoordinator->nativeImageResponseFailed(facebook::react::ImageLoadError(errorInfo));
-        break;
-      }
-      case winrt::Windows::Foundation::AsyncStatus::Error: {
-        auto errorInfo = std::make_shared<facebook::react::ImageErrorInfo>();
-        errorInfo->error = FormatHResultError(winrt::hresult_error(asyncOp.ErrorCode()));
-        observerCoordinator->nativeImageResponseFailed(facebook::react::ImageLoadError(errorInfo));
-        break;
+    if (image) {
+      observerCoordinator->nativeImageResponseComplete(facebook::react::ImageResponse(image, nullptr /*metadata*/));
+    } else {
+      auto error = errorInfo;
+      if (!error) {
+        error = std::make_shared<facebook::react::ImageErrorInfo>();
+        error->error = "Failed to load image.";
       }
+      observerCoordinator->nativeImageResponseFailed(facebook::react::ImageLoadError(error));
     }
-  });
+  };
+
+  auto key = MakeImageCacheKey(imageSource);
+  if (!imageSource.body.empty()) {
+    // Requests with a body are not guaranteed to return the same image each time, so are neither shared nor cached
+    FetchImage(
+        imageSource,
+        key,
+        std::move(progressCallback),
+        [completionCallback = std::move(completionCallback)](WindowsImagePipeline::Decoder &&decoder) {
+          RunOnBackground([completionCallback, decoder = std::move(decoder)]() {
+            auto result = decoder();
+            completionCallback(result.image, result.error);
+          });
+        });
+    return imageRequest;
+  }
+
+  // The observer coordinator identifies the request, so that the ImageComponentView displaying it can change its
+  // priority as it scrolls on and off screen.
+  WindowsImagePipeline::Requester requester;
+  requester.owner = imageRequest.getSharedObserverCoordinator().get();
+  requester.priority = ImageRequestPriority::Visible;
+  requester.progress = std::move(progressCallback);
+  requester.completion = std::move(completionCallback);
+  requester.isWanted = [weakObserverCoordinator]() { return !weakObserverCoordinator.expired(); };
+
+  m_imagePipeline->Request(
+      key,
+      [this, imageSource, key](
+          WindowsImagePipeline::ProgressCallback &&progress, WindowsImagePipeline::FetchCompletion &&complete) {
+        FetchImage(imageSource, key, std::move(progress), std::move(complete));
+      },
+      std::move(requester));
   return imageRequest;
 }
 
+void WindowsImageManager::prefetchImage(const std::string &uri, std::function<void(bool succeeded)> &&callback) const {
+  facebook::react::ImageSource imageSource;
+  imageSource.type = facebook::react::ImageSource::Type::Remote;
+  imageSource.uri = uri;
+
+  // Prefetches don't know the size the image will be displayed at, so they cache it at its natural size
+  WindowsImagePipeline::Requester requester;
+  requester.priority = ImageRequestPriority::Prefetch;
+  requester.completion = [callback = std::move(callback)](
+                             const std::shared_ptr<ImageResponseImage> &image,
+                             const std::shared_ptr<facebook::react::ImageErrorInfo> &) { callback(!!image); };
+
+  auto key = MakeImageCacheKey(imageSource);
+  m_imagePipeline->Request(
+      key,
+      [this, imageSource, key](
+          WindowsImagePipeline::ProgressCallback &&progress, WindowsImagePipeline::FetchCompletion &&complete) {
+        FetchImage(imageSource, key, std::move(progress), std::move(complete));
+      },
+      std::move(requester));
+}
+
 facebook::react::ImageRequest WindowsImageManager::requestImage(
     const facebook::react::ImageSource &imageSource,
     facebook::react::SurfaceId surfaceId,
@@ -261,6 +425,10 @@ facebook::react::ImageRequest WindowsImageManager::requestImage(
 namespace winrt::Microsoft::ReactNative::Composition::implementation {
 
 ImageResponseOrImageErrorInfo StreamImageResponse::ResolveImage() {
+  return ResolveImage(0, 0);
+}
+
+ImageResponseOrImageErrorInfo StreamImageResponse::ResolveImage(uint32_t targetWidth, uint32_t targetHeight) {
   ImageResponseOrImageErrorInfo imageOrError;
   try {
     auto result = ::Microsoft::ReactNative::wicBitmapSourceFromStream(m_stream);
@@ -273,22 +441,45 @@ ImageResponseOrImageErrorInfo StreamImageResponse::ResolveImage() {
     auto imagingFactory = std::get<winrt::com_ptr<IWICImagingFactory>>(result);
     auto decodedFrame = std::get<winrt::com_ptr<IWICBitmapSource>>(result);
 
+    imageOrError.image =
+        std::make_shared<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage>();
+
+    // Downsample images that are larger than their display size in both dimensions, keeping the aspect ratio and at
+    // least the target size in each dimension so any resizeMode can still be applied without upscaling.
+    winrt::com_ptr<IWICBitmapSource> source = decodedFrame;
+    UINT naturalWidth = 0, naturalHeight = 0;
+    winrt::check_hresult(decodedFrame->GetSize(&naturalWidth, &naturalHeight));
+    if (targetWidth > 0 && targetHeight > 0 && naturalWidth > targetWidth && naturalHeight > targetHeight) {
+      const double ratio = std::max(
+          static_cast<double>(targetWidth) / naturalWidth, static_cast<double>(targetHeight) / naturalHeight);
+      const UINT scaledWidth = std::max(1u, static_cast<UINT>(std::ceil(naturalWidth * ratio)));
+      const UINT scaledHeight = std::max(1u, static_cast<UINT>(std::ceil(naturalHeight * ratio)));
+
+      winrt::com_ptr<IWICBitmapScaler> scaler;
+      winrt::check_hresult(imagingFactory->CreateBitmapScaler(scaler.put()));
+      winrt::check_hresult(
+          scaler->Initialize(decodedFrame.get(), scaledWidth, scaledHeight, WICBitmapInterpolationModeFant));
+      source = scaler;
+
+      imageOrError.image->m_naturalWidth = naturalWidth;
+      imageOrError.image->m_naturalHeight = naturalHeight;
+    }
+
     winrt::com_ptr<IWICFormatConverter> converter;
     winrt::check_hresult(imagingFactory->CreateFormatConverter(converter.put()));
 
     winrt::check_hresult(converter->Initialize(
-        decodedFrame.get(),
+        source.get(),
         GUID_WICPixelFormat32bppPBGRA,
         WICBitmapDitherTypeNone,
         nullptr,
         0.0f,
         WICBitmapPaletteTypeMedianCut));
 
-    imageOrError.image =
-        std::make_shared<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage>();
     winrt::check_hresult(imagingFactory->CreateBitmapFromSource(
         converter.get(), WICBitmapCacheOnLoad, imageOrError.image->m_wicbmp.put()));
   } catch (winrt::hresult_error const &ex) {
+    imageOrError.image = nullptr;
     imageOrError.errorInfo = std::make_shared<facebook::react::ImageErrorInfo>();
     imageOrError.errorInfo->error = ::Microsoft::ReactNative::FormatHResultError(winrt::hresult_error(ex));
   }
@@ -6,6 +6,7 @@
 #include <react/renderer/imagemanager/ImageRequest.h>
 #include <react/renderer/imagemanager/ImageRequestParams.h>
 
+#include <Fabric/Composition/ImagePipeline.h>
 #include <Fabric/Composition/UriImageManager.h>
 #include <ReactContext.h>
 #include <Utils/ImageUtils.h>
@@ -14,6 +15,14 @@
 
 namespace Microsoft::ReactNative {
 
+using WindowsImagePipeline = winrt::Microsoft::ReactNative::Composition::implementation::ImagePipeline<
+    std::shared_ptr<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage>,
+    std::shared_ptr<facebook::react::ImageErrorInfo>>;
+
+// The image pipeline shared by all the images in a ReactNative instance
+std::shared_ptr<WindowsImagePipeline> GetImagePipeline(
+    const winrt::Microsoft::ReactNative::ReactPropertyBag &properties) noexcept;
+
 struct WindowsImageManager {
   WindowsImageManager(winrt::Microsoft::ReactNative::ReactContext reactContext);
 
@@ -27,16 +36,26 @@ struct WindowsImageManager {
       const facebook::react::ImageRequestParams & /* imageRequestParams */,
       facebook::react::Tag /* tag */) const;
 
+  // Fetches and decodes the image into the image pipeline's cache, at a lower priority than displayed images
+  void prefetchImage(const std::string &uri, std::function<void(bool succeeded)> &&callback) const;
+
  private:
   winrt::Windows::Foundation::IAsyncOperation<winrt::Microsoft::ReactNative::Composition::ImageResponse>
   GetImageRandomAccessStreamAsync(
       ReactImageSource source,
       std::function<void(uint64_t loaded, uint64_t total)> progressCallback) const;
 
+  void FetchImage(
+      const facebook::react::ImageSource &imageSource,
+      const winrt::Microsoft::ReactNative::Composition::implementation::ImageCacheKey &key,
+      WindowsImagePipeline::ProgressCallback &&progress,
+      WindowsImagePipeline::FetchCompletion &&complete) const;
+
   winrt::Windows::Web::Http::HttpClient m_httpClient;
   winrt::Microsoft::ReactNative::ReactContext m_reactContext;
   winrt::hstring m_defaultUserAgent;
   std::shared_ptr<winrt::Microsoft::ReactNative::Composition::implementation::UriImageManager> m_uriImageManager;
+  std::shared_ptr<WindowsImagePipeline> m_imagePipeline;
 };
 
 std::tuple<
@@ -13,11 +13,219 @@
 #include "WindowsTextLayoutManager.h"
 
 #include <unicode.h>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
 
 constexpr float cDefaultMaxFontSizeMultiplier = 0.0f;
+constexpr size_t cTextLayoutCacheSize = 256;
+constexpr size_t cTextFormatCacheSize = 64;
 
 namespace facebook::react {
 
+namespace {
+
+bool AreFloatsEqual(float lhs, float rhs) noexcept {
+  return lhs == rhs || (std::isnan(lhs) && std::isnan(rhs));
+}
+
+void HashCombine(size_t &seed, size_t value) noexcept {
+  seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+size_t HashFloat(float value) noexcept {
+  return std::isnan(value) ? 0 : std::hash<float>{}(value);
+}
+
+// Everything CreateTextFormat and the format setters in GetTextLayout depend on
+struct TextFormatKey {
+  std::wstring fontFamily;
+  DWRITE_FONT_WEIGHT weight{DWRITE_FONT_WEIGHT_REGULAR};
+  DWRITE_FONT_STYLE style{DWRITE_FONT_STYLE_NORMAL};
+  float fontSize{0};
+  std::optional<float> lineHeight;
+  std::optional<DWRITE_READING_DIRECTION> readingDirection;
+  DWRITE_TEXT_ALIGNMENT alignment{DWRITE_TEXT_ALIGNMENT_LEADING};
+
+  bool operator==(const TextFormatKey &rhs) const noexcept {
+    return fontFamily == rhs.fontFamily && weight == rhs.weight && style == rhs.style && fontSize == rhs.fontSize &&
+        lineHeight == rhs.lineHeight && readingDirection == rhs.readingDirection && alignment == rhs.alignment;
+  }
+};
+
+struct TextFormatKeyHash {
+  size_t operator()(const TextFormatKey &key) const noexcept {
+    size_t seed = std::hash<std::wstring>{}(key.fontFamily);
+    HashCombine(seed, static_cast<size_t>(key.weight));
+    HashCombine(seed, static_cast<size_t>(key.style));
+    HashCombine(seed, HashFloat(key.fontSize));
+    HashCombine(seed, HashFloat(key.lineHeight.value_or(0)));
+    HashCombine(seed, key.readingDirection ? static_cast<size_t>(*key.readingDirection) + 1 : 0);
+    HashCombine(seed, static_cast<size_t>(key.alignment));
+    return seed;
+  }
+};
+
+// The text attributes that change how GetTextLayout lays out a fragment. Unlike the measure cache, which only cares
+// about sizes, a layout is also used to draw the text, so the text transform has to match too.
+bool AreTextAttributesEquivalentForLayout(const TextAttributes &lhs, const TextAttributes &rhs) noexcept {
+  return lhs.fontFamily == rhs.fontFamily && AreFloatsEqual(lhs.fontSize, rhs.fontSize) &&
+      AreFloatsEqual(lhs.fontSizeMultiplier, rhs.fontSizeMultiplier) &&
+      AreFloatsEqual(lhs.maxFontSizeMultiplier, rhs.maxFontSizeMultiplier) && lhs.fontWeight == rhs.fontWeight &&
+      lhs.fontStyle == rhs.fontStyle && lhs.allowFontScaling == rhs.allowFontScaling &&
+      AreFloatsEqual(lhs.letterSpacing, rhs.letterSpacing) && AreFloatsEqual(lhs.lineHeight, rhs.lineHeight) &&
+      lhs.alignment == rhs.alignment && lhs.baseWritingDirection == rhs.baseWritingDirection &&
+      lhs.layoutDirection == rhs.layoutDirection && lhs.textTransform == rhs.textTransform;
+}
+
+bool AreAttributedStringsEquivalentForLayout(const AttributedString &lhs, const AttributedString &rhs) noexcept {
+  const auto &lhsFragments = lhs.getFragments();
+  const auto &rhsFragments = rhs.getFragments();
+  if (lhsFragments.size() != rhsFragments.size()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < lhsFragments.size(); i++) {
+    if (lhsFragments[i].string != rhsFragments[i].string ||
+        !AreTextAttributesEquivalentForLayout(lhsFragments[i].textAttributes, rhsFragments[i].textAttributes)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t HashAttributedStringForLayout(const AttributedString &attributedString) noexcept {
+  size_t seed = 0;
+  for (const auto &fragment : attributedString.getFragments()) {
+    HashCombine(seed, std::hash<std::string>{}(fragment.string));
+    HashCombine(seed, std::hash<std::string>{}(fragment.textAttributes.fontFamily));
+    HashCombine(seed, HashFloat(fragment.textAttributes.fontSize));
+  }
+  return seed;
+}
+
+bool HasAttachments(const AttributedString &attributedString) noexcept {
+  for (const auto &fragment : attributedString.getFragments()) {
+    if (fragment.isAttachment()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Bounded cache of the text formats and text layouts built by GetTextLayout, shared by measurement and drawing.
+// Formats are never modified once created, so they are shared. Layouts are handed out exclusively: whoever takes one
+// owns it until it is put back, since it is resized (and may be modified further) by its user.
+class TextLayoutCache {
+ public:
+  static TextLayoutCache &Instance() noexcept {
+    static TextLayoutCache s_instance;
+    return s_instance;
+  }
+
+  template <typename TCreate>
+  winrt::com_ptr<IDWriteTextFormat> GetOrCreateTextFormat(const TextFormatKey &key, TCreate &&create) {
+    {
+      std::scoped_lock lock{m_mutex};
+      auto it = m_textFormats.find(key);
+      if (it != m_textFormats.end()) {
+        m_stats.textFormatsReused++;
+        return it->second;
+      }
+    }
+
+    auto textFormat = create();
+
+    std::scoped_lock lock{m_mutex};
+    m_stats.textFormatsCreated++;
+    if (m_textFormats.size() >= cTextFormatCacheSize) {
+      m_textFormats.clear();
+    }
+    m_textFormats.emplace(key, textFormat);
+    return textFormat;
+  }
+
+  winrt::com_ptr<IDWriteTextLayout> TakeTextLayout(
+      const AttributedString &attributedString,
+      const ParagraphAttributes &paragraphAttributes) noexcept {
+    std::scoped_lock lock{m_mutex};
+    auto range = m_layoutsByHash.equal_range(HashAttributedStringForLayout(attributedString));
+    for (auto it = range.first; it != range.second; ++it) {
+      auto entry = it->second;
+      if (entry->paragraphAttributes == paragraphAttributes &&
+          AreAttributedStringsEquivalentForLayout(entry->attributedString, attributedString)) {
+        auto textLayout = std::move(entry->textLayout);
+        m_layoutsByHash.erase(it);
+        m_layouts.erase(entry);
+        m_stats.layoutsReused++;
+        return textLayout;
+      }
+    }
+    return nullptr;
+  }
+
+  void PutTextLayout(
+      const AttributedString &attributedString,
+      const ParagraphAttributes &paragraphAttributes,
+      winrt::com_ptr<IDWriteTextLayout> &&textLayout) noexcept {
+    std::scoped_lock lock{m_mutex};
+    m_layouts.push_front({attributedString, paragraphAttributes, std::move(textLayout)});
+    m_layoutsByHash.emplace(HashAttributedStringForLayout(attributedString), m_layouts.begin());
+    while (m_layouts.size() > cTextLayoutCacheSize) {
+      auto oldest = std::prev(m_layouts.end());
+      auto range = m_layoutsByHash.equal_range(HashAttributedStringForLayout(oldest->attributedString));
+      for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == oldest) {
+          m_layoutsByHash.erase(it);
+          break;
+        }
+      }
+      m_layouts.pop_back();
+    }
+  }
+
+  void OnTextLayoutCreated() noexcept {
+    std::scoped_lock lock{m_mutex};
+    m_stats.layoutsCreated++;
+  }
+
+  WindowsTextLayoutManager::TextLayoutCacheStats Stats() const noexcept {
+    std::scoped_lock lock{m_mutex};
+    return m_stats;
+  }
+
+ private:
+  struct Entry {
+    AttributedString attributedString;
+    ParagraphAttributes paragraphAttributes;
+    winrt::com_ptr<IDWriteTextLayout> textLayout;
+  };
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<TextFormatKey, winrt::com_ptr<IDWriteTextFormat>, TextFormatKeyHash> m_textFormats;
+  // Most recently used first
+  std::list<Entry> m_layouts;
+  std::unordered_multimap<size_t, std::list<Entry>::iterator> m_layoutsByHash;
+  WindowsTextLayoutManager::TextLayoutCacheStats m_stats;
+};
+
+// Reuses a layout previously built for the same text and paragraph attributes, resized to the new constraints
+bool TryTakeCachedTextLayout(
+    const AttributedString &attributedString,
+    const ParagraphAttributes &paragraphAttributes,
+    Size size,
+    winrt::com_ptr<IDWriteTextLayout> &spTextLayout) noexcept {
+  auto textLayout = TextLayoutCache::Instance().TakeTextLayout(attributedString, paragraphAttributes);
+  if (!textLayout || FAILED(textLayout->SetMaxWidth(size.width)) || FAILED(textLayout->SetMaxHeight(size.height))) {
+    return false;
+  }
+  spTextLayout = std::move(textLayout);
+  return true;
+}
+
+} // namespace
+
 // Creates an empty InlineObject since RN handles actually rendering the Inline object, this just reserves space for it.
 class AttachmentInlineObject : public winrt::implements<AttachmentInlineObject, IDWriteInlineObject> {
  public:
@@ -94,8 +302,6 @@ void WindowsTextLayoutManager::GetTextLayout(
   else if (outerFragment.textAttributes.fontStyle == facebook::react::FontStyle::Oblique)
     style = DWRITE_FONT_STYLE_OBLIQUE;
 
-  winrt::com_ptr<IDWriteTextFormat> spTextFormat;
-
   float fontSizeText =
       (std::isnan(outerFragment.textAttributes.fontSize)
            ? facebook::react::TextAttributes::defaultTextAttributes().fontSize
@@ -112,31 +318,16 @@ void WindowsTextLayoutManager::GetTextLayout(
         : outerFragment.textAttributes.fontSizeMultiplier;
   }
 
-  winrt::check_hresult(Microsoft::ReactNative::DWriteFactory()->CreateTextFormat(
-      outerFragment.textAttributes.fontFamily.empty()
-          ? L"Segoe UI"
-          : Microsoft::Common::Unicode::Utf8ToUtf16(outerFragment.textAttributes.fontFamily).c_str(),
-      nullptr, // Font collection (nullptr sets it to use the system font collection).
-      static_cast<DWRITE_FONT_WEIGHT>(outerFragment.textAttributes.fontWeight.value_or(
-          static_cast<facebook::react::FontWeight>(DWRITE_FONT_WEIGHT_REGULAR))),
-      style,
-      DWRITE_FONT_STRETCH_NORMAL,
-      fontSizeText,
-      L"",
-      spTextFormat.put()));
-
+  TextFormatKey formatKey;
+  formatKey.fontFamily = outerFragment.textAttributes.fontFamily.empty()
+      ? L"Segoe UI"
+      : Microsoft::Common::Unicode::Utf8ToUtf16(outerFragment.textAttributes.fontFamily);
+  formatKey.weight = static_cast<DWRITE_FONT_WEIGHT>(outerFragment.textAttributes.fontWeight.value_or(
+      static_cast<facebook::react::FontWeight>(DWRITE_FONT_WEIGHT_REGULAR)));
+  formatKey.style = style;
+  formatKey.fontSize = fontSizeText;
   if (!isnan(outerFragment.textAttributes.lineHeight)) {
-    winrt::check_hresult(spTextFormat->SetLineSpacing(
-        DWRITE_LINE_SPACING_METHOD_UNIFORM,
-        outerFragment.textAttributes.lineHeight,
-        // Recommended ratio of baseline to lineSpacing is 80%
-        // https://learn.microsoft.com/en-us/windows/win32/api/dwrite/nf-dwrite-idwritetextformat-getlinespacing
-        // It is possible we need to load full font metrics to calculate a better baseline value.
-        // For a particular font, you can determine what lineSpacing and baseline should be by examining a
-        // DWRITE_FONT_METRICS method available from the GetMetrics method of IDWriteFont or IDWriteFontFace. For normal
-        // behavior, you'd set lineSpacing to the sum of ascent, descent and lineGap (adjusted for the em size, of
-        // course), and baseline to the ascent value.
-        outerFragment.textAttributes.lineHeight * 0.8f));
+    formatKey.lineHeight = outerFragment.textAttributes.lineHeight;
   }
 
   // Set reading direction (RTL/LTR) based on baseWritingDirection
@@ -155,7 +346,7 @@ void WindowsTextLayoutManager::GetTextLayout(
       isRTL = (outerFragment.textAttributes.layoutDirection == facebook::react::LayoutDirection::RightToLeft);
       readingDirection = isRTL ? DWRITE_READING_DIRECTION_RIGHT_TO_LEFT : DWRITE_READING_DIRECTION_LEFT_TO_RIGHT;
     }
-    winrt::check_hresult(spTextFormat->SetReadingDirection(readingDirection));
+    formatKey.readingDirection = readingDirection;
   }
 
   // Set text alignment
@@ -182,7 +373,42 @@ void WindowsTextLayoutManager::GetTextLayout(
         assert(false);
     }
   }
-  winrt::check_hresult(spTextFormat->SetTextAlignment(alignment));
+  formatKey.alignment = alignment;
+
+  // Text formats only depend on the outer fragment's font attributes, so paragraphs with the same font share one
+  auto spTextFormat = TextLayoutCache::Instance().GetOrCreateTextFormat(formatKey, [&formatKey]() {
+    winrt::com_ptr<IDWriteTextFormat> textFormat;
+    winrt::check_hresult(Microsoft::ReactNative::DWriteFactory()->CreateTextFormat(
+        formatKey.fontFamily.c_str(),
+        nullptr, // Font collection (nullptr sets it to use the system font collection).
+        formatKey.weight,
+        formatKey.style,
+        DWRITE_FONT_STRETCH_NORMAL,
+        formatKey.fontSize,
+        L"",
+        textFormat.put()));
+
+    if (formatKey.lineHeight) {
+      winrt::check_hresult(textFormat->SetLineSpacing(
+          DWRITE_LINE_SPACING_METHOD_UNIFORM,
+          *formatKey.lineHeight,
+          // Recommended ratio of baseline to lineSpacing is 80%
+          // https://learn.microsoft.com/en-us/windows/win32/api/dwrite/nf-dwrite-idwritetextformat-getlinespacing
+          // It is possible we need to load full font metrics to calculate a better baseline value.
+          // For a particular font, you can determine what lineSpacing and baseline should be by examining a
+          // DWRITE_FONT_METRICS method available from the GetMetrics method of IDWriteFont or IDWriteFontFace. For
+          // normal behavior, you'd set lineSpacing to the sum of ascent, descent and lineGap (adjusted for the em size,
+          // of course), and baseline to the ascent value.
+          *formatKey.lineHeight * 0.8f));
+    }
+
+    if (formatKey.readingDirection) {
+      winrt::check_hresult(textFormat->SetReadingDirection(*formatKey.readingDirection));
+    }
+
+    winrt::check_hresult(textFormat->SetTextAlignment(formatKey.alignment));
+    return textFormat;
+  });
 
   // Get text with Object Replacement Characters for attachments
   auto str = GetTransformedText(attributedStringBox);
@@ -194,6 +420,7 @@ void WindowsTextLayoutManager::GetTextLayout(
       size.height, // The height of the layout box.
       spTextLayout.put() // The IDWriteTextLayout interface pointer.
       ));
+  TextLayoutCache::Instance().OnTextLayoutCreated();
 
   // Apply max width constraint and ellipsis trimming to ensure consistency with rendering
   spTextLayout->SetMaxWidth(size.width);
@@ -322,11 +549,16 @@ void WindowsTextLayoutManager::GetTextLayout(
     //}
     GetTextLayoutByAdjustingFontSizeToFit(
         attributedStringBox, paragraphAttributes, layoutConstraints, spTextLayout, attachments, minimumFontScale);
-  } else {
+  } else if (!TryTakeCachedTextLayout(
+                 attributedStringBox.getValue(), paragraphAttributes, layoutConstraints.maximumSize, spTextLayout)) {
     GetTextLayout(attributedStringBox, paragraphAttributes, layoutConstraints.maximumSize, spTextLayout, attachments);
   }
 }
 
+WindowsTextLayoutManager::TextLayoutCacheStats WindowsTextLayoutManager::GetTextLayoutCacheStats() noexcept {
+  return TextLayoutCache::Instance().Stats();
+}
+
 void WindowsTextLayoutManager::GetTextLayoutByAdjustingFontSizeToFit(
     AttributedStringBox attributedStringBox,
     const ParagraphAttributes &paragraphAttributes,
@@ -408,9 +640,15 @@ TextMeasurement TextLayoutManager::measure(
 
     winrt::com_ptr<IDWriteTextLayout> spTextLayout;
 
+    // Layouts of text with attachments also produce the attachment positions, so they are always built from scratch
+    const bool cacheTextLayout = !HasAttachments(attributedString);
+
     TextMeasurement::Attachments attachments;
-    WindowsTextLayoutManager::GetTextLayout(
-        attributedStringBox, paragraphAttributes, layoutConstraints.maximumSize, spTextLayout, attachments);
+    if (!cacheTextLayout ||
+        !TryTakeCachedTextLayout(attributedString, paragraphAttributes, layoutConstraints.maximumSize, spTextLayout)) {
+      WindowsTextLayoutManager::GetTextLayout(
+          attributedStringBox, paragraphAttributes, layoutConstraints.maximumSize, spTextLayout, attachments);
+    }
 
     if (spTextLayout) {
       auto maxHeight = std::numeric_limits<float>().max();
@@ -431,6 +669,11 @@ TextMeasurement TextLayoutManager::measure(
       winrt::check_hresult(spTextLayout->GetMetrics(&dtm));
       measurement.size = {dtm.width, std::min(dtm.height, maxHeight)};
       measurement.attachments = attachments;
+
+      // The view that draws this text is likely to ask for the same layout next
+      if (cacheTextLayout) {
+        TextLayoutCache::Instance().PutTextLayout(attributedString, paragraphAttributes, std::move(spTextLayout));
+      }
     }
 
     if (telemetry) {
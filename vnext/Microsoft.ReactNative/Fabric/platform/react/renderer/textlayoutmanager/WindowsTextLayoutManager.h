@@ -58,6 +58,17 @@ class WindowsTextLayoutManager : public TextLayoutManager {
 
   static winrt::hstring GetTransformedText(const AttributedStringBox &attributedStringBox);
 
+  struct TextLayoutCacheStats {
+    uint64_t layoutsCreated{0};
+    uint64_t layoutsReused{0};
+    uint64_t textFormatsCreated{0};
+    uint64_t textFormatsReused{0};
+  };
+
+  // How many text layouts and formats were built, against how many were reused from the cache shared by measurement
+  // and drawing
+  static TextLayoutCacheStats GetTextLayoutCacheStats() noexcept;
+
  private:
   static void GetTextLayout(
       const AttributedStringBox &attributedStringBox,
@@ -155,6 +155,19 @@ void ReactContext::EmitJSEvent(
   m_context->CallJSFunction(to_string(eventEmitterName), "emit", std::move(params));
 }
 
+void ReactContext::EmitCoalescedJSEvent(
+    hstring const &eventEmitterName,
+    hstring const &eventName,
+    JSValueArgWriter const &paramsArgWriter) noexcept {
+  auto paramsWriter = winrt::make_self<DynamicWriter>();
+  paramsWriter->WriteArrayBegin();
+  paramsWriter->WriteString(winrt::to_hstring(eventName));
+  paramsArgWriter(*paramsWriter);
+  paramsWriter->WriteArrayEnd();
+  auto params = paramsWriter->TakeValue();
+  m_context->CallIdempotentJSFunction(to_string(eventEmitterName), "emit", std::move(params));
+}
+
 Mso::React::IReactContext &ReactContext::GetInner() const noexcept {
   return *m_context;
 }
@@ -33,7 +33,7 @@ struct ReactSettingsSnapshot : winrt::implements<ReactSettingsSnapshot, IReactSe
   Mso::CntPtr<const Mso::React::IReactSettingsSnapshot> m_settings;
 };
 
-struct ReactContext : winrt::implements<ReactContext, IReactContext> {
+struct ReactContext : winrt::implements<ReactContext, IReactContext, IReactContextCoalescedEvents> {
   ReactContext(Mso::CntPtr<Mso::React::IReactContext> &&context) noexcept;
 
  public: // IReactContext
@@ -55,6 +55,12 @@ struct ReactContext : winrt::implements<ReactContext, IReactContext> {
       hstring const &eventName,
       JSValueArgWriter const &paramsArgWriter) noexcept;
 
+ public: // IReactContextCoalescedEvents
+  void EmitCoalescedJSEvent(
+      hstring const &eventEmitterName,
+      hstring const &eventName,
+      JSValueArgWriter const &paramsArgWriter) noexcept;
+
  public: // IReactContext
          // Not part of the public ABI interface
          // Internal accessor for within the Microsoft.ReactNative dll to allow calling into internal methods
@@ -0,0 +1,84 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+
+#include <JSI/LongLivedJsiValue.h>
+#include <Shared/GenerationalHandleTable.h>
+
+namespace winrt::Microsoft::ReactNative {
+
+// The JavaScript callbacks and promise functions that asynchronous TurboModule
+// methods call back later, for one runtime.
+// Calls hold handles to their functions rather than a LongLivedObject each, so
+// that high rate methods do not allocate and register an object per function.
+// It is itself the LongLivedObject of the runtime: all the functions are
+// released at once when the runtime is torn down and the LongLivedObjectCollection
+// is cleared.
+// It must only be used on the JavaScript thread.
+struct LongLivedJsiCallbacks : LongLivedJsiRuntime {
+  using Handle = ::Microsoft::ReactNative::GenerationalHandleTable<facebook::jsi::Function>::Handle;
+
+  static std::shared_ptr<LongLivedJsiCallbacks> Create(
+      std::shared_ptr<facebook::react::LongLivedObjectCollection> const &longLivedObjectCollection,
+      facebook::jsi::Runtime &runtime) noexcept {
+    auto callbacks =
+        std::shared_ptr<LongLivedJsiCallbacks>(new LongLivedJsiCallbacks(longLivedObjectCollection, runtime));
+    longLivedObjectCollection->add(callbacks);
+    return callbacks;
+  }
+
+  Handle Add(facebook::jsi::Function &&function) noexcept {
+    return functions_.Add(std::move(function));
+  }
+
+  // Releases the function of handle and returns it, std::nullopt when it was already released.
+  std::optional<facebook::jsi::Function> Take(Handle handle) noexcept {
+    return functions_.Take(handle);
+  }
+
+  void Release(Handle handle) noexcept {
+    functions_.Release(handle);
+  }
+
+ protected:
+  LongLivedJsiCallbacks(
+      std::shared_ptr<facebook::react::LongLivedObjectCollection> const &longLivedObjectCollection,
+      facebook::jsi::Runtime &runtime)
+      : LongLivedJsiRuntime(longLivedObjectCollection, runtime) {
+    // Enough for the calls pending at the same time in most applications.
+    functions_.Reserve(64);
+  }
+
+ private:
+  ::Microsoft::ReactNative::GenerationalHandleTable<facebook::jsi::Function> functions_;
+};
+
+// Holds the LongLivedJsiCallbacks of the runtime for all the TurboModules of a
+// TurboModulesProvider, so that the calls made in a runtime share one pool
+// whatever module they call. The callbacks are created with the first
+// asynchronous method call made in the runtime, and again for another runtime
+// or once the LongLivedObjectCollection released them.
+// It must only be used on the JavaScript thread.
+class RuntimeJsiCallbacks {
+ public:
+  RuntimeJsiCallbacks(std::weak_ptr<facebook::react::LongLivedObjectCollection> longLivedObjectCollection) noexcept
+      : longLivedObjectCollection_(std::move(longLivedObjectCollection)) {}
+
+  std::weak_ptr<LongLivedJsiCallbacks> Get(facebook::jsi::Runtime &runtime) noexcept {
+    auto callbacks = callbacks_.lock();
+    if (!callbacks || &callbacks->Runtime() != &runtime) {
+      callbacks = nullptr;
+      if (auto longLivedObjectCollection = longLivedObjectCollection_.lock()) {
+        callbacks = LongLivedJsiCallbacks::Create(longLivedObjectCollection, runtime);
+      }
+      callbacks_ = callbacks;
+    }
+    return callbacks;
+  }
+
+ private:
+  std::weak_ptr<facebook::react::LongLivedObjectCollection> longLivedObjectCollection_;
+  std::weak_ptr<LongLivedJsiCallbacks> callbacks_;
+};
+
+} // namespace winrt::Microsoft::ReactNative
@@ -96,22 +96,47 @@ void AnimationDriver::StopAnimation(bool ignoreCompletedHandlers) {
 }
 
 void AnimationDriver::RunAnimationStep(winrt::TimeSpan renderingTime) {
+  double timeDeltaMs;
+  bool restarting;
+  if (BeginAnimationStep(renderingTime, timeDeltaMs, restarting)) {
+    EndAnimationStep(Update(timeDeltaMs, restarting));
+  }
+}
+
+void AnimationDriver::PrepareAnimationStep(winrt::TimeSpan renderingTime, AnimationDriverPool &pool) {
+  m_stepPending = BeginAnimationStep(renderingTime, m_stepTimeDeltaMs, m_stepRestarting);
+  m_stepBatched = m_stepPending && PrepareUpdate(m_stepTimeDeltaMs, m_stepRestarting, pool);
+}
+
+void AnimationDriver::FinishAnimationStep(const AnimationDriverPool &pool) {
+  if (!m_stepPending) {
+    return;
+  }
+
+  m_stepPending = false;
+  EndAnimationStep(
+      m_stepBatched ? FinishUpdate(pool, m_stepRestarting) : Update(m_stepTimeDeltaMs, m_stepRestarting));
+}
+
+bool AnimationDriver::BeginAnimationStep(winrt::TimeSpan renderingTime, double &timeDeltaMs, bool &restarting) {
   assert(!m_useComposition);
   if (m_isComplete) {
-    return;
+    return false;
   }
 
   // winrt::TimeSpan ticks are 100 nanoseconds, divide by 10000 to get milliseconds.
   const auto frameTimeMs = renderingTime.count() / 10000.0;
-  auto restarting = false;
+  restarting = false;
   if (m_startFrameTimeMs < 0) {
     m_startFrameTimeMs = frameTimeMs;
     restarting = true;
   }
 
-  const auto timeDeltaMs = frameTimeMs - m_startFrameTimeMs;
-  const auto isComplete = Update(timeDeltaMs, restarting);
+  timeDeltaMs = frameTimeMs - m_startFrameTimeMs;
+  return true;
+}
 
+void AnimationDriver::EndAnimationStep(bool isComplete) {
   if (isComplete) {
     if (m_iterations == -1 || ++m_iteration < m_iterations) {
       m_startFrameTimeMs = -1;
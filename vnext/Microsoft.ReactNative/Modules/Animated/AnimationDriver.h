@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include "AnimationDriverPool.h"
 #include "NativeAnimatedNodeManager.h"
 #include "ValueAnimatedNode.h"
 
@@ -64,6 +65,12 @@ class AnimationDriver : public std::enable_shared_from_this<AnimationDriver> {
 
   void RunAnimationStep(winrt::TimeSpan renderingTime);
 
+  // Steps the animation in two phases so the math of many drivers can run as one batch: PrepareAnimationStep queues
+  // this frame's evaluation into pool, FinishAnimationStep applies the result once pool has been evaluated. Drivers
+  // that do not batch their math step in FinishAnimationStep exactly like RunAnimationStep.
+  void PrepareAnimationStep(winrt::TimeSpan renderingTime, AnimationDriverPool &pool);
+  void FinishAnimationStep(const AnimationDriverPool &pool);
+
  private:
   Callback m_endCallback{};
 #ifdef DEBUG
@@ -75,6 +82,14 @@ class AnimationDriver : public std::enable_shared_from_this<AnimationDriver> {
   virtual bool Update(double timeDeltaMs, bool restarting) {
     return true;
   };
+  // Queues the evaluation of this step into pool, returns false if the driver steps in Update instead.
+  virtual bool PrepareUpdate(double /*timeDeltaMs*/, bool /*restarting*/, AnimationDriverPool & /*pool*/) {
+    return false;
+  }
+  // Applies the evaluation queued by PrepareUpdate, returns whether the iteration completed like Update.
+  virtual bool FinishUpdate(const AnimationDriverPool & /*pool*/, bool /*restarting*/) {
+    return true;
+  }
 
   bool m_useComposition{};
   int64_t m_id{0};
@@ -98,5 +113,15 @@ class AnimationDriver : public std::enable_shared_from_this<AnimationDriver> {
   bool m_ignoreCompletedHandlers{false};
 
   static constexpr double s_frameDurationMs = 1000.0 / 60.0;
+
+ private:
+  bool BeginAnimationStep(winrt::TimeSpan renderingTime, double &timeDeltaMs, bool &restarting);
+  void EndAnimationStep(bool isComplete);
+
+  // The step started by PrepareAnimationStep
+  bool m_stepPending{false};
+  bool m_stepBatched{false};
+  bool m_stepRestarting{false};
+  double m_stepTimeDeltaMs{0};
 };
 } // namespace Microsoft::ReactNative
@@ -0,0 +1,216 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+/// <summary>
+/// Configuration of a spring animation, see SpringAnimationDriver.
+/// </summary>
+struct SpringParameters {
+  double stiffness{0};
+  double damping{0};
+  double mass{0};
+  double initialVelocity{0};
+  double restSpeedThreshold{0};
+  double displacementFromRestThreshold{0};
+  bool overshootClamping{false};
+};
+
+/// <summary>
+/// The closed form solution of a damped spring released at startValue
+/// towards toValue, time seconds later. This is the only place the spring
+/// math lives, so the scalar and the batched paths compute identical values.
+/// </summary>
+inline void EvaluateSpring(
+    const SpringParameters &spring,
+    double startValue,
+    double toValue,
+    double endValue,
+    double time,
+    float &value,
+    double &velocity) noexcept {
+  const auto c = spring.damping;
+  const auto m = spring.mass;
+  const auto k = spring.stiffness;
+  const auto v0 = -spring.initialVelocity;
+
+  const auto zeta = c / (2 * std::sqrt(k * m));
+  const auto omega0 = std::sqrt(k / m);
+  const auto omega1 = omega0 * std::sqrt(1.0 - (zeta * zeta));
+  const auto x0 = toValue - startValue;
+
+  if (zeta < 1) {
+    const auto envelope = std::exp(-zeta * omega0 * time);
+    value = static_cast<float>(
+        toValue -
+        envelope * ((v0 + zeta * omega0 * x0) / omega1 * std::sin(omega1 * time) + x0 * std::cos(omega1 * time)));
+    velocity = zeta * omega0 * envelope *
+            (std::sin(omega1 * time) * (v0 + zeta * omega0 * x0) / omega1 + x0 * std::cos(omega1 * time)) -
+        envelope * (std::cos(omega1 * time) * (v0 + zeta * omega0 * x0) - omega1 * x0 * std::sin(omega1 * time));
+  } else {
+    const auto envelope = std::exp(-omega0 * time);
+    value = static_cast<float>(endValue - envelope * (x0 + (v0 + omega0 * x0) * time));
+    velocity = envelope * (v0 * (time * omega0 - 1) + time * x0 * (omega0 * omega0));
+  }
+}
+
+/// <summary>
+/// Whether a spring released at startValue has settled at (or, with
+/// overshoot clamping, gone past) endValue.
+/// </summary>
+inline bool IsSpringDone(
+    const SpringParameters &spring,
+    double startValue,
+    double endValue,
+    double currentValue,
+    double currentVelocity) noexcept {
+  const auto isAtRest = std::abs(currentVelocity) <= spring.restSpeedThreshold &&
+      (std::abs(currentValue - endValue) <= spring.displacementFromRestThreshold || spring.stiffness == 0);
+  const auto isOvershooting = spring.stiffness > 0 &&
+      ((startValue < endValue && currentValue > endValue) || (startValue > endValue && currentValue < endValue));
+  return isAtRest || (spring.overshootClamping && isOvershooting);
+}
+
+/// <summary>
+/// The position of a decay animation, time seconds after it started at
+/// startValue.
+/// </summary>
+inline float EvaluateDecay(double startValue, double velocity, double deceleration, double time) noexcept {
+  return static_cast<float>(
+      startValue + velocity / (1 - deceleration) * (1 - std::exp(-(1 - deceleration) * (1000 * time))));
+}
+
+/// <summary>
+/// Steps all the spring and decay animations of a frame together.
+///
+/// Drivers append their inputs for the frame (the time they need to be
+/// evaluated at, plus their configuration) and get a lane back. Evaluate then
+/// runs a batched scalar loop per animation type over the contiguous arrays,
+/// calling the same EvaluateSpring / EvaluateDecay as the scalar path, and the
+/// drivers read their results back from their lane. The results are
+/// bit-for-bit identical to the scalar path. Clear keeps the storage, so
+/// stepping does not allocate once the pool has grown to the number of
+/// concurrent animations.
+/// </summary>
+class AnimationDriverPool {
+ public:
+  size_t AddSpring(
+      const SpringParameters &spring,
+      double startValue,
+      double toValue,
+      double endValue,
+      double time) noexcept {
+    m_springStiffness.push_back(spring.stiffness);
+    m_springDamping.push_back(spring.damping);
+    m_springMass.push_back(spring.mass);
+    m_springInitialVelocity.push_back(spring.initialVelocity);
+    m_springStartValue.push_back(startValue);
+    m_springToValue.push_back(toValue);
+    m_springEndValue.push_back(endValue);
+    m_springTime.push_back(time);
+    return m_springTime.size() - 1;
+  }
+
+  size_t AddDecay(double startValue, double velocity, double deceleration, double time) noexcept {
+    m_decayStartValue.push_back(startValue);
+    m_decayVelocity.push_back(velocity);
+    m_decayDeceleration.push_back(deceleration);
+    m_decayTime.push_back(time);
+    return m_decayTime.size() - 1;
+  }
+
+  size_t SpringCount() const noexcept {
+    return m_springTime.size();
+  }
+
+  size_t DecayCount() const noexcept {
+    return m_decayTime.size();
+  }
+
+  void Evaluate() noexcept {
+    const auto springCount = m_springTime.size();
+    m_springValue.resize(springCount);
+    m_springVelocity.resize(springCount);
+    for (size_t lane = 0; lane < springCount; lane++) {
+      SpringParameters spring;
+      spring.stiffness = m_springStiffness[lane];
+      spring.damping = m_springDamping[lane];
+      spring.mass = m_springMass[lane];
+      spring.initialVelocity = m_springInitialVelocity[lane];
+      EvaluateSpring(
+          spring,
+          m_springStartValue[lane],
+          m_springToValue[lane],
+          m_springEndValue[lane],
+          m_springTime[lane],
+          m_springValue[lane],
+          m_springVelocity[lane]);
+    }
+
+    const auto decayCount = m_decayTime.size();
+    m_decayValue.resize(decayCount);
+    for (size_t lane = 0; lane < decayCount; lane++) {
+      m_decayValue[lane] =
+          EvaluateDecay(m_decayStartValue[lane], m_decayVelocity[lane], m_decayDeceleration[lane], m_decayTime[lane]);
+    }
+  }
+
+  float SpringValue(size_t lane) const noexcept {
+    return m_springValue[lane];
+  }
+
+  double SpringVelocity(size_t lane) const noexcept {
+    return m_springVelocity[lane];
+  }
+
+  float DecayValue(size_t lane) const noexcept {
+    return m_decayValue[lane];
+  }
+
+  void Clear() noexcept {
+    m_springStiffness.clear();
+    m_springDamping.clear();
+    m_springMass.clear();
+    m_springInitialVelocity.clear();
+    m_springStartValue.clear();
+    m_springToValue.clear();
+    m_springEndValue.clear();
+    m_springTime.clear();
+    m_springValue.clear();
+    m_springVelocity.clear();
+    m_decayStartValue.clear();
+    m_decayVelocity.clear();
+    m_decayDeceleration.clear();
+    m_decayTime.clear();
+    m_decayValue.clear();
+  }
+
+ private:
+  // Springs
+  std::vector<double> m_springStiffness;
+  std::vector<double> m_springDamping;
+  std::vector<double> m_springMass;
+  std::vector<double> m_springInitialVelocity;
+  std::vector<double> m_springStartValue;
+  std::vector<double> m_springToValue;
+  std::vector<double> m_springEndValue;
+  std::vector<double> m_springTime;
+  std::vector<float> m_springValue;
+  std::vector<double> m_springVelocity;
+
+  // Decays
+  std::vector<double> m_decayStartValue;
+  std::vector<double> m_decayVelocity;
+  std::vector<double> m_decayDeceleration;
+  std::vector<double> m_decayTime;
+  std::vector<float> m_decayValue;
+};
+
+} // namespace Microsoft::ReactNative
@@ -2,34 +2,46 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <string_view>
+#include <vector>
+#include "ExtrapolationType.h"
 
 static constexpr std::string_view ExtrapolateTypeIdentity = "identity";
 static constexpr std::string_view ExtrapolateTypeClamp = "clamp";
 static constexpr std::string_view ExtrapolateTypeExtend = "extend";
 
+static ExtrapolationType ExtrapolationTypeFromStringView(std::string_view const &extrapolate) {
+  if (extrapolate == ExtrapolateTypeIdentity) {
+    return ExtrapolationType::Identity;
+  } else if (extrapolate == ExtrapolateTypeClamp) {
+    return ExtrapolationType::Clamp;
+  }
+  return ExtrapolationType::Extend;
+}
+
 static double Interpolate(
     double value,
     double inputMin,
     double inputMax,
     double outputMin,
     double outputMax,
-    std::string_view const &extrapolateLeft,
-    std::string_view const &extrapolateRight) {
+    ExtrapolationType extrapolateLeft,
+    ExtrapolationType extrapolateRight) {
   auto result = value;
 
   // Extrapolate
   if (result < inputMin) {
-    if (extrapolateLeft == ExtrapolateTypeIdentity) {
+    if (extrapolateLeft == ExtrapolationType::Identity) {
       return result;
-    } else if (extrapolateLeft == ExtrapolateTypeClamp) {
+    } else if (extrapolateLeft == ExtrapolationType::Clamp) {
       result = inputMin;
     }
   }
 
   if (result > inputMax) {
-    if (extrapolateRight == ExtrapolateTypeIdentity) {
+    if (extrapolateRight == ExtrapolationType::Identity) {
       return result;
-    } else if (extrapolateRight == ExtrapolateTypeClamp) {
+    } else if (extrapolateRight == ExtrapolationType::Clamp) {
       result = inputMax;
     }
   }
@@ -43,3 +55,68 @@ static double Interpolate(
 
   return outputMin + (outputMax - outputMin) * (result - inputMin) / (inputMax - inputMin);
 }
+
+static double Interpolate(
+    double value,
+    double inputMin,
+    double inputMax,
+    double outputMin,
+    double outputMax,
+    std::string_view const &extrapolateLeft,
+    std::string_view const &extrapolateRight) {
+  return Interpolate(
+      value,
+      inputMin,
+      inputMax,
+      outputMin,
+      outputMax,
+      ExtrapolationTypeFromStringView(extrapolateLeft),
+      ExtrapolationTypeFromStringView(extrapolateRight));
+}
+
+// Index of the segment of inputRanges (at least 2 values) that value is interpolated in, values outside of the
+// ranges use the first or last segment.
+static size_t InterpolationSegment(double value, std::vector<double> const &inputRanges) {
+  size_t index = 1;
+  for (; index < inputRanges.size() - 1; ++index) {
+    if (inputRanges[index] >= value) {
+      break;
+    }
+  }
+  return index - 1;
+}
+
+// Interpolates count values through the same ranges, with the same results as interpolating them one at a time.
+// The extrapolation types are only resolved once, and a single segment range (the common case for animations
+// driving opacity, translation, ...) runs without searching for segments.
+static void InterpolateValues(
+    const double *values,
+    double *results,
+    size_t count,
+    std::vector<double> const &inputRanges,
+    std::vector<double> const &outputRanges,
+    ExtrapolationType extrapolateLeft,
+    ExtrapolationType extrapolateRight) {
+  if (inputRanges.size() == 2) {
+    const auto inputMin = inputRanges[0];
+    const auto inputMax = inputRanges[1];
+    const auto outputMin = outputRanges[0];
+    const auto outputMax = outputRanges[1];
+    for (size_t i = 0; i < count; i++) {
+      results[i] = Interpolate(values[i], inputMin, inputMax, outputMin, outputMax, extrapolateLeft, extrapolateRight);
+    }
+    return;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    const auto index = InterpolationSegment(values[i], inputRanges);
+    results[i] = Interpolate(
+        values[i],
+        inputRanges[index],
+        inputRanges[index + 1],
+        outputRanges[index],
+        outputRanges[index + 1],
+        extrapolateLeft,
+        extrapolateRight);
+  }
+}
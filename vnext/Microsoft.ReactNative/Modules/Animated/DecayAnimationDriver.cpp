@@ -20,9 +20,8 @@ DecayAnimationDriver::DecayAnimationDriver(
 }
 
 std::tuple<float, double> DecayAnimationDriver::GetValueAndVelocityForTime(double time) {
-  const auto value = m_originalValue.value() +
-      m_velocity / (1 - m_deceleration) * (1 - std::exp(-(1 - m_deceleration) * (1000 * time)));
-  return std::make_tuple(static_cast<float>(value),
+  const auto value = EvaluateDecay(m_originalValue.value(), m_velocity, m_deceleration, time);
+  return std::make_tuple(value,
                          42.0f); // we don't need the velocity, so set it to a dummy value
 }
 
@@ -36,24 +35,55 @@ bool DecayAnimationDriver::IsAnimationDone(
 bool DecayAnimationDriver::Update(double timeDeltaMs, bool restarting) {
   if (const auto node = GetAnimatedValue()) {
     if (restarting) {
-      const auto value = node->RawValue();
-      if (!m_originalValue) {
-        // First iteration, assign m_fromValue based on AnimatedValue
-        m_originalValue = value;
-      } else {
-        // Not the first iteration, reset AnimatedValue based on m_originalValue
-        node->RawValue(m_originalValue.value());
-      }
-
-      m_lastValue = value;
+      Restart(*node);
     }
 
     const auto [value, velocity] = GetValueAndVelocityForTime(timeDeltaMs / 1000.0);
-    if (restarting || IsAnimationDone(value, m_lastValue, 0.0 /* ignored */)) {
-      m_lastValue = value;
-      node->RawValue(value);
-      return false;
+    return ApplyValue(*node, value, restarting);
+  }
+
+  return true;
+}
+
+bool DecayAnimationDriver::PrepareUpdate(double timeDeltaMs, bool restarting, AnimationDriverPool &pool) {
+  if (const auto node = GetAnimatedValue()) {
+    if (restarting) {
+      Restart(*node);
     }
+
+    m_poolLane = pool.AddDecay(m_originalValue.value(), m_velocity, m_deceleration, timeDeltaMs / 1000.0);
+    return true;
+  }
+
+  return false;
+}
+
+bool DecayAnimationDriver::FinishUpdate(const AnimationDriverPool &pool, bool restarting) {
+  if (const auto node = GetAnimatedValue()) {
+    return ApplyValue(*node, pool.DecayValue(m_poolLane), restarting);
+  }
+
+  return true;
+}
+
+void DecayAnimationDriver::Restart(ValueAnimatedNode &node) {
+  const auto value = node.RawValue();
+  if (!m_originalValue) {
+    // First iteration, assign m_fromValue based on AnimatedValue
+    m_originalValue = value;
+  } else {
+    // Not the first iteration, reset AnimatedValue based on m_originalValue
+    node.RawValue(m_originalValue.value());
+  }
+
+  m_lastValue = value;
+}
+
+bool DecayAnimationDriver::ApplyValue(ValueAnimatedNode &node, float value, bool restarting) {
+  if (restarting || IsAnimationDone(value, m_lastValue, 0.0 /* ignored */)) {
+    m_lastValue = value;
+    node.RawValue(value);
+    return false;
   }
 
   return true;
@@ -18,13 +18,19 @@ class DecayAnimationDriver : public CalculatedAnimationDriver {
 
  protected:
   bool Update(double timeDeltaMs, bool restarting) override;
+  bool PrepareUpdate(double timeDeltaMs, bool restarting, AnimationDriverPool &pool) override;
+  bool FinishUpdate(const AnimationDriverPool &pool, bool restarting) override;
   std::tuple<float, double> GetValueAndVelocityForTime(double time) override;
   bool IsAnimationDone(double currentValue, std::optional<double> previousValue, double currentVelocity) override;
 
  private:
+  void Restart(ValueAnimatedNode &node);
+  bool ApplyValue(ValueAnimatedNode &node, float value, bool restarting);
+
   double m_velocity{0};
   double m_deceleration{0};
   double m_lastValue{0};
+  size_t m_poolLane{0};
 
   static constexpr std::string_view s_velocityName{"velocity"};
   static constexpr std::string_view s_decelerationName{"deceleration"};
@@ -23,6 +23,8 @@ InterpolationAnimatedNode::InterpolationAnimatedNode(
 
   m_extrapolateLeft = config[s_extrapolateLeftName].AsString();
   m_extrapolateRight = config[s_extrapolateRightName].AsString();
+  m_extrapolateLeftType = ExtrapolationTypeFromStringView(m_extrapolateLeft);
+  m_extrapolateRightType = ExtrapolationTypeFromStringView(m_extrapolateRight);
 }
 
 void InterpolationAnimatedNode::Update() {
@@ -187,23 +189,20 @@ winrt::hstring InterpolationAnimatedNode::GetRightExpression(
 }
 
 double InterpolationAnimatedNode::InterpolateValue(double value) {
-  // Compute range index
-  size_t index = 1;
-  for (; index < m_inputRanges.size() - 1; ++index) {
-    if (m_inputRanges[index] >= value) {
-      break;
-    }
-  }
-  index--;
-
+  const auto index = InterpolationSegment(value, m_inputRanges);
   return Interpolate(
       value,
       m_inputRanges[index],
       m_inputRanges[index + 1],
       m_outputRanges[index],
       m_outputRanges[index + 1],
-      m_extrapolateLeft,
-      m_extrapolateRight);
+      m_extrapolateLeftType,
+      m_extrapolateRightType);
+}
+
+void InterpolationAnimatedNode::InterpolateValues(const double *values, double *results, size_t count) const {
+  ::InterpolateValues(
+      values, results, count, m_inputRanges, m_outputRanges, m_extrapolateLeftType, m_extrapolateRightType);
 }
 
 } // namespace Microsoft::ReactNative
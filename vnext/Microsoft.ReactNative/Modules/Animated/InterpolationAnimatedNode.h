@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include "ExtrapolationType.h"
 #include "ValueAnimatedNode.h"
 
 namespace Microsoft::ReactNative {
@@ -17,6 +18,9 @@ class InterpolationAnimatedNode final : public ValueAnimatedNode {
   virtual void OnDetachedFromNode(int64_t animatedNodeTag) override;
   virtual void OnAttachToNode(int64_t animatedNodeTag) override;
 
+  // Interpolates count values at once, results are the same as updating the node with each value as its input.
+  void InterpolateValues(const double *values, double *results, size_t count) const;
+
   static constexpr std::string_view ExtrapolateTypeIdentity = "identity";
   static constexpr std::string_view ExtrapolateTypeClamp = "clamp";
   static constexpr std::string_view ExtrapolateTypeExtend = "extend";
@@ -42,6 +46,8 @@ class InterpolationAnimatedNode final : public ValueAnimatedNode {
   std::vector<double> m_outputRanges;
   std::string m_extrapolateLeft;
   std::string m_extrapolateRight;
+  ExtrapolationType m_extrapolateLeftType{ExtrapolationType::Extend};
+  ExtrapolationType m_extrapolateRightType{ExtrapolationType::Extend};
 
   int64_t m_parentTag{s_parentTagUnset};
 
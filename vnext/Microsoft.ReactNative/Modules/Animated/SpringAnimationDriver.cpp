@@ -20,14 +20,14 @@ SpringAnimationDriver::SpringAnimationDriver(
     const winrt::Microsoft::ReactNative::JSValueArray &dynamicToValues)
     : CalculatedAnimationDriver(id, animatedValueTag, endCallback, config, manager),
       m_dynamicToValues(dynamicToValues.Copy()) {
-  m_springStiffness = config[s_springStiffnessParameterName].AsDouble();
-  m_springDamping = config[s_springDampingParameterName].AsDouble();
-  m_springMass = config[s_springMassParameterName].AsDouble();
-  m_initialVelocity = config[s_initialVelocityParameterName].AsDouble();
+  m_spring.stiffness = config[s_springStiffnessParameterName].AsDouble();
+  m_spring.damping = config[s_springDampingParameterName].AsDouble();
+  m_spring.mass = config[s_springMassParameterName].AsDouble();
+  m_spring.initialVelocity = config[s_initialVelocityParameterName].AsDouble();
   m_endValue = config[s_endValueParameterName].AsDouble();
-  m_restSpeedThreshold = config[s_restSpeedThresholdParameterName].AsDouble();
-  m_displacementFromRestThreshold = config[s_displacementFromRestThresholdParameterName].AsDouble();
-  m_overshootClampingEnabled = config[s_overshootClampingEnabledParameterName].AsBoolean();
+  m_spring.restSpeedThreshold = config[s_restSpeedThresholdParameterName].AsDouble();
+  m_spring.displacementFromRestThreshold = config[s_displacementFromRestThresholdParameterName].AsDouble();
+  m_spring.overshootClamping = config[s_overshootClampingEnabledParameterName].AsBoolean();
   m_iterations = static_cast<int>(config[s_iterationsParameterName].AsDouble());
 }
 
@@ -35,9 +35,7 @@ bool SpringAnimationDriver::IsAnimationDone(
     double currentValue,
     std::optional<double> /*previousValue*/,
     double currentVelocity) {
-  return (
-      IsAtRest(currentVelocity, currentValue, m_endValue) ||
-      (m_overshootClampingEnabled && IsOvershooting(currentValue)));
+  return IsSpringDone(m_spring, m_originalValue.value(), m_endValue, currentValue, currentVelocity);
 }
 
 std::tuple<float, double> SpringAnimationDriver::GetValueAndVelocityForTime(double time) {
@@ -51,89 +49,84 @@ std::tuple<float, double> SpringAnimationDriver::GetValueAndVelocityForTime(doub
     }
     return m_endValue;
   }();
-  const auto c = m_springDamping;
-  const auto m = m_springMass;
-  const auto k = m_springStiffness;
-  const auto v0 = -m_initialVelocity;
-
-  const auto zeta = c / (2 * std::sqrt(k * m));
-  const auto omega0 = std::sqrt(k / m);
-  const auto omega1 = omega0 * std::sqrt(1.0 - (zeta * zeta));
-  const auto x0 = toValue - startValue;
-
-  if (zeta < 1) {
-    const auto envelope = std::exp(-zeta * omega0 * time);
-    const auto value = static_cast<float>(
-        toValue -
-        envelope * ((v0 + zeta * omega0 * x0) / omega1 * std::sin(omega1 * time) + x0 * std::cos(omega1 * time)));
-    const auto velocity = zeta * omega0 * envelope *
-            (std::sin(omega1 * time) * (v0 + zeta * omega0 * x0) / omega1 + x0 * std::cos(omega1 * time)) -
-        envelope * (std::cos(omega1 * time) * (v0 + zeta * omega0 * x0) - omega1 * x0 * std::sin(omega1 * time));
-    return std::make_tuple(value, velocity);
-  } else {
-    const auto envelope = std::exp(-omega0 * time);
-    const auto value = static_cast<float>(m_endValue - envelope * (x0 + (v0 + omega0 * x0) * time));
-    const auto velocity = envelope * (v0 * (time * omega0 - 1) + time * x0 * (omega0 * omega0));
-    return std::make_tuple(value, velocity);
-  }
+
+  float value;
+  double velocity;
+  EvaluateSpring(m_spring, startValue, toValue, m_endValue, time, value, velocity);
+  return std::make_tuple(value, velocity);
 }
 
 bool SpringAnimationDriver::Update(double timeDeltaMs, bool restarting) {
   assert(!m_useComposition);
   if (const auto node = GetAnimatedValue()) {
-    if (restarting) {
-      if (!m_originalValue) {
-        m_originalValue = node->RawValue();
-      } else {
-        node->RawValue(m_originalValue.value());
-      }
+    const auto time = AdvanceTime(*node, timeDeltaMs, restarting);
+    const auto [value, velocity] = GetValueAndVelocityForTime(time);
+    return ApplyValue(*node, value, velocity);
+  }
 
-      // Spring animations run a frame behind JS driven animations if we do
-      // not start the first frame at 16ms.
-      m_lastTime = timeDeltaMs - s_frameDurationMs;
-      m_timeAccumulator = 0.0;
-    }
+  return true;
+}
 
-    // clamp the amount of timeDeltaMs to avoid stuttering in the UI.
-    // We should be able to catch up in a subsequent advance if necessary.
-    auto adjustedDeltaTime = timeDeltaMs - m_lastTime;
-    if (adjustedDeltaTime > MAX_DELTA_TIME_MS) {
-      adjustedDeltaTime = MAX_DELTA_TIME_MS;
-    }
-    m_timeAccumulator += adjustedDeltaTime;
-    m_lastTime = timeDeltaMs;
+bool SpringAnimationDriver::PrepareUpdate(double timeDeltaMs, bool restarting, AnimationDriverPool &pool) {
+  assert(!m_useComposition);
+  if (const auto node = GetAnimatedValue()) {
+    const auto time = AdvanceTime(*node, timeDeltaMs, restarting);
+    m_poolLane = pool.AddSpring(m_spring, m_originalValue.value(), m_endValue, m_endValue, time);
+    return true;
+  }
 
-    auto [value, velocity] = GetValueAndVelocityForTime(m_timeAccumulator / 1000.0);
+  return false;
+}
 
-    auto isComplete = false;
-    if (IsAnimationDone(value, std::nullopt, velocity)) {
-      if (m_springStiffness > 0) {
-        value = static_cast<float>(m_endValue);
-      } else {
-        m_endValue = value;
-      }
+bool SpringAnimationDriver::FinishUpdate(const AnimationDriverPool &pool, bool /*restarting*/) {
+  if (const auto node = GetAnimatedValue()) {
+    return ApplyValue(*node, pool.SpringValue(m_poolLane), pool.SpringVelocity(m_poolLane));
+  }
 
-      isComplete = true;
+  return true;
+}
+
+double SpringAnimationDriver::AdvanceTime(ValueAnimatedNode &node, double timeDeltaMs, bool restarting) {
+  if (restarting) {
+    if (!m_originalValue) {
+      m_originalValue = node.RawValue();
+    } else {
+      node.RawValue(m_originalValue.value());
     }
 
-    node->RawValue(value);
+    // Spring animations run a frame behind JS driven animations if we do
+    // not start the first frame at 16ms.
+    m_lastTime = timeDeltaMs - s_frameDurationMs;
+    m_timeAccumulator = 0.0;
+  }
 
-    return isComplete;
+  // clamp the amount of timeDeltaMs to avoid stuttering in the UI.
+  // We should be able to catch up in a subsequent advance if necessary.
+  auto adjustedDeltaTime = timeDeltaMs - m_lastTime;
+  if (adjustedDeltaTime > MAX_DELTA_TIME_MS) {
+    adjustedDeltaTime = MAX_DELTA_TIME_MS;
   }
+  m_timeAccumulator += adjustedDeltaTime;
+  m_lastTime = timeDeltaMs;
 
-  return true;
+  return m_timeAccumulator / 1000.0;
 }
 
-bool SpringAnimationDriver::IsAtRest(double currentVelocity, double currentValue, double endValue) {
-  return std::abs(currentVelocity) <= m_restSpeedThreshold &&
-      (std::abs(currentValue - endValue) <= m_displacementFromRestThreshold || m_springStiffness == 0);
-}
+bool SpringAnimationDriver::ApplyValue(ValueAnimatedNode &node, float value, double velocity) {
+  auto isComplete = false;
+  if (IsAnimationDone(value, std::nullopt, velocity)) {
+    if (m_spring.stiffness > 0) {
+      value = static_cast<float>(m_endValue);
+    } else {
+      m_endValue = value;
+    }
 
-bool SpringAnimationDriver::IsOvershooting(double currentValue) {
-  const auto startValue = m_originalValue.value();
-  return m_springStiffness > 0 &&
-      ((startValue < m_endValue && currentValue > m_endValue) ||
-       (startValue > m_endValue && currentValue < m_endValue));
+    isComplete = true;
+  }
+
+  node.RawValue(value);
+
+  return isComplete;
 }
 
 double SpringAnimationDriver::ToValue() {
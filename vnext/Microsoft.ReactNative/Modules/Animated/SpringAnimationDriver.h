@@ -22,22 +22,19 @@ class SpringAnimationDriver : public CalculatedAnimationDriver {
 
  protected:
   bool Update(double timeDeltaMs, bool restarting) override;
+  bool PrepareUpdate(double timeDeltaMs, bool restarting, AnimationDriverPool &pool) override;
+  bool FinishUpdate(const AnimationDriverPool &pool, bool restarting) override;
   std::tuple<float, double> GetValueAndVelocityForTime(double time) override;
   bool IsAnimationDone(double currentValue, std::optional<double> previousValue, double currentVelocity) override;
 
  private:
-  bool IsAtRest(double currentVelocity, double currentPosition, double endValue);
-  bool IsOvershooting(double currentValue);
+  double AdvanceTime(ValueAnimatedNode &node, double timeDeltaMs, bool restarting);
+  bool ApplyValue(ValueAnimatedNode &node, float value, double velocity);
 
-  double m_springStiffness{0};
-  double m_springDamping{0};
-  double m_springMass{0};
-  double m_initialVelocity{0};
+  SpringParameters m_spring{};
   double m_endValue{0};
-  double m_restSpeedThreshold{0};
-  double m_displacementFromRestThreshold{0};
-  bool m_overshootClampingEnabled{0};
   int m_iterations{0};
+  size_t m_poolLane{0};
   winrt::Microsoft::ReactNative::JSValueArray m_dynamicToValues{};
 
   double m_lastTime{0};
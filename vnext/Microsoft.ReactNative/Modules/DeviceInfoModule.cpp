@@ -143,7 +143,13 @@ void DeviceInfo::Initialize(React::ReactContext const &reactContext) noexcept {
   DeviceInfoHolder::SetCallback(
       m_context.Properties(), [weakThis = weak_from_this()](React::JSValueObject &&dimensions) {
         if (auto strongThis = weakThis.lock()) {
-          strongThis->m_context.EmitJSEvent(L"RCTDeviceEventEmitter", L"didUpdateDimensions", dimensions);
+          // Resizing a window raises many events: only the latest dimensions need to reach JavaScript.
+          if (auto coalescedEvents = strongThis->m_context.Handle().try_as<React::IReactContextCoalescedEvents>()) {
+            coalescedEvents.EmitCoalescedJSEvent(
+                L"RCTDeviceEventEmitter", L"didUpdateDimensions", React::MakeJSValueWriter(dimensions));
+          } else {
+            strongThis->m_context.EmitJSEvent(L"RCTDeviceEventEmitter", L"didUpdateDimensions", dimensions);
+          }
         }
       });
 }
@@ -2,8 +2,6 @@
 // Licensed under the MIT License.
 
 // NYI:
-//   implement image cache
-//   implement prefetch functionality
 //   implement multi source (parse out most suitable image source from array of
 //   sources)
 #include "pch.h"
@@ -26,6 +24,7 @@ namespace Microsoft::ReactNative {
 
 static const char *ERROR_INVALID_URI = "E_INVALID_URI";
 static const char *ERROR_GET_SIZE_FAILURE = "E_GET_SIZE_FAILURE";
+static const char *ERROR_PREFETCH_FAILURE = "E_PREFETCH_FAILURE";
 
 winrt::fire_and_forget GetImageSizeAsync(
     const winrt::Microsoft::ReactNative::IReactPropertyBag &properties,
@@ -96,6 +95,7 @@ winrt::fire_and_forget GetImageSizeAsync(
 
 void ImageLoader::Initialize(React::ReactContext const &reactContext) noexcept {
   m_context = reactContext;
+  m_imageManager = std::make_shared<WindowsImageManager>(reactContext);
 }
 
 void ImageLoader::getSize(std::string uri, React::ReactPromise<std::vector<double>> &&result) noexcept {
@@ -137,24 +137,40 @@ void ImageLoader::getSizeWithHeaders(
 }
 
 void ImageLoader::prefetchImage(std::string uri, React::ReactPromise<bool> &&result) noexcept {
-  // NYI
-  result.Resolve(true);
+  if (uri.empty()) {
+    result.Reject(React::ReactError{ERROR_INVALID_URI, "Cannot prefetch an image for an empty URI"});
+    return;
+  }
+
+  m_imageManager->prefetchImage(uri, [uri, result](bool succeeded) noexcept {
+    if (succeeded) {
+      result.Resolve(true);
+    } else {
+      result.Reject(React::ReactError{ERROR_PREFETCH_FAILURE, "Failed to prefetch image for URI: " + uri});
+    }
+  });
 }
 
 void ImageLoader::prefetchImageWithMetadata(
     std::string uri,
-    std::string queryRootName,
-    double rootTag,
+    std::string /*queryRootName*/,
+    double /*rootTag*/,
     React::ReactPromise<bool> &&result) noexcept {
-  // NYI
-  result.Resolve(true);
+  prefetchImage(std::move(uri), std::move(result));
 }
 
 void ImageLoader::queryCache(
     std::vector<std::string> const &uris,
     React::ReactPromise<React::JSValue> &&result) noexcept {
-  // NYI
-  result.Resolve(React::JSValueObject{});
+  // Only decoded images are cached, so anything we find is in memory
+  auto pipeline = GetImagePipeline(m_context.Properties());
+  React::JSValueObject cached;
+  for (const auto &uri : uris) {
+    if (pipeline->Cache().ContainsUri(uri)) {
+      cached[uri] = "memory";
+    }
+  }
+  result.Resolve(std::move(cached));
 }
 
 } // namespace Microsoft::ReactNative
\ No newline at end of file
@@ -5,12 +5,15 @@
 
 #include "codegen/NativeImageLoaderIOSSpec.g.h"
 #include <NativeModules.h>
+#include <memory>
 #include <winrt/Windows.ApplicationModel.h>
 #include <winrt/Windows.Foundation.h>
 #include <winrt/Windows.Graphics.Display.h>
 
 namespace Microsoft::ReactNative {
 
+struct WindowsImageManager;
+
 REACT_MODULE(ImageLoader)
 struct ImageLoader {
   using ModuleSpec = ReactNativeSpecs::ImageLoaderIOSSpec;
@@ -45,6 +48,7 @@ struct ImageLoader {
 
  private:
   winrt::Microsoft::ReactNative::ReactContext m_context;
+  std::shared_ptr<WindowsImageManager> m_imageManager;
 };
 
 } // namespace Microsoft::ReactNative
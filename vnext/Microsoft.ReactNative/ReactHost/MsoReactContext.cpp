@@ -177,6 +177,13 @@ void ReactContext::CallJSFunction(std::string &&module, std::string &&method, fo
   }
 }
 
+void ReactContext::CallIdempotentJSFunction(std::string &&module, std::string &&method, folly::dynamic &&params)
+    const noexcept {
+  if (auto instance = m_reactInstance.GetStrongPtr()) {
+    instance->CallJsFunction(std::move(module), std::move(method), std::move(params), /*idempotent:*/ true);
+  }
+}
+
 void ReactContext::DispatchEvent(int64_t viewTag, std::string &&eventName, folly::dynamic &&eventData) const noexcept {
   if (auto instance = m_reactInstance.GetStrongPtr()) {
     instance->DispatchEvent(viewTag, std::move(eventName), std::move(eventData));
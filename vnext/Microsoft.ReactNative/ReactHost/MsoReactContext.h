@@ -48,6 +48,8 @@ class ReactContext final : public Mso::UnknownObject<IReactContext> {
   winrt::Microsoft::ReactNative::IReactPropertyBag Properties() const noexcept override;
   winrt::Microsoft::ReactNative::IReactNotificationService Notifications() const noexcept override;
   void CallJSFunction(std::string &&module, std::string &&method, folly::dynamic &&params) const noexcept override;
+  void CallIdempotentJSFunction(std::string &&module, std::string &&method, folly::dynamic &&params)
+      const noexcept override;
   void DispatchEvent(int64_t viewTag, std::string &&eventName, folly::dynamic &&eventData) const noexcept override;
   winrt::Microsoft::ReactNative::JsiRuntime JsiRuntime() const noexcept override;
   ReactInstanceState State() const noexcept override;
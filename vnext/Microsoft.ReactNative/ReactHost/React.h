@@ -19,6 +19,7 @@
 #include <IReactInstance.h>
 
 #include <Shared/IReactRootView.h>
+#include <Shared/StartupTimeline.h>
 
 #include <winrt/Microsoft.ReactNative.h>
 
@@ -103,6 +104,9 @@ struct IReactContext : IUnknown {
   virtual winrt::Microsoft::ReactNative::IReactNotificationService Notifications() const noexcept = 0;
   virtual winrt::Microsoft::ReactNative::IReactPropertyBag Properties() const noexcept = 0;
   virtual void CallJSFunction(std::string &&module, std::string &&method, folly::dynamic &&params) const noexcept = 0;
+  // Replaces the arguments of the same call when it was not dispatched to JavaScript yet.
+  virtual void
+  CallIdempotentJSFunction(std::string &&module, std::string &&method, folly::dynamic &&params) const noexcept = 0;
   virtual void DispatchEvent(int64_t viewTag, std::string &&eventName, folly::dynamic &&eventData) const noexcept = 0;
   virtual winrt::Microsoft::ReactNative::JsiRuntime JsiRuntime() const noexcept = 0;
   virtual ReactInstanceState State() const noexcept = 0;
@@ -216,6 +220,14 @@ struct ReactOptions {
   std::string ByteCodeFileUri;
   bool EnableByteCodeCaching{true};
 
+  //! Flag controlling whether the thread agnostic eager init TurboModules are constructed in parallel
+  //! on background threads during the instance startup.
+  bool EnableParallelModuleInit{false};
+
+  //! Directory where the constants of the TurboModules that opted in are cached from one run to the next.
+  //! The constants are not cached when it is empty.
+  std::string ConstantsCacheDirectory;
+
   ReactDevOptions DeveloperSettings = {};
 
   //! This controls the availability of various developer support functionality including
@@ -305,6 +317,9 @@ struct ReactOptions {
 
   //! The HostTarget instance for modern inspector integration.
   facebook::react::jsinspector_modern::HostTarget *InspectorHostTarget;
+
+  //! Records the startup phases of the instance when set.
+  std::shared_ptr<Microsoft::ReactNative::StartupTimeline> StartupTimeline;
 };
 
 //! IReactHost manages a ReactNative instance.
@@ -27,6 +27,7 @@
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerCallInvoker.h>
 #include <winrt/Windows.Storage.h>
+#include <filesystem>
 #include <tuple>
 #include "BaseScriptStoreImpl.h"
 #include "CrashManager.h"
@@ -51,8 +52,10 @@
 #include "ReactCoreInjection.h"
 #include "ReactErrorProvider.h"
 #include "RedBox.h"
+#include "SegmentedBundleRegistry.h"
 #include "Unicode.h"
 
+#include <BundleFilePath.h>
 #include <Fabric/Composition/UriImageManager.h>
 #include <Fabric/FabricUIManagerModule.h>
 #include <Fabric/WindowsComponentDescriptorRegistry.h>
@@ -420,6 +423,51 @@ std::unique_ptr<facebook::jsi::PreparedScriptStore> CreatePreparedScriptStore()
   return preparedScriptStore;
 }
 
+// Identifies the JavaScript bundle the cached constants are returned to: its name, and the size and last write time of
+// the bundle file when it is loaded from a file.
+uint64_t JavaScriptBundleVersion(
+    std::shared_ptr<facebook::react::DevSettings> devSettings,
+    const std::string &bundleFile) noexcept {
+  std::vector<std::string> fileVersion;
+  auto bundleFilePath = ::Microsoft::ReactNative::BundleFilePath(devSettings, bundleFile);
+  if (!bundleFilePath.empty()) {
+    const auto path = ::Microsoft::ReactNative::Utf8ToPath(bundleFilePath);
+    std::error_code sizeError;
+    std::error_code timeError;
+    const auto size = std::filesystem::file_size(path, sizeError);
+    const auto lastWriteTime = std::filesystem::last_write_time(path, timeError);
+    if (!sizeError && !timeError) {
+      fileVersion.push_back(std::to_string(size));
+      fileVersion.push_back(std::to_string(lastWriteTime.time_since_epoch().count()));
+    }
+  }
+
+  return Microsoft::ReactNative::ConstantsCache::MakeKey(bundleFile, fileVersion);
+}
+
+// The constants cached for another bundle are not used, see JavaScriptBundleVersion.
+std::shared_ptr<Microsoft::ReactNative::ConstantsCache> CreateConstantsCache(
+    const std::string &directory,
+    uint64_t bundleVersion) noexcept {
+  if (directory.empty()) {
+    return nullptr;
+  }
+
+  // The buffer store expects an existing directory, ending with a separator.
+  std::error_code ec;
+  std::filesystem::create_directories(directory, ec);
+  if (ec) {
+    return nullptr;
+  }
+
+  auto storeDirectory = directory;
+  if (storeDirectory.back() != '\\' && storeDirectory.back() != '/') {
+    storeDirectory += '\\';
+  }
+  return std::make_shared<Microsoft::ReactNative::ConstantsCache>(
+      std::make_shared<facebook::react::LocalFileSimpleBufferStore>(storeDirectory), bundleVersion);
+}
+
 typedef HRESULT(__stdcall *SetThreadDescriptionFn)(HANDLE, PCWSTR);
 void SetJSThreadDescription() noexcept {
   // Office still supports Server 2016 so we need to use Run Time Dynamic Linking and cannot just use:
@@ -438,6 +486,10 @@ void SetJSThreadDescription() noexcept {
 }
 
 void ReactInstanceWin::InitializeBridgeless() noexcept {
+  if (auto startupTimeline = m_options.StartupTimeline.get()) {
+    startupTimeline->BeginPhase("InitializeBridgeless");
+  }
+
   InitUIQueue();
 
   m_uiMessageThread.Exchange(std::make_shared<MessageDispatchQueue2>(
@@ -460,7 +512,10 @@ void ReactInstanceWin::InitializeBridgeless() noexcept {
   m_uiQueue->Post([this, weakThis = Mso::WeakPtr{this}]() noexcept {
     // Objects that must be created on the UI thread
     if (auto strongThis = weakThis.GetStrongPtr()) {
-      InitUIDependentCalls();
+      {
+        Microsoft::ReactNative::StartupTimeline::Scope phase(m_options.StartupTimeline.get(), "InitUIDependentCalls");
+        InitUIDependentCalls();
+      }
 
       strongThis->Queue().Post([this, weakThis]() noexcept {
         if (auto strongThis = weakThis.GetStrongPtr()) {
@@ -470,7 +525,10 @@ void ReactInstanceWin::InitializeBridgeless() noexcept {
             if (devSettings->useFastRefresh || devSettings->liveReloadCallback) {
               Microsoft::ReactNative::PackagerConnection::CreateOrReusePackagerConnection(*devSettings);
             }
-            LoadModules(devSettings, m_options.TurboModuleProvider);
+            {
+              Microsoft::ReactNative::StartupTimeline::Scope phase(m_options.StartupTimeline.get(), "LoadModules");
+              LoadModules(devSettings, m_options.TurboModuleProvider);
+            }
 
             auto jsMessageThread = std::make_shared<facebook::react::MessageQueueThreadImpl>();
             m_jsMessageThread.Exchange(jsMessageThread);
@@ -497,8 +555,16 @@ void ReactInstanceWin::InitializeBridgeless() noexcept {
                     devSettings->sourceBundleHost, devSettings->sourceBundlePort, devSettings->bundleAppId);
               }
 
+              std::unique_ptr<facebook::jsi::PreparedScriptStore> preparedScriptStore;
+              {
+                Microsoft::ReactNative::StartupTimeline::Scope phase(
+                    m_options.StartupTimeline.get(), "CreatePreparedScriptStore");
+                preparedScriptStore = CreatePreparedScriptStore();
+              }
+
+              Microsoft::ReactNative::StartupTimeline::Scope phase(m_options.StartupTimeline.get(), "CreateRuntime");
               m_jsiRuntimeHolder = std::make_shared<Microsoft::ReactNative::HermesRuntimeHolder>(
-                  devSettings, jsMessageThread, CreatePreparedScriptStore());
+                  devSettings, jsMessageThread, std::move(preparedScriptStore));
               auto jsRuntime = std::make_unique<Microsoft::ReactNative::HermesJSRuntime>(m_jsiRuntimeHolder);
               jsRuntime->getRuntime();
 
@@ -528,12 +594,29 @@ void ReactInstanceWin::InitializeBridgeless() noexcept {
             m_options.TurboModuleProvider->SetReactContext(
                 winrt::make<implementation::ReactContext>(Mso::Copy(m_reactContext)));
 
+            // Overlaps the construction of the thread agnostic eager init modules with the runtime initialization
+            // and the bundle loading.
+            if (m_options.EnableParallelModuleInit) {
+              m_options.TurboModuleProvider->StartParallelEagerInit(m_options.StartupTimeline);
+            }
+
+            if (!m_options.ConstantsCacheDirectory.empty()) {
+              m_options.TurboModuleProvider->SetConstantsCache(CreateConstantsCache(
+                  m_options.ConstantsCacheDirectory, JavaScriptBundleVersion(devSettings, JavaScriptBundleFile())));
+            }
+
             facebook::react::ReactInstance::JSRuntimeFlags options;
 
+            m_segmentedBundleRegistry = std::make_shared<Microsoft::ReactNative::SegmentedBundleRegistry>(
+                std::make_shared<facebook::react::BaseScriptStoreImpl>());
+
             m_bridgelessReactInstance->initializeRuntime(
                 options,
                 [=, onCreated = m_options.OnInstanceCreated, reactContext = m_reactContext](
                     facebook::jsi::Runtime &runtime) {
+                  Microsoft::ReactNative::StartupTimeline::Scope phase(
+                      m_options.StartupTimeline.get(), "InitializeRuntime");
+
                   auto logger = [loggingHook = GetLoggingCallback()](
                                     const std::string &message, unsigned int logLevel) {
                     if (loggingHook)
@@ -541,6 +624,8 @@ void ReactInstanceWin::InitializeBridgeless() noexcept {
                   };
                   facebook::react::bindNativeLogger(runtime, logger);
 
+                  Microsoft::ReactNative::SegmentedBundleRegistry::Install(runtime, m_segmentedBundleRegistry);
+
                   auto turboModuleManager =
                       std::make_shared<facebook::react::TurboModuleManager>(m_options.TurboModuleProvider, callInvoker);
 
@@ -573,6 +658,9 @@ void ReactInstanceWin::InitializeBridgeless() noexcept {
 
                   // init TurboModule
                   for (const auto &moduleName : turboModuleManager->getEagerInitModuleNames()) {
+                    const auto phaseName = "InitModule:" + moduleName;
+                    Microsoft::ReactNative::StartupTimeline::Scope modulePhase(
+                        m_options.StartupTimeline.get(), phaseName);
                     turboModuleManager->getModule(moduleName);
                   }
 
@@ -628,31 +716,64 @@ void ReactInstanceWin::LoadJSBundlesBridgeless(std::shared_ptr<facebook::react::
   if (m_isFastReloadEnabled) {
     // Getting bundle from the packager, so do everything async.
 
-    ::Microsoft::ReactNative::LoadRemoteUrlScript(
-        devSettings,
-        ::Microsoft::ReactNative::GetSharedDevManager(),
-        Mso::Copy(JavaScriptBundleFile()),
-        [=](std::unique_ptr<const facebook::react::JSBigStdString> script, const std::string &sourceURL) {
-          m_bridgelessReactInstance->loadScript(std::move(script), sourceURL);
-        });
+    {
+      // LoadBundle covers the download from the packager, EvaluateBundle begins once it succeeded.
+      ::Microsoft::ReactNative::StartupTimeline::Scope phase(m_options.StartupTimeline.get(), "LoadBundle");
+      ::Microsoft::ReactNative::LoadRemoteUrlScript(
+          devSettings,
+          ::Microsoft::ReactNative::GetSharedDevManager(),
+          Mso::Copy(JavaScriptBundleFile()),
+          [=](std::unique_ptr<const facebook::react::JSBigStdString> script, const std::string &sourceURL) {
+            if (auto startupTimeline = m_options.StartupTimeline.get()) {
+              startupTimeline->BeginPhase("EvaluateBundle");
+            }
+            m_bridgelessReactInstance->loadScript(std::move(script), sourceURL);
+          });
+    }
 
     m_jsMessageThread.Load()->runOnQueue(
         [weakThis = Mso::WeakPtr{this},
          loadCallbackGuard = Mso::MakeMoveOnCopyWrapper(LoadedCallbackGuard{*this})]() noexcept {
           if (auto strongThis = weakThis.GetStrongPtr()) {
+            if (auto startupTimeline = strongThis->m_options.StartupTimeline.get()) {
+              startupTimeline->EndPhase("EvaluateBundle");
+            }
+
             if (strongThis->State() != ReactInstanceState::HasError) {
               strongThis->OnReactInstanceLoaded(Mso::ErrorCode{});
             }
           }
         });
   } else {
-    auto bundleString = ::Microsoft::ReactNative::JsBigStringFromPath(devSettings, Mso::Copy(JavaScriptBundleFile()));
+    // Only the startup code of indexed bundles is evaluated here, their modules
+    // are evaluated the first time they are required.
+    std::unique_ptr<const facebook::react::JSBigString> bundleString;
+    {
+      ::Microsoft::ReactNative::StartupTimeline::Scope phase(m_options.StartupTimeline.get(), "LoadBundle");
+      auto bundleFilePath = ::Microsoft::ReactNative::BundleFilePath(devSettings, JavaScriptBundleFile());
+      if (!bundleFilePath.empty()) {
+        bundleString = m_segmentedBundleRegistry->LoadMainSegment(bundleFilePath);
+      }
+
+      if (!bundleString) {
+        bundleString = ::Microsoft::ReactNative::JsBigStringFromPath(devSettings, Mso::Copy(JavaScriptBundleFile()));
+      }
+    }
+
+    // The bundle is evaluated on the JavaScript thread, before the task below.
+    if (auto startupTimeline = m_options.StartupTimeline.get()) {
+      startupTimeline->BeginPhase("EvaluateBundle");
+    }
     m_bridgelessReactInstance->loadScript(std::move(bundleString), Mso::Copy(JavaScriptBundleFile()));
 
     m_jsMessageThread.Load()->runOnQueue(
         [weakThis = Mso::WeakPtr{this},
          loadCallbackGuard = Mso::MakeMoveOnCopyWrapper(LoadedCallbackGuard{*this})]() noexcept {
           if (auto strongThis = weakThis.GetStrongPtr()) {
+            if (auto startupTimeline = strongThis->m_options.StartupTimeline.get()) {
+              startupTimeline->EndPhase("EvaluateBundle");
+            }
+
             try {
               if (strongThis->State() != ReactInstanceState::HasError) {
                 strongThis->OnReactInstanceLoaded(Mso::ErrorCode{});
@@ -668,6 +789,11 @@ void ReactInstanceWin::LoadJSBundlesBridgeless(std::shared_ptr<facebook::react::
 void ReactInstanceWin::OnReactInstanceLoaded(const Mso::ErrorCode &errorCode) noexcept {
   bool isLoadedExpected = false;
   if (m_isLoaded.compare_exchange_strong(isLoadedExpected, true)) {
+    if (auto startupTimeline = m_options.StartupTimeline.get()) {
+      startupTimeline->EndPhase("InitializeBridgeless");
+      startupTimeline->Mark(errorCode ? "InstanceLoadFailed" : "InstanceLoaded");
+    }
+
     if (!errorCode) {
       m_state = ReactInstanceState::Loaded;
       m_whenLoaded.SetValue();
@@ -877,58 +1003,98 @@ void ReactInstanceWin::OnDebuggerAttach() noexcept {
   m_updateUI();
 }
 
+// The most calls dispatched to the JavaScript thread at once. The work posted to the JavaScript thread meanwhile runs
+// before the next batch.
+constexpr size_t JSCallBatchSize = 64;
+
 void ReactInstanceWin::DrainJSCallQueue() noexcept {
-  // Handle all items in the queue one by one.
-  for (;;) {
-    JSCallEntry entry; // To avoid callJSFunction under the lock
-    {
-      std::scoped_lock lock{m_mutex};
-      if (m_state == ReactInstanceState::Loaded && !m_jsCallQueue.empty()) {
-        entry = std::move(m_jsCallQueue.front());
-        m_jsCallQueue.pop_front();
-      } else {
-        break;
-      }
+  std::scoped_lock dispatchLock{m_jsCallDispatchMutex};
+  std::vector<Microsoft::ReactNative::JSCall> calls; // To avoid callFunctionOnModule under the lock
+  {
+    std::scoped_lock lock{m_mutex};
+    if (m_state != ReactInstanceState::Loaded) {
+      m_isJSCallQueueDrainScheduled = false;
+      return;
     }
 
-    if (m_bridgelessReactInstance) {
-      m_bridgelessReactInstance->callFunctionOnModule(entry.ModuleName, entry.MethodName, std::move(entry.Args));
+    calls = m_jsCallQueue.PopBatch(JSCallBatchSize);
+  }
+
+  if (m_bridgelessReactInstance) {
+    for (auto &call : calls) {
+      m_bridgelessReactInstance->callFunctionOnModule(call.ModuleName, call.MethodName, std::move(call.Args));
     }
   }
+
+  std::unique_lock lock{m_mutex};
+  m_isJSCallQueueDrainScheduled = false;
+  if (!m_jsCallQueue.IsEmpty()) {
+    // Drain the next batch after the work the calls were scheduled with.
+    ScheduleJSCallQueueDrain(lock);
+  }
+}
+
+void ReactInstanceWin::ScheduleJSCallQueueDrain(std::unique_lock<std::mutex> &lock) noexcept {
+  if (m_isJSCallQueueDrainScheduled) {
+    return;
+  }
+
+  if (auto jsMessageThread = m_jsMessageThread.LoadWithLock(lock)) {
+    m_isJSCallQueueDrainScheduled = true;
+    jsMessageThread->runOnQueue([weakThis = Mso::WeakPtr{this}]() noexcept {
+      if (auto strongThis = weakThis.GetStrongPtr()) {
+        strongThis->DrainJSCallQueue();
+      }
+    });
+  }
 }
 
 void ReactInstanceWin::AbandonJSCallQueue() noexcept {
-  std::deque<JSCallEntry> jsCallQueue; // To avoid destruction under the lock
+  std::vector<Microsoft::ReactNative::JSCall> calls; // To avoid destruction under the lock
   {
     std::scoped_lock lock{m_mutex};
     if (m_state == ReactInstanceState::HasError || m_state == ReactInstanceState::Unloaded) {
-      jsCallQueue = std::move(m_jsCallQueue);
+      calls = m_jsCallQueue.TakeAll();
     }
   }
 }
 
-void ReactInstanceWin::CallJsFunction(
+bool ReactInstanceWin::CallJsFunction(
     std::string &&moduleName,
     std::string &&method,
-    folly::dynamic &&params) noexcept {
-  bool shouldCall{false}; // To call callJSFunction outside of lock
+    folly::dynamic &&params,
+    bool idempotent) noexcept {
+  // Calls are dispatched in the order they get this lock, whether they are queued or not.
+  std::scoped_lock dispatchLock{m_jsCallDispatchMutex};
   {
-    std::scoped_lock lock{m_mutex};
-    if (m_state == ReactInstanceState::Loaded && m_jsCallQueue.empty()) {
-      shouldCall = true;
-    } else if (
-        m_state == ReactInstanceState::Loading || m_state == ReactInstanceState::WaitingForDebugger ||
-        (m_state == ReactInstanceState::Loaded && !m_jsCallQueue.empty())) {
-      m_jsCallQueue.push_back(JSCallEntry{std::move(moduleName), std::move(method), std::move(params)});
+    std::unique_lock lock{m_mutex};
+    if (m_state != ReactInstanceState::Loading && m_state != ReactInstanceState::WaitingForDebugger &&
+        m_state != ReactInstanceState::Loaded) {
+      return false; // ignore the call
     }
-    // otherwise ignore the call
-  }
 
-  if (shouldCall) {
-    if (m_bridgelessReactInstance) {
-      m_bridgelessReactInstance->callFunctionOnModule(moduleName, method, std::move(params));
+    // callFunctionOnModule already posts the call to the JavaScript thread, the queue is only needed while calls
+    // are waiting: while loading, or when the JavaScript thread does not keep up.
+    if (m_state != ReactInstanceState::Loaded || m_isJSCallQueueDrainScheduled ||
+        !m_jsCallQueue.TryDispatchDirectly()) {
+      // Calls made while loading are dispatched once the instance is loaded.
+      const auto result = m_jsCallQueue.Push(std::move(moduleName), std::move(method), std::move(params), idempotent);
+      if (m_state == ReactInstanceState::Loaded) {
+        ScheduleJSCallQueueDrain(lock);
+      }
+      return result != Microsoft::ReactNative::JSCallQueue::PushResult::Dropped;
     }
   }
+
+  if (m_bridgelessReactInstance) {
+    m_bridgelessReactInstance->callFunctionOnModule(moduleName, method, std::move(params));
+  }
+  return true;
+}
+
+Microsoft::ReactNative::JSCallQueueMetrics ReactInstanceWin::JSCallQueueMetrics() const noexcept {
+  std::scoped_lock lock{m_mutex};
+  return m_jsCallQueue.Metrics();
 }
 
 void ReactInstanceWin::DispatchEvent(int64_t viewTag, std::string &&eventName, folly::dynamic &&eventData) noexcept {
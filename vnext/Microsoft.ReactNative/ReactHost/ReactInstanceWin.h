@@ -7,6 +7,7 @@
 #include <tuple>
 #include "IReactDispatcher.h"
 #include "IReactInstanceInternal.h"
+#include "JSCallQueue.h"
 #include "MsoReactContext.h"
 #include "ReactNativeHeaders.h"
 #include "React_win.h"
@@ -18,6 +19,10 @@ namespace winrt::Microsoft::ReactNative {
 class TurboModulesProvider;
 } // namespace winrt::Microsoft::ReactNative
 
+namespace Microsoft::ReactNative {
+class SegmentedBundleRegistry;
+} // namespace Microsoft::ReactNative
+
 namespace Mso::React {
 
 static_assert(
@@ -52,8 +57,15 @@ class ReactInstanceWin final : public Mso::ActiveObject<IReactInstanceInternal>
   Mso::Future<void> Destroy() noexcept override;
 
  public:
-  void CallJsFunction(std::string &&moduleName, std::string &&method, folly::dynamic &&params) noexcept;
+  // Idempotent calls replace the same call that was not dispatched yet, see JSCallQueue.
+  // Returns false when the call is dropped, because the instance is not loading or loaded, or the queue is full.
+  bool CallJsFunction(
+      std::string &&moduleName,
+      std::string &&method,
+      folly::dynamic &&params,
+      bool idempotent = false) noexcept;
   void DispatchEvent(int64_t viewTag, std::string &&eventName, folly::dynamic &&eventData) noexcept;
+  Microsoft::ReactNative::JSCallQueueMetrics JSCallQueueMetrics() const noexcept;
   winrt::Microsoft::ReactNative::JsiRuntime JsiRuntime() noexcept;
   bool IsLoaded() const noexcept;
 
@@ -121,16 +133,11 @@ class ReactInstanceWin final : public Mso::ActiveObject<IReactInstanceInternal>
   void OnReactInstanceLoaded(const Mso::ErrorCode &errorCode) noexcept;
 
   void DrainJSCallQueue() noexcept;
+  void ScheduleJSCallQueueDrain(std::unique_lock<std::mutex> &lock) noexcept;
   void AbandonJSCallQueue() noexcept;
 
   void InstanceCrashHandler(int fileDescriptor) noexcept;
 
-  struct JSCallEntry {
-    std::string ModuleName;
-    std::string MethodName;
-    folly::dynamic Args;
-  };
-
  private: // immutable fields
   const Mso::WeakPtr<IReactHost> m_weakReactHost;
   const ReactOptions m_options;
@@ -161,11 +168,15 @@ class ReactInstanceWin final : public Mso::ActiveObject<IReactInstanceInternal>
   const Mso::ActiveReadableField<std::shared_ptr<facebook::react::MessageQueueThread>> m_uiMessageThread{
       Queue(),
       m_mutex};
-  std::deque<JSCallEntry> m_jsCallQueue;
+  Microsoft::ReactNative::JSCallQueue m_jsCallQueue;
+  bool m_isJSCallQueueDrainScheduled{false};
+  // Held while calls are dispatched to keep them in order, locked before m_mutex.
+  std::mutex m_jsCallDispatchMutex;
 
   // Bridgeless
   std::shared_ptr<facebook::react::ReactInstance> m_bridgelessReactInstance;
   std::shared_ptr<Microsoft::JSI::RuntimeHolderLazyInit> m_jsiRuntimeHolder;
+  std::shared_ptr<Microsoft::ReactNative::SegmentedBundleRegistry> m_segmentedBundleRegistry;
   winrt::Microsoft::ReactNative::JsiRuntime m_jsiRuntime{nullptr};
 
   std::atomic<ReactInstanceState> m_state{ReactInstanceState::Loading};
@@ -102,6 +102,12 @@ struct ReactInstanceSettings : ReactInstanceSettingsT<ReactInstanceSettings> {
   bool EnableDefaultCrashHandler() noexcept;
   void EnableDefaultCrashHandler(bool value) noexcept;
 
+  bool EnableParallelModuleInit() noexcept;
+  void EnableParallelModuleInit(bool value) noexcept;
+
+  hstring ConstantsCacheDirectory() noexcept;
+  void ConstantsCacheDirectory(hstring const &value) noexcept;
+
   //! Same as UseDeveloperSupport
   bool EnableDeveloperMenu() noexcept;
   void EnableDeveloperMenu(bool value) noexcept;
@@ -177,6 +183,8 @@ struct ReactInstanceSettings : ReactInstanceSettingsT<ReactInstanceSettings> {
   bool m_devBundle{true};
   bool m_enableJITCompilation{true};
   bool m_enableByteCodeCaching{false};
+  bool m_enableParallelModuleInit{false};
+  hstring m_constantsCacheDirectory{};
   hstring m_byteCodeFileUri{};
   hstring m_debugBundlePath{};
   hstring m_bundleRootPath{};
@@ -257,6 +265,22 @@ inline void ReactInstanceSettings::EnableByteCodeCaching(bool value) noexcept {
   m_enableByteCodeCaching = value;
 }
 
+inline bool ReactInstanceSettings::EnableParallelModuleInit() noexcept {
+  return m_enableParallelModuleInit;
+}
+
+inline void ReactInstanceSettings::EnableParallelModuleInit(bool value) noexcept {
+  m_enableParallelModuleInit = value;
+}
+
+inline hstring ReactInstanceSettings::ConstantsCacheDirectory() noexcept {
+  return m_constantsCacheDirectory;
+}
+
+inline void ReactInstanceSettings::ConstantsCacheDirectory(hstring const &value) noexcept {
+  m_constantsCacheDirectory = value;
+}
+
 inline hstring ReactInstanceSettings::ByteCodeFileUri() noexcept {
   return m_byteCodeFileUri;
 }
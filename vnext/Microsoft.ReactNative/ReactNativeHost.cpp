@@ -82,6 +82,12 @@ ReactNativeHostProperty() noexcept {
 }
 
 IAsyncAction ReactNativeHost::ReloadInstance() noexcept {
+  auto startupTimeline = std::make_shared<::Microsoft::ReactNative::StartupTimeline>();
+  {
+    std::scoped_lock lock{m_startupTimelineMutex};
+    m_startupTimeline = startupTimeline;
+  }
+
   auto turboModulesProvider = std::make_shared<TurboModulesProvider>();
 
   auto uriImageManager =
@@ -97,6 +103,7 @@ IAsyncAction ReactNativeHost::ReloadInstance() noexcept {
   winrt::Microsoft::ReactNative::Composition::implementation::RegisterWindowsModalHostNativeComponent(m_packageBuilder);
 
   if (auto packageProviders = InstanceSettings().PackageProviders()) {
+    ::Microsoft::ReactNative::StartupTimeline::Scope phase(startupTimeline.get(), "CreatePackages");
     for (auto const &packageProvider : packageProviders) {
       packageProvider.CreatePackage(m_packageBuilder);
     }
@@ -145,6 +152,8 @@ IAsyncAction ReactNativeHost::ReloadInstance() noexcept {
 
   reactOptions.ByteCodeFileUri = to_string(m_instanceSettings.ByteCodeFileUri());
   reactOptions.EnableByteCodeCaching = m_instanceSettings.EnableByteCodeCaching();
+  reactOptions.EnableParallelModuleInit = m_instanceSettings.EnableParallelModuleInit();
+  reactOptions.ConstantsCacheDirectory = to_string(m_instanceSettings.ConstantsCacheDirectory());
   reactOptions.SetEnableDefaultCrashHandler(m_instanceSettings.EnableDefaultCrashHandler());
   reactOptions.SetJsiEngine(static_cast<Mso::React::JSIEngine>(m_instanceSettings.JSIEngineOverride()));
 
@@ -152,6 +161,8 @@ IAsyncAction ReactNativeHost::ReloadInstance() noexcept {
 
   reactOptions.UriImageManager = uriImageManager;
 
+  reactOptions.StartupTimeline = std::move(startupTimeline);
+
   reactOptions.OnInstanceCreated = [](Mso::CntPtr<Mso::React::IReactContext> &&context) {
     auto notifications = context->Notifications();
     ReactInstanceSettings::RaiseInstanceCreated(
@@ -181,6 +192,26 @@ IAsyncAction ReactNativeHost::UnloadInstance() noexcept {
   return make<Mso::AsyncActionFutureAdapter>(m_reactHost->UnloadInstance());
 }
 
+winrt::com_array<ReactNative::StartupPhase> ReactNativeHost::GetStartupTimeline() noexcept {
+  std::vector<ReactNative::StartupPhase> phases;
+  {
+    std::scoped_lock lock{m_startupTimelineMutex};
+    if (m_startupTimeline) {
+      for (const auto &phase : m_startupTimeline->Phases()) {
+        phases.push_back(
+            {winrt::to_hstring(phase.name), phase.startMs, phase.wallTimeMs, phase.cpuTimeMs, phase.isMarker});
+      }
+    }
+  }
+
+  return winrt::com_array<ReactNative::StartupPhase>(phases);
+}
+
+hstring ReactNativeHost::GetStartupTraceJson() noexcept {
+  std::scoped_lock lock{m_startupTimelineMutex};
+  return m_startupTimeline ? winrt::to_hstring(m_startupTimeline->ToChromeTraceJson()) : hstring{};
+}
+
 Mso::React::IReactHost *ReactNativeHost::ReactHost() noexcept {
   return m_reactHost.Get();
 }
@@ -29,6 +29,9 @@ struct ReactNativeHost : ReactNativeHostT<ReactNativeHost> {
   winrt::Windows::Foundation::IAsyncAction ReloadInstance() noexcept;
   winrt::Windows::Foundation::IAsyncAction UnloadInstance() noexcept;
 
+  winrt::com_array<ReactNative::StartupPhase> GetStartupTimeline() noexcept;
+  hstring GetStartupTraceJson() noexcept;
+
  public:
   Mso::React::IReactHost *ReactHost() noexcept;
   static ReactNative::ReactNativeHost GetReactNativeHost(ReactPropertyBag const &properties) noexcept;
@@ -38,6 +41,10 @@ struct ReactNativeHost : ReactNativeHostT<ReactNativeHost> {
 
   ReactNative::ReactInstanceSettings m_instanceSettings{nullptr};
   ReactNative::IReactPackageBuilder m_packageBuilder;
+
+  // Replaced on each reload, while the previous instance may still be using it.
+  std::mutex m_startupTimelineMutex;
+  std::shared_ptr<::Microsoft::ReactNative::StartupTimeline> m_startupTimeline;
 };
 
 } // namespace winrt::Microsoft::ReactNative::implementation
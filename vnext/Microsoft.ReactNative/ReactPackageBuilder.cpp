@@ -41,6 +41,29 @@ void ReactPackageBuilder::AddEagerInitTurboModule(
   m_turboModulesProvider->AddEagerInit(winrt::to_string(moduleName));
 }
 
+void ReactPackageBuilder::AddThreadAgnosticEagerInitTurboModule(
+    hstring const &moduleName,
+    ReactModuleProvider const &moduleProvider) noexcept {
+  m_turboModulesProvider->AddModuleProvider(moduleName, moduleProvider, true);
+  m_turboModulesProvider->AddEagerInit(winrt::to_string(moduleName), /*threadAgnostic:*/ true);
+}
+
+void ReactPackageBuilder::CacheTurboModuleConstants(
+    hstring const &moduleName,
+    hstring const &moduleVersion,
+    winrt::Windows::Foundation::Collections::IVectorView<hstring> const &invalidationInputs) noexcept {
+  std::vector<std::string> inputs;
+  if (invalidationInputs) {
+    for (auto const &input : invalidationInputs) {
+      inputs.push_back(winrt::to_string(input));
+    }
+  }
+
+  m_turboModulesProvider->CacheConstants(
+      winrt::to_string(moduleName),
+      ::Microsoft::ReactNative::ConstantsCache::MakeKey(winrt::to_string(moduleVersion), inputs));
+}
+
 void ReactPackageBuilder::AddViewComponent(
     winrt::hstring componentName,
     ReactViewComponentProvider const &viewComponentProvider) noexcept {
@@ -10,7 +10,12 @@
 
 namespace winrt::Microsoft::ReactNative {
 
-struct ReactPackageBuilder : winrt::implements<ReactPackageBuilder, IReactPackageBuilder, IReactPackageBuilderFabric> {
+struct ReactPackageBuilder : winrt::implements<
+                                 ReactPackageBuilder,
+                                 IReactPackageBuilder,
+                                 IReactPackageBuilderFabric,
+                                 IReactPackageBuilderEagerInit,
+                                 IReactPackageBuilderConstantsCache> {
   ReactPackageBuilder(
       std::shared_ptr<TurboModulesProvider> const &turboModulesProvider,
       std::shared_ptr<::Microsoft::ReactNative::WindowsComponentDescriptorRegistry> const &componentRegistry,
@@ -22,6 +27,17 @@ struct ReactPackageBuilder : winrt::implements<ReactPackageBuilder, IReactPackag
   void AddTurboModule(hstring const &moduleName, ReactModuleProvider const &moduleProvider) noexcept;
   void AddEagerInitTurboModule(hstring const &moduleName, ReactModuleProvider const &moduleProvider) noexcept;
 
+  // IReactPackageBuilderEagerInit
+  void AddThreadAgnosticEagerInitTurboModule(
+      hstring const &moduleName,
+      ReactModuleProvider const &moduleProvider) noexcept;
+
+  // IReactPackageBuilderConstantsCache
+  void CacheTurboModuleConstants(
+      hstring const &moduleName,
+      hstring const &moduleVersion,
+      winrt::Windows::Foundation::Collections::IVectorView<hstring> const &invalidationInputs) noexcept;
+
   // IReactPackageBuilderFabric
   void AddViewComponent(winrt::hstring componentName, ReactViewComponentProvider const &viewComponentProvider) noexcept;
   void AddUriImageProvider(const winrt::Microsoft::ReactNative::Composition::IUriImageProvider &provider) noexcept;
@@ -9,12 +9,15 @@
 #include "TurboModulesProvider.h"
 #include <IReactContext.h>
 #include <ReactCommon/TurboModuleUtils.h>
+#include <dispatchQueue/dispatchQueue.h>
 #include <react/bridging/EventEmitter.h>
+#include <condition_variable>
 #include "CallInvokerWriter.h"
 #include "JSValueWriter.h"
 #include "JsiApi.h"
 #include "JsiReader.h"
 #include "JsiWriter.h"
+#include "LongLivedJsiCallbacks.h"
 #ifdef __APPLE__
 #include "Crash.h"
 #else
@@ -38,12 +41,21 @@ struct TurboModuleMethodInfo {
 struct TurboModuleBuilder : winrt::implements<TurboModuleBuilder, IReactModuleBuilder> {
   TurboModuleBuilder(const IReactContext &reactContext) noexcept : m_reactContext(reactContext) {}
 
+  // A builder used off the JavaScript thread holds JSI initializers until RunDeferredJsiInitializers is called.
+  TurboModuleBuilder(const IReactContext &reactContext, bool deferJsiInitializers) noexcept
+      : m_reactContext(reactContext), m_deferJsiInitializers(deferJsiInitializers) {}
+
  public: // IReactModuleBuilder
   void AddInitializer(InitializerDelegate const &initializer) noexcept {
     initializer(m_reactContext);
   }
 
   void AddJsiInitializer(JsiInitializerDelegate const &initializer) noexcept {
+    if (m_deferJsiInitializers) {
+      m_deferredJsiInitializers.push_back(initializer);
+      return;
+    }
+
     initializer(
         m_reactContext,
         winrt::get_self<winrt::Microsoft::ReactNative::implementation::ReactContext>(m_reactContext)
@@ -75,6 +87,16 @@ struct TurboModuleBuilder : winrt::implements<TurboModuleBuilder, IReactModuleBu
   }
 
  public:
+  // Must be called on the JavaScript thread.
+  void RunDeferredJsiInitializers() noexcept {
+    m_deferJsiInitializers = false;
+    auto initializers = std::move(m_deferredJsiInitializers);
+    m_deferredJsiInitializers.clear();
+    for (const auto &initializer : initializers) {
+      AddJsiInitializer(initializer);
+    }
+  }
+
   const std::unordered_map<std::string, TurboModuleMethodInfo> &Methods() const noexcept {
     return m_methods;
   }
@@ -108,8 +130,95 @@ struct TurboModuleBuilder : winrt::implements<TurboModuleBuilder, IReactModuleBu
   std::unordered_map<std::string, SyncMethodDelegate> m_syncMethods;
   std::vector<ConstantProviderDelegate> m_constantProviders;
   bool m_constantsEvaluated{false};
+  bool m_deferJsiInitializers{false};
+  std::vector<JsiInitializerDelegate> m_deferredJsiInitializers;
+};
+
+/*-------------------------------------------------------------------------------
+  ConstantsSnapshotWriter
+-------------------------------------------------------------------------------*/
+
+// Writes the output of constant providers as a constants snapshot.
+struct ConstantsSnapshotWriter : winrt::implements<ConstantsSnapshotWriter, IJSValueWriter> {
+ public: // IJSValueWriter
+  void WriteNull() noexcept {
+    m_builder.WriteNull();
+  }
+
+  void WriteBoolean(bool value) noexcept {
+    m_builder.WriteBoolean(value);
+  }
+
+  void WriteInt64(int64_t value) noexcept {
+    m_builder.WriteNumber(static_cast<double>(value));
+  }
+
+  void WriteDouble(double value) noexcept {
+    m_builder.WriteNumber(value);
+  }
+
+  void WriteString(const winrt::hstring &value) noexcept {
+    m_builder.WriteString(winrt::to_string(value));
+  }
+
+  void WriteObjectBegin() noexcept {
+    m_builder.WriteObjectBegin();
+  }
+
+  void WritePropertyName(const winrt::hstring &name) noexcept {
+    m_builder.WritePropertyName(winrt::to_string(name));
+  }
+
+  void WriteObjectEnd() noexcept {
+    m_builder.WriteObjectEnd();
+  }
+
+  void WriteArrayBegin() noexcept {
+    m_builder.WriteArrayBegin();
+  }
+
+  void WriteArrayEnd() noexcept {
+    m_builder.WriteArrayEnd();
+  }
+
+ public:
+  std::string TakeSnapshot() noexcept {
+    return m_builder.TakeSnapshot();
+  }
+
+ private:
+  ::Microsoft::ReactNative::ConstantsSnapshotBuilder m_builder;
+};
+
+// The constants of a module that are cached from one run to the next.
+struct CachedConstants {
+  std::shared_ptr<::Microsoft::ReactNative::ConstantsCache> cache;
+  std::string moduleName;
+  uint64_t key;
+  // Loaded or built by the first getConstants call.
+  std::optional<std::string> snapshot;
 };
 
+std::string SnapshotConstants(const winrt::com_ptr<TurboModuleBuilder> &moduleBuilder) noexcept {
+  auto writer = winrt::make_self<ConstantsSnapshotWriter>();
+  writer->WriteObjectBegin();
+  for (auto const &constantProvider : moduleBuilder->ConstantProviders()) {
+    constantProvider(writer.as<IJSValueWriter>());
+  }
+  writer->WriteObjectEnd();
+  return writer->TakeSnapshot();
+}
+
+void StoreConstants(const std::shared_ptr<CachedConstants> &cachedConstants) noexcept {
+  // Writing the file does not need to hold the JavaScript thread.
+  Mso::DispatchQueue::ConcurrentQueue().Post([cache = cachedConstants->cache,
+                                               moduleName = cachedConstants->moduleName,
+                                               key = cachedConstants->key,
+                                               snapshot = *cachedConstants->snapshot]() noexcept {
+    cache->Store(moduleName, key, snapshot);
+  });
+}
+
 /*-------------------------------------------------------------------------------
   TurboModuleImpl
 -------------------------------------------------------------------------------*/
@@ -120,20 +229,30 @@ class TurboModuleImpl : public facebook::react::TurboModule {
       const IReactContext &reactContext,
       const std::string &name,
       const std::shared_ptr<facebook::react::CallInvoker> &jsInvoker,
-      std::weak_ptr<facebook::react::LongLivedObjectCollection> longLivedObjectCollection,
+      std::shared_ptr<RuntimeJsiCallbacks> runtimeJsiCallbacks,
       const ReactModuleProvider &reactModuleProvider)
       : facebook::react::TurboModule(name, jsInvoker),
         m_reactContext(reactContext),
-        m_longLivedObjectCollection(std::move(longLivedObjectCollection)),
+        m_runtimeJsiCallbacks(std::move(runtimeJsiCallbacks)),
         m_moduleBuilder(winrt::make_self<TurboModuleBuilder>(reactContext)),
         m_providedModule(reactModuleProvider(m_moduleBuilder.as<IReactModuleBuilder>())) {
-    if (auto hostObject = m_providedModule.try_as<IJsiHostObject>()) {
-      // Force ABI runtime creation if it hasn't already been created
-      winrt::get_self<winrt::Microsoft::ReactNative::implementation::ReactContext>(m_reactContext)
-          ->GetInner()
-          .JsiRuntime();
-      m_hostObjectWrapper = std::make_shared<implementation::HostObjectWrapper>(hostObject);
-    }
+    InitHostObject();
+  }
+
+  // Wraps a module that was already provided, possibly on another thread.
+  TurboModuleImpl(
+      const IReactContext &reactContext,
+      const std::string &name,
+      const std::shared_ptr<facebook::react::CallInvoker> &jsInvoker,
+      std::shared_ptr<RuntimeJsiCallbacks> runtimeJsiCallbacks,
+      winrt::com_ptr<TurboModuleBuilder> &&moduleBuilder,
+      IInspectable &&providedModule)
+      : facebook::react::TurboModule(name, jsInvoker),
+        m_reactContext(reactContext),
+        m_runtimeJsiCallbacks(std::move(runtimeJsiCallbacks)),
+        m_moduleBuilder(std::move(moduleBuilder)),
+        m_providedModule(std::move(providedModule)) {
+    InitHostObject();
   }
 
   std::vector<facebook::jsi::PropNameID> getPropertyNames(facebook::jsi::Runtime &rt) override {
@@ -169,6 +288,31 @@ class TurboModuleImpl : public facebook::react::TurboModule {
     // it is not safe to assume that "runtime" never changes, so members are not cached here
     std::string key = propName.utf8(runtime);
 
+    if (key == "getConstants" && !m_moduleBuilder->ConstantProviders().empty() && m_cachedConstants) {
+      return facebook::jsi::Function::createFromHostFunction(
+          runtime,
+          propName,
+          0,
+          [moduleBuilder = m_moduleBuilder, cachedConstants = m_cachedConstants](
+              facebook::jsi::Runtime &rt,
+              const facebook::jsi::Value & /*thisVal*/,
+              const facebook::jsi::Value * /*args*/,
+              size_t /*count*/) {
+            if (!cachedConstants->snapshot) {
+              // The cache only has constants stored with the same key and cache version, which change with the
+              // inputs the constants depend on: the constant providers only run when the snapshot is invalidated.
+              cachedConstants->snapshot =
+                  cachedConstants->cache->Load(cachedConstants->moduleName, cachedConstants->key);
+              if (!cachedConstants->snapshot) {
+                cachedConstants->snapshot = SnapshotConstants(moduleBuilder);
+                StoreConstants(cachedConstants);
+              }
+            }
+
+            return ::Microsoft::ReactNative::MaterializeConstantsSnapshot(rt, *cachedConstants->snapshot);
+          });
+    }
+
     if (key == "getConstants" && !m_moduleBuilder->ConstantProviders().empty()) {
       // try to find getConstants if there is any constant
       return facebook::jsi::Function::createFromHostFunction(
@@ -215,21 +359,18 @@ class TurboModuleImpl : public facebook::react::TurboModule {
                 runtime,
                 propName,
                 0,
-                [jsInvoker = jsInvoker_,
-                 method = methodInfo.Method,
-                 longLivedObjectCollection = m_longLivedObjectCollection](
+                [jsInvoker = jsInvoker_, method = methodInfo.Method, weakCallbacks = JsiCallbacks(runtime)](
                     facebook::jsi::Runtime &rt,
                     const facebook::jsi::Value & /*thisVal*/,
                     const facebook::jsi::Value *args,
                     size_t argCount) {
                   VerifyElseCrash(argCount > 0);
-                  if (auto strongLongLivedObjectCollection = longLivedObjectCollection.lock()) {
-                    auto jsiRuntimeHolder = LongLivedJsiRuntime::CreateWeak(strongLongLivedObjectCollection, rt);
-                    auto writer = winrt::make<CallInvokerWriter>(jsInvoker, jsiRuntimeHolder);
+                  if (auto callbacks = weakCallbacks.lock()) {
+                    auto writer = winrt::make<CallInvokerWriter>(jsInvoker, weakCallbacks);
                     method(
                         winrt::make<JsiReader>(rt, args, argCount - 1),
                         writer,
-                        MakeCallback(rt, strongLongLivedObjectCollection, args[argCount - 1]),
+                        MakeCallback(rt, callbacks, args[argCount - 1]),
                         nullptr);
                     winrt::get_self<CallInvokerWriter>(writer)->ExitCurrentCallInvokeScope();
                   }
@@ -240,54 +381,41 @@ class TurboModuleImpl : public facebook::react::TurboModule {
                 runtime,
                 propName,
                 0,
-                [jsInvoker = jsInvoker_,
-                 method = methodInfo.Method,
-                 longLivedObjectCollection = m_longLivedObjectCollection](
+                [jsInvoker = jsInvoker_, method = methodInfo.Method, weakCallbacks = JsiCallbacks(runtime)](
                     facebook::jsi::Runtime &rt,
                     const facebook::jsi::Value & /*thisVal*/,
                     const facebook::jsi::Value *args,
                     size_t argCount) {
                   VerifyElseCrash(argCount > 1);
-                  if (auto strongLongLivedObjectCollection = longLivedObjectCollection.lock()) {
-                    auto jsiRuntimeHolder = LongLivedJsiRuntime::CreateWeak(strongLongLivedObjectCollection, rt);
-                    auto weakCallback1 = LongLivedJsiFunction::CreateWeak(
-                        strongLongLivedObjectCollection, rt, args[argCount - 2].getObject(rt).getFunction(rt));
-                    auto weakCallback2 = LongLivedJsiFunction::CreateWeak(
-                        strongLongLivedObjectCollection, rt, args[argCount - 1].getObject(rt).getFunction(rt));
-
-                    auto writer = winrt::make<CallInvokerWriter>(jsInvoker, jsiRuntimeHolder);
+                  if (auto callbacks = weakCallbacks.lock()) {
+                    auto callback1 = callbacks->Add(args[argCount - 2].getObject(rt).getFunction(rt));
+                    auto callback2 = callbacks->Add(args[argCount - 1].getObject(rt).getFunction(rt));
+
+                    auto writer = winrt::make<CallInvokerWriter>(jsInvoker, weakCallbacks);
                     method(
                         winrt::make<JsiReader>(rt, args, argCount - 2),
                         writer,
-                        [weakCallback1, weakCallback2, jsiRuntimeHolder](const IJSValueWriter &writer) noexcept {
+                        [weakCallbacks, callback1, callback2](const IJSValueWriter &writer) noexcept {
                           writer.as<CallInvokerWriter>()->WithResultArgs(
-                              [weakCallback1, weakCallback2, jsiRuntimeHolder](
+                              [weakCallbacks, callback1, callback2](
                                   facebook::jsi::Runtime &rt, facebook::jsi::Value const *args, size_t count) {
-                                if (auto callback1 = weakCallback1.lock()) {
-                                  callback1->Value().call(rt, args, count);
-                                  callback1->allowRelease();
-                                }
-                                if (auto callback2 = weakCallback2.lock()) {
-                                  callback2->allowRelease();
-                                }
-                                if (auto runtimeHolder = jsiRuntimeHolder.lock()) {
-                                  runtimeHolder->allowRelease();
+                                if (auto callbacks = weakCallbacks.lock()) {
+                                  if (auto callback = callbacks->Take(callback1)) {
+                                    callback->call(rt, args, count);
+                                  }
+                                  callbacks->Release(callback2);
                                 }
                               });
                         },
-                        [weakCallback1, weakCallback2, jsiRuntimeHolder](const IJSValueWriter &writer) noexcept {
+                        [weakCallbacks, callback1, callback2](const IJSValueWriter &writer) noexcept {
                           writer.as<CallInvokerWriter>()->WithResultArgs(
-                              [weakCallback1, weakCallback2, jsiRuntimeHolder](
+                              [weakCallbacks, callback1, callback2](
                                   facebook::jsi::Runtime &rt, facebook::jsi::Value const *args, size_t count) {
-                                if (auto callback2 = weakCallback2.lock()) {
-                                  callback2->Value().call(rt, args, count);
-                                  callback2->allowRelease();
-                                }
-                                if (auto callback1 = weakCallback1.lock()) {
-                                  callback1->allowRelease();
-                                }
-                                if (auto runtimeHolder = jsiRuntimeHolder.lock()) {
-                                  runtimeHolder->allowRelease();
+                                if (auto callbacks = weakCallbacks.lock()) {
+                                  if (auto callback = callbacks->Take(callback2)) {
+                                    callback->call(rt, args, count);
+                                  }
+                                  callbacks->Release(callback1);
                                 }
                               });
                         });
@@ -300,76 +428,64 @@ class TurboModuleImpl : public facebook::react::TurboModule {
                 runtime,
                 propName,
                 0,
-                [jsInvoker = jsInvoker_,
-                 method = methodInfo.Method,
-                 longLivedObjectCollection = m_longLivedObjectCollection](
+                [jsInvoker = jsInvoker_, method = methodInfo.Method, weakCallbacks = JsiCallbacks(runtime)](
                     facebook::jsi::Runtime &rt,
                     const facebook::jsi::Value & /*thisVal*/,
                     const facebook::jsi::Value *args,
                     size_t count) {
-                  if (auto strongLongLivedObjectCollection = longLivedObjectCollection.lock()) {
-                    auto jsiRuntimeHolder = LongLivedJsiRuntime::CreateWeak(strongLongLivedObjectCollection, rt);
+                  if (auto callbacks = weakCallbacks.lock()) {
                     auto argReader = winrt::make<JsiReader>(rt, args, count);
-                    auto argWriter = winrt::make<CallInvokerWriter>(jsInvoker, jsiRuntimeHolder);
+                    auto argWriter = winrt::make<CallInvokerWriter>(jsInvoker, weakCallbacks);
                     return facebook::react::createPromiseAsJSIValue(
                         rt,
-                        [method, argReader, argWriter, strongLongLivedObjectCollection, jsiRuntimeHolder](
+                        [method, argReader, argWriter, callbacks, weakCallbacks](
                             facebook::jsi::Runtime &runtime, std::shared_ptr<facebook::react::Promise> promise) {
-                          auto weakResolve = LongLivedJsiFunction::CreateWeak(
-                              strongLongLivedObjectCollection, runtime, std::move(promise->resolve_));
-                          auto weakReject = LongLivedJsiFunction::CreateWeak(
-                              strongLongLivedObjectCollection, runtime, std::move(promise->reject_));
+                          auto resolve = callbacks->Add(std::move(promise->resolve_));
+                          auto reject = callbacks->Add(std::move(promise->reject_));
                           method(
                               argReader,
                               argWriter,
-                              [weakResolve, weakReject, jsiRuntimeHolder](const IJSValueWriter &writer) {
+                              [weakCallbacks, resolve, reject](const IJSValueWriter &writer) {
                                 writer.as<CallInvokerWriter>()->WithResultArgs(
-                                    [weakResolve, weakReject, jsiRuntimeHolder](
+                                    [weakCallbacks, resolve, reject](
                                         facebook::jsi::Runtime &runtime,
                                         facebook::jsi::Value const *args,
                                         size_t argCount) {
                                       VerifyElseCrash(argCount == 1);
-                                      if (auto resolveHolder = weakResolve.lock()) {
-                                        resolveHolder->Value().call(runtime, args[0]);
-                                        resolveHolder->allowRelease();
-                                      }
-                                      if (auto rejectHolder = weakReject.lock()) {
-                                        rejectHolder->allowRelease();
-                                      }
-                                      if (auto runtimeHolder = jsiRuntimeHolder.lock()) {
-                                        runtimeHolder->allowRelease();
+                                      if (auto callbacks = weakCallbacks.lock()) {
+                                        if (auto resolveFunction = callbacks->Take(resolve)) {
+                                          resolveFunction->call(runtime, args[0]);
+                                        }
+                                        callbacks->Release(reject);
                                       }
                                     });
                               },
-                              [weakResolve, weakReject, jsiRuntimeHolder](const IJSValueWriter &writer) {
+                              [weakCallbacks, resolve, reject](const IJSValueWriter &writer) {
                                 writer.as<CallInvokerWriter>()->WithResultArgs(
-                                    [weakResolve, weakReject, jsiRuntimeHolder](
+                                    [weakCallbacks, resolve, reject](
                                         facebook::jsi::Runtime &runtime,
                                         facebook::jsi::Value const *args,
                                         size_t argCount) {
                                       VerifyElseCrash(argCount == 1);
-                                      if (auto rejectHolder = weakReject.lock()) {
-                                        // To match the Android and iOS TurboModule behavior we create the Error object
-                                        // for the Promise rejection the same way as in updateErrorWithErrorData method.
-                                        // See react-native/Libraries/BatchedBridge/NativeModules.js for details.
-                                        auto error = runtime.global()
-                                                         .getPropertyAsFunction(runtime, "Error")
-                                                         .callAsConstructor(runtime, {});
-                                        auto &errorData = args[0];
-                                        if (errorData.isObject()) {
-                                          runtime.global()
-                                              .getPropertyAsObject(runtime, "Object")
-                                              .getPropertyAsFunction(runtime, "assign")
-                                              .call(runtime, error, errorData.getObject(runtime));
+                                      if (auto callbacks = weakCallbacks.lock()) {
+                                        if (auto rejectFunction = callbacks->Take(reject)) {
+                                          // To match the Android and iOS TurboModule behavior we create the Error
+                                          // object for the Promise rejection the same way as in
+                                          // updateErrorWithErrorData method.
+                                          // See react-native/Libraries/BatchedBridge/NativeModules.js for details.
+                                          auto error = runtime.global()
+                                                           .getPropertyAsFunction(runtime, "Error")
+                                                           .callAsConstructor(runtime, {});
+                                          auto &errorData = args[0];
+                                          if (errorData.isObject()) {
+                                            runtime.global()
+                                                .getPropertyAsObject(runtime, "Object")
+                                                .getPropertyAsFunction(runtime, "assign")
+                                                .call(runtime, error, errorData.getObject(runtime));
+                                          }
+                                          rejectFunction->call(runtime, args[0]);
                                         }
-                                        rejectHolder->Value().call(runtime, args[0]);
-                                        rejectHolder->allowRelease();
-                                      }
-                                      if (auto resolveHolder = weakResolve.lock()) {
-                                        resolveHolder->allowRelease();
-                                      }
-                                      if (auto runtimeHolder = jsiRuntimeHolder.lock()) {
-                                        runtimeHolder->allowRelease();
+                                        callbacks->Release(resolve);
                                       }
                                     });
                               });
@@ -448,19 +564,40 @@ class TurboModuleImpl : public facebook::react::TurboModule {
     facebook::react::TurboModule::set(rt, name, value);
   }
 
+ public:
+  void CacheConstants(std::shared_ptr<::Microsoft::ReactNative::ConstantsCache> cache, uint64_t key) noexcept {
+    m_cachedConstants = std::make_shared<CachedConstants>(CachedConstants{std::move(cache), name_, key});
+  }
+
  private:
+  void InitHostObject() noexcept {
+    if (auto hostObject = m_providedModule.try_as<IJsiHostObject>()) {
+      // Force ABI runtime creation if it hasn't already been created
+      winrt::get_self<winrt::Microsoft::ReactNative::implementation::ReactContext>(m_reactContext)
+          ->GetInner()
+          .JsiRuntime();
+      m_hostObjectWrapper = std::make_shared<implementation::HostObjectWrapper>(hostObject);
+    }
+  }
+
+  // The callbacks of the runtime, shared with the other modules.
+  std::weak_ptr<LongLivedJsiCallbacks> JsiCallbacks(facebook::jsi::Runtime &runtime) noexcept {
+    return m_runtimeJsiCallbacks->Get(runtime);
+  }
+
   static MethodResultCallback MakeCallback(
       facebook::jsi::Runtime &rt,
-      const std::shared_ptr<facebook::react::LongLivedObjectCollection> &longLivedObjectCollection,
+      const std::shared_ptr<LongLivedJsiCallbacks> &callbacks,
       const facebook::jsi::Value &callback) noexcept {
-    auto weakCallback =
-        LongLivedJsiFunction::CreateWeak(longLivedObjectCollection, rt, callback.getObject(rt).getFunction(rt));
-    return [weakCallback = std::move(weakCallback)](const IJSValueWriter &writer) noexcept {
+    auto handle = callbacks->Add(callback.getObject(rt).getFunction(rt));
+    std::weak_ptr<LongLivedJsiCallbacks> weakCallbacks = callbacks;
+    return [weakCallbacks = std::move(weakCallbacks), handle](const IJSValueWriter &writer) noexcept {
       writer.as<CallInvokerWriter>()->WithResultArgs(
-          [weakCallback](facebook::jsi::Runtime &rt, facebook::jsi::Value const *args, size_t count) {
-            if (auto callback = weakCallback.lock()) {
-              callback->Value().call(rt, args, count);
-              callback->allowRelease();
+          [weakCallbacks, handle](facebook::jsi::Runtime &rt, facebook::jsi::Value const *args, size_t count) {
+            if (auto callbacks = weakCallbacks.lock()) {
+              if (auto callback = callbacks->Take(handle)) {
+                callback->call(rt, args, count);
+              }
             }
           });
     };
@@ -472,16 +609,61 @@ class TurboModuleImpl : public facebook::react::TurboModule {
   IInspectable m_providedModule;
   std::unordered_map<std::string, std::shared_ptr<facebook::react::IAsyncEventEmitter>> m_eventEmitters;
   std::shared_ptr<implementation::HostObjectWrapper> m_hostObjectWrapper;
-  std::weak_ptr<facebook::react::LongLivedObjectCollection> m_longLivedObjectCollection;
+  std::shared_ptr<RuntimeJsiCallbacks> m_runtimeJsiCallbacks;
+  std::shared_ptr<CachedConstants> m_cachedConstants;
 };
 
 /*-------------------------------------------------------------------------------
   TurboModulesProvider
 -------------------------------------------------------------------------------*/
 
+// A module provided on a background thread by StartParallelEagerInit.
+struct TurboModulesProvider::PreparedModule {
+  std::mutex mutex;
+  std::condition_variable provided;
+  bool isProvided{false};
+  // Null when the module provider failed.
+  winrt::com_ptr<TurboModuleBuilder> moduleBuilder;
+  IInspectable providedModule{nullptr};
+};
+
 std::shared_ptr<facebook::react::TurboModule> TurboModulesProvider::getModule(
     const std::string &moduleName,
     const std::shared_ptr<facebook::react::CallInvoker> &callInvoker) noexcept {
+  std::shared_ptr<PreparedModule> preparedModule;
+  std::shared_ptr<::Microsoft::ReactNative::StartupTimeline> startupTimeline;
+  {
+    std::scoped_lock lock{m_preparedModulesMutex};
+    if (auto preparedIt = m_preparedModules.find(moduleName); preparedIt != m_preparedModules.end()) {
+      preparedModule = std::move(preparedIt->second);
+      m_preparedModules.erase(preparedIt);
+      startupTimeline = m_startupTimeline;
+    }
+  }
+
+  if (preparedModule) {
+    std::unique_lock lock{preparedModule->mutex};
+    if (!preparedModule->isProvided) {
+      // Only block the JavaScript thread on modules it uses before they are provided.
+      const auto phaseName = "WaitForModule:" + moduleName;
+      ::Microsoft::ReactNative::StartupTimeline::Scope phase(startupTimeline.get(), phaseName);
+      preparedModule->provided.wait(lock, [&preparedModule]() { return preparedModule->isProvided; });
+    }
+
+    if (preparedModule->moduleBuilder) {
+      // The module provider ran on a background thread, where the JSI runtime must not be used.
+      preparedModule->moduleBuilder->RunDeferredJsiInitializers();
+      auto tm = std::make_shared<TurboModuleImpl>(
+          m_reactContext,
+          moduleName,
+          callInvoker,
+          m_runtimeJsiCallbacks,
+          std::move(preparedModule->moduleBuilder),
+          std::move(preparedModule->providedModule));
+      return WithCachedConstants(moduleName, std::move(tm));
+    }
+  }
+
   // fail if the expected turbo module has not been registered
   auto it = m_moduleProviders.find(moduleName);
   if (it == m_moduleProviders.end()) {
@@ -489,16 +671,99 @@ std::shared_ptr<facebook::react::TurboModule> TurboModulesProvider::getModule(
   }
 
   auto tm = std::make_shared<TurboModuleImpl>(
-      m_reactContext, moduleName, callInvoker, m_longLivedObjectCollection, /*reactModuleProvider*/ it->second);
-  return tm;
+      m_reactContext, moduleName, callInvoker, m_runtimeJsiCallbacks, /*reactModuleProvider*/ it->second);
+  return WithCachedConstants(moduleName, std::move(tm));
+}
+
+std::shared_ptr<facebook::react::TurboModule> TurboModulesProvider::WithCachedConstants(
+    const std::string &moduleName,
+    std::shared_ptr<TurboModuleImpl> &&tm) noexcept {
+  if (m_constantsCache) {
+    if (auto it = m_constantsCacheKeys.find(moduleName); it != m_constantsCacheKeys.end()) {
+      tm->CacheConstants(m_constantsCache, it->second);
+    }
+  }
+  return std::move(tm);
 }
 
 std::vector<std::string> TurboModulesProvider::getEagerInitModuleNames() noexcept {
-  return m_eagerInitModuleNames;
+  std::scoped_lock lock{m_preparedModulesMutex};
+  if (!m_isParallelEagerInitStarted) {
+    return m_eagerInitModuleNames;
+  }
+
+  // The modules started by StartParallelEagerInit are provided when first requested.
+  std::vector<std::string> moduleNames;
+  for (const auto &moduleName : m_eagerInitModuleNames) {
+    if (m_threadAgnosticModuleNames.count(moduleName) == 0) {
+      moduleNames.push_back(moduleName);
+    }
+  }
+  return moduleNames;
+}
+
+void TurboModulesProvider::AddEagerInit(std::string moduleName, bool threadAgnostic) noexcept {
+  if (threadAgnostic) {
+    m_threadAgnosticModuleNames.insert(moduleName);
+  } else {
+    m_threadAgnosticModuleNames.erase(moduleName);
+  }
+  m_eagerInitModuleNames.push_back(std::move(moduleName));
+}
+
+void TurboModulesProvider::StartParallelEagerInit(
+    std::shared_ptr<::Microsoft::ReactNative::StartupTimeline> startupTimeline) noexcept {
+  std::scoped_lock lock{m_preparedModulesMutex};
+  m_isParallelEagerInitStarted = true;
+  m_startupTimeline = startupTimeline;
+
+  for (const auto &moduleName : m_eagerInitModuleNames) {
+    auto it = m_moduleProviders.find(moduleName);
+    if (it == m_moduleProviders.end() || m_threadAgnosticModuleNames.count(moduleName) == 0 ||
+        m_preparedModules.count(moduleName) != 0) {
+      continue;
+    }
+
+    auto preparedModule = std::make_shared<PreparedModule>();
+    m_preparedModules.emplace(moduleName, preparedModule);
+    Mso::DispatchQueue::ConcurrentQueue().Post([preparedModule,
+                                                 moduleName,
+                                                 reactContext = m_reactContext,
+                                                 moduleProvider = it->second,
+                                                 startupTimeline]() noexcept {
+      winrt::com_ptr<TurboModuleBuilder> moduleBuilder;
+      IInspectable providedModule{nullptr};
+      {
+        const auto phaseName = "InitModule:" + moduleName;
+        ::Microsoft::ReactNative::StartupTimeline::Scope phase(startupTimeline.get(), phaseName);
+        try {
+          moduleBuilder = winrt::make_self<TurboModuleBuilder>(reactContext, /*deferJsiInitializers*/ true);
+          providedModule = moduleProvider(moduleBuilder.as<IReactModuleBuilder>());
+        } catch (...) {
+          // getModule provides the module again on the JavaScript thread.
+          moduleBuilder = nullptr;
+          providedModule = nullptr;
+        }
+      }
+
+      {
+        std::scoped_lock lock{preparedModule->mutex};
+        preparedModule->moduleBuilder = std::move(moduleBuilder);
+        preparedModule->providedModule = std::move(providedModule);
+        preparedModule->isProvided = true;
+      }
+      preparedModule->provided.notify_all();
+    });
+  }
+}
+
+void TurboModulesProvider::CacheConstants(std::string moduleName, uint64_t key) noexcept {
+  m_constantsCacheKeys[std::move(moduleName)] = key;
 }
 
-void TurboModulesProvider::AddEagerInit(std::string moduleName) noexcept {
-  m_eagerInitModuleNames.push_back(moduleName);
+void TurboModulesProvider::SetConstantsCache(
+    std::shared_ptr<::Microsoft::ReactNative::ConstantsCache> constantsCache) noexcept {
+  m_constantsCache = std::move(constantsCache);
 }
 
 void TurboModulesProvider::SetReactContext(const IReactContext &reactContext) noexcept {
@@ -6,13 +6,20 @@
 
 #pragma once
 
+#include <Shared/ConstantsSnapshot.h>
+#include <Shared/StartupTimeline.h>
 #include <TurboModuleRegistry.h>
 #include <react/bridging/LongLivedObject.h>
+#include <mutex>
+#include <unordered_set>
 #include "Base/FollyIncludes.h"
+#include "LongLivedJsiCallbacks.h"
 #include "winrt/Microsoft.ReactNative.h"
 
 namespace winrt::Microsoft::ReactNative {
 
+class TurboModuleImpl;
+
 class TurboModulesProvider final : public facebook::react::TurboModuleRegistry {
  public: // TurboModuleRegistry implementation
   std::shared_ptr<facebook::react::TurboModule> getModule(
@@ -26,16 +33,44 @@ class TurboModulesProvider final : public facebook::react::TurboModuleRegistry {
       winrt::hstring const &moduleName,
       ReactModuleProvider const &moduleProvider,
       bool overwriteExisting) noexcept;
-  void AddEagerInit(std::string moduleName) noexcept;
+  void AddEagerInit(std::string moduleName, bool threadAgnostic = false) noexcept;
   std::shared_ptr<facebook::react::LongLivedObjectCollection> const &LongLivedObjectCollection() noexcept;
 
+  // Starts constructing the thread agnostic eager init modules on background threads. Must be called after
+  // SetReactContext and before the JavaScript runtime requests modules. getEagerInitModuleNames no longer returns
+  // these modules: getModule waits for them when they are first requested.
+  // The construction time of each module is recorded in startupTimeline when it is not null.
+  void StartParallelEagerInit(std::shared_ptr<::Microsoft::ReactNative::StartupTimeline> startupTimeline) noexcept;
+
+  // The constants of the module are cached with key when a constants cache is set.
+  void CacheConstants(std::string moduleName, uint64_t key) noexcept;
+  void SetConstantsCache(std::shared_ptr<::Microsoft::ReactNative::ConstantsCache> constantsCache) noexcept;
+
  private:
+  struct PreparedModule;
+
+  std::shared_ptr<facebook::react::TurboModule> WithCachedConstants(
+      const std::string &moduleName,
+      std::shared_ptr<TurboModuleImpl> &&tm) noexcept;
+
   // To keep a list of deferred asynchronous callbacks and promises.
   std::shared_ptr<facebook::react::LongLivedObjectCollection> m_longLivedObjectCollection{
       std::make_shared<facebook::react::LongLivedObjectCollection>()};
+  // The callbacks of the runtime, shared by all the modules.
+  std::shared_ptr<RuntimeJsiCallbacks> m_runtimeJsiCallbacks{
+      std::make_shared<RuntimeJsiCallbacks>(m_longLivedObjectCollection)};
   std::unordered_map<std::string, ReactModuleProvider> m_moduleProviders;
   std::vector<std::string> m_eagerInitModuleNames;
+  std::unordered_set<std::string> m_threadAgnosticModuleNames;
+  std::unordered_map<std::string, uint64_t> m_constantsCacheKeys;
+  std::shared_ptr<::Microsoft::ReactNative::ConstantsCache> m_constantsCache;
   IReactContext m_reactContext;
+
+  // Modules being constructed by StartParallelEagerInit, until getModule requests them.
+  std::mutex m_preparedModulesMutex;
+  std::unordered_map<std::string, std::shared_ptr<PreparedModule>> m_preparedModules;
+  bool m_isParallelEagerInitStarted{false};
+  std::shared_ptr<::Microsoft::ReactNative::StartupTimeline> m_startupTimeline;
 };
 
 } // namespace winrt::Microsoft::ReactNative
@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) Microsoft Corporation.
+ * Licensed under the MIT License.
+ * @format
+ */
+
+// Converts a bundle produced by `react-native bundle` (Metro's default
+// serializer) to the indexed bundle format, where only the startup code is
+// evaluated when the bundle is loaded and each module is evaluated the first
+// time it is required. See Shared/IndexedBundle.h for the format.
+//
+// Usage: node make-indexed-bundle.js <metro bundle> <indexed bundle> [--segment-id <id>]
+//
+// Metro writes each module definition (`__d(function ..., id, [deps], "name");`)
+// starting on its own line, after the prelude and polyfills and before the
+// `__r(id);` calls requiring the entry points. The prelude, polyfills and
+// entry point calls become the startup code and each module definition becomes
+// the body of its module id. Segments other than the main bundle (segment 0)
+// are loaded from next to the main bundle: segment 1 of index.windows.bundle
+// is index.windows.1.bundle.
+
+const fs = require('fs');
+
+const MAGIC = 0xfb0bd1e5;
+const LOCAL_ID_MASK = 0xffff;
+const SEGMENT_ID_SHIFT = 16;
+
+// Matches the end of a module definition: `, moduleId, [dependencies], "name");`
+const MODULE_TAIL = /,\s*(\d+)\s*,\s*\[[\d,\s]*\]\s*(?:,\s*"(?:[^"\\]|\\.)*"\s*)?\);?\s*$/;
+
+function parseArgs(argv) {
+  const args = {segmentId: 0};
+  const positional = [];
+  for (let i = 0; i < argv.length; i++) {
+    if (argv[i] === '--segment-id') {
+      args.segmentId = Number.parseInt(argv[++i], 10);
+    } else {
+      positional.push(argv[i]);
+    }
+  }
+
+  if (positional.length !== 2 || !Number.isInteger(args.segmentId)) {
+    throw new Error(
+      'Usage: node make-indexed-bundle.js <metro bundle> <indexed bundle> [--segment-id <id>]',
+    );
+  }
+
+  [args.input, args.output] = positional;
+  return args;
+}
+
+function splitBundle(source, segmentId) {
+  const lines = source.split('\n');
+  const startup = [];
+  const modules = new Map();
+  let current = null;
+
+  const endModule = () => {
+    if (current === null) {
+      return;
+    }
+
+    const code = current.join('\n');
+    const match = MODULE_TAIL.exec(code);
+    if (!match) {
+      throw new Error(`Cannot find the id of module: ${code.slice(0, 80)}`);
+    }
+
+    const moduleId = Number(match[1]);
+    if (moduleId >>> SEGMENT_ID_SHIFT !== segmentId) {
+      throw new Error(`Module ${moduleId} does not belong to segment ${segmentId}`);
+    }
+
+    modules.set(moduleId & LOCAL_ID_MASK, code);
+    current = null;
+  };
+
+  for (const line of lines) {
+    if (line.startsWith('__d(')) {
+      endModule();
+      current = [line];
+    } else if (current !== null && !line.startsWith('__r(') && !line.startsWith('//# ')) {
+      current.push(line);
+    } else {
+      endModule();
+      startup.push(line);
+    }
+  }
+  endModule();
+
+  return {startupCode: startup.join('\n'), modules};
+}
+
+function writeIndexedBundle(output, startupCode, modules) {
+  const moduleCount = modules.size === 0 ? 0 : Math.max(...modules.keys()) + 1;
+  const nul = Buffer.alloc(1);
+  const startup = Buffer.concat([Buffer.from(startupCode, 'utf8'), nul]);
+
+  const header = Buffer.alloc(12 + moduleCount * 8);
+  header.writeUInt32LE(MAGIC, 0);
+  header.writeUInt32LE(moduleCount, 4);
+  header.writeUInt32LE(startup.length, 8);
+
+  // Offsets are relative to the end of the module table, where the startup
+  // code is. Module ids without a body keep a zero offset and size.
+  const bodies = [];
+  let offset = startup.length;
+  for (const [moduleId, code] of [...modules].sort((a, b) => a[0] - b[0])) {
+    const body = Buffer.concat([Buffer.from(code, 'utf8'), nul]);
+    header.writeUInt32LE(offset, 12 + moduleId * 8);
+    header.writeUInt32LE(body.length, 12 + moduleId * 8 + 4);
+    bodies.push(body);
+    offset += body.length;
+  }
+
+  fs.writeFileSync(output, Buffer.concat([header, startup, ...bodies]));
+}
+
+const args = parseArgs(process.argv.slice(2));
+const {startupCode, modules} = splitBundle(
+  fs.readFileSync(args.input, 'utf8'),
+  args.segmentId,
+);
+writeIndexedBundle(args.output, startupCode, modules);
+console.log(
+  `Wrote ${modules.size} modules and ${startupCode.length} bytes of startup code to ${args.output}`,
+);
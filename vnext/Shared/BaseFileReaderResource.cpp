@@ -3,7 +3,8 @@
 
 #include "BaseFileReaderResource.h"
 
-#include <utilities.h>
+#include <Base64.h>
+#include <Utf8.h>
 
 // Windows API
 #include <winrt/base.h>
@@ -11,6 +12,7 @@
 using std::function;
 using std::shared_ptr;
 using std::string;
+using std::unique_ptr;
 
 namespace Microsoft::React {
 
@@ -33,7 +35,7 @@ void BaseFileReaderResource::ReadAsText(
     return resolver("Could not find Blob persistor");
   }
 
-  winrt::array_view<uint8_t const> bytes;
+  BlobView bytes;
   try {
     bytes = persistor->ResolveMessage(std::move(blobId), offset, size);
   } catch (const std::exception &e) {
@@ -42,7 +44,11 @@ void BaseFileReaderResource::ReadAsText(
 
   // #9982 - Handle non-UTF8 encodings
   //         See https://docs.oracle.com/en/java/javase/11/docs/api/java.base/java/nio/charset/Charset.html
-  auto result = string{bytes.cbegin(), bytes.cend()};
+  auto result = string(bytes.Size(), '\0');
+  bytes.CopyTo(reinterpret_cast<uint8_t *>(result.data()));
+  if (!Utilities::IsValidUtf8(result)) {
+    result = Utilities::ToValidUtf8(result);
+  }
 
   resolver(std::move(result));
 }
@@ -59,7 +65,7 @@ void BaseFileReaderResource::ReadAsDataUrl(
     return rejecter("Could not find Blob persistor");
   }
 
-  winrt::array_view<uint8_t const> bytes;
+  BlobView bytes;
   try {
     bytes = persistor->ResolveMessage(std::move(blobId), offset, size);
   } catch (const std::exception &e) {
@@ -70,13 +76,43 @@ void BaseFileReaderResource::ReadAsDataUrl(
   result += type;
   result += ";base64,";
 
-  auto chars = reinterpret_cast<const char *>(bytes.data());
-  auto view = std::string_view(chars, bytes.size());
-  result += Utilities::EncodeBase64(view);
+  // Encode in place, the data URL of a large blob would otherwise be copied.
+  result.reserve(result.size() + Utilities::Base64EncodedSize(bytes.Size()));
+  Utilities::Base64Encoder encoder;
+  for (const auto &segment : bytes.Segments()) {
+    encoder.Update(std::string_view(reinterpret_cast<const char *>(segment.Data()), segment.Size), result);
+  }
+  encoder.Finish(result);
 
   resolver(std::move(result));
 }
 
+unique_ptr<BlobChunkReader> BaseFileReaderResource::ReadInChunks(
+    string &&blobId,
+    int64_t offset,
+    int64_t size,
+    BlobChunkReader::Format format,
+    string &&type,
+    size_t chunkSize,
+    function<void(string &&)> &&rejecter) noexcept /*override*/ {
+  try {
+    return std::make_unique<BlobChunkReader>(
+        ReadAsBytes(std::move(blobId), offset, size), format, std::move(type), chunkSize);
+  } catch (const std::exception &e) {
+    rejecter(e.what());
+    return nullptr;
+  }
+}
+
+BlobView BaseFileReaderResource::ReadAsBytes(string &&blobId, int64_t offset, int64_t size) /*override*/ {
+  auto persistor = m_weakBlobPersistor.lock();
+  if (!persistor) {
+    throw std::runtime_error("Could not find Blob persistor");
+  }
+
+  return persistor->ResolveMessage(std::move(blobId), offset, size);
+}
+
 /*static*/ shared_ptr<IFileReaderResource> IFileReaderResource::Make(
     std::weak_ptr<IBlobPersistor> weakBlobPersistor) noexcept {
   return std::make_shared<BaseFileReaderResource>(weakBlobPersistor);
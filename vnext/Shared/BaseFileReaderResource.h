@@ -35,6 +35,17 @@ class BaseFileReaderResource : public IFileReaderResource, public std::enable_sh
       std::function<void(std::string &&)> &&resolver,
       std::function<void(std::string &&)> &&rejecter) noexcept override;
 
+  std::unique_ptr<BlobChunkReader> ReadInChunks(
+      std::string &&blobId,
+      int64_t offset,
+      int64_t size,
+      BlobChunkReader::Format format,
+      std::string &&type,
+      size_t chunkSize,
+      std::function<void(std::string &&)> &&rejecter) noexcept override;
+
+  BlobView ReadAsBytes(std::string &&blobId, int64_t offset, int64_t size) override;
+
 #pragma endregion IFileReaderResource
 };
 
@@ -5,7 +5,9 @@
 
 #include "BaseScriptStoreImpl.h"
 #include "Hasher.h"
+#include "IndexedBundle.h"
 #include "MemoryMappedBuffer.h"
+#include "XXHash64.h"
 
 #include <CppRuntimeOptions.h>
 
@@ -13,7 +15,12 @@
 #include <winrt/base.h>
 
 // Standard Library
+#include <atomic>
+#include <chrono>
+#include <filesystem>
 #include <fstream>
+#include <limits>
+#include <thread>
 
 namespace facebook {
 namespace react {
@@ -79,7 +86,79 @@ class BufferViewBuffer : public facebook::jsi::Buffer {
   size_t size_;
 };
 
-constexpr const char *PERSIST_MAGIC = "RNWPREP";
+// Reads the whole file into memory, returns nullptr if the file cannot be read
+// or does not fit in memory.
+std::unique_ptr<const jsi::Buffer> ReadFileBuffer(const std::string &path) noexcept {
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+  if (!file) {
+    return nullptr;
+  }
+
+  std::streamsize size = file.tellg();
+  if (size < 0 || static_cast<uint64_t>(size) > std::numeric_limits<size_t>::max()) {
+    return nullptr;
+  }
+  file.seekg(0, std::ios::beg);
+
+  std::unique_ptr<ByteArrayBuffer> buffer;
+  try {
+    buffer = std::make_unique<ByteArrayBuffer>(static_cast<size_t>(size));
+  } catch (const std::bad_alloc &) {
+    return nullptr;
+  }
+  if (!file.read(reinterpret_cast<char *>(buffer->data()), size)) {
+    return nullptr;
+  }
+
+  return buffer;
+}
+
+// Bundles and prepared scripts are memory mapped unless the
+// JSI.DisableMemoryMappedScriptStore runtime option is set: the pages are
+// shared with the file cache instead of being copied into a private
+// allocation. Empty files, and files the mapping fails for, are read into
+// memory instead. Files too large for the address space are not loaded at all,
+// a copy would not fit either: SegmentedBundleRegistry maps indexed bundles
+// that large one window at a time. Indexed bundles are not read ahead, only the
+// modules that get required are paged in.
+std::unique_ptr<const jsi::Buffer> LoadFileBuffer(const std::string &path) noexcept {
+  std::error_code ec;
+  const auto fileSize = std::filesystem::file_size(path, ec);
+  if (!ec && fileSize > std::numeric_limits<size_t>::max()) {
+    return nullptr;
+  }
+
+  if (!Microsoft::React::GetRuntimeOptionBool("JSI.DisableMemoryMappedScriptStore")) {
+    try {
+      return Microsoft::JSI::MakeMemoryMappedBuffer(
+          winrt::to_hstring(path).c_str(),
+          0 /* offset */,
+          Microsoft::ReactNative::IsIndexedBundleFile(path) ? Microsoft::JSI::MemoryMappedAccess::Random
+                                                            : Microsoft::JSI::MemoryMappedAccess::Sequential);
+    } catch (const facebook::jsi::JSINativeException &) {
+      // Fall back to reading the file
+    }
+  }
+
+  return ReadFileBuffer(path);
+}
+
+// Version of a script file that changes whenever the file is rewritten, 0 if
+// the file does not exist.
+jsi::ScriptVersion_t GetFileVersion(const std::string &path) noexcept {
+  std::error_code ec;
+  const uint64_t fileInfo[] = {
+      static_cast<uint64_t>(std::filesystem::file_size(path, ec)),
+      ec ? 0 : static_cast<uint64_t>(std::filesystem::last_write_time(path, ec).time_since_epoch().count())};
+  if (ec) {
+    return 0;
+  }
+
+  return Microsoft::ReactNative::XXHash64(fileInfo, sizeof(fileInfo));
+}
+
+constexpr const char *PERSIST_MAGIC = "RNWPRE2";
 constexpr const char *PERSIST_EOF = "EOF";
 
 int constexpr length__(const char *str) {
@@ -93,7 +172,7 @@ struct PreparedScriptPrefix {
   jsi::ScriptVersion_t scriptVersion;
   jsi::JSRuntimeVersion_t runtimeVersion;
   uint64_t sizeInBytes;
-  std::uint8_t hash[32];
+  uint64_t checksum;
 };
 
 struct PreparedScriptSuffix {
@@ -103,40 +182,37 @@ struct PreparedScriptSuffix {
 } // namespace
 
 jsi::VersionedBuffer BaseScriptStoreImpl::getVersionedScript(const std::string &url) noexcept {
-  std::ifstream file(url, std::ios::binary | std::ios::ate);
+  auto buffer = LoadFileBuffer(url);
 
-  if (!file) {
-    return {nullptr, 0};
-  }
-
-  std::streamsize size = file.tellg();
-  file.seekg(0, std::ios::beg);
-
-  auto buffer = std::make_unique<ByteArrayBuffer>(static_cast<size_t>(size));
-  if (!file.read(reinterpret_cast<char *>(buffer->data()), size)) {
+  if (!buffer) {
     return {nullptr, 0};
   }
 
-  file.close();
-
-  return {std::move(buffer), versionProvider_ ? versionProvider_->getVersion(url) : static_cast<uint64_t>(size)};
+  return {std::move(buffer), versionProvider_ ? versionProvider_->getVersion(url) : GetFileVersion(url)};
 }
 
 jsi::ScriptVersion_t BaseScriptStoreImpl::getScriptVersion(const std::string &url) noexcept {
   if (versionProvider_) {
     return versionProvider_->getVersion(url);
   } else {
-    std::ifstream file(url, std::ios::binary | std::ios::ate);
-
-    if (!file) {
-      return 0;
-    }
+    return GetFileVersion(url);
+  }
+}
 
-    std::streamsize size = file.tellg();
-    file.seekg(0, std::ios::beg);
+bool BufferStore::persistBufferChunks(const std::string &bufferId, const std::vector<BufferChunk> &chunks) noexcept {
+  size_t size = 0;
+  for (const auto &chunk : chunks) {
+    size += chunk.second;
+  }
 
-    return static_cast<uint64_t>(size);
+  auto buffer = std::make_unique<ByteArrayBuffer>(size);
+  size_t offset = 0;
+  for (const auto &chunk : chunks) {
+    memcpy_s(buffer->data() + offset, size - offset, chunk.first, chunk.second);
+    offset += chunk.second;
   }
+
+  return persistBuffer(bufferId, std::move(buffer));
 }
 
 std::unique_ptr<const jsi::Buffer> LocalFileSimpleBufferStore::getBuffer(const std::string &bufferId) noexcept {
@@ -148,86 +224,153 @@ std::unique_ptr<const jsi::Buffer> LocalFileSimpleBufferStore::getBuffer(const s
     std::terminate();
   }
 
-  if (Microsoft::React::GetRuntimeOptionBool("JSI.MemoryMappedScriptStore")) {
-    try {
-      return Microsoft::JSI::MakeMemoryMappedBuffer(winrt::to_hstring(storeDirectory_ + bufferId).c_str());
-    } catch (const facebook::jsi::JSINativeException &) {
-      return nullptr;
-    }
-  } else {
-    // Treat buffer id as the relative path fragment.
-    std::ifstream file(storeDirectory_ + bufferId, std::ios::binary | std::ios::ate);
-
-    if (!file) {
-      return nullptr;
-    }
-
-    std::streamsize size = file.tellg();
-    file.seekg(0, std::ios::beg);
-
-    auto buffer = std::make_unique<ByteArrayBuffer>(static_cast<size_t>(size));
-    if (!file.read(reinterpret_cast<char *>(buffer->data()), size)) {
-      return nullptr;
-    }
+  // Treat buffer id as the relative path fragment.
+  const auto path = storeDirectory_ + bufferId;
 
-    return buffer;
+  if (maxSizeInBytes_) {
+    // The last write time doubles as the last use time for eviction.
+    std::error_code ec;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
   }
+
+  return LoadFileBuffer(path);
 }
 
 bool LocalFileSimpleBufferStore::persistBuffer(
     const std::string &relativeUrl,
     std::unique_ptr<const jsi::Buffer> buffer) noexcept {
+  return persistBufferChunks(relativeUrl, {{buffer->data(), buffer->size()}});
+}
+
+bool LocalFileSimpleBufferStore::persistBufferChunks(
+    const std::string &relativeUrl,
+    const std::vector<BufferChunk> &chunks) noexcept {
   // Assumptions on storeDirectory_ same as in getRawBuffer
   if (storeDirectory_.empty())
     std::terminate();
 
-  std::ofstream file;
-  file.open(storeDirectory_ + relativeUrl, std::ios::binary | std::ios::trunc);
-  if (!file)
+  static std::atomic<uint64_t> s_tempFileCount{0};
+  const auto path = storeDirectory_ + relativeUrl;
+  const auto tempPath = path + "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + "." +
+      std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "." +
+      std::to_string(s_tempFileCount++) + ".tmp";
+
+  std::error_code ec;
+  {
+    std::ofstream file;
+    file.open(tempPath, std::ios::binary | std::ios::trunc);
+    if (!file)
+      return false;
+
+    for (const auto &chunk : chunks) {
+      file.write(reinterpret_cast<const char *>(chunk.first), chunk.second);
+    }
+    file.close();
+
+    if (!file) {
+      std::filesystem::remove(tempPath, ec);
+      return false;
+    }
+  }
+
+  // Replaces the previous buffer, if any, in one step.
+  std::filesystem::rename(tempPath, path, ec);
+  if (ec) {
+    std::filesystem::remove(tempPath, ec);
     return false;
+  }
 
-  file.write(reinterpret_cast<const char *>(buffer->data()), buffer->size());
-  file.close();
+  if (maxSizeInBytes_) {
+    evictLeastRecentlyUsed(relativeUrl);
+  }
 
   return true;
 }
 
+void LocalFileSimpleBufferStore::evictLeastRecentlyUsed(const std::string &keepBufferId) noexcept {
+  struct StoredFile {
+    std::filesystem::path path;
+    uint64_t size;
+    std::filesystem::file_time_type lastUse;
+  };
+
+  std::vector<StoredFile> files;
+  uint64_t totalSize = 0;
+  std::error_code ec;
+  for (std::filesystem::directory_iterator it(storeDirectory_, ec), end; !ec && it != end; it.increment(ec)) {
+    const auto name = it->path().filename().string();
+    const auto isTempFile = name.size() >= 4 && name.compare(name.size() - 4, 4, ".tmp") == 0;
+    std::error_code entryError;
+    if (name.compare(0, evictableFilePrefix_.size(), evictableFilePrefix_) != 0 || isTempFile ||
+        !it->is_regular_file(entryError)) {
+      continue;
+    }
+
+    const auto size = static_cast<uint64_t>(it->file_size(entryError));
+    const auto lastUse = it->last_write_time(entryError);
+    if (entryError) {
+      continue;
+    }
+
+    totalSize += size;
+    if (name != keepBufferId) {
+      files.push_back({it->path(), size, lastUse});
+    }
+  }
+
+  if (totalSize <= maxSizeInBytes_) {
+    return;
+  }
+
+  std::sort(files.begin(), files.end(), [](const StoredFile &a, const StoredFile &b) { return a.lastUse < b.lastUse; });
+  for (const auto &file : files) {
+    if (totalSize <= maxSizeInBytes_) {
+      break;
+    }
+
+    // Files that are still mapped by a reader cannot be deleted, they get evicted by a later persist.
+    if (std::filesystem::remove(file.path, ec)) {
+      totalSize -= file.size;
+    }
+  }
+}
+
 std::string BasePreparedScriptStoreImpl::getPreparedScriptFileName(
     const jsi::ScriptSignature &scriptSignature,
     const jsi::JSRuntimeSignature &runtimeSignature,
     const char *prepareTag) {
   // Essentially, we are trying to construct,
-  // prep_<source_url>_<runtime_id>_<preparation_tag>.cache
-
-  std::string preparedScriptFileName("prep_");
-
-  const std::string &scriptUrl = scriptSignature.url;
-
-  // As a crude heuristic we choose the last 64 characters of the source url.
-  constexpr int MAXLENGTH = 64;
-  preparedScriptFileName.append(
-      scriptUrl.begin() + ((scriptUrl.size() < MAXLENGTH) ? 0 : (scriptUrl.size() - MAXLENGTH)), scriptUrl.end());
-
-  // Make a valid file name.
-  std::replace(preparedScriptFileName.begin(), preparedScriptFileName.end(), '\\', '_');
-  std::replace(preparedScriptFileName.begin(), preparedScriptFileName.end(), '/', '_');
-  std::replace(preparedScriptFileName.begin(), preparedScriptFileName.end(), ':', '_');
-  std::replace(preparedScriptFileName.begin(), preparedScriptFileName.end(), '.', '_');
+  // rnwprep_<sha256(source_url, script_version, runtime_id, runtime_version, preparation_tag)>.cache
 
   if (runtimeSignature.runtimeName.empty()) {
     std::terminate();
   }
 
-  preparedScriptFileName.append("_");
-  preparedScriptFileName.append(runtimeSignature.runtimeName);
-
+  std::string key(scriptSignature.url);
+  key.push_back('\0');
+  key.append(std::to_string(scriptSignature.version));
+  key.push_back('\0');
+  key.append(runtimeSignature.runtimeName);
+  key.push_back('\0');
+  key.append(std::to_string(runtimeSignature.version));
   if (prepareTag) {
-    preparedScriptFileName.append("_");
-    preparedScriptFileName.append(prepareTag);
+    key.push_back('\0');
+    key.append(prepareTag);
+  }
+
+  std::optional<std::vector<std::uint8_t>> hashBuffer =
+      Microsoft::ReactNative::GetSHA256Hash(key.data(), key.size());
+  if (!hashBuffer) {
+    // Hashing failed.
+    return {};
   }
 
-  // TODO :: Need to construct a hash. ref:
-  // https://en.wikipedia.org/wiki/Base64#Filenames
+  constexpr const char *hexDigits = "0123456789abcdef";
+  std::string preparedScriptFileName(PreparedScriptFilePrefix);
+  for (auto byte : hashBuffer.value()) {
+    preparedScriptFileName.push_back(hexDigits[byte >> 4]);
+    preparedScriptFileName.push_back(hexDigits[byte & 0xf]);
+  }
 
   // extension
   preparedScriptFileName.append(".cache");
@@ -240,6 +383,9 @@ std::shared_ptr<const jsi::Buffer> BasePreparedScriptStoreImpl::tryGetPreparedSc
     const jsi::JSRuntimeSignature &runtimeSignature,
     const char *prepareTag) noexcept {
   std::string preparedScriptFilePath = getPreparedScriptFileName(scriptSignature, runtimeSignature, prepareTag);
+  if (preparedScriptFilePath.empty()) {
+    return nullptr;
+  }
 
   auto buffer = bufferStore_->getBuffer(preparedScriptFilePath);
 
@@ -247,6 +393,11 @@ std::shared_ptr<const jsi::Buffer> BasePreparedScriptStoreImpl::tryGetPreparedSc
     return nullptr;
   }
 
+  if (buffer->size() < sizeof(PreparedScriptPrefix) + sizeof(PreparedScriptSuffix)) {
+    // Truncated store.
+    return nullptr;
+  }
+
   const PreparedScriptPrefix *prefix = reinterpret_cast<const PreparedScriptPrefix *>(buffer->data());
 
   if (strncmp(prefix->magic, PERSIST_MAGIC, sizeof(prefix->magic)) != 0) {
@@ -271,24 +422,6 @@ std::shared_ptr<const jsi::Buffer> BasePreparedScriptStoreImpl::tryGetPreparedSc
     return nullptr;
   }
 
-  std::optional<std::vector<std::uint8_t>> hashBuffer = Microsoft::ReactNative::GetSHA256Hash(
-      reinterpret_cast<const std::uint8_t *>(buffer->data()) + sizeof(PreparedScriptPrefix),
-      static_cast<size_t>(prefix->sizeInBytes));
-  if (!hashBuffer) {
-    // Hashing failed.
-    return nullptr;
-  }
-
-  if (hashBuffer.value().size() < sizeof(prefix->hash)) {
-    // Unexpected hash size.
-    return nullptr;
-  }
-
-  if (memcmp(hashBuffer.value().data(), prefix->hash, sizeof(prefix->hash)) != 0) {
-    // Hash doesn't match. Store is possibly corrupted. It is safer to bail out.
-    return nullptr;
-  }
-
   const PreparedScriptSuffix *suffix = reinterpret_cast<const PreparedScriptSuffix *>(
       buffer->data() + sizeof(PreparedScriptPrefix) + prefix->sizeInBytes);
   if (strncmp(suffix->eof, PERSIST_EOF, sizeof(suffix->eof)) != 0) {
@@ -297,6 +430,13 @@ std::shared_ptr<const jsi::Buffer> BasePreparedScriptStoreImpl::tryGetPreparedSc
     return nullptr;
   }
 
+  if (Microsoft::ReactNative::XXHash64(
+          buffer->data() + sizeof(PreparedScriptPrefix), static_cast<size_t>(prefix->sizeInBytes)) !=
+      prefix->checksum) {
+    // Checksum doesn't match. Store is possibly corrupted. It is safer to bail out.
+    return nullptr;
+  }
+
   return std::make_shared<BufferViewBuffer>(
       std::move(buffer), sizeof(PreparedScriptPrefix), static_cast<size_t>(prefix->sizeInBytes));
 }
@@ -306,39 +446,28 @@ void BasePreparedScriptStoreImpl::persistPreparedScript(
     const jsi::ScriptSignature &scriptMetadata,
     const jsi::JSRuntimeSignature &runtimeMetadata,
     const char *prepareTag) noexcept {
-  // TODO :: Unfortunately, The current abstraction is forcing us to make a
-  // copy. Need to re-evaluate.
-  auto newBuffer = std::make_unique<ByteArrayBuffer>(
-      sizeof(PreparedScriptPrefix) + preparedScript->size() + sizeof(PreparedScriptSuffix));
-
-  PreparedScriptPrefix *prefix = reinterpret_cast<PreparedScriptPrefix *>(newBuffer->data());
-  memcpy_s(prefix->magic, sizeof(prefix->magic), PERSIST_MAGIC, sizeof(prefix->magic));
-  prefix->scriptVersion = scriptMetadata.version;
-  prefix->runtimeVersion = runtimeMetadata.version;
-  prefix->sizeInBytes = preparedScript->size();
-
-  std::optional<std::vector<std::uint8_t>> hashBuffer =
-      Microsoft::ReactNative::GetSHA256Hash(preparedScript->data(), preparedScript->size());
-  if (!hashBuffer) {
-    // Hashing failed.
-    std::terminate();
-  }
-
-  memcpy_s(prefix->hash, sizeof(prefix->hash), hashBuffer.value().data(), hashBuffer.value().size());
-
-  memcpy_s(
-      newBuffer->data() + sizeof(PreparedScriptPrefix),
-      newBuffer->size() - sizeof(PreparedScriptPrefix),
-      preparedScript->data(),
-      preparedScript->size());
-
-  PreparedScriptSuffix *suffix = reinterpret_cast<PreparedScriptSuffix *>(
-      newBuffer->data() + sizeof(PreparedScriptPrefix) + preparedScript->size());
-  memcpy_s(suffix->eof, sizeof(suffix->eof), PERSIST_EOF, sizeof(suffix->eof));
-
   std::string preparedScriptFilePath = getPreparedScriptFileName(scriptMetadata, runtimeMetadata, prepareTag);
+  if (preparedScriptFilePath.empty()) {
+    return;
+  }
 
-  bufferStore_->persistBuffer(preparedScriptFilePath, std::move(newBuffer));
+  PreparedScriptPrefix prefix{};
+  memcpy_s(prefix.magic, sizeof(prefix.magic), PERSIST_MAGIC, sizeof(prefix.magic));
+  prefix.scriptVersion = scriptMetadata.version;
+  prefix.runtimeVersion = runtimeMetadata.version;
+  prefix.sizeInBytes = preparedScript->size();
+  prefix.checksum = Microsoft::ReactNative::XXHash64(preparedScript->data(), preparedScript->size());
+
+  PreparedScriptSuffix suffix{};
+  memcpy_s(suffix.eof, sizeof(suffix.eof), PERSIST_EOF, sizeof(suffix.eof));
+
+  // The prepared script is written straight from its buffer, between the
+  // prefix and the suffix, without being copied.
+  bufferStore_->persistBufferChunks(
+      preparedScriptFilePath,
+      {{reinterpret_cast<const uint8_t *>(&prefix), sizeof(prefix)},
+       {preparedScript->data(), preparedScript->size()},
+       {reinterpret_cast<const uint8_t *>(&suffix), sizeof(suffix)}});
 }
 
 } // namespace react
@@ -7,27 +7,55 @@
 #include <jsi/jsi.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <fstream>
+#include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace facebook {
 namespace react {
 
+// A contiguous range of bytes owned by the caller.
+using BufferChunk = std::pair<const uint8_t *, size_t>;
+
 struct BufferStore {
   virtual std::unique_ptr<const facebook::jsi::Buffer> getBuffer(const std::string &bufferId) noexcept = 0;
   virtual bool persistBuffer(const std::string &bufferId, std::unique_ptr<const facebook::jsi::Buffer>) noexcept = 0;
+
+  // Persists the concatenation of chunks as a single buffer. Stores that can
+  // write the chunks one after the other should override this to avoid the
+  // copy the default implementation makes.
+  virtual bool persistBufferChunks(const std::string &bufferId, const std::vector<BufferChunk> &chunks) noexcept;
 };
 
+// Stores each buffer in a file of storeDirectory named by the buffer id.
+// Buffers are written to a temporary file that is then renamed over the
+// destination, so readers never see a partially written buffer. When
+// maxSizeInBytes is set, the least recently used files whose names start
+// with evictableFilePrefix are deleted once the total size of those files
+// exceeds it.
 class LocalFileSimpleBufferStore : public BufferStore {
  public:
-  LocalFileSimpleBufferStore(const std::string &storeDirectory) : storeDirectory_(storeDirectory) {}
+  LocalFileSimpleBufferStore(
+      const std::string &storeDirectory,
+      uint64_t maxSizeInBytes = 0,
+      std::string evictableFilePrefix = {})
+      : storeDirectory_(storeDirectory),
+        maxSizeInBytes_(maxSizeInBytes),
+        evictableFilePrefix_(std::move(evictableFilePrefix)) {}
 
   std::unique_ptr<const facebook::jsi::Buffer> getBuffer(const std::string &bufferId) noexcept override;
   bool persistBuffer(const std::string &bufferId, std::unique_ptr<const facebook::jsi::Buffer>) noexcept override;
+  bool persistBufferChunks(const std::string &bufferId, const std::vector<BufferChunk> &chunks) noexcept override;
 
  private:
+  void evictLeastRecentlyUsed(const std::string &keepBufferId) noexcept;
+
   std::string storeDirectory_;
+  uint64_t maxSizeInBytes_;
+  std::string evictableFilePrefix_;
 };
 
 struct ScriptVersionProvider {
@@ -43,8 +71,13 @@ struct PreparedScriptStoreNameGenerator {
   virtual std::string getStoreName(const std::string &url) noexcept = 0;
 };
 
-// Dead simple implementation with local filesystem storage using standard c++
-// fileio but with optional extension point with custom bufferStore.
+// Prepared scripts are stored under a hash of the script signature (url and
+// version), the runtime signature and the prepare tag. The key is not a hash
+// of the script itself, which is not known when looking a prepared script up,
+// so a script changing without a new version is served stale. Prepared
+// scripts are checked against an XXH64 checksum of their content when loaded. With local filesystem storage the
+// store is bounded to DefaultMaxStoreSizeInBytes, evicting the least recently
+// used prepared scripts. Custom storage can be provided with a bufferStore.
 class BasePreparedScriptStoreImpl : public facebook::jsi::PreparedScriptStore {
  public:
   std::shared_ptr<const facebook::jsi::Buffer> tryGetPreparedScript(
@@ -58,8 +91,15 @@ class BasePreparedScriptStoreImpl : public facebook::jsi::PreparedScriptStore {
       const facebook::jsi::JSRuntimeSignature &runtimeSignature,
       const char *prepareTag) noexcept override;
 
-  BasePreparedScriptStoreImpl(const std::string &storeDirectory)
-      : bufferStore_(std::make_shared<LocalFileSimpleBufferStore>(storeDirectory)) {}
+  static constexpr uint64_t DefaultMaxStoreSizeInBytes = 256 * 1024 * 1024;
+
+  BasePreparedScriptStoreImpl(
+      const std::string &storeDirectory,
+      uint64_t maxStoreSizeInBytes = DefaultMaxStoreSizeInBytes)
+      : bufferStore_(std::make_shared<LocalFileSimpleBufferStore>(
+            storeDirectory,
+            maxStoreSizeInBytes,
+            PreparedScriptFilePrefix)) {}
 
   BasePreparedScriptStoreImpl(std::shared_ptr<BufferStore> bufferStore) : bufferStore_(std::move(bufferStore)) {}
 
@@ -69,12 +109,15 @@ class BasePreparedScriptStoreImpl : public facebook::jsi::PreparedScriptStore {
       const facebook::jsi::JSRuntimeSignature &runtimeMetadata,
       const char *prepareTag);
 
+  static constexpr const char *PreparedScriptFilePrefix = "rnwprep_";
+
   std::shared_ptr<BufferStore> bufferStore_;
 };
 
 // Dead simple script store implementation assuming that the script url is a
-// local filesystem path and assuming the script version is the script size, but
-// with extension point to provide custom version provider.
+// local filesystem path and deriving the script version from the script size
+// and last write time, but with extension point to provide custom version
+// provider.
 class BaseScriptStoreImpl : public facebook::jsi::ScriptStore {
  public:
   facebook::jsi::VersionedBuffer getVersionedScript(const std::string &url) noexcept override;
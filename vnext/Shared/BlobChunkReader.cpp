@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "BlobChunkReader.h"
+
+#include <Utf8.h>
+
+// Standard Library
+#include <algorithm>
+
+using std::optional;
+using std::string;
+
+namespace Microsoft::React {
+
+BlobChunkReader::BlobChunkReader(BlobView &&bytes, Format format, string &&type, size_t chunkSize) noexcept
+    : m_bytes{std::move(bytes)},
+      m_format{format},
+      m_type{std::move(type)},
+      m_chunkSize{chunkSize > 0 ? chunkSize : DefaultChunkSize} {}
+
+optional<string> BlobChunkReader::Next() {
+  if (m_isDone) {
+    return std::nullopt;
+  }
+
+  const auto chunk = m_bytes.Slice(m_loaded, std::min(m_chunkSize, Total() - m_loaded));
+  const auto isFirst = !m_isStarted;
+  m_isStarted = true;
+  m_loaded += chunk.Size();
+  m_isDone = m_loaded == Total();
+
+  string result;
+  if (m_format == Format::Text) {
+    result = std::move(m_pendingText);
+    const auto pendingSize = result.size();
+    result.resize(pendingSize + chunk.Size());
+    chunk.CopyTo(reinterpret_cast<uint8_t *>(result.data() + pendingSize));
+
+    m_pendingText.clear();
+    if (!m_isDone) {
+      const auto incompleteSize = Utilities::IncompleteUtf8SuffixSize(result);
+      m_pendingText.assign(result.cend() - incompleteSize, result.cend());
+      result.resize(result.size() - incompleteSize);
+    }
+
+    // The last part also holds the sequence left incomplete by the end of the blob, if any.
+    if (!Utilities::IsValidUtf8(result)) {
+      result = Utilities::ToValidUtf8(result);
+    }
+
+    return result;
+  }
+
+  if (isFirst) {
+    result = "data:" + m_type + ";base64,";
+  }
+  result.reserve(result.size() + Utilities::Base64EncodedSize(chunk.Size()));
+  for (const auto &segment : chunk.Segments()) {
+    m_encoder.Update(std::string_view(reinterpret_cast<const char *>(segment.Data()), segment.Size), result);
+  }
+  if (m_isDone) {
+    m_encoder.Finish(result);
+  }
+
+  return result;
+}
+
+size_t BlobChunkReader::Loaded() const noexcept {
+  return m_loaded;
+}
+
+size_t BlobChunkReader::Total() const noexcept {
+  return m_bytes.Size();
+}
+
+bool BlobChunkReader::Done() const noexcept {
+  return m_isDone;
+}
+
+} // namespace Microsoft::React
@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <Base64.h>
+#include "BlobView.h"
+
+// Standard Library
+#include <optional>
+#include <string>
+
+namespace Microsoft::React {
+
+/// <summary>
+/// Reads the bytes of a blob as text or as a data URL, one part at a time, so
+/// that only a chunk of the result is held in memory at once.
+///
+/// Text parts end on whole UTF-8 sequences: the bytes of a sequence split by a
+/// chunk boundary are kept for the next part. Invalid sequences, and one left
+/// incomplete at the end of the blob, are replaced by U+FFFD.
+/// </summary>
+class BlobChunkReader final {
+ public:
+  enum class Format {
+    Text,
+    DataUrl,
+  };
+
+  static constexpr size_t DefaultChunkSize = 1024 * 1024;
+
+  /// <param name="type">
+  /// Media type of the data URL. Ignored for text.
+  /// </param>
+  BlobChunkReader(BlobView &&bytes, Format format, std::string &&type, size_t chunkSize) noexcept;
+
+  /// <returns>
+  /// The next part of the result, or std::nullopt once all of it was read.
+  /// Concatenated, the parts make the result of reading the blob at once.
+  /// </returns>
+  std::optional<std::string> Next();
+
+  // Number of bytes of the blob read so far.
+  size_t Loaded() const noexcept;
+
+  size_t Total() const noexcept;
+
+  bool Done() const noexcept;
+
+ private:
+  BlobView m_bytes;
+  Format m_format;
+  std::string m_type;
+  size_t m_chunkSize;
+
+  size_t m_loaded{0};
+  bool m_isStarted{false};
+  bool m_isDone{false};
+
+  // Start of a UTF-8 sequence the last text part did not include.
+  std::string m_pendingText;
+  Utilities::Base64Encoder m_encoder;
+};
+
+} // namespace Microsoft::React
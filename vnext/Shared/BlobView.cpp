@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "BlobView.h"
+
+// Standard Library
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using std::shared_ptr;
+using std::vector;
+
+namespace Microsoft::React {
+
+namespace {
+
+class MemoryBlobChunk final : public BlobChunk {
+  vector<uint8_t> m_bytes;
+
+ public:
+  MemoryBlobChunk(vector<uint8_t> &&bytes) noexcept : m_bytes{std::move(bytes)} {}
+
+  const uint8_t *Data() const noexcept override {
+    return m_bytes.data();
+  }
+
+  size_t Size() const noexcept override {
+    return m_bytes.size();
+  }
+};
+
+} // namespace
+
+/*static*/ BlobView BlobView::FromBytes(vector<uint8_t> &&bytes) {
+  if (bytes.empty()) {
+    return {};
+  }
+
+  return FromChunk(std::make_shared<MemoryBlobChunk>(std::move(bytes)));
+}
+
+/*static*/ BlobView BlobView::FromChunk(shared_ptr<const BlobChunk> chunk) {
+  BlobView view;
+  const auto size = chunk->Size();
+  view.Append(BlobSegment{std::move(chunk), 0, size});
+  return view;
+}
+
+size_t BlobView::Size() const noexcept {
+  return m_size;
+}
+
+bool BlobView::Empty() const noexcept {
+  return m_size == 0;
+}
+
+const vector<BlobSegment> &BlobView::Segments() const noexcept {
+  return m_segments;
+}
+
+BlobView BlobView::Slice(size_t offset, size_t size) const {
+  if (offset > m_size || size > m_size - offset) {
+    throw std::out_of_range("Offset or size out of range");
+  }
+
+  BlobView slice;
+  for (const auto &segment : m_segments) {
+    if (size == 0) {
+      break;
+    }
+    if (offset >= segment.Size) {
+      offset -= segment.Size;
+      continue;
+    }
+
+    const auto count = std::min(segment.Size - offset, size);
+    slice.Append(BlobSegment{segment.Chunk, segment.Offset + offset, count});
+    offset = 0;
+    size -= count;
+  }
+
+  return slice;
+}
+
+void BlobView::Append(const BlobView &other) {
+  m_segments.reserve(m_segments.size() + other.m_segments.size());
+  for (const auto &segment : other.m_segments) {
+    Append(segment);
+  }
+}
+
+void BlobView::Append(const BlobSegment &segment) {
+  if (segment.Size == 0) {
+    return;
+  }
+
+  // Joins the slices of a chunk that follow each other back into one segment.
+  if (!m_segments.empty()) {
+    auto &last = m_segments.back();
+    if (last.Chunk == segment.Chunk && last.Offset + last.Size == segment.Offset) {
+      last.Size += segment.Size;
+      m_size += segment.Size;
+      return;
+    }
+  }
+
+  m_segments.push_back(segment);
+  m_size += segment.Size;
+}
+
+void BlobView::CopyTo(uint8_t *destination) const noexcept {
+  for (const auto &segment : m_segments) {
+    std::memcpy(destination, segment.Data(), segment.Size);
+    destination += segment.Size;
+  }
+}
+
+vector<uint8_t> BlobView::ToVector() const {
+  vector<uint8_t> bytes(m_size);
+  CopyTo(bytes.data());
+  return bytes;
+}
+
+} // namespace Microsoft::React
@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Standard Library
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Microsoft::React {
+
+// Immutable bytes of blob data, shared by all the blobs and slices that contain them.
+struct BlobChunk {
+  virtual ~BlobChunk() = default;
+
+  virtual const uint8_t *Data() const noexcept = 0;
+  virtual size_t Size() const noexcept = 0;
+};
+
+// A range of the bytes of a chunk.
+struct BlobSegment {
+  std::shared_ptr<const BlobChunk> Chunk;
+  size_t Offset{0};
+  size_t Size{0};
+
+  const uint8_t *Data() const noexcept {
+    return Chunk->Data() + Offset;
+  }
+};
+
+/// <summary>
+/// Scatter-gather view of the bytes of a blob, as a rope of chunk segments.
+///
+/// Slicing and composing views share the chunks rather than copying their
+/// bytes, so a slice of a blob, or a blob made of other blobs, costs a few
+/// segments. A view holds references to its chunks: it stays valid after the
+/// blob it was resolved from is released.
+/// </summary>
+class BlobView {
+ public:
+  BlobView() noexcept = default;
+
+  // A view of the bytes, moved into a new chunk.
+  static BlobView FromBytes(std::vector<uint8_t> &&bytes);
+
+  // A view of the whole chunk.
+  static BlobView FromChunk(std::shared_ptr<const BlobChunk> chunk);
+
+  size_t Size() const noexcept;
+
+  bool Empty() const noexcept;
+
+  const std::vector<BlobSegment> &Segments() const noexcept;
+
+  ///
+  /// <exception cref="std::out_of_range">
+  /// When the range is not within the view.
+  /// </exception>
+  ///
+  BlobView Slice(size_t offset, size_t size) const;
+
+  // Appends the segments of other, sharing their chunks.
+  void Append(const BlobView &other);
+
+  // Copies the bytes into destination, which must hold Size() bytes.
+  void CopyTo(uint8_t *destination) const noexcept;
+
+  std::vector<uint8_t> ToVector() const;
+
+ private:
+  void Append(const BlobSegment &segment);
+
+  std::vector<BlobSegment> m_segments;
+  size_t m_size{0};
+};
+
+} // namespace Microsoft::React
@@ -0,0 +1,109 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace Microsoft::ReactNative {
+
+// A path from a UTF-8 string, std::filesystem::u8path is deprecated in C++20.
+inline std::filesystem::path Utf8ToPath(std::string_view value) {
+  return std::filesystem::path{std::u8string_view{reinterpret_cast<const char8_t *>(value.data()), value.size()}};
+}
+
+// The application folders that ms-appx and ms-appdata uris point into.
+enum class ApplicationFolder {
+  Installed, // ms-appx:///
+  Local, // ms-appdata:///local/
+  Roaming, // ms-appdata:///roaming/
+  Temporary, // ms-appdata:///temp/
+};
+
+namespace Detail {
+
+inline bool StartsWithIgnoreCase(std::string_view value, std::string_view prefix) noexcept {
+  if (value.size() < prefix.size()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < prefix.size(); i++) {
+    auto c = value[i];
+    if (c >= 'A' && c <= 'Z') {
+      c = static_cast<char>(c - 'A' + 'a');
+    }
+    if (c != prefix[i]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Decodes the %XX escapes of a uri path, leaves malformed escapes as they are.
+inline std::string UnescapeUriPath(std::string_view path) {
+  auto hexValue = [](char c) {
+    return c >= '0' && c <= '9' ? c - '0'
+        : c >= 'a' && c <= 'f'  ? c - 'a' + 10
+        : c >= 'A' && c <= 'F'  ? c - 'A' + 10
+                                : -1;
+  };
+
+  std::string result;
+  result.reserve(path.size());
+  for (size_t i = 0; i < path.size(); i++) {
+    if (path[i] == '%' && i + 2 < path.size() && hexValue(path[i + 1]) >= 0 && hexValue(path[i + 2]) >= 0) {
+      result.push_back(static_cast<char>(hexValue(path[i + 1]) * 16 + hexValue(path[i + 2])));
+      i += 2;
+    } else {
+      result.push_back(path[i]);
+    }
+  }
+
+  return result;
+}
+
+} // namespace Detail
+
+/// <summary>
+/// The filesystem folder of a bundle root path, which is a folder path, or an
+/// ms-appx:/// or ms-appdata:/// uri. getFolderPath returns the path of an
+/// ApplicationFolder, or an empty path when the application has none (ex:
+/// ms-appx in an unpackaged application). Returns an empty path when the root
+/// is not a folder on the filesystem: embedded resources (resource://), other
+/// schemes, and application folders that do not exist.
+/// </summary>
+template <typename GetFolderPath>
+std::filesystem::path BundleRootFolder(std::string_view bundleRootPath, GetFolderPath &&getFolderPath) {
+  struct ApplicationUriPrefix {
+    std::string_view prefix;
+    ApplicationFolder folder;
+  };
+  static constexpr ApplicationUriPrefix prefixes[] = {
+      {"ms-appx:///", ApplicationFolder::Installed},
+      {"ms-appdata:///local/", ApplicationFolder::Local},
+      {"ms-appdata:///roaming/", ApplicationFolder::Roaming},
+      {"ms-appdata:///temp/", ApplicationFolder::Temporary},
+  };
+
+  for (const auto &prefix : prefixes) {
+    if (Detail::StartsWithIgnoreCase(bundleRootPath, prefix.prefix)) {
+      std::filesystem::path folder = getFolderPath(prefix.folder);
+      if (folder.empty()) {
+        return {};
+      }
+
+      return folder / Utf8ToPath(Detail::UnescapeUriPath(bundleRootPath.substr(prefix.prefix.size())));
+    }
+  }
+
+  if (bundleRootPath.find("://") != std::string_view::npos) {
+    return {};
+  }
+
+  return Utf8ToPath(bundleRootPath);
+}
+
+} // namespace Microsoft::ReactNative
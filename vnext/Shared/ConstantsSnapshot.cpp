@@ -0,0 +1,328 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "ConstantsSnapshot.h"
+
+#include <cstring>
+#include "XXHash64.h"
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+// Constants are shallow, deeper snapshots are treated as corrupted.
+constexpr size_t MaxSnapshotDepth = 64;
+
+constexpr char SnapshotMagic[8] = {'R', 'N', 'W', 'C', 'N', 'S', 'T', '1'};
+
+struct ConstantsSnapshotPrefix {
+  char magic[8];
+  uint64_t key;
+  uint64_t sizeInBytes;
+  uint64_t checksum;
+};
+
+bool SkipValue(ConstantsSnapshotReader &reader, ConstantsSnapshotTag tag, size_t depth) noexcept {
+  switch (tag) {
+    case ConstantsSnapshotTag::Null:
+    case ConstantsSnapshotTag::False:
+    case ConstantsSnapshotTag::True:
+      return true;
+    case ConstantsSnapshotTag::Number: {
+      double value;
+      return reader.ReadNumber(value);
+    }
+    case ConstantsSnapshotTag::String: {
+      std::string_view value;
+      return reader.ReadString(value);
+    }
+    case ConstantsSnapshotTag::ObjectBegin:
+    case ConstantsSnapshotTag::ArrayBegin: {
+      if (depth == MaxSnapshotDepth) {
+        return false;
+      }
+
+      const auto isObject = tag == ConstantsSnapshotTag::ObjectBegin;
+      for (;;) {
+        ConstantsSnapshotTag itemTag;
+        if (!reader.ReadTag(itemTag)) {
+          return false;
+        }
+        if (itemTag == ConstantsSnapshotTag::End) {
+          return true;
+        }
+
+        if (isObject) {
+          std::string_view name;
+          if (itemTag != ConstantsSnapshotTag::String || !reader.ReadString(name) || !reader.ReadTag(itemTag)) {
+            return false;
+          }
+        }
+
+        if (!SkipValue(reader, itemTag, depth + 1)) {
+          return false;
+        }
+      }
+    }
+    default:
+      return false;
+  }
+}
+
+facebook::jsi::Value ReadValue(
+    facebook::jsi::Runtime &runtime,
+    ConstantsSnapshotReader &reader,
+    ConstantsSnapshotTag tag) {
+  switch (tag) {
+    case ConstantsSnapshotTag::Null:
+      return facebook::jsi::Value::null();
+    case ConstantsSnapshotTag::False:
+      return facebook::jsi::Value(false);
+    case ConstantsSnapshotTag::True:
+      return facebook::jsi::Value(true);
+    case ConstantsSnapshotTag::Number: {
+      double value{0};
+      reader.ReadNumber(value);
+      return facebook::jsi::Value(value);
+    }
+    case ConstantsSnapshotTag::String: {
+      std::string_view value;
+      reader.ReadString(value);
+      return facebook::jsi::String::createFromUtf8(
+          runtime, reinterpret_cast<const uint8_t *>(value.data()), value.size());
+    }
+    case ConstantsSnapshotTag::ObjectBegin: {
+      facebook::jsi::Object object(runtime);
+      ConstantsSnapshotTag itemTag;
+      while (reader.ReadTag(itemTag) && itemTag != ConstantsSnapshotTag::End) {
+        std::string_view name;
+        reader.ReadString(name);
+        reader.ReadTag(itemTag);
+        object.setProperty(
+            runtime,
+            facebook::jsi::PropNameID::forUtf8(runtime, reinterpret_cast<const uint8_t *>(name.data()), name.size()),
+            ReadValue(runtime, reader, itemTag));
+      }
+      return object;
+    }
+    case ConstantsSnapshotTag::ArrayBegin: {
+      std::vector<facebook::jsi::Value> elements;
+      ConstantsSnapshotTag itemTag;
+      while (reader.ReadTag(itemTag) && itemTag != ConstantsSnapshotTag::End) {
+        elements.push_back(ReadValue(runtime, reader, itemTag));
+      }
+
+      facebook::jsi::Array array(runtime, elements.size());
+      for (size_t i = 0; i < elements.size(); i++) {
+        array.setValueAtIndex(runtime, i, std::move(elements[i]));
+      }
+      return array;
+    }
+    default:
+      return facebook::jsi::Value::undefined();
+  }
+}
+
+} // namespace
+
+//===========================================================================
+// ConstantsSnapshotBuilder implementation
+//===========================================================================
+
+void ConstantsSnapshotBuilder::WriteNull() noexcept {
+  WriteTag(ConstantsSnapshotTag::Null);
+}
+
+void ConstantsSnapshotBuilder::WriteBoolean(bool value) noexcept {
+  WriteTag(value ? ConstantsSnapshotTag::True : ConstantsSnapshotTag::False);
+}
+
+void ConstantsSnapshotBuilder::WriteNumber(double value) noexcept {
+  WriteTag(ConstantsSnapshotTag::Number);
+  m_snapshot.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+void ConstantsSnapshotBuilder::WriteString(std::string_view value) noexcept {
+  WriteTag(ConstantsSnapshotTag::String);
+  WriteSize(value.size());
+  m_snapshot.append(value);
+}
+
+void ConstantsSnapshotBuilder::WriteObjectBegin() noexcept {
+  WriteTag(ConstantsSnapshotTag::ObjectBegin);
+}
+
+void ConstantsSnapshotBuilder::WritePropertyName(std::string_view name) noexcept {
+  WriteString(name);
+}
+
+void ConstantsSnapshotBuilder::WriteObjectEnd() noexcept {
+  WriteTag(ConstantsSnapshotTag::End);
+}
+
+void ConstantsSnapshotBuilder::WriteArrayBegin() noexcept {
+  WriteTag(ConstantsSnapshotTag::ArrayBegin);
+}
+
+void ConstantsSnapshotBuilder::WriteArrayEnd() noexcept {
+  WriteTag(ConstantsSnapshotTag::End);
+}
+
+std::string ConstantsSnapshotBuilder::TakeSnapshot() noexcept {
+  return std::move(m_snapshot);
+}
+
+void ConstantsSnapshotBuilder::WriteTag(ConstantsSnapshotTag tag) noexcept {
+  m_snapshot.push_back(static_cast<char>(tag));
+}
+
+void ConstantsSnapshotBuilder::WriteSize(size_t size) noexcept {
+  do {
+    const auto byte = static_cast<uint8_t>(size & 0x7F);
+    size >>= 7;
+    m_snapshot.push_back(static_cast<char>(size ? byte | 0x80 : byte));
+  } while (size);
+}
+
+//===========================================================================
+// ConstantsSnapshotReader implementation
+//===========================================================================
+
+ConstantsSnapshotReader::ConstantsSnapshotReader(std::string_view snapshot) noexcept : m_snapshot(snapshot) {}
+
+bool ConstantsSnapshotReader::IsAtEnd() const noexcept {
+  return m_position == m_snapshot.size();
+}
+
+bool ConstantsSnapshotReader::ReadTag(ConstantsSnapshotTag &tag) noexcept {
+  if (IsAtEnd()) {
+    return false;
+  }
+
+  tag = static_cast<ConstantsSnapshotTag>(m_snapshot[m_position++]);
+  return true;
+}
+
+bool ConstantsSnapshotReader::ReadNumber(double &value) noexcept {
+  if (m_snapshot.size() - m_position < sizeof(value)) {
+    return false;
+  }
+
+  std::memcpy(&value, m_snapshot.data() + m_position, sizeof(value));
+  m_position += sizeof(value);
+  return true;
+}
+
+bool ConstantsSnapshotReader::ReadString(std::string_view &value) noexcept {
+  size_t size = 0;
+  for (uint32_t shift = 0;; shift += 7) {
+    if (IsAtEnd() || shift > 56) {
+      return false;
+    }
+
+    const auto byte = static_cast<uint8_t>(m_snapshot[m_position++]);
+    size |= static_cast<size_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      break;
+    }
+  }
+
+  if (m_snapshot.size() - m_position < size) {
+    return false;
+  }
+
+  value = m_snapshot.substr(m_position, size);
+  m_position += size;
+  return true;
+}
+
+bool IsValidConstantsSnapshot(std::string_view snapshot) noexcept {
+  ConstantsSnapshotReader reader(snapshot);
+  ConstantsSnapshotTag tag;
+  return reader.ReadTag(tag) && SkipValue(reader, tag, 0) && reader.IsAtEnd();
+}
+
+facebook::jsi::Value MaterializeConstantsSnapshot(facebook::jsi::Runtime &runtime, std::string_view snapshot) {
+  ConstantsSnapshotReader reader(snapshot);
+  ConstantsSnapshotTag tag;
+  if (!reader.ReadTag(tag)) {
+    return facebook::jsi::Value::undefined();
+  }
+
+  return ReadValue(runtime, reader, tag);
+}
+
+//===========================================================================
+// ConstantsCache implementation
+//===========================================================================
+
+ConstantsCache::ConstantsCache(
+    std::shared_ptr<facebook::react::BufferStore> bufferStore,
+    uint64_t cacheVersion) noexcept
+    : m_bufferStore(std::move(bufferStore)), m_cacheVersion(cacheVersion) {}
+
+/*static*/ uint64_t ConstantsCache::MakeKey(
+    std::string_view moduleVersion,
+    const std::vector<std::string> &invalidationInputs) noexcept {
+  // Each part is hashed with its size so that ("ab", "c") and ("a", "bc") differ.
+  auto key = XXHash64(moduleVersion.data(), moduleVersion.size(), moduleVersion.size());
+  for (const auto &input : invalidationInputs) {
+    key = XXHash64(input.data(), input.size(), key ^ input.size());
+  }
+  return key;
+}
+
+std::optional<std::string> ConstantsCache::Load(std::string_view moduleName, uint64_t key) const noexcept {
+  auto buffer = m_bufferStore->getBuffer(GetBufferId(moduleName));
+  if (!buffer || buffer->size() < sizeof(ConstantsSnapshotPrefix)) {
+    return std::nullopt;
+  }
+
+  ConstantsSnapshotPrefix prefix;
+  std::memcpy(&prefix, buffer->data(), sizeof(prefix));
+  if (std::memcmp(prefix.magic, SnapshotMagic, sizeof(prefix.magic)) != 0 || prefix.key != GetStoredKey(key) ||
+      prefix.sizeInBytes != buffer->size() - sizeof(prefix)) {
+    // From another version of the module or of the format, or truncated.
+    return std::nullopt;
+  }
+
+  std::string snapshot(
+      reinterpret_cast<const char *>(buffer->data()) + sizeof(prefix), static_cast<size_t>(prefix.sizeInBytes));
+  if (XXHash64(snapshot.data(), snapshot.size()) != prefix.checksum || !IsValidConstantsSnapshot(snapshot)) {
+    return std::nullopt;
+  }
+
+  return snapshot;
+}
+
+bool ConstantsCache::Store(std::string_view moduleName, uint64_t key, std::string_view snapshot) const noexcept {
+  ConstantsSnapshotPrefix prefix{};
+  std::memcpy(prefix.magic, SnapshotMagic, sizeof(prefix.magic));
+  prefix.key = GetStoredKey(key);
+  prefix.sizeInBytes = snapshot.size();
+  prefix.checksum = XXHash64(snapshot.data(), snapshot.size());
+
+  return m_bufferStore->persistBufferChunks(
+      GetBufferId(moduleName),
+      {{reinterpret_cast<const uint8_t *>(&prefix), sizeof(prefix)},
+       {reinterpret_cast<const uint8_t *>(snapshot.data()), snapshot.size()}});
+}
+
+uint64_t ConstantsCache::GetStoredKey(uint64_t key) const noexcept {
+  // The stored key changes with the cache version, so that snapshots of another version are not loaded.
+  return m_cacheVersion == 0 ? key : XXHash64(&key, sizeof(key), m_cacheVersion);
+}
+
+/*static*/ std::string ConstantsCache::GetBufferId(std::string_view moduleName) {
+  // Module names are identifiers, anything else is replaced to get a valid file name.
+  std::string bufferId;
+  for (const auto c : moduleName) {
+    const auto isValid = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+    bufferId += isValid ? c : '_';
+  }
+  return bufferId + ".constants";
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <BaseScriptStoreImpl.h>
+#include <jsi/jsi.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+/// <summary>
+/// Compact binary form of the constants a native module provides to
+/// JavaScript, so that they can be persisted from one run of the application to
+/// the next, and turned into JSI values without running the constant providers.
+///
+/// A snapshot holds a single value. Each value starts with a tag: numbers are
+/// followed by their 8 bytes, strings by their UTF-8 length as a LEB128 varint
+/// and their bytes, objects by property name (a string) and value pairs, and
+/// arrays by their elements. Objects and arrays end with an End tag.
+/// </summary>
+enum class ConstantsSnapshotTag : uint8_t {
+  Null,
+  False,
+  True,
+  Number,
+  String,
+  ObjectBegin,
+  ArrayBegin,
+  End,
+};
+
+// Writes a snapshot, in the same order as an IJSValueWriter.
+class ConstantsSnapshotBuilder {
+ public:
+  void WriteNull() noexcept;
+  void WriteBoolean(bool value) noexcept;
+  void WriteNumber(double value) noexcept;
+  void WriteString(std::string_view value) noexcept;
+  void WriteObjectBegin() noexcept;
+  void WritePropertyName(std::string_view name) noexcept;
+  void WriteObjectEnd() noexcept;
+  void WriteArrayBegin() noexcept;
+  void WriteArrayEnd() noexcept;
+
+  std::string TakeSnapshot() noexcept;
+
+ private:
+  void WriteTag(ConstantsSnapshotTag tag) noexcept;
+  void WriteSize(size_t size) noexcept;
+
+  std::string m_snapshot;
+};
+
+// Reads a snapshot front to back. Each read returns false past the end of the
+// snapshot, or when the snapshot is truncated.
+class ConstantsSnapshotReader {
+ public:
+  ConstantsSnapshotReader(std::string_view snapshot) noexcept;
+
+  bool IsAtEnd() const noexcept;
+  bool ReadTag(ConstantsSnapshotTag &tag) noexcept;
+  bool ReadNumber(double &value) noexcept;
+  // Also reads property names. value points into the snapshot.
+  bool ReadString(std::string_view &value) noexcept;
+
+ private:
+  std::string_view m_snapshot;
+  size_t m_position{0};
+};
+
+// Whether snapshot holds exactly one well formed value.
+bool IsValidConstantsSnapshot(std::string_view snapshot) noexcept;
+
+// Creates the value of a valid snapshot in runtime.
+facebook::jsi::Value MaterializeConstantsSnapshot(facebook::jsi::Runtime &runtime, std::string_view snapshot);
+
+/// <summary>
+/// Persists constants snapshots in a buffer store, one buffer per module.
+///
+/// Each snapshot is stored with a key made of the version of the module and of
+/// the inputs its constants depend on (ex: the display language or the OS
+/// version), and is only loaded back with the same key and cache version. The
+/// cache version identifies what all the snapshots depend on, such as the
+/// JavaScript bundle. Buffers that are truncated, corrupted or from another
+/// version of the format are ignored.
+/// </summary>
+class ConstantsCache {
+ public:
+  ConstantsCache(std::shared_ptr<facebook::react::BufferStore> bufferStore, uint64_t cacheVersion = 0) noexcept;
+
+  static uint64_t MakeKey(std::string_view moduleVersion, const std::vector<std::string> &invalidationInputs) noexcept;
+
+  std::optional<std::string> Load(std::string_view moduleName, uint64_t key) const noexcept;
+
+  // Replaces the snapshot of the module. Returns false when it cannot be written.
+  bool Store(std::string_view moduleName, uint64_t key, std::string_view snapshot) const noexcept;
+
+ private:
+  static std::string GetBufferId(std::string_view moduleName);
+  uint64_t GetStoredKey(uint64_t key) const noexcept;
+
+  std::shared_ptr<facebook::react::BufferStore> m_bufferStore;
+  uint64_t m_cacheVersion;
+};
+
+} // namespace Microsoft::ReactNative
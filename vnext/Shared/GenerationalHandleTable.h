@@ -0,0 +1,149 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+/// <summary>
+/// A pool of values addressed by handles.
+///
+/// Values are stored in slots that are reused once released, so adding and
+/// releasing values is O(1) and does not allocate once the table has grown to
+/// the number of values alive at the same time. A handle is the index of its
+/// slot and the generation of the slot when the value was added: the
+/// generation changes each time the slot is released, so handles to released
+/// values are never confused with the values that reuse their slot.
+///
+/// The table is not thread safe.
+/// </summary>
+template <typename T>
+class GenerationalHandleTable {
+ public:
+  // 0 is never a valid handle.
+  using Handle = uint64_t;
+
+  GenerationalHandleTable() noexcept = default;
+  GenerationalHandleTable(const GenerationalHandleTable &) = delete;
+  GenerationalHandleTable &operator=(const GenerationalHandleTable &) = delete;
+
+  void Reserve(size_t capacity) {
+    m_slots.reserve(capacity);
+  }
+
+  Handle Add(T &&value) {
+    uint32_t index;
+    if (m_firstFreeSlot != NoSlot) {
+      index = m_firstFreeSlot;
+      m_firstFreeSlot = m_slots[index].nextFreeSlot;
+    } else {
+      index = static_cast<uint32_t>(m_slots.size());
+      m_slots.emplace_back();
+    }
+
+    auto &slot = m_slots[index];
+    slot.value.emplace(std::move(value));
+    m_size++;
+    return MakeHandle(index, slot.generation);
+  }
+
+  // The value of handle, nullptr when it was released.
+  T *Get(Handle handle) noexcept {
+    auto slot = Find(handle);
+    return slot ? &*slot->value : nullptr;
+  }
+
+  // Releases the value of handle and returns it, std::nullopt when it was
+  // already released.
+  std::optional<T> Take(Handle handle) noexcept {
+    auto slot = Find(handle);
+    if (!slot) {
+      return std::nullopt;
+    }
+
+    std::optional<T> value{std::move(slot->value)};
+    Free(handle);
+    return value;
+  }
+
+  // Returns false when the value of handle was already released.
+  bool Release(Handle handle) noexcept {
+    if (!Find(handle)) {
+      return false;
+    }
+
+    Free(handle);
+    return true;
+  }
+
+  // Releases all values, keeping the slots for the values added next.
+  void Clear() noexcept {
+    m_firstFreeSlot = NoSlot;
+    for (auto index = static_cast<uint32_t>(m_slots.size()); index-- > 0;) {
+      auto &slot = m_slots[index];
+      if (slot.value) {
+        slot.value.reset();
+        slot.generation = NextGeneration(slot.generation);
+      }
+      slot.nextFreeSlot = m_firstFreeSlot;
+      m_firstFreeSlot = index;
+    }
+    m_size = 0;
+  }
+
+  // The number of values that were not released.
+  size_t Size() const noexcept {
+    return m_size;
+  }
+
+ private:
+  static constexpr uint32_t NoSlot = UINT32_MAX;
+
+  struct Slot {
+    std::optional<T> value;
+    // Starts at 1 so that handles are never 0.
+    uint32_t generation{1};
+    uint32_t nextFreeSlot{NoSlot};
+  };
+
+  static Handle MakeHandle(uint32_t index, uint32_t generation) noexcept {
+    return static_cast<Handle>(generation) << 32 | index;
+  }
+
+  // Generation 0 is skipped when it wraps around.
+  static uint32_t NextGeneration(uint32_t generation) noexcept {
+    return generation == UINT32_MAX ? 1 : generation + 1;
+  }
+
+  Slot *Find(Handle handle) noexcept {
+    const auto index = static_cast<uint32_t>(handle);
+    const auto generation = static_cast<uint32_t>(handle >> 32);
+    if (index >= m_slots.size()) {
+      return nullptr;
+    }
+
+    auto &slot = m_slots[index];
+    return slot.generation == generation && slot.value ? &slot : nullptr;
+  }
+
+  void Free(Handle handle) noexcept {
+    const auto index = static_cast<uint32_t>(handle);
+    auto &slot = m_slots[index];
+    slot.value.reset();
+    slot.generation = NextGeneration(slot.generation);
+    slot.nextFreeSlot = m_firstFreeSlot;
+    m_firstFreeSlot = index;
+    m_size--;
+  }
+
+  std::vector<Slot> m_slots;
+  uint32_t m_firstFreeSlot{NoSlot};
+  size_t m_size{0};
+};
+
+} // namespace Microsoft::ReactNative
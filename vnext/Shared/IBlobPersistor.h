@@ -3,8 +3,7 @@
 
 #pragma once
 
-// Windows API
-#include <winrt/base.h>
+#include "BlobView.h"
 
 // Standard Library
 #include <string>
@@ -17,14 +16,34 @@ struct IBlobPersistor {
   /// <exception cref="std::invalid_argument">
   /// When an entry for blobId cannot be found.
   /// </exception>
+  /// <exception cref="std::out_of_range">
+  /// When the range is not within the blob.
+  /// </exception>
   ///
-  virtual winrt::array_view<uint8_t const> ResolveMessage(std::string &&blobId, int64_t offset, int64_t size) = 0;
+  virtual BlobView ResolveMessage(std::string &&blobId, int64_t offset, int64_t size) = 0;
 
   virtual void RemoveMessage(std::string &&blobId) noexcept = 0;
 
   virtual void StoreMessage(std::vector<uint8_t> &&message, std::string &&blobId) noexcept = 0;
 
   virtual std::string StoreMessage(std::vector<uint8_t> &&message) noexcept = 0;
+
+  // Stores a blob made of the segments of view. Persistors that share chunks
+  // between blobs do not copy them.
+  virtual void StoreView(BlobView &&view, std::string &&blobId) noexcept {
+    StoreMessage(view.ToVector(), std::move(blobId));
+  }
+
+  // Stores a blob made of the segments of view under a new id, and returns the id.
+  virtual std::string StoreView(BlobView &&view) noexcept {
+    return StoreMessage(view.ToVector());
+  }
+
+  // Moves message into a chunk that blobs stored by this persistor can share,
+  // so that a blob can be built from chunks as its bytes arrive.
+  virtual BlobView MakeView(std::vector<uint8_t> &&message) noexcept {
+    return BlobView::FromBytes(std::move(message));
+  }
 };
 
 } // namespace Microsoft::React
@@ -3,10 +3,12 @@
 
 #pragma once
 
+#include "BlobChunkReader.h"
 #include "IBlobPersistor.h"
 
 // Standard Library
 #include <functional>
+#include <memory>
 #include <string>
 
 namespace Microsoft::React {
@@ -30,6 +32,27 @@ struct IFileReaderResource {
       std::function<void(std::string &&)> &&resolver,
       std::function<void(std::string &&)> &&rejecter) noexcept = 0;
 
+  /// <summary>
+  /// Starts reading a blob as text or as a data URL, in parts of at most chunkSize bytes.
+  /// </summary>
+  /// <returns>
+  /// The reader of the parts, or nullptr after calling rejecter if the blob can not be read.
+  /// </returns>
+  virtual std::unique_ptr<BlobChunkReader> ReadInChunks(
+      std::string &&blobId,
+      int64_t offset,
+      int64_t size,
+      BlobChunkReader::Format format,
+      std::string &&type,
+      size_t chunkSize,
+      std::function<void(std::string &&)> &&rejecter) noexcept = 0;
+
+  /// <summary>
+  /// Returns the bytes of a blob, without copying them.
+  /// Throws if the blob can not be read.
+  /// </summary>
+  virtual BlobView ReadAsBytes(std::string &&blobId, int64_t offset, int64_t size) = 0;
+
   static std::shared_ptr<IFileReaderResource> Make(std::weak_ptr<IBlobPersistor> weakBlobPersistor) noexcept;
 };
 
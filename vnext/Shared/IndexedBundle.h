@@ -0,0 +1,160 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "BundleFilePath.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+namespace Microsoft::ReactNative {
+
+// First four bytes of an indexed bundle, see IndexedBundle.
+constexpr uint32_t IndexedBundleMagic = 0xFB0BD1E5;
+
+namespace Detail {
+
+inline uint32_t IndexedBundleRead32(const uint8_t *p) noexcept {
+  uint32_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+} // namespace Detail
+
+inline bool IsIndexedBundle(const void *data, size_t size) noexcept {
+  return size >= sizeof(uint32_t) && Detail::IndexedBundleRead32(static_cast<const uint8_t *>(data)) ==
+      IndexedBundleMagic;
+}
+
+// Checks the magic of a bundle file without reading the rest of the file.
+inline bool IsIndexedBundleFile(const std::string &path) noexcept {
+  std::ifstream file(Utf8ToPath(path), std::ios::binary);
+  uint8_t magic[sizeof(uint32_t)];
+  return file.read(reinterpret_cast<char *>(magic), sizeof(magic)) && IsIndexedBundle(magic, sizeof(magic));
+}
+
+/// <summary>
+/// A view of a bundle in the indexed (RAM bundle) format Metro produces with
+/// --indexed-ram-bundle, and that Scripts/make-indexed-bundle.js produces from
+/// a regular Metro bundle. All integers are 32-bit little endian:
+///
+///   magic (0xFB0BD1E5) | module count | startup code size
+///   module table: { offset, size } for each module id
+///   startup code | module bodies
+///
+/// Offsets are relative to the end of the module table, the startup code is
+/// at offset zero, and sizes include a null terminator after each code
+/// section. A module id without a body has a zero size.
+///
+/// Parse only reads the header and the module table, so module bodies of a
+/// memory mapped bundle are not paged in until they are asked for. A bundle
+/// too large to be mapped whole can be parsed from a mapping of its first
+/// PrefixSize bytes, its module bodies are then located with ModuleRange.
+/// </summary>
+class IndexedBundle {
+ public:
+  static constexpr size_t HeaderSize = 3 * sizeof(uint32_t);
+  static constexpr size_t TableEntrySize = 2 * sizeof(uint32_t);
+
+  // The size of the header, the module table and the startup code of a bundle
+  // starting with header, which holds at least HeaderSize bytes.
+  static uint64_t PrefixSize(const uint8_t *header) noexcept {
+    return HeaderSize + uint64_t{Detail::IndexedBundleRead32(header + 4)} * TableEntrySize +
+        Detail::IndexedBundleRead32(header + 8);
+  }
+
+  // Returns false when the buffer is not a well formed indexed bundle.
+  bool Parse(const uint8_t *data, size_t size) noexcept {
+    return Parse(data, size, size);
+  }
+
+  // Same as above when data only holds the first size bytes of a bundle of
+  // bundleSize bytes, at least its PrefixSize bytes.
+  bool Parse(const uint8_t *data, size_t size, uint64_t bundleSize) noexcept {
+    *this = {};
+    if (size < HeaderSize || size > bundleSize || !IsIndexedBundle(data, size)) {
+      return false;
+    }
+
+    const uint64_t moduleCount = Detail::IndexedBundleRead32(data + 4);
+    const uint64_t startupCodeSize = Detail::IndexedBundleRead32(data + 8);
+    const uint64_t baseOffset = HeaderSize + moduleCount * TableEntrySize;
+    if (baseOffset + startupCodeSize > size || startupCodeSize == 0 ||
+        data[baseOffset + startupCodeSize - 1] != '\0') {
+      return false;
+    }
+
+    for (uint64_t moduleId = 0; moduleId < moduleCount; moduleId++) {
+      const auto entry = data + HeaderSize + moduleId * TableEntrySize;
+      const uint64_t offset = Detail::IndexedBundleRead32(entry);
+      const uint64_t length = Detail::IndexedBundleRead32(entry + 4);
+      if (length != 0 && baseOffset + offset + length > bundleSize) {
+        return false;
+      }
+    }
+
+    m_data = data;
+    m_size = size;
+    m_moduleCount = static_cast<uint32_t>(moduleCount);
+    m_baseOffset = static_cast<size_t>(baseOffset);
+    m_startupCodeSize = static_cast<uint32_t>(startupCodeSize);
+    return true;
+  }
+
+  uint32_t ModuleCount() const noexcept {
+    return m_moduleCount;
+  }
+
+  // The code to evaluate at startup (the module system and the calls requiring
+  // the entry point). The view is followed by a null terminator.
+  std::string_view StartupCode() const noexcept {
+    return {reinterpret_cast<const char *>(m_data + m_baseOffset), m_startupCodeSize - 1u};
+  }
+
+  // The body of a module, an empty view when the bundle has no module with
+  // that id, its body is not null terminated, or is past the parsed data. The
+  // view is followed by a null terminator.
+  std::string_view Module(uint32_t moduleId) const noexcept {
+    uint64_t offset;
+    uint32_t length;
+    if (!ModuleRange(moduleId, offset, length) || offset + length > m_size) {
+      return {};
+    }
+
+    const auto body = reinterpret_cast<const char *>(m_data + offset);
+    if (body[length - 1] != '\0') {
+      return {};
+    }
+
+    return {body, length - 1u};
+  }
+
+  // The offset of the body of a module from the start of the bundle, and its
+  // length including the null terminator. Returns false when the bundle has no
+  // module with that id.
+  bool ModuleRange(uint32_t moduleId, uint64_t &offset, uint32_t &length) const noexcept {
+    if (moduleId >= m_moduleCount) {
+      return false;
+    }
+
+    const auto entry = m_data + HeaderSize + static_cast<size_t>(moduleId) * TableEntrySize;
+    offset = m_baseOffset + uint64_t{Detail::IndexedBundleRead32(entry)};
+    length = Detail::IndexedBundleRead32(entry + 4);
+    return length != 0;
+  }
+
+ private:
+  const uint8_t *m_data{nullptr};
+  size_t m_size{0};
+  size_t m_baseOffset{0};
+  uint32_t m_moduleCount{0};
+  uint32_t m_startupCodeSize{0};
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,144 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "JSCallQueue.h"
+
+#include <folly/json.h>
+
+#include <algorithm>
+
+namespace Microsoft::ReactNative {
+
+JSCallQueue::JSCallQueue() noexcept : JSCallQueue(Options{}) {}
+
+JSCallQueue::JSCallQueue(Options options) noexcept : m_options(options) {}
+
+JSCallQueue::PushResult JSCallQueue::Push(
+    std::string &&moduleName,
+    std::string &&methodName,
+    folly::dynamic &&args,
+    bool idempotent) noexcept {
+  std::string coalescingKey;
+  if (idempotent) {
+    coalescingKey = GetCoalescingKey(moduleName, methodName, args);
+    auto it = m_idempotentEntries.find(coalescingKey);
+    if (it != m_idempotentEntries.end()) {
+      // The call keeps its place in the queue, with the latest arguments.
+      it->second->call.Args = std::move(args);
+      m_metrics.CoalescedCount++;
+      return PushResult::Coalesced;
+    }
+  }
+
+  auto sourceDepth = m_sourceDepths.find(moduleName);
+  if (!IsLifecycleCall(moduleName) &&
+      (m_metrics.Depth >= m_options.MaxDepth ||
+       (sourceDepth != m_sourceDepths.end() && sourceDepth->second >= m_options.MaxDepthPerSource))) {
+    m_metrics.DroppedCount++;
+    return PushResult::Dropped;
+  }
+
+  if (sourceDepth == m_sourceDepths.end()) {
+    m_sourceDepths.emplace(moduleName, 1);
+  } else {
+    sourceDepth->second++;
+  }
+
+  m_entries.push_back(Entry{
+      JSCall{std::move(moduleName), std::move(methodName), std::move(args), std::chrono::steady_clock::now()},
+      std::move(coalescingKey)});
+  if (!m_entries.back().coalescingKey.empty()) {
+    m_idempotentEntries.emplace(m_entries.back().coalescingKey, &m_entries.back());
+  }
+
+  m_metrics.QueuedCount++;
+  m_metrics.Depth++;
+  m_metrics.MaxDepth = std::max(m_metrics.MaxDepth, m_metrics.Depth);
+  return PushResult::Queued;
+}
+
+bool JSCallQueue::TryDispatchDirectly() noexcept {
+  if (!m_entries.empty() || m_directDispatchCount >= m_options.MaxDirectDispatches) {
+    return false;
+  }
+
+  m_directDispatchCount++;
+  m_metrics.DirectDispatchCount++;
+  m_metrics.DispatchedCount++;
+  return true;
+}
+
+std::vector<JSCall> JSCallQueue::PopBatch(size_t maxCount) noexcept {
+  // The calls dispatched directly before the batch already ran.
+  m_directDispatchCount = 0;
+
+  std::vector<JSCall> calls;
+  const auto now = std::chrono::steady_clock::now();
+  while (calls.size() < maxCount && !m_entries.empty()) {
+    auto entry = PopEntry();
+    const auto latencyMs = std::chrono::duration<double, std::milli>(now - entry.call.EnqueueTime).count();
+    m_metrics.TotalLatencyMs += latencyMs;
+    m_metrics.MaxLatencyMs = std::max(m_metrics.MaxLatencyMs, latencyMs);
+    m_metrics.DispatchedCount++;
+    calls.push_back(std::move(entry.call));
+  }
+
+  return calls;
+}
+
+std::vector<JSCall> JSCallQueue::TakeAll() noexcept {
+  std::vector<JSCall> calls;
+  calls.reserve(m_metrics.Depth);
+  while (!m_entries.empty()) {
+    calls.push_back(PopEntry().call);
+  }
+
+  return calls;
+}
+
+bool JSCallQueue::IsEmpty() const noexcept {
+  return m_metrics.Depth == 0;
+}
+
+const JSCallQueueMetrics &JSCallQueue::Metrics() const noexcept {
+  return m_metrics;
+}
+
+JSCallQueue::Entry JSCallQueue::PopEntry() noexcept {
+  auto entry = std::move(m_entries.front());
+  m_entries.pop_front();
+  if (!entry.coalescingKey.empty()) {
+    m_idempotentEntries.erase(entry.coalescingKey);
+  }
+
+  auto sourceDepth = m_sourceDepths.find(entry.call.ModuleName);
+  if (--sourceDepth->second == 0) {
+    m_sourceDepths.erase(sourceDepth);
+  }
+
+  m_metrics.Depth--;
+  return entry;
+}
+
+/*static*/ bool JSCallQueue::IsLifecycleCall(const std::string &moduleName) noexcept {
+  // Ex: runApplication and unmountApplicationComponentAtRootTag.
+  return moduleName == "AppRegistry";
+}
+
+/*static*/ std::string JSCallQueue::GetCoalescingKey(
+    const std::string &moduleName,
+    const std::string &methodName,
+    const folly::dynamic &args) {
+  std::string key = moduleName + '\n' + methodName;
+  if (args.isArray()) {
+    for (size_t i = 0; i + 1 < args.size(); i++) {
+      key += '\n';
+      key += folly::toJson(args[i]);
+    }
+  }
+  return key;
+}
+
+} // namespace Microsoft::ReactNative
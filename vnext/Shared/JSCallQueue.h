@@ -0,0 +1,120 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <folly/dynamic.h>
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+// A call of a JavaScript module method made by native code.
+struct JSCall {
+  std::string ModuleName;
+  std::string MethodName;
+  folly::dynamic Args;
+  std::chrono::steady_clock::time_point EnqueueTime;
+};
+
+struct JSCallQueueMetrics {
+  size_t Depth{0}; // Calls waiting to be dispatched
+  size_t MaxDepth{0};
+  uint64_t QueuedCount{0};
+  uint64_t CoalescedCount{0};
+  uint64_t DroppedCount{0};
+  uint64_t DispatchedCount{0}; // Including the calls dispatched without being queued
+  uint64_t DirectDispatchCount{0};
+  // Time the dispatched calls waited in the queue
+  double TotalLatencyMs{0};
+  double MaxLatencyMs{0};
+};
+
+/// <summary>
+/// Bounded queue of the calls native code makes to JavaScript modules.
+///
+/// Calls are dispatched in the order they were pushed, whatever module they
+/// call. Calls are grouped by source, the JavaScript module they call, for the
+/// bound: beyond MaxDepth waiting calls, or MaxDepthPerSource waiting calls of
+/// the same source, calls are dropped and Push returns Dropped so that the
+/// caller can slow down. A burst of calls from one source therefore drops its
+/// own calls rather than the calls of the others (ex: user input events).
+///
+/// Calls to AppRegistry start and stop the application, and are never dropped.
+///
+/// Calls do not need to be queued while the queue is empty and the JavaScript
+/// thread keeps up: TryDispatchDirectly lets up to MaxDirectDispatches calls be
+/// dispatched right away between two batches, since batches are popped on the
+/// JavaScript thread after the calls dispatched before them ran.
+///
+/// A call that is marked idempotent replaces the arguments of the same call
+/// that is still waiting rather than being queued again. Calls are the same
+/// when they have the same module, method and arguments but the last one, which
+/// is the payload: the event name of an emit call, or the view tag and event
+/// name of an event dispatched to a view.
+///
+/// The queue is not thread safe.
+/// </summary>
+class JSCallQueue {
+ public:
+  struct Options {
+    size_t MaxDepth{10000};
+    size_t MaxDepthPerSource{1000};
+    size_t MaxDirectDispatches{64};
+  };
+
+  enum class PushResult { Queued, Coalesced, Dropped };
+
+  JSCallQueue() noexcept;
+  JSCallQueue(Options options) noexcept;
+
+  PushResult Push(
+      std::string &&moduleName,
+      std::string &&methodName,
+      folly::dynamic &&args,
+      bool idempotent = false) noexcept;
+
+  // Returns true, and counts the call as dispatched, when a call can be dispatched without being queued: the queue is
+  // empty and fewer than MaxDirectDispatches calls were dispatched that way since the last batch. Otherwise the call
+  // must be pushed, to run after the waiting calls.
+  bool TryDispatchDirectly() noexcept;
+
+  // Removes up to maxCount calls, in the order they were pushed.
+  std::vector<JSCall> PopBatch(size_t maxCount) noexcept;
+
+  // Removes all the calls without dispatching them.
+  std::vector<JSCall> TakeAll() noexcept;
+
+  bool IsEmpty() const noexcept;
+
+  const JSCallQueueMetrics &Metrics() const noexcept;
+
+ private:
+  struct Entry {
+    JSCall call;
+    std::string coalescingKey; // Empty when the call is not idempotent
+  };
+
+  static bool IsLifecycleCall(const std::string &moduleName) noexcept;
+  static std::string
+  GetCoalescingKey(const std::string &moduleName, const std::string &methodName, const folly::dynamic &args);
+
+  Entry PopEntry() noexcept;
+
+  Options m_options;
+  std::deque<Entry> m_entries;
+  // The number of waiting calls of each source that has some.
+  std::unordered_map<std::string, size_t> m_sourceDepths;
+  // The waiting idempotent calls by coalescing key. Entries are not moved
+  // while they are in the deque, which is only pushed to and popped from its ends.
+  std::unordered_map<std::string, Entry *> m_idempotentEntries;
+  size_t m_directDispatchCount{0};
+  JSCallQueueMetrics m_metrics;
+};
+
+} // namespace Microsoft::ReactNative
@@ -7,11 +7,18 @@
 #include <werapi.h>
 #include <windows.h>
 
+#include <limits>
+
 namespace {
 
 class MemoryMappedBuffer : public facebook::jsi::Buffer {
  public:
-  MemoryMappedBuffer(const wchar_t *const filename, uint32_t offset);
+  // Maps size bytes of the file from offset, or the rest of the file when size is zero.
+  MemoryMappedBuffer(
+      const wchar_t *const filename,
+      uint64_t offset,
+      size_t size,
+      Microsoft::JSI::MemoryMappedAccess access);
 
   size_t size() const override;
   const uint8_t *data() const override;
@@ -24,18 +31,29 @@ class MemoryMappedBuffer : public facebook::jsi::Buffer {
 
   std::unique_ptr<void, decltype(&CloseHandle)> m_fileMapping;
   std::unique_ptr<void, decltype(&FileDataDeleter)> m_fileData;
-  uint32_t m_fileSize = 0;
-  uint32_t m_offset = 0;
+  size_t m_size = 0;
+  // Offset of the data in the view
+  size_t m_offset = 0;
 };
 
-MemoryMappedBuffer::MemoryMappedBuffer(const wchar_t *const filename, uint32_t offset)
-    : m_fileMapping{nullptr, &CloseHandle}, m_fileData{nullptr, &FileDataDeleter}, m_offset{offset} {
+MemoryMappedBuffer::MemoryMappedBuffer(
+    const wchar_t *const filename,
+    uint64_t offset,
+    size_t size,
+    Microsoft::JSI::MemoryMappedAccess access)
+    : m_fileMapping{nullptr, &CloseHandle}, m_fileData{nullptr, &FileDataDeleter} {
   if (!filename) {
     throw facebook::jsi::JSINativeException("MemoryMappedBuffer constructor is called with nullptr filename.");
   }
 
+  const auto sequential = access == Microsoft::JSI::MemoryMappedAccess::Sequential;
+  CREATEFILE2_EXTENDED_PARAMETERS createParams{};
+  createParams.dwSize = sizeof(createParams);
+  createParams.dwFileAttributes = FILE_ATTRIBUTE_NORMAL;
+  createParams.dwFileFlags = sequential ? FILE_FLAG_SEQUENTIAL_SCAN : 0;
+
   std::unique_ptr<void, decltype(&CloseHandle)> fileHandle{
-      CreateFile2(filename, GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, nullptr /* pCreateExParams */), &CloseHandle};
+      CreateFile2(filename, GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, &createParams), &CloseHandle};
 
   if (fileHandle.get() == INVALID_HANDLE_VALUE) {
     throw facebook::jsi::JSINativeException(
@@ -47,40 +65,73 @@ MemoryMappedBuffer::MemoryMappedBuffer(const wchar_t *const filename, uint32_t o
     throw facebook::jsi::JSINativeException("GetFileSizeEx failed with last error " + std::to_string(GetLastError()));
   }
 
-  if (fileSize.LowPart == 0) {
+  if (fileSize.QuadPart == 0) {
     throw facebook::jsi::JSINativeException("Cannot memory map an empty file.");
   }
 
-  if (fileSize.HighPart != 0) {
-    throw facebook::jsi::JSINativeException(
-        "MemoryMappedBuffer only supports files whose size can fit within an "
-        "uint32_t.");
+  if (offset > static_cast<uint64_t>(fileSize.QuadPart)) {
+    throw facebook::jsi::JSINativeException("Invalid offset.");
   }
 
-  m_fileSize = fileSize.LowPart;
-  if (m_offset > m_fileSize) {
-    throw facebook::jsi::JSINativeException("Invalid offset.");
+  // The rest of the file is mapped whole, a window is mapped from the
+  // allocation granularity boundary before offset.
+  uint64_t viewOffset = 0;
+  if (size == 0) {
+    if (static_cast<uint64_t>(fileSize.QuadPart) > std::numeric_limits<size_t>::max()) {
+      throw facebook::jsi::JSINativeException("File is too large to be memory mapped in this process.");
+    }
+
+    m_offset = static_cast<size_t>(offset);
+    m_size = static_cast<size_t>(fileSize.QuadPart) - m_offset;
+  } else {
+    if (size > static_cast<uint64_t>(fileSize.QuadPart) - offset) {
+      throw facebook::jsi::JSINativeException("Window goes past the end of the file.");
+    }
+
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    viewOffset = offset - offset % systemInfo.dwAllocationGranularity;
+    m_offset = static_cast<size_t>(offset - viewOffset);
+    m_size = size;
+    if (m_size > std::numeric_limits<size_t>::max() - m_offset) {
+      throw facebook::jsi::JSINativeException("Window is too large to be memory mapped in this process.");
+    }
   }
 
   m_fileMapping.reset(CreateFileMappingFromApp(
-      fileHandle.get(), nullptr /* SecurityAttributes */, PAGE_READONLY, m_fileSize, nullptr /* Name */));
+      fileHandle.get(),
+      nullptr /* SecurityAttributes */,
+      PAGE_READONLY,
+      static_cast<ULONG64>(fileSize.QuadPart),
+      nullptr /* Name */));
 
   if (!m_fileMapping) {
     throw facebook::jsi::JSINativeException(
         "CreateFileMapping/CreateFileMappingFromApp failed with last error " + std::to_string(GetLastError()));
   }
 
-  m_fileData.reset(
-      MapViewOfFileFromApp(m_fileMapping.get(), FILE_MAP_READ, 0 /* FileOffset */, 0 /* NumberOfBytesToMap */));
+  m_fileData.reset(MapViewOfFileFromApp(
+      m_fileMapping.get(),
+      FILE_MAP_READ,
+      viewOffset,
+      size == 0 ? 0 /* NumberOfBytesToMap, the rest of the file */ : m_offset + m_size));
 
   if (!m_fileData) {
     throw facebook::jsi::JSINativeException(
         "MapViewOfFile/MapViewOfFileFromApp failed with last error " + std::to_string(GetLastError()));
   }
+
+  if (sequential) {
+    // Start reading the file into the file cache now rather than one page
+    // fault at a time. Prefetched pages are not added to the working set
+    // until they are accessed. This is only a hint, ignore failures.
+    WIN32_MEMORY_RANGE_ENTRY range{static_cast<uint8_t *>(m_fileData.get()) + m_offset, m_size};
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0 /* Flags */);
+  }
 }
 
 size_t MemoryMappedBuffer::size() const {
-  return m_fileSize - m_offset;
+  return m_size;
 }
 
 const uint8_t *MemoryMappedBuffer::data() const {
@@ -91,8 +142,18 @@ const uint8_t *MemoryMappedBuffer::data() const {
 
 namespace Microsoft::JSI {
 
-std::unique_ptr<facebook::jsi::Buffer> MakeMemoryMappedBuffer(const wchar_t *const filename, uint32_t offset) {
-  return std::make_unique<MemoryMappedBuffer>(filename, offset);
+std::unique_ptr<facebook::jsi::Buffer>
+MakeMemoryMappedBuffer(const wchar_t *const filename, uint32_t offset, MemoryMappedAccess access) {
+  return std::make_unique<MemoryMappedBuffer>(filename, offset, 0 /* size */, access);
+}
+
+std::unique_ptr<facebook::jsi::Buffer>
+MakeMemoryMappedWindow(const wchar_t *const filename, uint64_t offset, size_t size, MemoryMappedAccess access) {
+  if (size == 0) {
+    throw facebook::jsi::JSINativeException("Cannot memory map an empty window.");
+  }
+
+  return std::make_unique<MemoryMappedBuffer>(filename, offset, size, access);
 }
 
 } // namespace Microsoft::JSI
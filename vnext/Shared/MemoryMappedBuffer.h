@@ -9,8 +9,32 @@
 
 namespace Microsoft::JSI {
 
-// We only support files whose size can fit within an uint32_t. Memory
-// mapping an empty or a larger file fails.
-std::unique_ptr<facebook::jsi::Buffer> MakeMemoryMappedBuffer(const wchar_t *const filename, uint32_t offset = 0);
+// How the mapped buffer is going to be read.
+enum class MemoryMappedAccess {
+  // Pages are read from the file as they are first accessed.
+  Random,
+  // The buffer is read front to back right after it is mapped (ex: a bundle
+  // about to be parsed), the file is read ahead into the file cache.
+  Sequential,
+};
+
+// Memory mapping an empty file, or a file that does not fit in the address
+// space (files over 4 GB in 32-bit processes) fails with a
+// JSINativeException. Callers can fall back to reading empty files, files that
+// do not fit in the address space can only be mapped a window at a time.
+std::unique_ptr<facebook::jsi::Buffer> MakeMemoryMappedBuffer(
+    const wchar_t *const filename,
+    uint32_t offset = 0,
+    MemoryMappedAccess access = MemoryMappedAccess::Random);
+
+// Maps the size bytes of the file starting at offset. Only that window is
+// mapped into the address space, so any part of a file that is too large to be
+// mapped whole can be mapped. Fails with a JSINativeException when the window
+// is empty or goes past the end of the file.
+std::unique_ptr<facebook::jsi::Buffer> MakeMemoryMappedWindow(
+    const wchar_t *const filename,
+    uint64_t offset,
+    size_t size,
+    MemoryMappedAccess access = MemoryMappedAccess::Random);
 
 } // namespace Microsoft::JSI
@@ -4,12 +4,18 @@
 #include "FileReaderModule.h"
 
 #include <CreateModules.h>
+#include <Modules/CxxModuleUtilities.h>
 #include <ReactPropertyBag.h>
+#include <Utf8.h>
 #include "Networking/NetworkPropertyIds.h"
 
 // Windows API
 #include <winrt/Windows.Foundation.h>
 
+// Standard Library
+#include <optional>
+
+namespace jsi = facebook::jsi;
 namespace msrn = winrt::Microsoft::ReactNative;
 
 using std::string;
@@ -17,9 +23,21 @@ using std::weak_ptr;
 using winrt::Windows::Foundation::IInspectable;
 
 namespace {
+using Microsoft::React::BlobChunkReader;
+using Microsoft::React::Modules::SendEvent;
+
 constexpr wchar_t s_moduleNameW[] = L"FileReaderModule";
 
 msrn::ReactModuleProvider s_moduleProvider = msrn::MakeTurboModuleProvider<Microsoft::React::FileReaderTurboModule>();
+
+void SetGlobalFunction(jsi::Runtime &runtime, const char *name, unsigned int paramCount, jsi::HostFunctionType &&fn) {
+  runtime.global().setProperty(
+      runtime,
+      name,
+      jsi::Function::createFromHostFunction(
+          runtime, jsi::PropNameID::forAscii(runtime, name), paramCount, std::move(fn)));
+}
+
 } // namespace
 
 namespace Microsoft::React {
@@ -30,6 +48,58 @@ void FileReaderTurboModule::Initialize(msrn::ReactContext const &reactContext) n
   auto props = reactContext.Properties();
   auto prop = props.Get(BlobModulePersistorPropertyId());
   m_resource = IFileReaderResource::Make(prop.Value());
+  m_context = reactContext.Handle();
+}
+
+void FileReaderTurboModule::InitializeJsi(msrn::ReactContext const & /*reactContext*/, jsi::Runtime &runtime) noexcept {
+  auto weakResource = weak_ptr<IFileReaderResource>{m_resource};
+
+  // __fileReaderReadAsText(blobId, offset, size)
+  // Returns the blob bytes as a string. Valid UTF-8 stored contiguously is passed to the runtime as is; otherwise
+  // the bytes are joined and invalid sequences are replaced by U+FFFD.
+  SetGlobalFunction(
+      runtime,
+      "__fileReaderReadAsText",
+      3,
+      [weakResource](jsi::Runtime &rt, const jsi::Value & /*thisVal*/, const jsi::Value *args, size_t count) {
+        if (count < 3 || !args[0].isString() || !args[1].isNumber() || !args[2].isNumber()) {
+          throw jsi::JSError(rt, "__fileReaderReadAsText expects a blob ID, an offset and a size");
+        }
+
+        auto resource = weakResource.lock();
+        if (!resource) {
+          throw jsi::JSError(rt, "Could not find FileReader resource");
+        }
+
+        BlobView bytes;
+        try {
+          bytes = resource->ReadAsBytes(
+              args[0].getString(rt).utf8(rt),
+              static_cast<int64_t>(args[1].getNumber()),
+              static_cast<int64_t>(args[2].getNumber()));
+        } catch (const std::exception &e) {
+          throw jsi::JSError(rt, e.what());
+        }
+
+        const auto &segments = bytes.Segments();
+        if (segments.size() == 1) {
+          auto data = reinterpret_cast<const char *>(segments.front().Data());
+          auto text = std::string_view(data, segments.front().Size);
+          if (Utilities::IsValidUtf8(text)) {
+            return jsi::Value{jsi::String::createFromUtf8(rt, segments.front().Data(), text.size())};
+          }
+
+          return jsi::Value{jsi::String::createFromUtf8(rt, Utilities::ToValidUtf8(text))};
+        }
+
+        auto text = string(bytes.Size(), '\0');
+        bytes.CopyTo(reinterpret_cast<uint8_t *>(text.data()));
+        if (!Utilities::IsValidUtf8(text)) {
+          text = Utilities::ToValidUtf8(text);
+        }
+
+        return jsi::Value{jsi::String::createFromUtf8(rt, text)};
+      });
 }
 
 ///
@@ -100,6 +170,116 @@ void FileReaderTurboModule::ReadAsText(
       [&result](string &&message) { result.Reject(winrt::to_hstring(std::move(message)).c_str()); });
 }
 
+///
+/// <param name="data">
+/// Blob object with the following fields:
+/// - blobId
+/// - offset
+/// - size
+/// - type (optional)
+/// </param>
+/// <param name="format">
+/// Either "text" or "dataUrl".
+/// </param>
+/// <param name="chunkSize">
+/// Maximum number of blob bytes in each part, or 0 for the default.
+/// </param>
+/// <param name="result">
+/// Resolves with the ID to pass to readChunk, or rejects with a text message.
+/// </param>
+///
+void FileReaderTurboModule::ReadInChunks(
+    msrn::JSValue &&data,
+    string &&format,
+    double chunkSize,
+    msrn::ReactPromise<double> &&result) noexcept {
+  BlobChunkReader::Format readerFormat;
+  if (format == "text") {
+    readerFormat = BlobChunkReader::Format::Text;
+  } else if (format == "dataUrl") {
+    readerFormat = BlobChunkReader::Format::DataUrl;
+  } else {
+    return result.Reject(winrt::to_hstring("Unsupported read format: " + format).c_str());
+  }
+
+  auto &blob = data.AsObject();
+  auto blobId = blob["blobId"].AsString();
+  auto offset = blob["offset"].AsInt64();
+  auto size = blob["size"].AsInt64();
+
+  auto typeItr = blob.find("type");
+  string type{};
+  if (typeItr == blob.end()) {
+    type = "application/octet-stream";
+  } else {
+    type = (*typeItr).second.AsString();
+  }
+
+  auto reader = m_resource->ReadInChunks(
+      std::move(blobId),
+      offset,
+      size,
+      readerFormat,
+      std::move(type),
+      chunkSize > 0 ? static_cast<size_t>(chunkSize) : BlobChunkReader::DefaultChunkSize,
+      [&result](string &&message) { result.Reject(winrt::to_hstring(std::move(message)).c_str()); });
+  if (!reader) {
+    return;
+  }
+
+  auto readerId = m_nextReaderId++;
+  m_chunkReaders.emplace(readerId, std::move(reader));
+  result.Resolve(readerId);
+}
+
+///
+/// <param name="readerId">
+/// ID returned by readInChunks.
+/// </param>
+/// <param name="result">
+/// Resolves with an object with the following fields, or rejects with a text message:
+/// - data: the next part of the result
+/// - loaded: number of blob bytes read so far
+/// - total: size of the blob
+/// - done: whether data is the last part
+/// </param>
+/// <remarks>
+/// Also emits fileReaderProgress with the readerId, loaded and total fields.
+/// The reader is released after its last part.
+/// </remarks>
+///
+void FileReaderTurboModule::ReadChunk(double readerId, msrn::ReactPromise<msrn::JSValue> &&result) noexcept {
+  auto readerItr = m_chunkReaders.find(readerId);
+  if (readerItr == m_chunkReaders.end()) {
+    return result.Reject(L"Unknown or finished reader");
+  }
+
+  auto &reader = (*readerItr).second;
+  std::optional<string> chunk;
+  try {
+    chunk = reader->Next();
+  } catch (const std::exception &e) {
+    m_chunkReaders.erase(readerItr);
+    return result.Reject(winrt::to_hstring(e.what()).c_str());
+  }
+
+  auto loaded = static_cast<int64_t>(reader->Loaded());
+  auto total = static_cast<int64_t>(reader->Total());
+  auto done = reader->Done();
+  if (done) {
+    m_chunkReaders.erase(readerItr);
+  }
+
+  SendEvent(m_context, L"fileReaderProgress", {{"readerId", readerId}, {"loaded", loaded}, {"total", total}});
+
+  result.Resolve(msrn::JSValueObject{
+      {"data", chunk.value_or(string{})}, {"loaded", loaded}, {"total", total}, {"done", done}});
+}
+
+void FileReaderTurboModule::AbortRead(double readerId) noexcept {
+  m_chunkReaders.erase(readerId);
+}
+
 #pragma endregion FileReaderTurboModule
 
 /*extern*/ const wchar_t *GetFileReaderTurboModuleName() noexcept {
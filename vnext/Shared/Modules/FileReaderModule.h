@@ -13,6 +13,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace Microsoft::React {
@@ -24,6 +25,15 @@ struct FileReaderTurboModule {
   REACT_INIT(Initialize)
   void Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept;
 
+  /// <summary>
+  /// Installs __fileReaderReadAsText, which passes blob bytes that are valid UTF-8 to the runtime as they are.
+  /// The runtime still copies them into its string; only the intermediate std::string and JSValue are avoided.
+  /// </summary>
+  REACT_INIT(InitializeJsi)
+  void InitializeJsi(
+      winrt::Microsoft::ReactNative::ReactContext const &reactContext,
+      facebook::jsi::Runtime &runtime) noexcept;
+
   REACT_METHOD(ReadAsDataUrl, L"readAsDataURL")
   void ReadAsDataUrl(
       winrt::Microsoft::ReactNative::JSValue &&data,
@@ -35,8 +45,28 @@ struct FileReaderTurboModule {
       std::string &&encoding,
       winrt::Microsoft::ReactNative::ReactPromise<std::string> &&result) noexcept;
 
+  REACT_METHOD(ReadInChunks, L"readInChunks")
+  void ReadInChunks(
+      winrt::Microsoft::ReactNative::JSValue &&data,
+      std::string &&format,
+      double chunkSize,
+      winrt::Microsoft::ReactNative::ReactPromise<double> &&result) noexcept;
+
+  REACT_METHOD(ReadChunk, L"readChunk")
+  void ReadChunk(
+      double readerId,
+      winrt::Microsoft::ReactNative::ReactPromise<winrt::Microsoft::ReactNative::JSValue> &&result) noexcept;
+
+  REACT_METHOD(AbortRead, L"abortRead")
+  void AbortRead(double readerId) noexcept;
+
  private:
   std::shared_ptr<IFileReaderResource> m_resource;
+  winrt::Microsoft::ReactNative::ReactContext m_context;
+
+  // Chunked reads in progress, by reader ID. Methods run on the JavaScript thread only.
+  std::unordered_map<double, std::unique_ptr<BlobChunkReader>> m_chunkReaders;
+  double m_nextReaderId{0};
 };
 
 } // namespace Microsoft::React
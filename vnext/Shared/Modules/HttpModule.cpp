@@ -5,14 +5,22 @@
 
 #include "HttpModule.h"
 
+#include <CppRuntimeOptions.h>
 #include <CreateModules.h>
 #include <Modules/CxxModuleUtilities.h>
 #include <ReactPropertyBag.h>
 
+// Boost Libraries
+#include <boost/algorithm/string.hpp>
+
+// Standard Library
+#include <algorithm>
+
 using folly::dynamic;
 using std::function;
 using std::shared_ptr;
 using std::string;
+using std::vector;
 using std::weak_ptr;
 using winrt::Microsoft::ReactNative::IReactPropertyBag;
 using winrt::Microsoft::ReactNative::ReactNonAbiValue;
@@ -25,6 +33,7 @@ namespace msrn = winrt::Microsoft::ReactNative;
 namespace {
 
 using Microsoft::React::Modules::SendEvent;
+using Microsoft::React::Networking::HttpRequestScheduler;
 using Microsoft::React::Networking::IHttpResource;
 
 constexpr wchar_t s_moduleNameW[] = L"Networking";
@@ -56,18 +65,36 @@ void HttpTurboModule::Initialize(msrn::ReactContext const &reactContext) noexcep
   m_context = reactContext;
   m_resource = IHttpResource::Make(m_context.Properties().Handle());
 
-  m_resource->SetOnRequestSuccess([context = m_context](int64_t requestId) {
+  HttpRequestScheduler::Options schedulerOptions;
+  if (auto maxRequests = GetRuntimeOptionInt("Http.MaxConcurrentRequests"); maxRequests > 0) {
+    schedulerOptions.MaxRequests = static_cast<size_t>(maxRequests);
+  }
+  if (auto maxRequestsPerHost = GetRuntimeOptionInt("Http.MaxConcurrentRequestsPerHost"); maxRequestsPerHost > 0) {
+    schedulerOptions.MaxRequestsPerHost = static_cast<size_t>(maxRequestsPerHost);
+  }
+  m_scheduler = std::make_shared<HttpRequestScheduler>(std::move(schedulerOptions));
+  auto scheduler = weak_ptr<HttpRequestScheduler>{m_scheduler};
+
+  m_resource->SetOnRequestSuccess([context = m_context, scheduler](int64_t requestId) {
+    if (auto strongScheduler = scheduler.lock()) {
+      strongScheduler->Complete(requestId);
+    }
     SendEvent(context, completedResponseW, msrn::JSValueArray{requestId});
   });
 
-  m_resource->SetOnResponse([context = m_context](int64_t requestId, IHttpResource::Response &&response) {
+  m_resource->SetOnResponse([context = m_context, scheduler](int64_t requestId, IHttpResource::Response &&response) {
     auto headers = msrn::JSValueObject{};
     for (auto &header : response.Headers) {
       headers[header.first] = header.second;
     }
 
+    if (auto strongScheduler = scheduler.lock()) {
+      response.QueueTime = strongScheduler->QueueTime(requestId);
+    }
+
     // TODO: Test response content?
-    auto args = msrn::JSValueArray{requestId, response.StatusCode, std::move(headers), response.Url};
+    auto args =
+        msrn::JSValueArray{requestId, response.StatusCode, std::move(headers), response.Url, response.QueueTime};
 
     SendEvent(context, receivedResponseW, std::move(args));
   });
@@ -93,11 +120,18 @@ void HttpTurboModule::Initialize(msrn::ReactContext const &reactContext) noexcep
     SendEvent(context, receivedDataProgressW, msrn::JSValueArray{requestId, progress, total});
   });
 
-  m_resource->SetOnResponseComplete([context = m_context](int64_t requestId) {
+  m_resource->SetOnResponseComplete([context = m_context, scheduler](int64_t requestId) {
+    if (auto strongScheduler = scheduler.lock()) {
+      strongScheduler->Complete(requestId);
+    }
     SendEvent(context, completedResponseW, msrn::JSValueArray{requestId});
   });
 
-  m_resource->SetOnError([context = m_context](int64_t requestId, string &&message, bool isTimeout) {
+  m_resource->SetOnError([context = m_context, scheduler](int64_t requestId, string &&message, bool isTimeout) {
+    if (auto strongScheduler = scheduler.lock()) {
+      strongScheduler->Complete(requestId);
+    }
+
     auto args = msrn::JSValueArray{requestId, std::move(message)};
     if (isTimeout) {
       args.push_back(true);
@@ -105,6 +139,18 @@ void HttpTurboModule::Initialize(msrn::ReactContext const &reactContext) noexcep
 
     SendEvent(context, completedResponseW, std::move(args));
   });
+
+  // Comma-separated URLs the host app expects to request, such as its API servers. Connecting to them now takes DNS
+  // resolution and handshakes off the first requests.
+  if (auto origins = GetRuntimeOptionString("Http.PreconnectOrigins"); !origins.empty()) {
+    vector<string> urls;
+    boost::split(urls, origins, boost::is_any_of(","));
+    for (auto &url : urls) {
+      boost::trim(url);
+    }
+    urls.erase(std::remove(urls.begin(), urls.end(), string{}), urls.end());
+    m_resource->Preconnect(std::move(urls));
+  }
 }
 
 void HttpTurboModule::SendRequest(
@@ -117,27 +163,69 @@ void HttpTurboModule::SendRequest(
     headers.emplace(entry.first, entry.second.AsString());
   }
 
-  m_resource->SendRequest(
-      std::move(query.method),
-      std::move(query.url),
+  // Report the request ID right away, so that JavaScript can abort the request while it is queued.
+  callback({static_cast<double>(m_requestId)});
+
+  auto priority = Networking::GetRequestPriority(headers, query.responseType);
+  auto host = Networking::GetRequestHost(query.url);
+  m_scheduler->Enqueue(
       m_requestId,
-      std::move(headers),
-      query.data.MoveObject(),
-      std::move(query.responseType),
-      query.incrementalUpdates,
-      static_cast<int64_t>(query.timeout),
-      query.withCredentials,
-      [&callback](int64_t requestId) { callback({static_cast<double>(requestId)}); });
+      std::move(host),
+      priority,
+      [resource = m_resource,
+       method = std::move(query.method),
+       url = std::move(query.url),
+       requestId = m_requestId,
+       headers = std::move(headers),
+       data = std::make_shared<msrn::JSValueObject>(query.data.MoveObject()),
+       responseType = std::move(query.responseType),
+       incrementalUpdates = query.incrementalUpdates,
+       timeout = static_cast<int64_t>(query.timeout),
+       withCredentials = query.withCredentials]() mutable {
+        resource->SendRequest(
+            std::move(method),
+            std::move(url),
+            requestId,
+            std::move(headers),
+            std::move(*data),
+            std::move(responseType),
+            incrementalUpdates,
+            timeout,
+            withCredentials,
+            {});
+      });
 }
 
 void HttpTurboModule::AbortRequest(double requestId) noexcept {
+  // Requests still queued were never sent.
+  if (m_scheduler->Cancel(static_cast<int64_t>(requestId))) {
+    return;
+  }
+
   m_resource->AbortRequest(static_cast<int64_t>(requestId));
+  m_scheduler->Complete(static_cast<int64_t>(requestId));
 }
 
 void HttpTurboModule::ClearCookies(function<void(bool)> const &callback) noexcept {
   m_resource->ClearCookies();
 }
 
+void HttpTurboModule::Preconnect(vector<string> &&urls) noexcept {
+  m_resource->Preconnect(std::move(urls));
+}
+
+void HttpTurboModule::GetConnectionMetrics(msrn::ReactPromise<msrn::JSValue> &&result) noexcept {
+  auto metrics = m_resource->GetConnectionMetrics();
+  result.Resolve(msrn::JSValueObject{
+      {"preconnectsRequested", static_cast<int64_t>(metrics.PreconnectsRequested)},
+      {"preconnectsSkipped", static_cast<int64_t>(metrics.PreconnectsSkipped)},
+      {"preconnectsSucceeded", static_cast<int64_t>(metrics.PreconnectsSucceeded)},
+      {"preconnectsFailed", static_cast<int64_t>(metrics.PreconnectsFailed)},
+      {"preconnectTime", metrics.PreconnectTime},
+      {"warmRequests", static_cast<int64_t>(metrics.WarmRequests)},
+      {"coldRequests", static_cast<int64_t>(metrics.ColdRequests)}});
+}
+
 void HttpTurboModule::AddListener(string &&eventName) noexcept { /*NOOP*/
 }
 
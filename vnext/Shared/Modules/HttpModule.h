@@ -5,6 +5,7 @@
 
 #include <codegen/NativeNetworkingIOSSpec.g.h>
 #include <NativeModules.h>
+#include <Networking/HttpRequestScheduler.h>
 #include <Networking/IHttpResource.h>
 
 // Windows API
@@ -30,6 +31,13 @@ struct HttpTurboModule {
   REACT_METHOD(ClearCookies, L"clearCookies")
   void ClearCookies(std::function<void(bool)> const &callback) noexcept;
 
+  REACT_METHOD(Preconnect, L"preconnect")
+  void Preconnect(std::vector<std::string> &&urls) noexcept;
+
+  REACT_METHOD(GetConnectionMetrics, L"getConnectionMetrics")
+  void GetConnectionMetrics(
+      winrt::Microsoft::ReactNative::ReactPromise<winrt::Microsoft::ReactNative::JSValue> &&result) noexcept;
+
   REACT_METHOD(AddListener, L"addListener")
   void AddListener(std::string &&eventName) noexcept;
 
@@ -38,6 +46,7 @@ struct HttpTurboModule {
 
  private:
   std::shared_ptr<Networking::IHttpResource> m_resource;
+  std::shared_ptr<Networking::HttpRequestScheduler> m_scheduler;
   winrt::Microsoft::ReactNative::ReactContext m_context;
   int64_t m_requestId{0};
 };
@@ -0,0 +1,24 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Standard Library
+#include <cstdint>
+
+namespace Microsoft::React {
+
+/// <summary>
+/// Receives the {@link ResponseBody} in chunks, in the order they are read from the network.
+/// </summary>
+struct IResponseBodySink {
+  virtual ~IResponseBodySink() = default;
+
+  /// <summary>
+  /// Copies a chunk of the body into the destination of the sink.
+  /// The chunk is only valid for the duration of the call.
+  /// </summary>
+  virtual void Write(const uint8_t *data, size_t size) = 0;
+};
+
+} // namespace Microsoft::React
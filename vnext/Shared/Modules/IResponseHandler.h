@@ -1,14 +1,27 @@
 #pragma once
 
+#include "IResponseBodySink.h"
+
 // React Native Windows
 #include <JSValue.h>
 
 // Standard Library
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace Microsoft::React {
 
+/// <summary>
+/// Builds the JS body payload while the {@link ResponseBody} is being read.
+/// </summary>
+struct IResponseDataSink : IResponseBodySink {
+  /// <summary>
+  /// Returns the JS body payload, once the whole body has been written.
+  /// </summary>
+  virtual winrt::Microsoft::ReactNative::JSValueObject ToResponseData() = 0;
+};
+
 /// <summary>
 /// Allows adding custom handling to build the JS body payload from the {@link ResponseBody}.
 /// </summary>
@@ -22,6 +35,36 @@ struct IResponseHandler {
   /// Returns the JS body payload for the {@link ResponseBody}.
   /// </summary>
   virtual winrt::Microsoft::ReactNative::JSValueObject ToResponseData(std::vector<uint8_t> &&content) = 0;
+
+  /// <summary>
+  /// Returns a sink that builds the JS body payload from the chunks of the {@link ResponseBody}.
+  /// By default, gathers the body and passes it to ToResponseData.
+  /// </summary>
+  virtual std::unique_ptr<IResponseDataSink> CreateResponseDataSink();
 };
 
+namespace detail {
+
+class BufferedResponseDataSink final : public IResponseDataSink {
+  IResponseHandler &m_handler;
+  std::vector<uint8_t> m_content;
+
+ public:
+  BufferedResponseDataSink(IResponseHandler &handler) noexcept : m_handler{handler} {}
+
+  void Write(const uint8_t *data, size_t size) override {
+    m_content.insert(m_content.end(), data, data + size);
+  }
+
+  winrt::Microsoft::ReactNative::JSValueObject ToResponseData() override {
+    return m_handler.ToResponseData(std::move(m_content));
+  }
+};
+
+} // namespace detail
+
+inline std::unique_ptr<IResponseDataSink> IResponseHandler::CreateResponseDataSink() {
+  return std::make_unique<detail::BufferedResponseDataSink>(*this);
+}
+
 } // namespace Microsoft::React
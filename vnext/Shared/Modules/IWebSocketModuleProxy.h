@@ -4,8 +4,10 @@
 #pragma once
 
 // Standard Library
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Microsoft::React {
 
@@ -17,6 +19,10 @@ struct IWebSocketModuleProxy {
   virtual ~IWebSocketModuleProxy() noexcept {}
 
   virtual void SendBinary(std::string &&base64String, int64_t id) noexcept = 0;
+
+  virtual void SendBinary(std::vector<uint8_t> &&data, int64_t id) noexcept = 0;
+
+  virtual size_t GetBufferedAmount(int64_t id) noexcept = 0;
 };
 
 } // namespace Microsoft::React
@@ -0,0 +1,104 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "WebSocketArrayBufferMessages.h"
+
+// Standard Library
+#include <algorithm>
+
+using std::scoped_lock;
+using std::vector;
+
+namespace Microsoft::React {
+
+WebSocketArrayBufferMessages::WebSocketArrayBufferMessages() noexcept : WebSocketArrayBufferMessages(Options{}) {}
+
+WebSocketArrayBufferMessages::WebSocketArrayBufferMessages(Options options) noexcept : m_options{options} {}
+
+void WebSocketArrayBufferMessages::SetReceiving(int64_t socketId, bool isReceiving) noexcept {
+  if (!isReceiving) {
+    return Close(socketId);
+  }
+
+  scoped_lock lock{m_mutex};
+  m_sockets.try_emplace(socketId);
+}
+
+bool WebSocketArrayBufferMessages::IsReceiving(int64_t socketId) noexcept {
+  scoped_lock lock{m_mutex};
+  return m_sockets.count(socketId) > 0;
+}
+
+int64_t WebSocketArrayBufferMessages::Add(int64_t socketId, vector<uint8_t> &&message) noexcept {
+  scoped_lock lock{m_mutex};
+  auto messageId = ++m_nextMessageId;
+  auto socket = m_sockets.find(socketId);
+  if (socket == m_sockets.end()) {
+    // Stopped receiving since the message arrived, nothing takes it.
+    return messageId;
+  }
+
+  socket->second.MessageIds.push_back(messageId);
+  socket->second.Bytes += message.size();
+  m_messages.emplace(messageId, std::make_pair(socketId, std::move(message)));
+
+  // Keeps the newest message, even over MaxBytes.
+  while (socket->second.MessageIds.size() > m_options.MaxMessages ||
+         (socket->second.Bytes > m_options.MaxBytes && socket->second.MessageIds.size() > 1)) {
+    Drop(socket->second);
+  }
+
+  return messageId;
+}
+
+std::optional<vector<uint8_t>> WebSocketArrayBufferMessages::Take(int64_t messageId) noexcept {
+  scoped_lock lock{m_mutex};
+  auto message = m_messages.find(messageId);
+  if (message == m_messages.end()) {
+    return {};
+  }
+
+  auto bytes = std::move(message->second.second);
+  if (auto socket = m_sockets.find(message->second.first); socket != m_sockets.end()) {
+    // Messages are usually taken in order, so the ID is found first.
+    auto &ids = socket->second.MessageIds;
+    ids.erase(std::find(ids.begin(), ids.end(), messageId));
+    socket->second.Bytes -= bytes.size();
+  }
+  m_messages.erase(message);
+
+  return bytes;
+}
+
+void WebSocketArrayBufferMessages::Close(int64_t socketId) noexcept {
+  scoped_lock lock{m_mutex};
+  auto socket = m_sockets.find(socketId);
+  if (socket == m_sockets.end()) {
+    return;
+  }
+
+  for (auto messageId : socket->second.MessageIds) {
+    m_messages.erase(messageId);
+  }
+  m_sockets.erase(socket);
+}
+
+size_t WebSocketArrayBufferMessages::Count() noexcept {
+  scoped_lock lock{m_mutex};
+  return m_messages.size();
+}
+
+size_t WebSocketArrayBufferMessages::DroppedCount() noexcept {
+  scoped_lock lock{m_mutex};
+  return m_droppedCount;
+}
+
+void WebSocketArrayBufferMessages::Drop(Socket &socket) noexcept {
+  auto message = m_messages.find(socket.MessageIds.front());
+  socket.Bytes -= message->second.second.size();
+  m_messages.erase(message);
+  socket.MessageIds.pop_front();
+  m_droppedCount++;
+}
+
+} // namespace Microsoft::React
@@ -0,0 +1,67 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Standard Library
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Microsoft::React {
+
+/// <summary>
+/// Keeps the binary messages of the sockets that receive ArrayBuffers, until JavaScript takes them.
+/// A socket keeps at most MaxMessages untaken messages of at most MaxBytes in total; older ones are dropped
+/// first, so that a socket JavaScript does not take messages from does not keep all of them.
+/// </summary>
+class WebSocketArrayBufferMessages final {
+ public:
+  struct Options {
+    size_t MaxMessages{1024};
+    size_t MaxBytes{16 * 1024 * 1024};
+  };
+
+  WebSocketArrayBufferMessages() noexcept;
+
+  WebSocketArrayBufferMessages(Options options) noexcept;
+
+  void SetReceiving(int64_t socketId, bool isReceiving) noexcept;
+
+  bool IsReceiving(int64_t socketId) noexcept;
+
+  // Returns the ID JavaScript takes the message with.
+  int64_t Add(int64_t socketId, std::vector<uint8_t> &&message) noexcept;
+
+  std::optional<std::vector<uint8_t>> Take(int64_t messageId) noexcept;
+
+  // Stops receiving for a socket that closed or failed, and drops the messages JavaScript did not take.
+  void Close(int64_t socketId) noexcept;
+
+  size_t Count() noexcept;
+
+  // Messages dropped over the bounds of their socket.
+  size_t DroppedCount() noexcept;
+
+ private:
+  struct Socket {
+    std::deque<int64_t> MessageIds; // Oldest first
+    size_t Bytes{0};
+  };
+
+  // Must be called with the lock held.
+  void Drop(Socket &socket) noexcept;
+
+  Options m_options;
+  std::mutex m_mutex;
+  std::unordered_map<int64_t, Socket> m_sockets;
+  std::unordered_map<int64_t, std::pair<int64_t, std::vector<uint8_t>>> m_messages; // Socket and bytes, by message ID
+  int64_t m_nextMessageId{0};
+  size_t m_droppedCount{0};
+};
+
+} // namespace Microsoft::React
@@ -5,7 +5,9 @@
 
 #include <Modules/WebSocketModule.h>
 
+#include <Base64.h>
 #include <CreateModules.h>
+#include <JSI/JsiApiContext.h>
 #include <Modules/CxxModuleUtilities.h>
 #include <Modules/IWebSocketModuleContentHandler.h>
 #include <ReactPropertyBag.h>
@@ -18,8 +20,12 @@
 #include <winrt/Windows.Security.Cryptography.h>
 
 // Standard Library
+#include <algorithm>
 #include <iomanip>
+#include <limits>
+#include <optional>
 
+namespace jsi = facebook::jsi;
 namespace msrn = winrt::Microsoft::ReactNative;
 using folly::dynamic;
 
@@ -45,12 +51,47 @@ constexpr wchar_t s_moduleNameW[] = L"WebSocketModule";
 
 msrn::ReactModuleProvider s_moduleProvider = msrn::MakeTurboModuleProvider<Microsoft::React::WebSocketTurboModule>();
 
+// Lends the bytes of a received message to an ArrayBuffer, without copying them.
+class ByteVectorBuffer final : public jsi::MutableBuffer {
+  vector<uint8_t> m_data;
+
+ public:
+  ByteVectorBuffer(vector<uint8_t> &&data) noexcept : m_data{std::move(data)} {}
+
+  size_t size() const override {
+    return m_data.size();
+  }
+
+  uint8_t *data() override {
+    return m_data.data();
+  }
+};
+
+string EncodeBase64(const vector<uint8_t> &bytes) {
+  string result(Microsoft::React::Utilities::Base64EncodedSize(bytes.size()), '\0');
+  Microsoft::React::Utilities::EncodeBase64Into(
+      std::string_view(reinterpret_cast<const char *>(bytes.data()), bytes.size()), result.data());
+
+  return result;
+}
+
+void SetGlobalFunction(jsi::Runtime &runtime, const char *name, unsigned int paramCount, jsi::HostFunctionType &&fn) {
+  runtime.global().setProperty(
+      runtime,
+      name,
+      jsi::Function::createFromHostFunction(
+          runtime, jsi::PropNameID::forAscii(runtime, name), paramCount, std::move(fn)));
+}
+
 } // anonymous namespace
 
 namespace Microsoft::React {
 
 #pragma region WebSocketTurboModule
 
+WebSocketTurboModule::WebSocketTurboModule() noexcept
+    : m_arrayBufferMessages{std::make_shared<WebSocketArrayBufferMessages>()} {}
+
 shared_ptr<IWebSocketResource> WebSocketTurboModule::CreateResource(int64_t id, string &&url) noexcept {
   shared_ptr<IWebSocketResource> rc;
   try {
@@ -106,16 +147,59 @@ shared_ptr<IWebSocketResource> WebSocketTurboModule::CreateResource(int64_t id,
     SendEvent(context, L"websocketMessage", std::move(args));
   });
 
-  rc->SetOnClose([id, context = m_context](IWebSocketResource::CloseCode code, const string &reason) {
+  rc->SetOnBinaryMessage([id, context = m_context, messages = m_arrayBufferMessages](vector<uint8_t> &&message) {
+    auto args = msrn::JSValueObject{{"id", id}, {"type", "binary"}};
+    if (messages->IsReceiving(id)) {
+      // JavaScript takes the bytes through __webSocketTakeArrayBuffer.
+      args["arrayBufferId"] = messages->Add(id, std::move(message));
+
+      return SendEvent(context, L"websocketMessage", std::move(args));
+    }
+
+    shared_ptr<IWebSocketModuleContentHandler> contentHandler;
+    if (auto prop = context.Properties().Get(BlobModuleContentHandlerPropertyId()))
+      contentHandler = prop.Value().lock();
+
+    if (contentHandler && contentHandler->CanHandleSocket(id)) {
+      contentHandler->ProcessMessage(std::move(message), args);
+    } else {
+      args["data"] = EncodeBase64(message);
+    }
+
+    SendEvent(context, L"websocketMessage", std::move(args));
+  });
+
+  // The messages JavaScript did not take are dropped on the JavaScript thread, so that the message events
+  // dispatched there meanwhile can still take theirs.
+  auto weakMessages = weak_ptr<WebSocketArrayBufferMessages>{m_arrayBufferMessages};
+  auto dropMessages = [id, context = m_context, weakMessages]() {
+    context.JSDispatcher().Post([id, messages = weakMessages]() {
+      if (auto strongMessages = messages.lock()) {
+        strongMessages->Close(id);
+      }
+    });
+  };
+
+  rc->SetOnClose([id, context = m_context, dropMessages](IWebSocketResource::CloseCode code, const string &reason) {
     auto args = msrn::JSValueObject{{"id", id}, {"code", static_cast<uint16_t>(code)}, {"reason", reason}};
 
     SendEvent(context, L"websocketClosed", std::move(args));
+    dropMessages();
   });
 
-  rc->SetOnError([id, context = m_context](const IWebSocketResource::Error &err) {
+  rc->SetOnError([id, context = m_context, dropMessages](const IWebSocketResource::Error &err) {
     auto errorObj = msrn::JSValueObject{{"id", id}, {"message", err.Message}};
 
     SendEvent(context, L"websocketFailed", std::move(errorObj));
+    dropMessages();
+  });
+
+  // Native only: the WebSocket class of react-native does not listen to this event. Code that pauses its sends
+  // subscribes to it through the WebSocketModule event emitter, and resumes on {paused: false}.
+  rc->SetOnBackpressure([id, context = m_context](bool isPaused) {
+    auto args = msrn::JSValueObject{{"id", id}, {"paused", isPaused}};
+
+    SendEvent(context, L"websocketBackpressure", std::move(args));
   });
 
   m_resourceMap.emplace(static_cast<double>(id), rc);
@@ -125,12 +209,119 @@ shared_ptr<IWebSocketResource> WebSocketTurboModule::CreateResource(int64_t id,
 
 void WebSocketTurboModule::Initialize(msrn::ReactContext const &reactContext) noexcept {
   m_context = reactContext.Handle();
-  m_proxy = std::make_shared<WebSocketTurboModuleProxy>(m_resourceMap);
 
   auto proxy = weak_ptr<IWebSocketModuleProxy>{m_proxy};
   m_context.Properties().Set(WebSocketModuleProxyPropertyId(), std::move(proxy));
 }
 
+void WebSocketTurboModule::InitializeJsi(msrn::ReactContext const & /*reactContext*/, jsi::Runtime &runtime) noexcept {
+  auto proxy = weak_ptr<IWebSocketModuleProxy>{m_proxy};
+  auto messages = weak_ptr<WebSocketArrayBufferMessages>{m_arrayBufferMessages};
+
+  // The functions below are native only: the WebSocket class of react-native still sends and receives binary
+  // messages as Base64. Apps and libraries call them directly to skip the Base64 round trips.
+
+  // __webSocketSendArrayBuffer(socketID, data)
+  // Sends an ArrayBuffer, a typed array or a DataView as a binary message.
+  SetGlobalFunction(
+      runtime,
+      "__webSocketSendArrayBuffer",
+      2,
+      [proxy](jsi::Runtime &rt, const jsi::Value & /*thisVal*/, const jsi::Value *args, size_t count) {
+        if (count < 2 || !args[0].isNumber() || !args[1].isObject()) {
+          throw jsi::JSError(rt, "__webSocketSendArrayBuffer expects a socket ID and an ArrayBuffer");
+        }
+
+        auto object = args[1].getObject(rt);
+        size_t offset = 0;
+        auto size = std::numeric_limits<size_t>::max();
+        if (!object.isArrayBuffer(rt)) {
+          offset = static_cast<size_t>(object.getProperty(rt, "byteOffset").asNumber());
+          size = static_cast<size_t>(object.getProperty(rt, "byteLength").asNumber());
+          object = object.getPropertyAsObject(rt, "buffer");
+        }
+
+        auto buffer = object.getArrayBuffer(rt);
+        auto bufferSize = buffer.size(rt);
+        if (offset > bufferSize) {
+          throw jsi::JSError(rt, "__webSocketSendArrayBuffer got a view out of the bounds of its buffer");
+        }
+        size = std::min(size, bufferSize - offset);
+
+        // The bytes are copied once out of the JavaScript heap, and the resource writes that copy.
+        auto data = buffer.data(rt) + offset;
+        if (auto strongProxy = proxy.lock()) {
+          strongProxy->SendBinary(vector<uint8_t>(data, data + size), static_cast<int64_t>(args[0].getNumber()));
+        }
+
+        return jsi::Value::undefined();
+      });
+
+  // __webSocketBufferedAmount(socketID)
+  // Returns the number of bytes sent and not written to the network yet. The WebSocket class of react-native does
+  // not read it for bufferedAmount.
+  SetGlobalFunction(
+      runtime,
+      "__webSocketBufferedAmount",
+      1,
+      [proxy](jsi::Runtime &rt, const jsi::Value & /*thisVal*/, const jsi::Value *args, size_t count) {
+        if (count < 1 || !args[0].isNumber()) {
+          throw jsi::JSError(rt, "__webSocketBufferedAmount expects a socket ID");
+        }
+
+        size_t bufferedAmount = 0;
+        if (auto strongProxy = proxy.lock()) {
+          bufferedAmount = strongProxy->GetBufferedAmount(static_cast<int64_t>(args[0].getNumber()));
+        }
+
+        return jsi::Value{static_cast<double>(bufferedAmount)};
+      });
+
+  // __webSocketReceiveArrayBuffers(socketID, isReceiving)
+  // Makes the binary messages of the socket carry an arrayBufferId rather than Base64 data.
+  SetGlobalFunction(
+      runtime,
+      "__webSocketReceiveArrayBuffers",
+      2,
+      [messages](jsi::Runtime &rt, const jsi::Value & /*thisVal*/, const jsi::Value *args, size_t count) {
+        if (count < 2 || !args[0].isNumber() || !args[1].isBool()) {
+          throw jsi::JSError(rt, "__webSocketReceiveArrayBuffers expects a socket ID and a boolean");
+        }
+
+        if (auto strongMessages = messages.lock()) {
+          strongMessages->SetReceiving(static_cast<int64_t>(args[0].getNumber()), args[1].getBool());
+        }
+
+        return jsi::Value::undefined();
+      });
+
+  // __webSocketTakeArrayBuffer(arrayBufferId)
+  // Returns the bytes of a received message as an ArrayBuffer, or undefined if already taken.
+  SetGlobalFunction(
+      runtime,
+      "__webSocketTakeArrayBuffer",
+      1,
+      [messages](jsi::Runtime &rt, const jsi::Value & /*thisVal*/, const jsi::Value *args, size_t count) {
+        if (count < 1 || !args[0].isNumber()) {
+          throw jsi::JSError(rt, "__webSocketTakeArrayBuffer expects an ArrayBuffer ID");
+        }
+
+        auto strongMessages = messages.lock();
+        if (!strongMessages) {
+          return jsi::Value::undefined();
+        }
+
+        auto bytes = strongMessages->Take(static_cast<int64_t>(args[0].getNumber()));
+        if (!bytes) {
+          return jsi::Value::undefined();
+        }
+
+        jsi::Object arrayBuffer = jsi::ArrayBuffer{rt, std::make_shared<ByteVectorBuffer>(std::move(*bytes))};
+
+        return jsi::Value{std::move(arrayBuffer)};
+      });
+}
+
 void WebSocketTurboModule::Connect(
     string &&url,
     std::optional<vector<string>> protocols,
@@ -240,6 +431,29 @@ void WebSocketTurboModuleProxy::SendBinary(string &&base64String, int64_t id) no
   }
 }
 
+void WebSocketTurboModuleProxy::SendBinary(vector<uint8_t> &&data, int64_t id) noexcept /*override*/
+{
+  auto rcItr = m_resourceMap.find(static_cast<double>(id));
+  if (rcItr == m_resourceMap.cend()) {
+    return;
+  }
+
+  weak_ptr<IWebSocketResource> weakRc = (*rcItr).second;
+  if (auto rc = weakRc.lock()) {
+    rc->SendBytes(std::move(data));
+  }
+}
+
+size_t WebSocketTurboModuleProxy::GetBufferedAmount(int64_t id) noexcept /*override*/
+{
+  auto rcItr = m_resourceMap.find(static_cast<double>(id));
+  if (rcItr == m_resourceMap.cend()) {
+    return 0;
+  }
+
+  return (*rcItr).second->GetBufferedAmount();
+}
+
 #pragma region WebSocketTurboModule
 
 /*extern*/ const wchar_t *GetWebSocketTurboModuleName() noexcept {
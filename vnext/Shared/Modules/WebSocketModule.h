@@ -4,33 +4,30 @@
 #pragma once
 
 #include <codegen/NativeWebSocketModuleSpec.g.h>
-#include <Modules/IWebSocketModuleProxy.h>
+#include <Modules/WebSocketArrayBufferMessages.h>
+#include <Modules/WebSocketTurboModuleProxy.h>
 #include <NativeModules.h>
 #include <Networking/IWebSocketResource.h>
 
 namespace Microsoft::React {
 
-class WebSocketTurboModuleProxy final : public IWebSocketModuleProxy {
-  std::unordered_map<double, std::shared_ptr<Networking::IWebSocketResource>> &m_resourceMap;
-
- public:
-  WebSocketTurboModuleProxy(
-      std::unordered_map<double, std::shared_ptr<Networking::IWebSocketResource>> &resourceMap) noexcept;
-
-#pragma region IWebSocketModuleProxy
-
-  void SendBinary(std::string &&base64String, int64_t id) noexcept override;
-
-#pragma endregion
-};
-
 REACT_MODULE(WebSocketTurboModule, L"WebSocketModule")
 struct WebSocketTurboModule {
   using ModuleSpec = ReactNativeSpecs::WebSocketModuleSpec;
 
+  WebSocketTurboModule() noexcept;
+
   REACT_INIT(Initialize)
   void Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept;
 
+  /// <summary>
+  /// Installs the JSI functions that send and receive binary messages as ArrayBuffers, without Base64 encoding.
+  /// </summary>
+  REACT_INIT(InitializeJsi)
+  void InitializeJsi(
+      winrt::Microsoft::ReactNative::ReactContext const &reactContext,
+      facebook::jsi::Runtime &runtime) noexcept;
+
   REACT_METHOD(Connect, L"connect")
   void Connect(
       std::string &&url,
@@ -65,7 +62,12 @@ struct WebSocketTurboModule {
   /// <summary>
   /// Exposes a subset of the module's methods.
   /// </summary>
-  std::shared_ptr<IWebSocketModuleProxy> m_proxy;
+  std::shared_ptr<IWebSocketModuleProxy> m_proxy{std::make_shared<WebSocketTurboModuleProxy>(m_resourceMap)};
+
+  /// <summary>
+  /// Binary messages received for JavaScript as ArrayBuffers.
+  /// </summary>
+  std::shared_ptr<WebSocketArrayBufferMessages> m_arrayBufferMessages;
 };
 
 } // namespace Microsoft::React
@@ -0,0 +1,33 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <Modules/IWebSocketModuleProxy.h>
+#include <Networking/IWebSocketResource.h>
+
+// Standard Library
+#include <memory>
+#include <unordered_map>
+
+namespace Microsoft::React {
+
+class WebSocketTurboModuleProxy final : public IWebSocketModuleProxy {
+  std::unordered_map<double, std::shared_ptr<Networking::IWebSocketResource>> &m_resourceMap;
+
+ public:
+  WebSocketTurboModuleProxy(
+      std::unordered_map<double, std::shared_ptr<Networking::IWebSocketResource>> &resourceMap) noexcept;
+
+#pragma region IWebSocketModuleProxy
+
+  void SendBinary(std::string &&base64String, int64_t id) noexcept override;
+
+  void SendBinary(std::vector<uint8_t> &&data, int64_t id) noexcept override;
+
+  size_t GetBufferedAmount(int64_t id) noexcept override;
+
+#pragma endregion
+};
+
+} // namespace Microsoft::React
@@ -0,0 +1,147 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CaseInsensitiveNameSet.h"
+
+// Standard Library
+#include <algorithm>
+
+using std::vector;
+using std::wstring;
+using std::wstring_view;
+
+namespace {
+
+constexpr wchar_t ToLowerAscii(wchar_t c) noexcept {
+  return c >= L'A' && c <= L'Z' ? static_cast<wchar_t>(c - L'A' + L'a') : c;
+}
+
+// FNV-1a over the lowercased characters, then a final mix so the low bits depend on the whole name.
+uint32_t HashLowercase(wstring_view name, uint32_t seed) noexcept {
+  uint32_t hash = 2166136261u ^ (seed * 0x9E3779B9u);
+  for (const auto c : name) {
+    hash ^= static_cast<uint32_t>(ToLowerAscii(c));
+    hash *= 16777619u;
+  }
+
+  hash ^= hash >> 16;
+  hash *= 0x7FEB352Du;
+  hash ^= hash >> 15;
+
+  return hash;
+}
+
+// Seeds tried for a table size before doubling it.
+constexpr uint32_t MaxSeedsPerSize = 64;
+
+} // namespace
+
+namespace Microsoft::React::Networking {
+
+#pragma region CaseInsensitiveHash
+
+size_t CaseInsensitiveHash::operator()(wstring_view name) const noexcept {
+  return HashLowercase(name, 0);
+}
+
+#pragma endregion CaseInsensitiveHash
+
+#pragma region CaseInsensitiveEqual
+
+bool CaseInsensitiveEqual::operator()(wstring_view a, wstring_view b) const noexcept {
+  return a.size() == b.size() && std::equal(a.cbegin(), a.cend(), b.cbegin(), [](wchar_t x, wchar_t y) noexcept {
+           return ToLowerAscii(x) == ToLowerAscii(y);
+         });
+}
+
+#pragma endregion CaseInsensitiveEqual
+
+#pragma region CaseInsensitiveNameSet
+
+CaseInsensitiveNameSet::CaseInsensitiveNameSet() noexcept {}
+
+CaseInsensitiveNameSet::CaseInsensitiveNameSet(std::initializer_list<wstring_view> names) {
+  m_names.reserve(names.size());
+  for (const auto name : names) {
+    m_names.emplace_back(name);
+  }
+
+  Build();
+}
+
+CaseInsensitiveNameSet::CaseInsensitiveNameSet(vector<wstring> &&names) : m_names{std::move(names)} {
+  Build();
+}
+
+bool CaseInsensitiveNameSet::Contains(wstring_view name) const noexcept {
+  if (m_names.empty()) {
+    return false;
+  }
+
+  const auto slot = m_slots[Hash(name, m_seed) & (m_slots.size() - 1)];
+  if (slot < 0) {
+    return false;
+  }
+
+  const auto &candidate = m_names[slot];
+  return candidate.size() == name.size() &&
+      std::equal(name.cbegin(), name.cend(), candidate.cbegin(), [](wchar_t a, wchar_t b) noexcept {
+           return ToLowerAscii(a) == b;
+         });
+}
+
+const vector<wstring> &CaseInsensitiveNameSet::Names() const noexcept {
+  return m_names;
+}
+
+size_t CaseInsensitiveNameSet::Size() const noexcept {
+  return m_names.size();
+}
+
+bool CaseInsensitiveNameSet::Empty() const noexcept {
+  return m_names.empty();
+}
+
+/*static*/ uint32_t CaseInsensitiveNameSet::Hash(wstring_view name, uint32_t seed) noexcept {
+  return HashLowercase(name, seed);
+}
+
+void CaseInsensitiveNameSet::Build() {
+  for (auto &name : m_names) {
+    std::transform(name.begin(), name.end(), name.begin(), ToLowerAscii);
+  }
+  std::sort(m_names.begin(), m_names.end());
+  m_names.erase(std::unique(m_names.begin(), m_names.end()), m_names.end());
+
+  if (m_names.empty()) {
+    return;
+  }
+
+  size_t size = 1;
+  while (size < m_names.size() * 2) {
+    size <<= 1;
+  }
+
+  // Look for a seed that gives every name its own slot. Doubling the table makes one more likely.
+  for (;; size <<= 1) {
+    for (uint32_t seed = 0; seed < MaxSeedsPerSize; seed++) {
+      m_slots.assign(size, -1);
+
+      bool isPerfect = true;
+      for (size_t i = 0; i < m_names.size() && isPerfect; i++) {
+        auto &slot = m_slots[Hash(m_names[i], seed) & (size - 1)];
+        isPerfect = slot < 0;
+        slot = static_cast<int32_t>(i);
+      }
+
+      if (isPerfect) {
+        m_seed = seed;
+        return;
+      }
+    }
+  }
+}
+
+#pragma endregion CaseInsensitiveNameSet
+
+} // namespace Microsoft::React::Networking
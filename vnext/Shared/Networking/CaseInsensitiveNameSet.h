@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Standard Library
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace Microsoft::React::Networking {
+
+struct CaseInsensitiveHash {
+  using is_transparent = void;
+
+  size_t operator()(std::wstring_view name) const noexcept;
+};
+
+struct CaseInsensitiveEqual {
+  using is_transparent = void;
+
+  bool operator()(std::wstring_view a, std::wstring_view b) const noexcept;
+};
+
+/// <summary>
+/// Set of HTTP tokens compared without regard to ASCII case, for lists only
+/// known at run time, such as those of response headers.
+/// </summary>
+using CaseInsensitiveNames = std::unordered_set<std::wstring, CaseInsensitiveHash, CaseInsensitiveEqual>;
+
+/// <summary>
+/// Immutable set of HTTP tokens (method names, header names, media types),
+/// compared without regard to ASCII case.
+///
+/// The names are lowercased once, and placed in a table by a hash seeded so
+/// that no two names share a slot. A lookup then costs one hash of the name
+/// and at most one comparison. Finding the seed takes time, so this is meant
+/// for the fixed lists of the Fetch standard; see CaseInsensitiveNames for
+/// the others.
+/// </summary>
+class CaseInsensitiveNameSet final {
+ public:
+  CaseInsensitiveNameSet() noexcept;
+
+  CaseInsensitiveNameSet(std::initializer_list<std::wstring_view> names);
+
+  CaseInsensitiveNameSet(std::vector<std::wstring> &&names);
+
+  bool Contains(std::wstring_view name) const noexcept;
+
+  /// <summary>
+  /// The names, lowercased and without duplicates.
+  /// </summary>
+  const std::vector<std::wstring> &Names() const noexcept;
+
+  size_t Size() const noexcept;
+
+  bool Empty() const noexcept;
+
+ private:
+  static uint32_t Hash(std::wstring_view name, uint32_t seed) noexcept;
+
+  void Build();
+
+  std::vector<std::wstring> m_names;
+
+  // Index into m_names, or -1 for an empty slot. The size is a power of two.
+  std::vector<int32_t> m_slots;
+  uint32_t m_seed{0};
+};
+
+} // namespace Microsoft::React::Networking
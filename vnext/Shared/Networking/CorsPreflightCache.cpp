@@ -0,0 +1,110 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CorsPreflightCache.h"
+
+// Boost Library
+#include <boost/algorithm/string.hpp>
+
+// Standard Library
+#include <algorithm>
+#include <chrono>
+
+using std::scoped_lock;
+using std::vector;
+using std::wstring;
+using std::wstring_view;
+
+namespace Microsoft::React::Networking {
+
+CorsPreflightCache::CorsPreflightCache() noexcept : CorsPreflightCache(Options{}) {}
+
+CorsPreflightCache::CorsPreflightCache(Options options) noexcept : m_options{std::move(options)} {
+  m_options.MaxEntries = std::max<size_t>(m_options.MaxEntries, 1);
+}
+
+void CorsPreflightCache::Insert(
+    const wstring &origin,
+    const wstring &url,
+    bool withCredentials,
+    int64_t maxAge,
+    CaseInsensitiveNames &&methods,
+    CaseInsensitiveNames &&headers) noexcept {
+  if (maxAge <= 0) {
+    return;
+  }
+
+  const auto now = Now();
+  const auto expiry = now + std::min(maxAge, m_options.MaxAge) * 1000;
+  auto key = MakeKey(origin, url, withCredentials);
+
+  scoped_lock lock{m_mutex};
+  if (m_entries.size() >= m_options.MaxEntries && m_entries.find(key) == m_entries.end()) {
+    for (auto entry = m_entries.begin(); entry != m_entries.end();) {
+      entry = entry->second.Expiry <= now ? m_entries.erase(entry) : std::next(entry);
+    }
+
+    if (m_entries.size() >= m_options.MaxEntries) {
+      m_entries.erase(std::min_element(m_entries.begin(), m_entries.end(), [](const auto &a, const auto &b) {
+        return a.second.Expiry < b.second.Expiry;
+      }));
+    }
+  }
+
+  m_entries.insert_or_assign(std::move(key), Entry{std::move(methods), std::move(headers), expiry});
+}
+
+bool CorsPreflightCache::Matches(
+    const wstring &origin,
+    const wstring &url,
+    bool withCredentials,
+    wstring_view method,
+    const vector<wstring_view> &headerNames) const noexcept {
+  static const CaseInsensitiveNameSet simpleMethods{L"GET", L"HEAD", L"POST"};
+
+  const auto key = MakeKey(origin, url, withCredentials);
+
+  scoped_lock lock{m_mutex};
+  auto entry = m_entries.find(key);
+  if (entry == m_entries.end() || entry->second.Expiry <= Now()) {
+    return false;
+  }
+
+  const auto &methods = entry->second.Methods;
+  if (!simpleMethods.Contains(method) && !methods.contains(method) && (withCredentials || !methods.contains(L"*"))) {
+    return false;
+  }
+
+  // "Authorization" cannot be allowed through the wildcard alone.
+  const auto &headers = entry->second.Headers;
+  const auto allowsAnyHeader = !withCredentials && headers.contains(L"*");
+  return std::all_of(headerNames.cbegin(), headerNames.cend(), [&headers, allowsAnyHeader](wstring_view name) {
+    return headers.contains(name) || (allowsAnyHeader && !boost::iequals(name, L"Authorization"));
+  });
+}
+
+void CorsPreflightCache::Clear() noexcept {
+  scoped_lock lock{m_mutex};
+  m_entries.clear();
+}
+
+size_t CorsPreflightCache::Size() const noexcept {
+  scoped_lock lock{m_mutex};
+  return m_entries.size();
+}
+
+/*static*/ wstring CorsPreflightCache::MakeKey(const wstring &origin, const wstring &url, bool withCredentials) {
+  // Origins and URLs have no spaces.
+  return origin + L' ' + url + (withCredentials ? L" include" : L" omit");
+}
+
+int64_t CorsPreflightCache::Now() const noexcept {
+  if (m_options.Now) {
+    return m_options.Now();
+  }
+
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+} // namespace Microsoft::React::Networking
@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CaseInsensitiveNameSet.h"
+
+// Standard Library
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft::React::Networking {
+
+/// <summary>
+/// Remembers the methods and headers allowed by successful CORS preflight
+/// responses, so that later requests they cover can skip the preflight.
+/// See https://fetch.spec.whatwg.org/#concept-cache.
+///
+/// Entries are keyed by origin, request URL and whether credentials are sent,
+/// and last as long as the response's Access-Control-Max-Age, up to MaxAge.
+/// </summary>
+class CorsPreflightCache final {
+ public:
+  struct Options {
+    size_t MaxEntries{256};
+
+    // Upper bound of Access-Control-Max-Age, in seconds. Chromium also uses two hours.
+    int64_t MaxAge{2 * 60 * 60};
+
+    // Current time, in milliseconds. Defaults to a steady clock.
+    std::function<int64_t()> Now;
+  };
+
+  CorsPreflightCache() noexcept;
+
+  CorsPreflightCache(Options options) noexcept;
+
+  /// <param name="maxAge">
+  /// Seconds the entry is valid for. Entries with a maxAge of 0 or less are not stored.
+  /// </param>
+  void Insert(
+      const std::wstring &origin,
+      const std::wstring &url,
+      bool withCredentials,
+      int64_t maxAge,
+      CaseInsensitiveNames &&methods,
+      CaseInsensitiveNames &&headers) noexcept;
+
+  /// <summary>
+  /// Whether a valid entry allows the method and every header name, by the
+  /// same rules as the validation of a preflight response.
+  /// </summary>
+  bool Matches(
+      const std::wstring &origin,
+      const std::wstring &url,
+      bool withCredentials,
+      std::wstring_view method,
+      const std::vector<std::wstring_view> &headerNames) const noexcept;
+
+  void Clear() noexcept;
+
+  size_t Size() const noexcept;
+
+ private:
+  struct Entry {
+    CaseInsensitiveNames Methods;
+    CaseInsensitiveNames Headers;
+    int64_t Expiry;
+  };
+
+  static std::wstring MakeKey(const std::wstring &origin, const std::wstring &url, bool withCredentials);
+
+  int64_t Now() const noexcept;
+
+  Options m_options;
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<std::wstring, Entry> m_entries;
+};
+
+} // namespace Microsoft::React::Networking
@@ -3,24 +3,26 @@
 
 #include "DefaultBlobResource.h"
 
+#include <MemoryMappedBuffer.h>
 #include <Modules/IHttpModuleProxy.h>
 #include <Modules/IWebSocketModuleProxy.h>
-#include <utilities.h>
 #include "NetworkPropertyIds.h"
+#include "ResponseBodySinks.h"
 
 // Boost Libraries
 #include <boost/uuid/uuid_io.hpp>
 
 // Windows API
-#include <winrt/Windows.Security.Cryptography.h>
+#include <windows.h>
+
+// Standard Library
+#include <algorithm>
 
 using std::scoped_lock;
 using std::shared_ptr;
 using std::string;
 using std::vector;
 using std::weak_ptr;
-using winrt::array_view;
-using winrt::Windows::Security::Cryptography::CryptographicBuffer;
 
 namespace msrn = winrt::Microsoft::ReactNative;
 
@@ -29,6 +31,110 @@ namespace {
 constexpr Microsoft::React::Networking::IBlobResource::BlobFieldNames
     blobKeys{"blob", "blobId", "offset", "size", "type", "data"};
 
+// Message bytes held in memory, counted in the memory usage of their persistor while they are alive.
+class AccountedBlobChunk final : public Microsoft::React::BlobChunk {
+  vector<uint8_t> m_bytes;
+  shared_ptr<std::atomic<size_t>> m_memoryUsage;
+
+ public:
+  AccountedBlobChunk(vector<uint8_t> &&bytes, shared_ptr<std::atomic<size_t>> memoryUsage) noexcept
+      : m_bytes{std::move(bytes)}, m_memoryUsage{std::move(memoryUsage)} {
+    *m_memoryUsage += m_bytes.size();
+  }
+
+  ~AccountedBlobChunk() override {
+    *m_memoryUsage -= m_bytes.size();
+  }
+
+  const uint8_t *Data() const noexcept override {
+    return m_bytes.data();
+  }
+
+  size_t Size() const noexcept override {
+    return m_bytes.size();
+  }
+};
+
+// Message bytes written to a temporary file and memory mapped. The file is deleted with the chunk.
+class SpilledBlobChunk final : public Microsoft::React::BlobChunk {
+  std::unique_ptr<facebook::jsi::Buffer> m_buffer;
+  std::wstring m_path;
+
+ public:
+  SpilledBlobChunk(std::unique_ptr<facebook::jsi::Buffer> buffer, std::wstring &&path) noexcept
+      : m_buffer{std::move(buffer)}, m_path{std::move(path)} {}
+
+  ~SpilledBlobChunk() override {
+    m_buffer.reset();
+    DeleteFileW(m_path.c_str());
+  }
+
+  const uint8_t *Data() const noexcept override {
+    return m_buffer->data();
+  }
+
+  size_t Size() const noexcept override {
+    return m_buffer->size();
+  }
+};
+
+shared_ptr<const Microsoft::React::BlobChunk> SpillToDisk(const vector<uint8_t> &bytes, const string &name) {
+  wchar_t tempPath[MAX_PATH + 1];
+  const auto tempPathLength = GetTempPathW(MAX_PATH + 1, tempPath);
+  if (tempPathLength == 0 || tempPathLength > MAX_PATH) {
+    throw std::runtime_error("GetTempPathW failed with last error " + std::to_string(GetLastError()));
+  }
+  auto path = std::wstring{tempPath} + L"rnw-blob-" + std::wstring(name.cbegin(), name.cend()) + L".bin";
+
+  CREATEFILE2_EXTENDED_PARAMETERS createParams{};
+  createParams.dwSize = sizeof(createParams);
+  createParams.dwFileAttributes = FILE_ATTRIBUTE_TEMPORARY;
+  std::unique_ptr<void, decltype(&CloseHandle)> fileHandle{
+      CreateFile2(path.c_str(), GENERIC_WRITE, 0 /* ShareMode */, CREATE_NEW, &createParams), &CloseHandle};
+  if (fileHandle.get() == INVALID_HANDLE_VALUE) {
+    throw std::runtime_error("CreateFile2 failed with last error " + std::to_string(GetLastError()));
+  }
+
+  for (size_t offset = 0; offset < bytes.size();) {
+    const auto count = static_cast<DWORD>(std::min<size_t>(bytes.size() - offset, 1 << 30));
+    DWORD written = 0;
+    if (!WriteFile(fileHandle.get(), bytes.data() + offset, count, &written, nullptr /* Overlapped */)) {
+      const auto error = GetLastError();
+      fileHandle.reset();
+      DeleteFileW(path.c_str());
+      throw std::runtime_error("WriteFile failed with last error " + std::to_string(error));
+    }
+    offset += written;
+  }
+  fileHandle.reset();
+
+  try {
+    auto buffer = Microsoft::JSI::MakeMemoryMappedBuffer(path.c_str());
+    return std::make_shared<SpilledBlobChunk>(std::move(buffer), std::move(path));
+  } catch (...) {
+    DeleteFileW(path.c_str());
+    throw;
+  }
+}
+
+// Builds the blob of a response from its chunks, as they are read.
+class BlobResponseDataSink final : public Microsoft::React::IResponseDataSink {
+  Microsoft::React::Networking::BlobResponseBodySink m_body;
+
+ public:
+  BlobResponseDataSink(shared_ptr<Microsoft::React::IBlobPersistor> blobPersistor) noexcept
+      : m_body{std::move(blobPersistor)} {}
+
+  void Write(const uint8_t *data, size_t size) override {
+    m_body.Write(data, size);
+  }
+
+  msrn::JSValueObject ToResponseData() override {
+    const auto size = m_body.Size();
+    return {{blobKeys.Offset, 0}, {blobKeys.Size, size}, {blobKeys.BlobId, m_body.Store()}};
+  }
+};
+
 } // namespace
 
 namespace Microsoft::React::Networking {
@@ -84,47 +190,50 @@ void DefaultBlobResource::SendOverSocket(string &&blobId, int64_t offset, int64_
     return;
   }
 
-  array_view<uint8_t const> data;
+  BlobView data;
   try {
     data = m_blobPersistor->ResolveMessage(std::move(blobId), offset, size);
   } catch (const std::exception &e) {
     return m_callbacks.OnError(e.what());
   }
 
-  auto chars = reinterpret_cast<const char *>(data.data());
-  auto view = std::string_view(chars, data.size());
-  wsProxy->SendBinary(Utilities::EncodeBase64(view), socketId);
+  wsProxy->SendBinary(data.ToVector(), socketId);
 }
 
 void DefaultBlobResource::CreateFromParts(msrn::JSValueArray &&parts, string &&blobId) noexcept /*override*/ {
-  vector<uint8_t> buffer{};
+  // Blob parts are shared rather than copied. Consecutive string parts are gathered in one chunk.
+  BlobView blob;
+  vector<uint8_t> strings;
 
   for (const auto &partItem : parts) {
     auto &part = partItem.AsObject();
     auto type = part.at(blobKeys.Type).AsString();
     if (blobKeys.Blob == type) {
-      auto &blob = part.at(blobKeys.Data).AsObject();
-      array_view<uint8_t const> bufferPart;
+      auto &blobPart = part.at(blobKeys.Data).AsObject();
+      BlobView view;
       try {
-        bufferPart = m_blobPersistor->ResolveMessage(
-            blob.at(blobKeys.BlobId).AsString(), blob.at(blobKeys.Offset).AsInt64(), blob.at(blobKeys.Size).AsInt64());
+        view = m_blobPersistor->ResolveMessage(
+            blobPart.at(blobKeys.BlobId).AsString(),
+            blobPart.at(blobKeys.Offset).AsInt64(),
+            blobPart.at(blobKeys.Size).AsInt64());
       } catch (const std::exception &e) {
         return m_callbacks.OnError(e.what());
       }
 
-      buffer.reserve(buffer.size() + bufferPart.size());
-      buffer.insert(buffer.end(), bufferPart.begin(), bufferPart.end());
+      blob.Append(BlobView::FromBytes(std::move(strings)));
+      strings = {};
+      blob.Append(view);
     } else if ("string" == type) {
       auto data = part.at(blobKeys.Data).AsString();
 
-      buffer.reserve(buffer.size() + data.size());
-      buffer.insert(buffer.end(), data.begin(), data.end());
+      strings.insert(strings.end(), data.begin(), data.end());
     } else {
       return m_callbacks.OnError("Invalid type for blob: " + type);
     }
   }
+  blob.Append(BlobView::FromBytes(std::move(strings)));
 
-  m_blobPersistor->StoreMessage(std::move(buffer), std::move(blobId));
+  m_blobPersistor->StoreView(std::move(blob), std::move(blobId));
 }
 
 void DefaultBlobResource::Release(string &&blobId) noexcept /*override*/ {
@@ -167,49 +276,101 @@ IBlobResource::BlobCallbacks &DefaultBlobResource::Callbacks() noexcept /*overri
 
 #pragma region MemoryBlobPersistor
 
+MemoryBlobPersistor::MemoryBlobPersistor() noexcept : MemoryBlobPersistor(Options{}) {}
+
+MemoryBlobPersistor::MemoryBlobPersistor(Options options) noexcept
+    : m_options{options}, m_memoryUsage{std::make_shared<std::atomic<size_t>>(0)} {}
+
+size_t MemoryBlobPersistor::MemoryUsage() const noexcept {
+  return *m_memoryUsage;
+}
+
+MemoryBlobPersistor::Shard &MemoryBlobPersistor::ShardOf(const string &blobId) noexcept {
+  return m_shards[std::hash<string>{}(blobId) % ShardCount];
+}
+
+string MemoryBlobPersistor::NewGuid() noexcept {
+  scoped_lock lock{m_guidMutex};
+  return boost::uuids::to_string(m_guidGenerator());
+}
+
 #pragma region IBlobPersistor
 
-array_view<uint8_t const> MemoryBlobPersistor::ResolveMessage(string &&blobId, int64_t offset, int64_t size) {
+BlobView MemoryBlobPersistor::ResolveMessage(string &&blobId, int64_t offset, int64_t size) {
   if (size < 1)
     return {};
 
-  scoped_lock lock{m_mutex};
+  auto &shard = ShardOf(blobId);
+  scoped_lock lock{shard.Mutex};
 
-  auto dataItr = m_blobs.find(std::move(blobId));
+  auto dataItr = shard.Blobs.find(std::move(blobId));
   // Not found.
-  if (dataItr == m_blobs.cend())
+  if (dataItr == shard.Blobs.cend())
     throw std::invalid_argument("Blob object not found");
 
-  auto &bytes = (*dataItr).second;
+  auto &blob = (*dataItr).second;
   auto endBound = static_cast<size_t>(offset + size);
   // Out of bounds.
-  if (endBound > bytes.size() || offset >= static_cast<int64_t>(bytes.size()) || offset < 0)
+  if (endBound > blob.Size() || offset >= static_cast<int64_t>(blob.Size()) || offset < 0)
     throw std::out_of_range("Offset or size out of range");
 
-  return array_view<uint8_t const>(bytes.data() + offset, bytes.data() + endBound);
+  return blob.Slice(static_cast<size_t>(offset), static_cast<size_t>(size));
 }
 
 void MemoryBlobPersistor::RemoveMessage(string &&blobId) noexcept {
-  scoped_lock lock{m_mutex};
-
-  m_blobs.erase(std::move(blobId));
+  BlobView blob; // To release the chunks outside of the lock
+  auto &shard = ShardOf(blobId);
+  scoped_lock lock{shard.Mutex};
+
+  auto dataItr = shard.Blobs.find(blobId);
+  if (dataItr != shard.Blobs.end()) {
+    blob = std::move((*dataItr).second);
+    shard.Blobs.erase(dataItr);
+  }
 }
 
 void MemoryBlobPersistor::StoreMessage(vector<uint8_t> &&message, string &&blobId) noexcept {
-  scoped_lock lock{m_mutex};
-
-  m_blobs.insert_or_assign(std::move(blobId), std::move(message));
+  StoreView(MakeView(std::move(message)), std::move(blobId));
 }
 
 string MemoryBlobPersistor::StoreMessage(vector<uint8_t> &&message) noexcept {
-  auto blobId = boost::uuids::to_string(m_guidGenerator());
+  return StoreView(MakeView(std::move(message)));
+}
 
-  scoped_lock lock{m_mutex};
-  m_blobs.insert_or_assign(blobId, std::move(message));
+void MemoryBlobPersistor::StoreView(BlobView &&view, string &&blobId) noexcept {
+  BlobView replaced; // To release the chunks outside of the lock
+  auto &shard = ShardOf(blobId);
+  scoped_lock lock{shard.Mutex};
+
+  auto [dataItr, inserted] = shard.Blobs.try_emplace(std::move(blobId), std::move(view));
+  if (!inserted) {
+    replaced = std::exchange((*dataItr).second, std::move(view));
+  }
+}
+
+string MemoryBlobPersistor::StoreView(BlobView &&view) noexcept {
+  auto blobId = NewGuid();
+  StoreView(std::move(view), string{blobId});
 
   return blobId;
 }
 
+BlobView MemoryBlobPersistor::MakeView(vector<uint8_t> &&message) noexcept {
+  if (message.empty()) {
+    return {};
+  }
+
+  if (message.size() >= m_options.SpillThreshold && *m_memoryUsage + message.size() > m_options.MemoryBudget) {
+    try {
+      return BlobView::FromChunk(SpillToDisk(message, NewGuid()));
+    } catch (const std::exception &) {
+      // Keep the message in memory.
+    }
+  }
+
+  return BlobView::FromChunk(std::make_shared<AccountedBlobChunk>(std::move(message), m_memoryUsage));
+}
+
 #pragma endregion IBlobPersistor
 
 #pragma endregion MemoryBlobPersistor
@@ -322,13 +483,18 @@ msrn::JSValueObject BlobModuleRequestBodyHandler::ToRequestBody(
 
   auto &blob = data[blobKeys.Blob].AsObject();
   auto blobId = blob[blobKeys.BlobId].AsString();
-  auto bytes = m_blobPersistor->ResolveMessage(
+  auto view = m_blobPersistor->ResolveMessage(
       std::move(blobId), blob[blobKeys.Offset].AsInt64(), blob[blobKeys.Size].AsInt64());
 
-  return {
-      {blobKeys.Type, type},
-      {blobKeys.Size, bytes.size()},
-      {"bytes", msrn::JSValueArray(bytes.cbegin(), bytes.cend())}};
+  msrn::JSValueArray bytes;
+  bytes.reserve(view.Size());
+  for (const auto &segment : view.Segments()) {
+    for (size_t i = 0; i < segment.Size; i++) {
+      bytes.push_back(segment.Data()[i]);
+    }
+  }
+
+  return {{blobKeys.Type, type}, {blobKeys.Size, view.Size()}, {"bytes", std::move(bytes)}};
 }
 
 #pragma endregion IRequestBodyHandler
@@ -353,6 +519,10 @@ msrn::JSValueObject BlobModuleResponseHandler::ToResponseData(vector<uint8_t> &&
       {blobKeys.BlobId, m_blobPersistor->StoreMessage(std::move(content))}};
 }
 
+std::unique_ptr<IResponseDataSink> BlobModuleResponseHandler::CreateResponseDataSink() /*override*/ {
+  return std::make_unique<BlobResponseDataSink>(m_blobPersistor);
+}
+
 #pragma endregion IResponseHandler
 
 #pragma endregion BlobModuleResponseHandler
@@ -17,20 +17,40 @@
 #include <boost/uuid/uuid_generators.hpp>
 
 // Standard Library
+#include <array>
+#include <atomic>
 #include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace Microsoft::React::Networking {
 
+/// <summary>
+/// Stores blobs as ropes of immutable chunks (see BlobView).
+///
+/// Slices of a blob and blobs made of other blobs share their chunks rather
+/// than copying them. Blobs are spread over shards that each have their own
+/// lock. Messages at least SpillThreshold large that are stored once the
+/// messages in memory exceed MemoryBudget are written to a temporary file and
+/// memory mapped, so that their pages can be evicted to the file rather than
+/// held in private memory.
+/// </summary>
 class MemoryBlobPersistor final : public IBlobPersistor {
-  std::unordered_map<std::string, std::vector<uint8_t>> m_blobs;
-  std::mutex m_mutex;
-  boost::uuids::random_generator m_guidGenerator;
-
  public:
+  struct Options {
+    size_t MemoryBudget{256 * 1024 * 1024};
+    size_t SpillThreshold{4 * 1024 * 1024};
+  };
+
+  MemoryBlobPersistor() noexcept;
+  MemoryBlobPersistor(Options options) noexcept;
+
+  // Bytes of the stored messages held in memory, including those only referenced by views.
+  size_t MemoryUsage() const noexcept;
+
 #pragma region IBlobPersistor
 
-  winrt::array_view<uint8_t const> ResolveMessage(std::string &&blobId, int64_t offset, int64_t size) override;
+  BlobView ResolveMessage(std::string &&blobId, int64_t offset, int64_t size) override;
 
   void RemoveMessage(std::string &&blobId) noexcept override;
 
@@ -38,7 +58,31 @@ class MemoryBlobPersistor final : public IBlobPersistor {
 
   std::string StoreMessage(std::vector<uint8_t> &&message) noexcept override;
 
+  void StoreView(BlobView &&view, std::string &&blobId) noexcept override;
+
+  std::string StoreView(BlobView &&view) noexcept override;
+
+  BlobView MakeView(std::vector<uint8_t> &&message) noexcept override;
+
 #pragma endregion IBlobPersistor
+
+ private:
+  static constexpr size_t ShardCount = 16;
+
+  struct Shard {
+    std::mutex Mutex;
+    std::unordered_map<std::string, BlobView> Blobs;
+  };
+
+  Shard &ShardOf(const std::string &blobId) noexcept;
+
+  std::string NewGuid() noexcept;
+
+  Options m_options;
+  std::array<Shard, ShardCount> m_shards;
+  std::shared_ptr<std::atomic<size_t>> m_memoryUsage;
+  std::mutex m_guidMutex;
+  boost::uuids::random_generator m_guidGenerator;
 };
 
 class BlobWebSocketModuleContentHandler final : public IWebSocketModuleContentHandler {
@@ -104,6 +148,8 @@ class BlobModuleResponseHandler final : public IResponseHandler {
 
   winrt::Microsoft::ReactNative::JSValueObject ToResponseData(std::vector<uint8_t> &&content) override;
 
+  std::unique_ptr<IResponseDataSink> CreateResponseDataSink() override;
+
 #pragma endregion IResponseHandler
 };
 
@@ -0,0 +1,366 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "DiskHttpCacheStore.h"
+
+// Standard Library
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace fs = std::filesystem;
+
+using std::optional;
+using std::scoped_lock;
+using std::string;
+using std::vector;
+
+namespace Microsoft::React::Networking {
+
+namespace {
+
+// Entry files start with the format version and the key of the entry, followed by the
+// metadata of the response one line at a time, and the body.
+constexpr char fileMagic[] = "RNW-HTTP-CACHE/1";
+constexpr char fileExtension[] = ".entry";
+constexpr char partialFileExtension[] = ".partial";
+
+bool IsLineSafe(const string &value) noexcept {
+  return value.find_first_of("\r\n") == string::npos;
+}
+
+void AppendHeaders(string &metadata, const HttpHeaders &headers) {
+  size_t count = 0;
+  string lines;
+  for (const auto &[name, value] : headers) {
+    if (IsLineSafe(name) && IsLineSafe(value)) {
+      lines += name + '\n' + value + '\n';
+      count++;
+    }
+  }
+
+  metadata += std::to_string(count) + '\n' + lines;
+}
+
+string SerializeMetadata(const string &key, const HttpCacheEntry &entry) {
+  auto metadata = string{fileMagic} + '\n' + key + '\n';
+  metadata += std::to_string(entry.StatusCode) + '\n';
+  metadata += std::to_string(entry.RequestTime) + '\n';
+  metadata += std::to_string(entry.ResponseTime) + '\n';
+  metadata += entry.Url + '\n';
+  AppendHeaders(metadata, entry.Headers);
+  AppendHeaders(metadata, entry.VaryHeaders);
+
+  return metadata;
+}
+
+class LineReader {
+  const char *m_position;
+  const char *m_end;
+
+ public:
+  LineReader(const uint8_t *data, size_t size) noexcept
+      : m_position{reinterpret_cast<const char *>(data)}, m_end{m_position + size} {}
+
+  bool Next(string &line) {
+    auto lineEnd = static_cast<const char *>(std::memchr(m_position, '\n', m_end - m_position));
+    if (!lineEnd) {
+      return false;
+    }
+
+    line.assign(m_position, lineEnd);
+    m_position = lineEnd + 1;
+    return true;
+  }
+
+  bool Next(int64_t &value) {
+    string line;
+    if (!Next(line)) {
+      return false;
+    }
+
+    try {
+      size_t parsed = 0;
+      value = std::stoll(line, &parsed);
+      return parsed == line.size();
+    } catch (const std::exception &) {
+      return false;
+    }
+  }
+
+  bool Next(HttpHeaders &headers) {
+    int64_t count = 0;
+    if (!Next(count) || count < 0) {
+      return false;
+    }
+
+    for (int64_t i = 0; i < count; i++) {
+      string name, value;
+      if (!Next(name) || !Next(value)) {
+        return false;
+      }
+      headers.emplace(std::move(name), std::move(value));
+    }
+
+    return true;
+  }
+
+  size_t Consumed(const uint8_t *data) const noexcept {
+    return m_position - reinterpret_cast<const char *>(data);
+  }
+};
+
+optional<HttpCacheEntry> ParseEntry(const string &key, const BlobView &file) {
+  if (file.Segments().size() != 1) {
+    return {};
+  }
+
+  const auto data = file.Segments()[0].Data();
+  LineReader reader{data, file.Size()};
+
+  string magic, fileKey;
+  if (!reader.Next(magic) || magic != fileMagic || !reader.Next(fileKey) || fileKey != key) {
+    return {};
+  }
+
+  HttpCacheEntry entry;
+  if (!reader.Next(entry.StatusCode) || !reader.Next(entry.RequestTime) || !reader.Next(entry.ResponseTime) ||
+      !reader.Next(entry.Url) || !reader.Next(entry.Headers) || !reader.Next(entry.VaryHeaders)) {
+    return {};
+  }
+
+  const auto bodyOffset = reader.Consumed(data);
+  entry.Body = file.Slice(bodyOffset, file.Size() - bodyOffset);
+
+  return entry;
+}
+
+// Reads the key of an entry file, without reading the rest of it.
+optional<string> ReadKey(const fs::path &path) {
+  std::ifstream file{path, std::ios::binary};
+  string magic, key;
+  if (!std::getline(file, magic) || magic != fileMagic || !std::getline(file, key)) {
+    return {};
+  }
+
+  return key;
+}
+
+BlobView ReadWholeFile(const fs::path &path) {
+  std::ifstream file{path, std::ios::binary | std::ios::ate};
+  if (!file) {
+    throw std::runtime_error("Could not open " + path.string());
+  }
+
+  vector<uint8_t> bytes(static_cast<size_t>(file.tellg()));
+  file.seekg(0);
+  if (!file.read(reinterpret_cast<char *>(bytes.data()), bytes.size())) {
+    throw std::runtime_error("Could not read " + path.string());
+  }
+
+  return BlobView::FromBytes(std::move(bytes));
+}
+
+} // namespace
+
+DiskHttpCacheStore::DiskHttpCacheStore(Options options) noexcept : m_options{std::move(options)} {
+  if (!m_options.ReadFile) {
+    m_options.ReadFile = ReadWholeFile;
+  }
+}
+
+void DiskHttpCacheStore::EnsureLoaded() noexcept {
+  std::call_once(m_loaded, [this]() { Load(); });
+}
+
+void DiskHttpCacheStore::Load() noexcept {
+  struct FoundFile {
+    uint64_t Id;
+    string Key;
+    fs::path Path;
+    size_t Size;
+  };
+  vector<FoundFile> found;
+
+  scoped_lock lock{m_mutex};
+  try {
+    fs::create_directories(m_options.Directory);
+
+    for (const auto &file : fs::directory_iterator{m_options.Directory}) {
+      const auto &path = file.path();
+      if (path.extension() == partialFileExtension) {
+        // Left by a write that did not complete.
+        DeleteEntryFile(path);
+        continue;
+      }
+      if (path.extension() != fileExtension) {
+        continue;
+      }
+
+      auto key = ReadKey(path);
+      if (!key) {
+        DeleteEntryFile(path);
+        continue;
+      }
+
+      uint64_t id = 0;
+      const auto stem = path.stem().string();
+      if (std::from_chars(stem.data(), stem.data() + stem.size(), id, 16).ec != std::errc{}) {
+        continue;
+      }
+      m_nextFileId = std::max(m_nextFileId, id + 1);
+      found.push_back({id, std::move(*key), path, static_cast<size_t>(file.file_size())});
+    }
+  } catch (const std::exception &) {
+    // Start from what could be loaded.
+  }
+
+  // Newer files were written later, and are considered more recently used.
+  std::sort(found.begin(), found.end(), [](const auto &a, const auto &b) { return a.Id > b.Id; });
+  for (auto &file : found) {
+    if (m_index.count(file.Key) > 0) {
+      // Replaced by the newer file of the same key.
+      DeleteEntryFile(file.Path);
+      continue;
+    }
+
+    m_entries.push_back(IndexEntry{file.Key, std::move(file.Path), file.Size});
+    m_index.emplace(std::move(file.Key), std::prev(m_entries.end()));
+    m_size += file.Size;
+  }
+
+  while (m_size > m_options.MaxSize && !m_entries.empty()) {
+    Erase(std::prev(m_entries.end()));
+  }
+}
+
+size_t DiskHttpCacheStore::Size() noexcept {
+  EnsureLoaded();
+
+  scoped_lock lock{m_mutex};
+  return m_size;
+}
+
+#pragma region IHttpCacheStore
+
+optional<HttpCacheEntry> DiskHttpCacheStore::Get(const string &key) noexcept {
+  EnsureLoaded();
+
+  fs::path path;
+  {
+    scoped_lock lock{m_mutex};
+    auto entry = m_index.find(key);
+    if (entry == m_index.end()) {
+      return {};
+    }
+
+    m_entries.splice(m_entries.begin(), m_entries, entry->second);
+    path = entry->second->Path;
+  }
+
+  try {
+    if (auto entry = ParseEntry(key, m_options.ReadFile(path))) {
+      return entry;
+    }
+  } catch (const std::exception &) {
+  }
+
+  Remove(key, path);
+  return {};
+}
+
+void DiskHttpCacheStore::Put(const string &key, HttpCacheEntry &&entry) noexcept {
+  EnsureLoaded();
+
+  const auto metadata = SerializeMetadata(key, entry);
+  const auto size = metadata.size() + entry.Body.Size();
+  if (size > m_options.MaxSize) {
+    return Remove(key);
+  }
+
+  fs::path path;
+  {
+    scoped_lock lock{m_mutex};
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(m_nextFileId++));
+    path = m_options.Directory / (string{name} + fileExtension);
+  }
+
+  // Write the file under another name first, so that it is either whole or not found.
+  auto partialPath = fs::path{path}.replace_extension(partialFileExtension);
+  try {
+    {
+      std::ofstream file{partialPath, std::ios::binary | std::ios::trunc};
+      file.write(metadata.data(), metadata.size());
+      for (const auto &segment : entry.Body.Segments()) {
+        file.write(reinterpret_cast<const char *>(segment.Data()), segment.Size);
+      }
+      if (!file.flush()) {
+        throw std::runtime_error("Could not write " + partialPath.string());
+      }
+    }
+    fs::rename(partialPath, path);
+  } catch (const std::exception &) {
+    std::error_code ec;
+    fs::remove(partialPath, ec);
+    return Remove(key);
+  }
+
+  scoped_lock lock{m_mutex};
+  if (auto replaced = m_index.find(key); replaced != m_index.end()) {
+    Erase(replaced->second);
+  }
+
+  m_entries.push_front(IndexEntry{key, std::move(path), size});
+  m_index.emplace(key, m_entries.begin());
+  m_size += size;
+
+  while (m_size > m_options.MaxSize) {
+    Erase(std::prev(m_entries.end()));
+  }
+
+  // Retry deleting the files that were still in use.
+  auto orphans = std::move(m_orphans);
+  for (const auto &orphan : orphans) {
+    DeleteEntryFile(orphan);
+  }
+}
+
+void DiskHttpCacheStore::Remove(const string &key) noexcept {
+  EnsureLoaded();
+
+  scoped_lock lock{m_mutex};
+  if (auto entry = m_index.find(key); entry != m_index.end()) {
+    Erase(entry->second);
+  }
+}
+
+#pragma endregion IHttpCacheStore
+
+void DiskHttpCacheStore::Remove(const string &key, const fs::path &path) noexcept {
+  // The entry may have been replaced since its file was read.
+  scoped_lock lock{m_mutex};
+  if (auto entry = m_index.find(key); entry != m_index.end() && entry->second->Path == path) {
+    Erase(entry->second);
+  }
+}
+
+void DiskHttpCacheStore::Erase(std::list<IndexEntry>::iterator entry) noexcept {
+  DeleteEntryFile(entry->Path);
+  m_size -= entry->Size;
+  m_index.erase(entry->Key);
+  m_entries.erase(entry);
+}
+
+void DiskHttpCacheStore::DeleteEntryFile(const fs::path &path) noexcept {
+  std::error_code ec;
+  fs::remove(path, ec);
+  if (ec) {
+    m_orphans.push_back(path);
+  }
+}
+
+} // namespace Microsoft::React::Networking
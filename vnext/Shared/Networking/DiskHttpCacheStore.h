@@ -0,0 +1,89 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "HttpCache.h"
+
+// Standard Library
+#include <filesystem>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft::React::Networking {
+
+/// <summary>
+/// Stores HTTP cache entries as files of a directory, up to a total size.
+///
+/// Each entry is written to a new file, so a file is never rewritten while it
+/// may be read. Entries are read through ReadFile, which memory maps the file
+/// on Windows: the body of a response served from the store is a view of the
+/// mapped file. The least recently used entries are evicted when the files
+/// exceed MaxSize. The entries found in the directory are loaded on first use,
+/// so that creating the store does not scan it.
+/// </summary>
+class DiskHttpCacheStore final : public IHttpCacheStore {
+ public:
+  using FileReader = std::function<BlobView(const std::filesystem::path &path)>;
+
+  struct Options {
+    std::filesystem::path Directory;
+    size_t MaxSize{50 * 1024 * 1024};
+
+    // Defaults to reading the whole file into memory.
+    FileReader ReadFile;
+  };
+
+  DiskHttpCacheStore(Options options) noexcept;
+
+  // Total size of the entry files.
+  size_t Size() noexcept;
+
+#pragma region IHttpCacheStore
+
+  std::optional<HttpCacheEntry> Get(const std::string &key) noexcept override;
+
+  void Put(const std::string &key, HttpCacheEntry &&entry) noexcept override;
+
+  void Remove(const std::string &key) noexcept override;
+
+#pragma endregion IHttpCacheStore
+
+ private:
+  struct IndexEntry {
+    std::string Key;
+    std::filesystem::path Path;
+    size_t Size;
+  };
+
+  // Loads the entries found in the directory, once.
+  void EnsureLoaded() noexcept;
+
+  void Load() noexcept;
+
+  void Remove(const std::string &key, const std::filesystem::path &path) noexcept;
+
+  // Must be called with the lock held.
+  void Erase(std::list<IndexEntry>::iterator entry) noexcept;
+
+  // Must be called with the lock held.
+  void DeleteEntryFile(const std::filesystem::path &path) noexcept;
+
+  Options m_options;
+
+  std::once_flag m_loaded;
+  mutable std::mutex m_mutex;
+  std::list<IndexEntry> m_entries; // Most recently used first
+  std::unordered_map<std::string, std::list<IndexEntry>::iterator> m_index;
+  size_t m_size{0};
+  uint64_t m_nextFileId{0};
+
+  // Files that could not be deleted yet (ex: still mapped by a response being read).
+  std::vector<std::filesystem::path> m_orphans;
+};
+
+} // namespace Microsoft::React::Networking
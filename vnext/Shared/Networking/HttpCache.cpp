@@ -0,0 +1,583 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HttpCache.h"
+
+// Boost Libraries
+#include <boost/algorithm/string.hpp>
+
+// Standard Library
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <locale>
+#include <map>
+#include <sstream>
+
+using std::function;
+using std::optional;
+using std::scoped_lock;
+using std::string;
+using std::string_view;
+using std::vector;
+
+namespace Microsoft::React::Networking {
+
+namespace {
+
+// Delta seconds greater than this are treated as this value (RFC 9111 section 1.2.2).
+constexpr int64_t maxDeltaSeconds = 2147483648;
+
+const string *FindHeader(const HttpHeaders &headers, string_view name) noexcept {
+  for (const auto &header : headers) {
+    if (boost::iequals(header.first, name)) {
+      return &header.second;
+    }
+  }
+
+  return nullptr;
+}
+
+void SetHeader(HttpHeaders &headers, const string &name, const string &value) {
+  for (auto header = headers.begin(); header != headers.end();) {
+    if (boost::iequals(header->first, name)) {
+      header = headers.erase(header);
+    } else {
+      ++header;
+    }
+  }
+
+  headers.emplace(name, value);
+}
+
+optional<int64_t> ParseDeltaSeconds(const string &value) noexcept {
+  if (value.empty() || !std::all_of(value.cbegin(), value.cend(), [](char c) { return c >= '0' && c <= '9'; })) {
+    return {};
+  }
+
+  int64_t result = 0;
+  for (auto c : value) {
+    result = std::min(result * 10 + (c - '0'), maxDeltaSeconds);
+  }
+
+  return result;
+}
+
+// See https://howardhinnant.github.io/date_algorithms.html#days_from_civil
+int64_t DaysFromCivil(int64_t year, int64_t month, int64_t day) noexcept {
+  year -= month <= 2;
+  const auto era = (year >= 0 ? year : year - 399) / 400;
+  const auto yearOfEra = year - era * 400;
+  const auto dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  const auto dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+  return era * 146097 + dayOfEra - 719468;
+}
+
+// Parses an HTTP-date into seconds since the epoch (RFC 9110 section 5.6.7).
+optional<int64_t> ParseHttpDate(const string &value) {
+  // IMF-fixdate, then the obsolete RFC 850 and asctime formats.
+  for (auto format : {"%a, %d %b %Y %H:%M:%S GMT", "%a, %d-%b-%y %H:%M:%S GMT", "%a %b %d %H:%M:%S %Y"}) {
+    std::tm time{};
+    std::istringstream stream{value};
+    stream.imbue(std::locale::classic());
+    stream >> std::get_time(&time, format);
+    if (stream.fail()) {
+      continue;
+    }
+
+    const auto days = DaysFromCivil(time.tm_year + 1900, time.tm_mon + 1, time.tm_mday);
+    return days * 86400 + time.tm_hour * 3600 + time.tm_min * 60 + time.tm_sec;
+  }
+
+  return {};
+}
+
+struct CacheControl {
+  bool NoStore{false};
+  bool NoCache{false};
+  bool Public{false};
+  bool MustRevalidate{false};
+  bool SMaxAge{false};
+  optional<int64_t> MaxAge;
+
+  static CacheControl Parse(const HttpHeaders &headers) {
+    CacheControl result;
+
+    auto value = FindHeader(headers, "Cache-Control");
+    if (!value) {
+      // Pragma is only considered without Cache-Control (RFC 9111 section 5.4).
+      if (auto pragma = FindHeader(headers, "Pragma")) {
+        result.NoCache = boost::icontains(*pragma, "no-cache");
+      }
+
+      return result;
+    }
+
+    vector<string> directives;
+    boost::split(directives, *value, boost::is_any_of(","));
+    for (const auto &directive : directives) {
+      const auto separator = directive.find('=');
+      const auto name = boost::to_lower_copy(boost::trim_copy(directive.substr(0, separator)));
+      auto argument = separator == string::npos ? string{} : boost::trim_copy(directive.substr(separator + 1));
+      boost::trim_if(argument, boost::is_any_of("\""));
+
+      if (name == "no-store") {
+        result.NoStore = true;
+      } else if (name == "no-cache") {
+        // Treats no-cache with field names as unqualified no-cache.
+        result.NoCache = true;
+      } else if (name == "public") {
+        result.Public = true;
+      } else if (name == "must-revalidate" || name == "proxy-revalidate") {
+        result.MustRevalidate = true;
+      } else if (name == "s-maxage") {
+        // Only shared caches use its value.
+        result.SMaxAge = true;
+      } else if (name == "max-age") {
+        // An invalid max-age makes the response stale.
+        result.MaxAge = ParseDeltaSeconds(argument).value_or(0);
+      }
+    }
+
+    return result;
+  }
+};
+
+// Status codes that are heuristically cacheable (RFC 9110 section 15.1).
+bool IsHeuristicallyCacheable(int64_t statusCode) noexcept {
+  switch (statusCode) {
+    case 200:
+    case 203:
+    case 204:
+    case 300:
+    case 301:
+    case 308:
+    case 404:
+    case 405:
+    case 410:
+    case 414:
+    case 501:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool HasValidator(const HttpCacheEntry &entry) noexcept {
+  return FindHeader(entry.Headers, "ETag") || FindHeader(entry.Headers, "Last-Modified");
+}
+
+int64_t DateValue(const HttpCacheEntry &entry) {
+  if (auto date = FindHeader(entry.Headers, "Date")) {
+    if (auto value = ParseHttpDate(*date)) {
+      return *value;
+    }
+  }
+
+  return entry.ResponseTime;
+}
+
+// See RFC 9111 section 4.2.1.
+int64_t FreshnessLifetime(const HttpCacheEntry &entry, const CacheControl &cacheControl, int64_t maxHeuristic) {
+  if (cacheControl.MaxAge) {
+    return *cacheControl.MaxAge;
+  }
+
+  const auto date = DateValue(entry);
+  if (auto expires = FindHeader(entry.Headers, "Expires")) {
+    // An invalid Expires date represents a time in the past.
+    auto expiresValue = ParseHttpDate(*expires);
+    return expiresValue ? std::max<int64_t>(*expiresValue - date, 0) : 0;
+  }
+
+  // See RFC 9111 section 4.2.2.
+  if (auto lastModified = FindHeader(entry.Headers, "Last-Modified");
+      lastModified && (cacheControl.Public || IsHeuristicallyCacheable(entry.StatusCode))) {
+    if (auto lastModifiedValue = ParseHttpDate(*lastModified); lastModifiedValue && *lastModifiedValue < date) {
+      return std::min((date - *lastModifiedValue) / 10, maxHeuristic);
+    }
+  }
+
+  return 0;
+}
+
+// See RFC 9111 section 4.2.3.
+int64_t CurrentAge(const HttpCacheEntry &entry, int64_t now) {
+  int64_t ageValue = 0;
+  if (auto age = FindHeader(entry.Headers, "Age")) {
+    ageValue = ParseDeltaSeconds(*age).value_or(0);
+  }
+
+  const auto apparentAge = std::max<int64_t>(entry.ResponseTime - DateValue(entry), 0);
+  const auto responseDelay = entry.ResponseTime - entry.RequestTime;
+  const auto correctedInitialAge = std::max(apparentAge, ageValue + responseDelay);
+  const auto residentTime = now - entry.ResponseTime;
+
+  return correctedInitialAge + residentTime;
+}
+
+// See RFC 9111 section 3.
+bool IsStorable(
+    const HttpCacheRequest &request,
+    const HttpCacheResponse &response,
+    const CacheControl &requestCacheControl,
+    const CacheControl &responseCacheControl) {
+  // Partial content is not stored.
+  if (response.StatusCode < 200 || response.StatusCode == 206 || response.StatusCode == 304) {
+    return false;
+  }
+  if (requestCacheControl.NoStore || responseCacheControl.NoStore) {
+    return false;
+  }
+  if (auto vary = FindHeader(response.Headers, "Vary"); vary && boost::trim_copy(*vary) == "*") {
+    return false;
+  }
+  if (FindHeader(request.Headers, "Authorization") &&
+      !(responseCacheControl.Public || responseCacheControl.MustRevalidate || responseCacheControl.SMaxAge)) {
+    return false;
+  }
+
+  return responseCacheControl.Public || responseCacheControl.MaxAge || FindHeader(response.Headers, "Expires") ||
+      IsHeuristicallyCacheable(response.StatusCode);
+}
+
+// Values of the request headers the response varies on (RFC 9111 section 4.1).
+HttpHeaders VaryHeaders(const HttpHeaders &responseHeaders, const HttpHeaders &requestHeaders) {
+  HttpHeaders result;
+  auto vary = FindHeader(responseHeaders, "Vary");
+  if (!vary) {
+    return result;
+  }
+
+  vector<string> names;
+  boost::split(names, *vary, boost::is_any_of(","));
+  for (auto &name : names) {
+    boost::trim(name);
+    if (name.empty()) {
+      continue;
+    }
+
+    auto value = FindHeader(requestHeaders, name);
+    result.emplace(boost::to_lower_copy(name), value ? boost::trim_copy(*value) : string{});
+  }
+
+  return result;
+}
+
+bool VaryMatches(const HttpCacheEntry &entry, const HttpHeaders &requestHeaders) {
+  for (const auto &[name, storedValue] : entry.VaryHeaders) {
+    auto value = FindHeader(requestHeaders, name);
+    if ((value ? boost::trim_copy(*value) : string{}) != storedValue) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Identical requests share the URL and all the header values.
+string FlightKey(const HttpCacheRequest &request) {
+  std::map<string, string> headers;
+  for (const auto &header : request.Headers) {
+    headers.emplace(boost::to_lower_copy(header.first), header.second);
+  }
+
+  auto key = request.Url;
+  key += request.WithCredentials ? "\n1" : "\n0";
+  for (const auto &[name, value] : headers) {
+    key += '\n' + name + ':' + value;
+  }
+
+  return key;
+}
+
+HttpCacheResponse ToResponse(const HttpCacheEntry &entry, int64_t age) {
+  auto response = HttpCacheResponse{entry.StatusCode, entry.Url, entry.Headers, entry.Body};
+
+  // See RFC 9111 section 5.1.
+  SetHeader(response.Headers, "Age", std::to_string(std::max<int64_t>(age, 0)));
+
+  return response;
+}
+
+} // namespace
+
+HttpCache::HttpCache(std::weak_ptr<IHttpCacheTransport> transport, std::shared_ptr<IHttpCacheStore> store) noexcept
+    : HttpCache(std::move(transport), std::move(store), Options{}) {}
+
+HttpCache::HttpCache(
+    std::weak_ptr<IHttpCacheTransport> transport,
+    std::shared_ptr<IHttpCacheStore> store,
+    Options options) noexcept
+    : m_transport{std::move(transport)}, m_store{std::move(store)}, m_options{std::move(options)} {}
+
+int64_t HttpCache::Now() const noexcept {
+  if (m_options.Now) {
+    return m_options.Now();
+  }
+
+  using namespace std::chrono;
+  return duration_cast<seconds>(system_clock::now().time_since_epoch()).count();
+}
+
+void HttpCache::Send(
+    HttpCacheRequest &&request,
+    function<void(HttpCacheResponse &&response)> &&onResponse,
+    function<void(string &&errorMessage)> &&onError) noexcept {
+  auto self = shared_from_this();
+
+  if (!boost::iequals(request.Method, "GET")) {
+    m_bypassed++;
+
+    // See RFC 9111 section 4.4.
+    auto isSafe = boost::iequals(request.Method, "HEAD") || boost::iequals(request.Method, "OPTIONS") ||
+        boost::iequals(request.Method, "TRACE");
+    if (!isSafe) {
+      onResponse = [self, url = request.Url, onResponse = std::move(onResponse)](HttpCacheResponse &&response) {
+        if (response.StatusCode >= 200 && response.StatusCode < 400) {
+          self->Invalidate(url);
+        }
+        onResponse(std::move(response));
+      };
+    }
+
+    return SendAlone(std::move(request), std::move(onResponse), std::move(onError));
+  }
+
+  auto requestCacheControl = CacheControl::Parse(request.Headers);
+  for (auto name : {"Range", "If-Range", "If-Match", "If-None-Match", "If-Modified-Since", "If-Unmodified-Since"}) {
+    // Requests that are already conditional or partial are left to the server.
+    if (FindHeader(request.Headers, name)) {
+      requestCacheControl.NoStore = true;
+    }
+  }
+  if (requestCacheControl.NoStore) {
+    m_bypassed++;
+    return SendAlone(std::move(request), std::move(onResponse), std::move(onError));
+  }
+
+  const auto requestTime = Now();
+  auto stored = m_store->Get(request.Url);
+  if (stored && !VaryMatches(*stored, request.Headers)) {
+    stored.reset();
+  }
+
+  if (stored) {
+    const auto responseCacheControl = CacheControl::Parse(stored->Headers);
+    const auto age = CurrentAge(*stored, requestTime);
+    const auto isFresh = !requestCacheControl.NoCache && !responseCacheControl.NoCache &&
+        age < FreshnessLifetime(*stored, responseCacheControl, m_options.MaxHeuristicLifetime) &&
+        (!requestCacheControl.MaxAge || age <= *requestCacheControl.MaxAge);
+
+    if (isFresh) {
+      m_hits++;
+      return onResponse(ToResponse(*stored, age));
+    }
+
+    if (!HasValidator(*stored)) {
+      stored.reset();
+    }
+  }
+
+  auto flightKey = FlightKey(request);
+  int64_t flightId;
+  {
+    scoped_lock lock{m_flightsMutex};
+    auto [flightIdIt, isFirst] = m_flightIds.try_emplace(flightKey, m_nextFlightId);
+    flightId = flightIdIt->second;
+    if (isFirst) {
+      m_nextFlightId--;
+      m_flights.emplace(flightId, Flight{flightKey, {}});
+    } else {
+      m_coalesced++;
+    }
+    m_flights[flightId].Waiters.push_back(Waiter{request.Id, std::move(onResponse), std::move(onError)});
+    if (!isFirst) {
+      return;
+    }
+  }
+
+  auto networkRequest = request;
+  networkRequest.Id = flightId;
+  if (stored) {
+    m_revalidations++;
+
+    // See RFC 9110 section 13.1.
+    if (auto etag = FindHeader(stored->Headers, "ETag")) {
+      SetHeader(networkRequest.Headers, "If-None-Match", *etag);
+    }
+    if (auto lastModified = FindHeader(stored->Headers, "Last-Modified")) {
+      SetHeader(networkRequest.Headers, "If-Modified-Since", *lastModified);
+    }
+  } else {
+    m_misses++;
+  }
+
+  SendToTransport(
+      std::move(networkRequest),
+      [self, flightId, request = std::move(request), requestTime, stored = std::move(stored)](
+          HttpCacheResponse &&response) mutable {
+        self->OnNetworkResponse(flightId, request, requestTime, std::move(stored), std::move(response));
+      },
+      [self, flightId](string &&errorMessage) {
+        for (auto &waiter : self->Land(flightId)) {
+          waiter.OnError(string{errorMessage});
+        }
+      });
+}
+
+bool HttpCache::Abort(int64_t requestId) noexcept {
+  optional<Waiter> aborted;
+  optional<int64_t> canceledFlightId;
+  {
+    scoped_lock lock{m_flightsMutex};
+    for (auto flight = m_flights.begin(); flight != m_flights.end() && !aborted; ++flight) {
+      auto &waiters = flight->second.Waiters;
+      auto waiter = std::find_if(
+          waiters.begin(), waiters.end(), [requestId](const Waiter &waiter) { return waiter.RequestId == requestId; });
+      if (waiter == waiters.end()) {
+        continue;
+      }
+
+      aborted = std::move(*waiter);
+      waiters.erase(waiter);
+      if (waiters.empty()) {
+        canceledFlightId = flight->first;
+        if (!flight->second.Key.empty()) {
+          m_flightIds.erase(flight->second.Key);
+        }
+        m_flights.erase(flight);
+        break;
+      }
+    }
+  }
+
+  if (!aborted) {
+    return false;
+  }
+
+  if (canceledFlightId) {
+    if (auto transport = m_transport.lock()) {
+      transport->Cancel(*canceledFlightId);
+    }
+  }
+  aborted->OnError("Request aborted");
+  return true;
+}
+
+void HttpCache::SendAlone(
+    HttpCacheRequest &&request,
+    function<void(HttpCacheResponse &&response)> &&onResponse,
+    function<void(string &&errorMessage)> &&onError) noexcept {
+  auto self = shared_from_this();
+  int64_t flightId;
+  {
+    scoped_lock lock{m_flightsMutex};
+    flightId = m_nextFlightId--;
+    m_flights.emplace(flightId, Flight{{}, {Waiter{request.Id, std::move(onResponse), std::move(onError)}}});
+  }
+
+  request.Id = flightId;
+  SendToTransport(
+      std::move(request),
+      [self, flightId](HttpCacheResponse &&response) {
+        for (auto &waiter : self->Land(flightId)) {
+          waiter.OnResponse(std::move(response));
+        }
+      },
+      [self, flightId](string &&errorMessage) {
+        for (auto &waiter : self->Land(flightId)) {
+          waiter.OnError(std::move(errorMessage));
+        }
+      });
+}
+
+void HttpCache::SendToTransport(
+    HttpCacheRequest &&request,
+    function<void(HttpCacheResponse &&response)> &&onResponse,
+    function<void(string &&errorMessage)> &&onError) noexcept {
+  if (auto transport = m_transport.lock()) {
+    return transport->Send(std::move(request), std::move(onResponse), std::move(onError));
+  }
+
+  onError("HTTP transport is no longer available");
+}
+
+void HttpCache::OnNetworkResponse(
+    int64_t flightId,
+    const HttpCacheRequest &request,
+    int64_t requestTime,
+    optional<HttpCacheEntry> &&stored,
+    HttpCacheResponse &&response) noexcept {
+  const auto responseTime = Now();
+
+  HttpCacheResponse result;
+  if (stored && response.StatusCode == 304) {
+    m_notModified++;
+
+    // Freshen the stored response (RFC 9111 section 4.3.4).
+    for (const auto &header : response.Headers) {
+      if (!boost::iequals(header.first, "Content-Length")) {
+        SetHeader(stored->Headers, header.first, header.second);
+      }
+    }
+    stored->RequestTime = requestTime;
+    stored->ResponseTime = responseTime;
+
+    result = ToResponse(*stored, CurrentAge(*stored, responseTime));
+    m_store->Put(request.Url, std::move(*stored));
+  } else {
+    const auto responseCacheControl = CacheControl::Parse(response.Headers);
+    auto entry = HttpCacheEntry{
+        response.StatusCode,
+        response.Url,
+        response.Headers,
+        VaryHeaders(response.Headers, request.Headers),
+        requestTime,
+        responseTime,
+        response.Body};
+
+    // Responses that would be stale right away are only worth storing when they can be revalidated.
+    if (IsStorable(request, response, CacheControl::Parse(request.Headers), responseCacheControl) &&
+        (HasValidator(entry) ||
+         FreshnessLifetime(entry, responseCacheControl, m_options.MaxHeuristicLifetime) > 0)) {
+      m_store->Put(request.Url, std::move(entry));
+    } else {
+      m_store->Remove(request.Url);
+    }
+
+    result = std::move(response);
+  }
+
+  for (auto &waiter : Land(flightId)) {
+    waiter.OnResponse(HttpCacheResponse{result});
+  }
+}
+
+vector<HttpCache::Waiter> HttpCache::Land(int64_t flightId) noexcept {
+  vector<Waiter> waiters;
+
+  scoped_lock lock{m_flightsMutex};
+  auto flight = m_flights.find(flightId);
+  if (flight != m_flights.end()) {
+    waiters = std::move(flight->second.Waiters);
+    if (!flight->second.Key.empty()) {
+      m_flightIds.erase(flight->second.Key);
+    }
+    m_flights.erase(flight);
+  }
+
+  return waiters;
+}
+
+void HttpCache::Invalidate(const string &url) noexcept {
+  m_store->Remove(url);
+}
+
+HttpCacheMetrics HttpCache::Metrics() const noexcept {
+  return {m_hits, m_misses, m_revalidations, m_notModified, m_coalesced, m_bypassed};
+}
+
+} // namespace Microsoft::React::Networking
@@ -0,0 +1,202 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <BlobView.h>
+
+// Standard Library
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft::React::Networking {
+
+typedef std::unordered_map<std::string, std::string> HttpHeaders;
+
+struct HttpCacheRequest {
+  // Identifies the request. The requests the cache sends to its transport have negative ids of their own, since
+  // one of them may stand for several coalesced requests.
+  int64_t Id{0};
+  std::string Method;
+  std::string Url;
+  HttpHeaders Headers;
+  bool WithCredentials{false};
+};
+
+struct HttpCacheResponse {
+  int64_t StatusCode{0};
+  std::string Url;
+  HttpHeaders Headers;
+  BlobView Body;
+};
+
+/// <summary>
+/// Sends the requests of an HttpCache to the network.
+/// </summary>
+struct IHttpCacheTransport {
+  virtual ~IHttpCacheTransport() = default;
+
+  /// <summary>
+  /// Sends the request, and calls either onResponse with the whole response or onError.
+  /// </summary>
+  virtual void Send(
+      HttpCacheRequest &&request,
+      std::function<void(HttpCacheResponse &&response)> &&onResponse,
+      std::function<void(std::string &&errorMessage)> &&onError) noexcept = 0;
+
+  /// <summary>
+  /// Cancels a request passed to Send. Its callbacks may still be called.
+  /// </summary>
+  virtual void Cancel(int64_t requestId) noexcept = 0;
+};
+
+struct HttpCacheEntry {
+  int64_t StatusCode{0};
+  std::string Url;
+  HttpHeaders Headers;
+
+  // Values of the request headers named by the Vary header of the response (lower case names).
+  HttpHeaders VaryHeaders;
+
+  // Seconds since the epoch at which the request was sent and the response received.
+  int64_t RequestTime{0};
+  int64_t ResponseTime{0};
+
+  BlobView Body;
+};
+
+/// <summary>
+/// Stores the responses of an HttpCache.
+/// </summary>
+struct IHttpCacheStore {
+  virtual ~IHttpCacheStore() = default;
+
+  virtual std::optional<HttpCacheEntry> Get(const std::string &key) noexcept = 0;
+
+  virtual void Put(const std::string &key, HttpCacheEntry &&entry) noexcept = 0;
+
+  virtual void Remove(const std::string &key) noexcept = 0;
+};
+
+struct HttpCacheMetrics {
+  // Requests served from a fresh stored response.
+  uint64_t Hits{0};
+
+  // Requests sent to the network without a stored response to validate.
+  uint64_t Misses{0};
+
+  // Conditional requests sent to validate a stale stored response.
+  uint64_t Revalidations{0};
+
+  // Revalidations answered with 304 Not Modified, served from the stored response.
+  uint64_t NotModified{0};
+
+  // Requests that joined an identical request already in flight.
+  uint64_t Coalesced{0};
+
+  // Requests the cache did not apply to (ex: unsafe methods, no-store, range requests).
+  uint64_t Bypassed{0};
+};
+
+/// <summary>
+/// Private HTTP cache (RFC 9111) in front of a transport.
+///
+/// GET responses are stored when storable, and served without going to the
+/// network while they are fresh. Stale responses with an ETag or a
+/// Last-Modified validator are revalidated with a conditional request. GET
+/// requests identical to one already in flight wait for its response rather
+/// than being sent again. Aborting one of them only detaches it; the request
+/// sent to the network is canceled once none of them waits for it.
+/// </summary>
+class HttpCache final : public std::enable_shared_from_this<HttpCache> {
+ public:
+  struct Options {
+    // Current time, in seconds since the epoch. Defaults to the system clock.
+    std::function<int64_t()> Now;
+
+    // Upper bound of the heuristic freshness lifetime of responses with a Last-Modified header only.
+    int64_t MaxHeuristicLifetime{24 * 60 * 60};
+  };
+
+  HttpCache(std::weak_ptr<IHttpCacheTransport> transport, std::shared_ptr<IHttpCacheStore> store) noexcept;
+
+  HttpCache(
+      std::weak_ptr<IHttpCacheTransport> transport,
+      std::shared_ptr<IHttpCacheStore> store,
+      Options options) noexcept;
+
+  void Send(
+      HttpCacheRequest &&request,
+      std::function<void(HttpCacheResponse &&response)> &&onResponse,
+      std::function<void(std::string &&errorMessage)> &&onError) noexcept;
+
+  // Calls the onError of the request with the given id, unless it was answered, and no longer waits for the
+  // network on its behalf. Returns false when the request is not waiting for the network.
+  bool Abort(int64_t requestId) noexcept;
+
+  // Drops the stored response for url, after an unsafe request to it succeeded (RFC 9111 section 4.4).
+  void Invalidate(const std::string &url) noexcept;
+
+  HttpCacheMetrics Metrics() const noexcept;
+
+ private:
+  struct Waiter {
+    int64_t RequestId;
+    std::function<void(HttpCacheResponse &&response)> OnResponse;
+    std::function<void(std::string &&errorMessage)> OnError;
+  };
+
+  // A request sent to the transport, and the requests waiting for its response.
+  struct Flight {
+    std::string Key; // Empty when other requests may not join the flight
+    std::vector<Waiter> Waiters;
+  };
+
+  int64_t Now() const noexcept;
+
+  void SendToTransport(
+      HttpCacheRequest &&request,
+      std::function<void(HttpCacheResponse &&response)> &&onResponse,
+      std::function<void(std::string &&errorMessage)> &&onError) noexcept;
+
+  // Sends a request that no other request joins.
+  void SendAlone(
+      HttpCacheRequest &&request,
+      std::function<void(HttpCacheResponse &&response)> &&onResponse,
+      std::function<void(std::string &&errorMessage)> &&onError) noexcept;
+
+  void OnNetworkResponse(
+      int64_t flightId,
+      const HttpCacheRequest &request,
+      int64_t requestTime,
+      std::optional<HttpCacheEntry> &&stored,
+      HttpCacheResponse &&response) noexcept;
+
+  std::vector<Waiter> Land(int64_t flightId) noexcept;
+
+  std::weak_ptr<IHttpCacheTransport> m_transport;
+  std::shared_ptr<IHttpCacheStore> m_store;
+  Options m_options;
+
+  std::mutex m_flightsMutex;
+  int64_t m_nextFlightId{-1};
+  // Flights by the id of the request sent to the transport.
+  std::unordered_map<int64_t, Flight> m_flights;
+  std::unordered_map<std::string, int64_t> m_flightIds;
+
+  std::atomic<uint64_t> m_hits{0};
+  std::atomic<uint64_t> m_misses{0};
+  std::atomic<uint64_t> m_revalidations{0};
+  std::atomic<uint64_t> m_notModified{0};
+  std::atomic<uint64_t> m_coalesced{0};
+  std::atomic<uint64_t> m_bypassed{0};
+};
+
+} // namespace Microsoft::React::Networking
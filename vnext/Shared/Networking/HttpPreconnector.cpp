@@ -0,0 +1,162 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HttpPreconnector.h"
+
+#include "HttpRequestScheduler.h"
+
+// Standard Library
+#include <algorithm>
+#include <chrono>
+
+using std::function;
+using std::scoped_lock;
+using std::string;
+using std::vector;
+
+namespace Microsoft::React::Networking {
+
+HttpPreconnector::HttpPreconnector(ConnectFunction &&connect) noexcept
+    : HttpPreconnector(std::move(connect), Options{}) {}
+
+HttpPreconnector::HttpPreconnector(ConnectFunction &&connect, Options options) noexcept
+    : m_connect{std::move(connect)}, m_options{std::move(options)} {
+  m_options.MaxConnects = std::max<size_t>(m_options.MaxConnects, 1);
+}
+
+int64_t HttpPreconnector::Now() const noexcept {
+  if (m_options.Now) {
+    return m_options.Now();
+  }
+
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void HttpPreconnector::Preconnect(const vector<string> &urls) noexcept {
+  vector<string> origins;
+  {
+    scoped_lock lock{m_mutex};
+    const auto now = Now();
+    for (const auto &url : urls) {
+      m_metrics.PreconnectsRequested++;
+
+      auto origin = GetRequestHost(url);
+      if (origin.rfind("http://", 0) != 0 && origin.rfind("https://", 0) != 0) {
+        m_metrics.PreconnectsFailed++;
+        continue;
+      }
+
+      if (IsWarm(origin, now) || m_active.count(origin) ||
+          std::find(m_queued.cbegin(), m_queued.cend(), origin) != m_queued.cend()) {
+        m_metrics.PreconnectsSkipped++;
+        continue;
+      }
+
+      m_queued.push_back(std::move(origin));
+    }
+
+    origins = Dequeue();
+  }
+
+  ConnectAll(std::move(origins));
+}
+
+void HttpPreconnector::NoteRequest(const string &url) noexcept {
+  auto origin = GetRequestHost(url);
+
+  scoped_lock lock{m_mutex};
+  const auto now = Now();
+  if (IsWarm(origin, now)) {
+    m_metrics.WarmRequests++;
+  } else {
+    m_metrics.ColdRequests++;
+  }
+  MarkWarm(origin, now);
+}
+
+bool HttpPreconnector::IsWarm(const string &origin) const noexcept {
+  scoped_lock lock{m_mutex};
+  return IsWarm(origin, Now());
+}
+
+HttpConnectionMetrics HttpPreconnector::Metrics() const noexcept {
+  scoped_lock lock{m_mutex};
+  return m_metrics;
+}
+
+size_t HttpPreconnector::QueuedCount() const noexcept {
+  scoped_lock lock{m_mutex};
+  return m_queued.size();
+}
+
+size_t HttpPreconnector::ActiveCount() const noexcept {
+  scoped_lock lock{m_mutex};
+  return m_active.size();
+}
+
+bool HttpPreconnector::IsWarm(const string &origin, int64_t now) const noexcept {
+  auto lastUsed = m_lastUsed.find(origin);
+  return lastUsed != m_lastUsed.cend() && now - lastUsed->second < m_options.IdleTimeout;
+}
+
+void HttpPreconnector::MarkWarm(const string &origin, int64_t now) noexcept {
+  if (m_lastUsed.size() >= MaxWarmOrigins && !m_lastUsed.count(origin)) {
+    for (auto entry = m_lastUsed.begin(); entry != m_lastUsed.end();) {
+      if (now - entry->second >= m_options.IdleTimeout) {
+        entry = m_lastUsed.erase(entry);
+      } else {
+        ++entry;
+      }
+    }
+  }
+
+  m_lastUsed.insert_or_assign(origin, now);
+}
+
+vector<string> HttpPreconnector::Dequeue() noexcept {
+  vector<string> origins;
+  const auto now = Now();
+  while (m_active.size() < m_options.MaxConnects && !m_queued.empty()) {
+    auto origin = std::move(m_queued.front());
+    m_queued.pop_front();
+
+    m_active.emplace(origin, now);
+    origins.push_back(std::move(origin));
+  }
+
+  return origins;
+}
+
+void HttpPreconnector::ConnectAll(vector<string> &&origins) noexcept {
+  for (auto &origin : origins) {
+    m_connect(origin, [this, origin](bool succeeded) { OnConnected(origin, succeeded); });
+  }
+}
+
+void HttpPreconnector::OnConnected(const string &origin, bool succeeded) noexcept {
+  vector<string> origins;
+  {
+    scoped_lock lock{m_mutex};
+    auto active = m_active.find(origin);
+    if (active == m_active.end()) {
+      return;
+    }
+
+    const auto now = Now();
+    if (succeeded) {
+      m_metrics.PreconnectsSucceeded++;
+      m_metrics.PreconnectTime += now - active->second;
+      MarkWarm(origin, now);
+    } else {
+      m_metrics.PreconnectsFailed++;
+    }
+    m_active.erase(active);
+
+    origins = Dequeue();
+  }
+
+  ConnectAll(std::move(origins));
+}
+
+} // namespace Microsoft::React::Networking
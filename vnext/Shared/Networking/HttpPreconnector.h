@@ -0,0 +1,116 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Standard Library
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft::React::Networking {
+
+struct HttpConnectionMetrics {
+  // Origins passed to Preconnect, and what came of them.
+  size_t PreconnectsRequested{0};
+  size_t PreconnectsSkipped{0}; // Already connected, or being connected.
+  size_t PreconnectsSucceeded{0};
+  size_t PreconnectsFailed{0};
+
+  // Milliseconds spent by the successful preconnects, in total.
+  int64_t PreconnectTime{0};
+
+  // Requests sent to an origin connected to within the idle timeout, and the others.
+  size_t WarmRequests{0};
+  size_t ColdRequests{0};
+};
+
+/// <summary>
+/// Opens connections to origins ahead of the requests to them, so that DNS
+/// resolution and the TCP and TLS handshakes are not on their critical path.
+///
+/// At most MaxConnects origins are connected to at once; the others wait in
+/// order. An origin connected to, or requested, within IdleTimeout is
+/// considered warm: it is not connected to again, and requests to it count as
+/// reusing a connection.
+/// </summary>
+class HttpPreconnector final {
+ public:
+  struct Options {
+    size_t MaxConnects{4};
+
+    // Milliseconds an unused connection is expected to stay open.
+    int64_t IdleTimeout{60 * 1000};
+
+    // Current time, in milliseconds. Defaults to the steady clock.
+    std::function<int64_t()> Now;
+  };
+
+  /// <summary>
+  /// Connects to an origin, such as "https://example.com:8443", then calls done, from any thread, with whether it
+  /// could. done must be called once, while the preconnector exists.
+  /// </summary>
+  using ConnectFunction = std::function<void(const std::string &origin, std::function<void(bool)> &&done)>;
+
+  HttpPreconnector(ConnectFunction &&connect) noexcept;
+
+  HttpPreconnector(ConnectFunction &&connect, Options options) noexcept;
+
+  /// <summary>
+  /// Queues a connection to the origin of each HTTP or HTTPS URL, unless it is warm or already queued.
+  /// Connections may start right away, on the calling thread.
+  /// </summary>
+  void Preconnect(const std::vector<std::string> &urls) noexcept;
+
+  /// <summary>
+  /// Counts a request to url as warm or cold, and keeps its origin warm.
+  /// </summary>
+  void NoteRequest(const std::string &url) noexcept;
+
+  bool IsWarm(const std::string &origin) const noexcept;
+
+  HttpConnectionMetrics Metrics() const noexcept;
+
+  size_t QueuedCount() const noexcept;
+
+  size_t ActiveCount() const noexcept;
+
+ private:
+  // Origins remembered as warm before the expired ones are dropped.
+  static constexpr size_t MaxWarmOrigins = 64;
+
+  int64_t Now() const noexcept;
+
+  // Must be called with the lock held.
+  bool IsWarm(const std::string &origin, int64_t now) const noexcept;
+
+  // Must be called with the lock held.
+  void MarkWarm(const std::string &origin, int64_t now) noexcept;
+
+  // Must be called with the lock held. Returns the origins to connect to once the lock is released.
+  std::vector<std::string> Dequeue() noexcept;
+
+  void ConnectAll(std::vector<std::string> &&origins) noexcept;
+
+  void OnConnected(const std::string &origin, bool succeeded) noexcept;
+
+  ConnectFunction m_connect;
+  Options m_options;
+
+  mutable std::mutex m_mutex;
+  std::deque<std::string> m_queued;
+
+  // Start time of the connections in progress, by origin.
+  std::unordered_map<std::string, int64_t> m_active;
+
+  // Last time each origin was connected to or requested.
+  std::unordered_map<std::string, int64_t> m_lastUsed;
+
+  HttpConnectionMetrics m_metrics;
+};
+
+} // namespace Microsoft::React::Networking
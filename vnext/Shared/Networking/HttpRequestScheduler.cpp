@@ -0,0 +1,214 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HttpRequestScheduler.h"
+
+// Boost Libraries
+#include <boost/algorithm/string.hpp>
+
+// Standard Library
+#include <algorithm>
+#include <chrono>
+
+using std::function;
+using std::scoped_lock;
+using std::string;
+using std::vector;
+
+namespace Microsoft::React::Networking {
+
+HttpRequestPriority GetRequestPriority(
+    const std::unordered_map<string, string> &headers,
+    const string &responseType) noexcept {
+  for (const auto &[name, value] : headers) {
+    if (!boost::iequals(name, "Priority")) {
+      continue;
+    }
+
+    // Dictionary of parameters, such as "u=1, i". Urgency ranges from 0 (highest) to 7, and defaults to 3.
+    vector<string> parameters;
+    boost::split(parameters, value, boost::is_any_of(","));
+    for (auto &parameter : parameters) {
+      boost::trim(parameter);
+      if (parameter.size() == 3 && parameter[0] == 'u' && parameter[1] == '=' && parameter[2] >= '0' &&
+          parameter[2] <= '7') {
+        const auto urgency = parameter[2] - '0';
+        if (urgency <= 2) {
+          return HttpRequestPriority::High;
+        }
+
+        return urgency <= 4 ? HttpRequestPriority::Normal : HttpRequestPriority::Low;
+      }
+    }
+
+    return HttpRequestPriority::Normal;
+  }
+
+  return responseType == "base64" ? HttpRequestPriority::Low : HttpRequestPriority::Normal;
+}
+
+string GetRequestHost(const string &url) noexcept {
+  const auto schemeEnd = url.find("://");
+  if (schemeEnd == string::npos) {
+    return url;
+  }
+
+  const auto authorityStart = schemeEnd + 3;
+  const auto authorityEnd = std::min(url.find_first_of("/?#", authorityStart), url.size());
+  auto authority = url.substr(authorityStart, authorityEnd - authorityStart);
+  if (const auto userInfoEnd = authority.rfind('@'); userInfoEnd != string::npos) {
+    authority.erase(0, userInfoEnd + 1);
+  }
+
+  return boost::to_lower_copy(url.substr(0, authorityStart) + authority);
+}
+
+HttpRequestScheduler::HttpRequestScheduler() noexcept : HttpRequestScheduler(Options{}) {}
+
+HttpRequestScheduler::HttpRequestScheduler(Options options) noexcept : m_options{std::move(options)} {
+  m_options.MaxRequests = std::max<size_t>(m_options.MaxRequests, 1);
+  m_options.MaxRequestsPerHost = std::max<size_t>(m_options.MaxRequestsPerHost, 1);
+}
+
+int64_t HttpRequestScheduler::Now() const noexcept {
+  if (m_options.Now) {
+    return m_options.Now();
+  }
+
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void HttpRequestScheduler::Enqueue(
+    int64_t requestId,
+    string &&host,
+    HttpRequestPriority priority,
+    function<void()> &&send) noexcept {
+  vector<function<void()>> sends;
+  {
+    scoped_lock lock{m_mutex};
+    auto &queue = m_queues[static_cast<size_t>(priority)];
+    auto &requests = queue.Requests[host];
+    if (requests.empty()) {
+      queue.Hosts.push_back(host);
+    }
+    requests.push_back(QueuedRequest{requestId, Now(), std::move(send)});
+    m_queued.emplace(requestId, std::make_pair(priority, std::move(host)));
+
+    sends = Dequeue();
+  }
+
+  SendAll(std::move(sends));
+}
+
+bool HttpRequestScheduler::Cancel(int64_t requestId) noexcept {
+  scoped_lock lock{m_mutex};
+  auto queued = m_queued.find(requestId);
+  if (queued == m_queued.end()) {
+    return false;
+  }
+
+  const auto &[priority, host] = queued->second;
+  auto &queue = m_queues[static_cast<size_t>(priority)];
+  auto &requests = queue.Requests[host];
+  requests.erase(std::find_if(requests.begin(), requests.end(), [requestId](const QueuedRequest &request) {
+    return request.RequestId == requestId;
+  }));
+  if (requests.empty()) {
+    queue.Requests.erase(host);
+    queue.Hosts.erase(std::find(queue.Hosts.begin(), queue.Hosts.end(), host));
+  }
+  m_queued.erase(queued);
+
+  return true;
+}
+
+void HttpRequestScheduler::Complete(int64_t requestId) noexcept {
+  vector<function<void()>> sends;
+  {
+    scoped_lock lock{m_mutex};
+    auto active = m_active.find(requestId);
+    if (active == m_active.end()) {
+      return;
+    }
+
+    if (auto perHost = m_activePerHost.find(active->second.Host); --perHost->second == 0) {
+      m_activePerHost.erase(perHost);
+    }
+    m_active.erase(active);
+
+    sends = Dequeue();
+  }
+
+  SendAll(std::move(sends));
+}
+
+int64_t HttpRequestScheduler::QueueTime(int64_t requestId) const noexcept {
+  scoped_lock lock{m_mutex};
+  auto active = m_active.find(requestId);
+
+  return active == m_active.end() ? 0 : active->second.QueueTime;
+}
+
+size_t HttpRequestScheduler::QueuedCount() const noexcept {
+  scoped_lock lock{m_mutex};
+  return m_queued.size();
+}
+
+size_t HttpRequestScheduler::ActiveCount() const noexcept {
+  scoped_lock lock{m_mutex};
+  return m_active.size();
+}
+
+vector<function<void()>> HttpRequestScheduler::Dequeue() noexcept {
+  vector<function<void()>> sends;
+  const auto now = Now();
+
+  for (size_t priority = 0; priority < PriorityCount; priority++) {
+    auto maxRequests = m_options.MaxRequests;
+    if (priority != static_cast<size_t>(HttpRequestPriority::High)) {
+      maxRequests -= std::min(m_options.ReservedHighPriorityRequests, m_options.MaxRequests - 1);
+    }
+
+    // Give each host with queued requests a turn, skipping those at their limit.
+    auto &queue = m_queues[priority];
+    size_t skipped = 0;
+    while (m_active.size() < maxRequests && skipped < queue.Hosts.size()) {
+      auto host = std::move(queue.Hosts.front());
+      queue.Hosts.pop_front();
+
+      auto &perHost = m_activePerHost[host];
+      if (perHost >= m_options.MaxRequestsPerHost) {
+        queue.Hosts.push_back(std::move(host));
+        skipped++;
+        continue;
+      }
+
+      auto &requests = queue.Requests[host];
+      auto request = std::move(requests.front());
+      requests.pop_front();
+
+      perHost++;
+      m_queued.erase(request.RequestId);
+      m_active.emplace(request.RequestId, ActiveRequest{host, now - request.EnqueueTime});
+      sends.push_back(std::move(request.Send));
+
+      if (requests.empty()) {
+        queue.Requests.erase(host);
+      } else {
+        queue.Hosts.push_back(std::move(host));
+      }
+      skipped = 0;
+    }
+  }
+
+  return sends;
+}
+
+void HttpRequestScheduler::SendAll(vector<function<void()>> &&sends) noexcept {
+  for (auto &send : sends) {
+    send();
+  }
+}
+
+} // namespace Microsoft::React::Networking
@@ -0,0 +1,121 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Standard Library
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft::React::Networking {
+
+enum class HttpRequestPriority : size_t { High = 0, Normal, Low };
+
+/// <summary>
+/// Priority of a request, from the urgency of its Priority header (RFC 9218) if any.
+/// Otherwise, base64 responses (binary downloads) are Low and everything else Normal.
+/// </summary>
+HttpRequestPriority GetRequestPriority(
+    const std::unordered_map<std::string, std::string> &headers,
+    const std::string &responseType) noexcept;
+
+/// <summary>
+/// Scheme, host and port of the URL, in lower case. Requests are limited per host by this value.
+/// </summary>
+std::string GetRequestHost(const std::string &url) noexcept;
+
+/// <summary>
+/// Decides when queued HTTP requests are sent.
+///
+/// At most MaxRequests requests are in flight, and at most MaxRequestsPerHost
+/// to the same host. Higher priority requests are sent first. Within a
+/// priority, hosts take turns so that a burst of requests to one host does
+/// not hold back the requests to the others. The last
+/// ReservedHighPriorityRequests slots are only used by High priority requests,
+/// so that long lived downloads cannot starve the requests the user waits on.
+/// </summary>
+class HttpRequestScheduler final {
+ public:
+  struct Options {
+    size_t MaxRequests{16};
+    size_t MaxRequestsPerHost{6};
+    size_t ReservedHighPriorityRequests{1};
+
+    // Current time, in milliseconds. Defaults to the steady clock.
+    std::function<int64_t()> Now;
+  };
+
+  HttpRequestScheduler() noexcept;
+
+  HttpRequestScheduler(Options options) noexcept;
+
+  /// <summary>
+  /// Queues a request. send is called once the request may be sent, which may be right away on the calling thread.
+  /// </summary>
+  void Enqueue(
+      int64_t requestId,
+      std::string &&host,
+      HttpRequestPriority priority,
+      std::function<void()> &&send) noexcept;
+
+  /// <summary>
+  /// Drops a request that has not been sent yet.
+  /// Returns false if the request was already sent, or is not known.
+  /// </summary>
+  bool Cancel(int64_t requestId) noexcept;
+
+  /// <summary>
+  /// Releases the slot of a sent request once it completed, failed or was aborted, and sends the queued requests
+  /// this makes room for. Completing a request more than once has no effect.
+  /// </summary>
+  void Complete(int64_t requestId) noexcept;
+
+  // Milliseconds a sent request waited in the queue, or 0 if not known.
+  int64_t QueueTime(int64_t requestId) const noexcept;
+
+  size_t QueuedCount() const noexcept;
+
+  size_t ActiveCount() const noexcept;
+
+ private:
+  static constexpr size_t PriorityCount = 3;
+
+  struct QueuedRequest {
+    int64_t RequestId;
+    int64_t EnqueueTime;
+    std::function<void()> Send;
+  };
+
+  struct ActiveRequest {
+    std::string Host;
+    int64_t QueueTime;
+  };
+
+  struct PriorityQueue {
+    // Hosts with queued requests, in the order they take turns.
+    std::deque<std::string> Hosts;
+    std::unordered_map<std::string, std::deque<QueuedRequest>> Requests;
+  };
+
+  int64_t Now() const noexcept;
+
+  // Must be called with the lock held. Returns the send functions to call once the lock is released.
+  std::vector<std::function<void()>> Dequeue() noexcept;
+
+  void SendAll(std::vector<std::function<void()>> &&sends) noexcept;
+
+  Options m_options;
+
+  mutable std::mutex m_mutex;
+  PriorityQueue m_queues[PriorityCount];
+  std::unordered_map<int64_t, std::pair<HttpRequestPriority, std::string>> m_queued;
+  std::unordered_map<int64_t, ActiveRequest> m_active;
+  std::unordered_map<std::string, size_t> m_activePerHost;
+};
+
+} // namespace Microsoft::React::Networking
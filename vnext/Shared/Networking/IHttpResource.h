@@ -5,6 +5,7 @@
 
 // React Native Windows
 #include <JSValue.h>
+#include "HttpPreconnector.h"
 
 // Windows API
 #include <winrt/Windows.Foundation.h>
@@ -14,6 +15,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace Microsoft::React::Networking {
 
@@ -29,6 +31,9 @@ struct IHttpResource {
     int64_t StatusCode;
     std::string Url;
     Headers Headers;
+
+    // Milliseconds the request waited in the queue of the Networking module before it was sent.
+    int64_t QueueTime{0};
   };
 
   static std::shared_ptr<IHttpResource> Make() noexcept;
@@ -90,6 +95,20 @@ struct IHttpResource {
 
   virtual void ClearCookies() noexcept = 0;
 
+  /// <summary>
+  /// Opens connections to the origins of the given URLs ahead of the requests to them, so that DNS resolution and
+  /// the TCP and TLS handshakes are done by the time the requests are sent.
+  /// </summary>
+  /// <param name="urls">
+  /// HTTP or HTTPS URLs. Only their scheme, host and port are used.
+  /// </param>
+  virtual void Preconnect(std::vector<std::string> &&urls) noexcept = 0;
+
+  /// <summary>
+  /// Counts the preconnects and the requests sent to origins with open connections.
+  /// </summary>
+  virtual HttpConnectionMetrics GetConnectionMetrics() const noexcept = 0;
+
   /// <summary>
   /// Sets a function to be invoked when a request has been successfully responded.
   /// </summary>
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -121,6 +122,14 @@ struct IWebSocketResource {
   /// </param>
   virtual void SendBinary(std::string &&base64String) noexcept = 0;
 
+  /// <summary>
+  /// Sends a binary message to the remote endpoint.
+  /// </summary>
+  /// <param name="data">
+  /// Message bytes. The resource takes ownership of them and writes them without copying.
+  /// </param>
+  virtual void SendBytes(std::vector<uint8_t> &&data) noexcept = 0;
+
   /// <summary>
   /// Terminates this resource's connection to the remote endpoint.
   /// This instance can't be restarted or re-connected afterwards.
@@ -136,6 +145,11 @@ struct IWebSocketResource {
   /// </returns>
   virtual ReadyState GetReadyState() const noexcept = 0;
 
+  /// <returns>
+  /// Number of bytes of the messages sent but not written to the network yet.
+  /// </returns>
+  virtual std::size_t GetBufferedAmount() const noexcept = 0;
+
   /// <summary>
   /// Sets the optional custom behavior on a successful connection.
   /// </summary>
@@ -167,6 +181,16 @@ struct IWebSocketResource {
   virtual void SetOnMessage(
       std::function<void(std::size_t, const std::string &, bool isBinary)> &&handler) noexcept = 0;
 
+  /// <summary>
+  /// Sets the optional custom behavior to run when there is an incoming
+  /// binary message.
+  /// When set, binary messages are passed to this handler as bytes instead of
+  /// to the message handler as Base64 strings.
+  /// </summary>
+  /// <param name="handler">
+  /// </param>
+  virtual void SetOnBinaryMessage(std::function<void(std::vector<uint8_t> &&)> &&handler) noexcept = 0;
+
   /// <summary>
   /// Sets the optional custom behavior to run when this instance is closed.
   /// </summary>
@@ -180,6 +204,14 @@ struct IWebSocketResource {
   /// <param name="handler">
   /// </param>
   virtual void SetOnError(std::function<void(Error &&)> &&handler) noexcept = 0;
+
+  /// <summary>
+  /// Sets the optional custom behavior to run when the buffered amount goes
+  /// above the high watermark (true), then back to the low watermark (false).
+  /// </summary>
+  /// <param name="handler">
+  /// </param>
+  virtual void SetOnBackpressure(std::function<void(bool isPaused)> &&handler) noexcept = 0;
 };
 
 } // namespace Microsoft::React::Networking
@@ -19,6 +19,7 @@
 
 using std::set;
 using std::string;
+using std::vector;
 using std::wstring;
 
 using winrt::hresult_error;
@@ -60,63 +61,56 @@ bool OriginPolicyHttpFilter::CaseInsensitiveComparer::operator()(const wstring &
 #pragma endregion CaseInsensitiveComparer
 
 // https://fetch.spec.whatwg.org/#forbidden-method
-/*static*/ set<const wchar_t *, OriginPolicyHttpFilter::CaseInsensitiveComparer>
-    OriginPolicyHttpFilter::s_forbiddenMethods = {L"CONNECT", L"TRACE", L"TRACK"};
+/*static*/ const CaseInsensitiveNameSet OriginPolicyHttpFilter::s_forbiddenMethods = {L"CONNECT", L"TRACE", L"TRACK"};
 
-/*static*/ set<const wchar_t *, OriginPolicyHttpFilter::CaseInsensitiveComparer>
-    OriginPolicyHttpFilter::s_simpleCorsMethods = {L"GET", L"HEAD", L"POST"};
+/*static*/ const CaseInsensitiveNameSet OriginPolicyHttpFilter::s_simpleCorsMethods = {L"GET", L"HEAD", L"POST"};
 
-/*static*/ set<const wchar_t *, OriginPolicyHttpFilter::CaseInsensitiveComparer>
-    OriginPolicyHttpFilter::s_simpleCorsRequestHeaderNames = {
-        L"Accept",
-        L"Accept-Language",
-        L"Content-Language",
-        L"Content-Type",
-        L"DPR",
-        L"Downlink",
-        L"Save-Data",
-        L"Viewport-Width",
-        L"Width"};
+/*static*/ const CaseInsensitiveNameSet OriginPolicyHttpFilter::s_simpleCorsRequestHeaderNames = {
+    L"Accept",
+    L"Accept-Language",
+    L"Content-Language",
+    L"Content-Type",
+    L"DPR",
+    L"Downlink",
+    L"Save-Data",
+    L"Viewport-Width",
+    L"Width"};
 
-/*static*/ set<const wchar_t *, OriginPolicyHttpFilter::CaseInsensitiveComparer>
-    OriginPolicyHttpFilter::s_simpleCorsResponseHeaderNames =
-        {L"Cache-Control", L"Content-Language", L"Content-Type", L"Expires", L"Last-Modified", L"Pragma"};
+/*static*/ const CaseInsensitiveNameSet OriginPolicyHttpFilter::s_simpleCorsResponseHeaderNames =
+    {L"Cache-Control", L"Content-Language", L"Content-Type", L"Expires", L"Last-Modified", L"Pragma"};
 
-/*static*/ set<const wchar_t *, OriginPolicyHttpFilter::CaseInsensitiveComparer>
-    OriginPolicyHttpFilter::s_simpleCorsContentTypeValues = {
-        L"application/x-www-form-urlencoded",
-        L"multipart/form-data",
-        L"text/plain"};
+/*static*/ const CaseInsensitiveNameSet OriginPolicyHttpFilter::s_simpleCorsContentTypeValues = {
+    L"application/x-www-form-urlencoded",
+    L"multipart/form-data",
+    L"text/plain"};
 
 // https://fetch.spec.whatwg.org/#forbidden-header-name
 // Chromium still bans "User-Agent" due to https://crbug.com/571722
-/*static*/ set<const wchar_t *, OriginPolicyHttpFilter::CaseInsensitiveComparer>
-    OriginPolicyHttpFilter::s_corsForbiddenRequestHeaderNames = {
-        L"Accept-Charset",
-        L"Accept-Encoding",
-        L"Access-Control-Request-Headers",
-        L"Access-Control-Request-Method",
-        L"Connection",
-        L"Content-Length",
-        L"Cookie",
-        L"Cookie2",
-        L"Date",
-        L"DNT",
-        L"Expect",
-        L"Host",
-        L"Keep-Alive",
-        L"Origin",
-        L"Referer",
-        L"TE",
-        L"Trailer",
-        L"Transfer-Encoding",
-        L"Upgrade",
-        L"Via"};
-
-/*static*/ set<const wchar_t *, OriginPolicyHttpFilter::CaseInsensitiveComparer>
-    OriginPolicyHttpFilter::s_cookieSettingResponseHeaders = {
-        L"Set-Cookie",
-        L"Set-Cookie2", // Deprecated by the spec, but probably still used
+/*static*/ const CaseInsensitiveNameSet OriginPolicyHttpFilter::s_corsForbiddenRequestHeaderNames = {
+    L"Accept-Charset",
+    L"Accept-Encoding",
+    L"Access-Control-Request-Headers",
+    L"Access-Control-Request-Method",
+    L"Connection",
+    L"Content-Length",
+    L"Cookie",
+    L"Cookie2",
+    L"Date",
+    L"DNT",
+    L"Expect",
+    L"Host",
+    L"Keep-Alive",
+    L"Origin",
+    L"Referer",
+    L"TE",
+    L"Trailer",
+    L"Transfer-Encoding",
+    L"Upgrade",
+    L"Via"};
+
+/*static*/ const CaseInsensitiveNameSet OriginPolicyHttpFilter::s_cookieSettingResponseHeaders = {
+    L"Set-Cookie",
+    L"Set-Cookie2", // Deprecated by the spec, but probably still used
 };
 
 /*static*/ set<const wchar_t *, OriginPolicyHttpFilter::CaseInsensitiveComparer>
@@ -129,12 +123,12 @@ bool OriginPolicyHttpFilter::CaseInsensitiveComparer::operator()(const wstring &
 /*static*/ bool OriginPolicyHttpFilter::IsSimpleCorsRequest(HttpRequestMessage const &request) noexcept {
   // Ensure header is in Simple CORS allowlist
   for (const auto &header : request.Headers()) {
-    if (s_simpleCorsRequestHeaderNames.find(header.Key().c_str()) == s_simpleCorsRequestHeaderNames.cend())
+    if (!s_simpleCorsRequestHeaderNames.Contains(header.Key()))
       return false;
 
     // Ensure Content-Type value is in Simple CORS allowlist, if present
     if (boost::iequals(header.Key(), L"Content-Type")) {
-      if (s_simpleCorsContentTypeValues.find(header.Value().c_str()) != s_simpleCorsContentTypeValues.cend())
+      if (s_simpleCorsContentTypeValues.Contains(header.Value()))
         return false;
     }
   }
@@ -143,20 +137,19 @@ bool OriginPolicyHttpFilter::CaseInsensitiveComparer::operator()(const wstring &
   if (auto content = request.Content()) {
     for (const auto &header : content.Headers()) {
       // WinRT automatically appends non-allowlisted header Content-Length when Content-Type is set. Skip it.
-      if (s_simpleCorsRequestHeaderNames.find(header.Key().c_str()) == s_simpleCorsRequestHeaderNames.cend() &&
-          !boost::iequals(header.Key(), "Content-Length"))
+      if (!s_simpleCorsRequestHeaderNames.Contains(header.Key()) && !boost::iequals(header.Key(), "Content-Length"))
         return false;
 
       // Ensure Content-Type value is in Simple CORS allowlist, if present
       if (boost::iequals(header.Key(), L"Content-Type")) {
-        if (s_simpleCorsContentTypeValues.find(header.Value().c_str()) == s_simpleCorsContentTypeValues.cend())
+        if (!s_simpleCorsContentTypeValues.Contains(header.Value()))
           return false;
       }
     }
   }
 
   // Ensure method is in Simple CORS allowlist
-  return s_simpleCorsMethods.find(request.Method().ToString().c_str()) != s_simpleCorsMethods.cend();
+  return s_simpleCorsMethods.Contains(request.Method().ToString());
 }
 
 /*static*/ const hstring OriginPolicyHttpFilter::GetOrigin(Uri const &uri) noexcept {
@@ -174,7 +167,7 @@ bool OriginPolicyHttpFilter::CaseInsensitiveComparer::operator()(const wstring &
 /*static*/ bool OriginPolicyHttpFilter::AreSafeRequestHeaders(
     winrt::Windows::Web::Http::Headers::HttpRequestHeaderCollection const &headers) noexcept {
   for (const auto &header : headers) {
-    if (s_corsForbiddenRequestHeaderNames.find(header.Key().c_str()) != s_corsForbiddenRequestHeaderNames.cend())
+    if (s_corsForbiddenRequestHeaderNames.Contains(header.Key()))
       return false;
 
     for (const auto &prefix : s_corsForbiddenRequestHeaderNamePrefixes) {
@@ -288,7 +281,7 @@ bool OriginPolicyHttpFilter::CaseInsensitiveComparer::operator()(const wstring &
 
     // If header is not safe
     if (boost::istarts_with(headerName, L"Proxy-") || boost::istarts_with(headerName, L"Sec-") ||
-        s_corsForbiddenRequestHeaderNames.find(headerName) != s_corsForbiddenRequestHeaderNames.cend())
+        s_corsForbiddenRequestHeaderNames.Contains(headerName))
       continue;
 
     if (!IsCorsSafelistedRequestHeader(header.Key(), header.Value())) {
@@ -307,45 +300,29 @@ bool OriginPolicyHttpFilter::CaseInsensitiveComparer::operator()(const wstring &
 
 /*static*/ OriginPolicyHttpFilter::AccessControlValues OriginPolicyHttpFilter::ExtractAccessControlValues(
     IMap<hstring, hstring> const &headers) {
-  using std::wregex;
-  using std::wsregex_token_iterator;
-
   // https://tools.ietf.org/html/rfc2616#section-4.2
-  wregex rgx{L"\\s*,\\s*"};
-  AccessControlValues result;
-
-  auto ciStrCmp = [](const wstring &a, const wstring &b) { return _wcsicmp(a.c_str(), b.c_str()) < 0; };
-  set<wstring, decltype(ciStrCmp)> allowedHeaders{ciStrCmp};
-  set<wstring, decltype(ciStrCmp)> allowedMethods{ciStrCmp};
-  set<wstring, decltype(ciStrCmp)> exposedHeaders{ciStrCmp};
+  // Headers may be repeated, so the items of all occurrences are gathered.
+  auto appendList = [](CaseInsensitiveNames &names, hstring const &value) {
+    vector<wstring> items;
+    boost::split(items, std::wstring_view{value}, boost::is_any_of(L","));
+    for (auto &item : items) {
+      boost::trim(item);
+      if (!item.empty()) {
+        names.insert(std::move(item));
+      }
+    }
+  };
 
+  AccessControlValues result;
   for (const auto &header : headers) {
     if (boost::iequals(header.Key(), L"Access-Control-Allow-Headers")) {
-      auto value = wstring{header.Value().c_str()};
-
-      // TODO: Avoid redundant comparison.
-      auto parsed = set<wstring, decltype(ciStrCmp)>{
-          wsregex_token_iterator{value.cbegin(), value.cend(), rgx, -1}, wsregex_token_iterator{}, ciStrCmp};
-      allowedHeaders.insert(parsed.cbegin(), parsed.cend());
-      result.AllowedHeaders.insert(allowedHeaders.cbegin(), allowedHeaders.cend());
+      appendList(result.AllowedHeaders, header.Value());
     } else if (boost::iequals(header.Key(), L"Access-Control-Allow-Methods")) {
-      auto value = wstring{header.Value().c_str()};
-
-      // TODO: Avoid redundant comparison.
-      auto parsed = set<wstring, decltype(ciStrCmp)>{
-          wsregex_token_iterator{value.cbegin(), value.cend(), rgx, -1}, wsregex_token_iterator{}, ciStrCmp};
-      allowedMethods.insert(parsed.cbegin(), parsed.cend());
-      result.AllowedMethods.insert(allowedMethods.cbegin(), allowedMethods.cend());
+      appendList(result.AllowedMethods, header.Value());
     } else if (boost::iequals(header.Key(), L"Access-Control-Allow-Origin")) {
       result.AllowedOrigin = header.Value();
     } else if (boost::iequals(header.Key(), L"Access-Control-Expose-Headers")) {
-      auto value = wstring{header.Value().c_str()};
-
-      // TODO: Avoid redundant comparison.
-      auto parsed = set<wstring, decltype(ciStrCmp)>{
-          wsregex_token_iterator{value.cbegin(), value.cend(), rgx, -1}, wsregex_token_iterator{}, ciStrCmp};
-      exposedHeaders.insert(parsed.cbegin(), parsed.cend());
-      result.ExposedHeaders.insert(exposedHeaders.cbegin(), exposedHeaders.cend());
+      appendList(result.ExposedHeaders, header.Value());
     } else if (boost::iequals(header.Key(), L"Access-Control-Allow-Credentials")) {
       result.AllowedCredentials = header.Value();
     } else if (boost::iequals(header.Key(), L"Access-Control-Max-Age")) {
@@ -362,7 +339,7 @@ bool OriginPolicyHttpFilter::CaseInsensitiveComparer::operator()(const wstring &
   // Example: "Set-Cookie", L"id=a3fWa; Expires=Wed, 21 Oct 2020 07:28:00 GMT;  HttpOnly"
   std::queue<hstring> httpOnlyCookies;
   for (const auto &header : response.Headers()) {
-    if (s_cookieSettingResponseHeaders.find(header.Key().c_str()) == s_cookieSettingResponseHeaders.cend())
+    if (!s_cookieSettingResponseHeaders.Contains(header.Key()))
       continue;
 
     if (removeAll) {
@@ -435,7 +412,7 @@ OriginPolicy OriginPolicyHttpFilter::ValidateRequest(HttpRequestMessage const &r
       if (!AreSafeRequestHeaders(request.Headers()))
         throw hresult_error{E_INVALIDARG, L"Request header not allowed in cross-origin resource sharing"};
 
-      if (s_forbiddenMethods.find(request.Method().ToString().c_str()) != s_forbiddenMethods.cend())
+      if (s_forbiddenMethods.Contains(request.Method().ToString()))
         throw hresult_error{E_INVALIDARG, L"Request method not allowed in cross-origin resource sharing"};
 
       if (IsSameOrigin(m_origin, request.RequestUri()))
@@ -515,7 +492,7 @@ void OriginPolicyHttpFilter::ValidateAllowOrigin(
 
 void OriginPolicyHttpFilter::ValidatePreflightResponse(
     HttpRequestMessage const &request,
-    HttpResponseMessage const &response) const {
+    HttpResponseMessage const &response) {
   // https://developer.mozilla.org/en-US/docs/Web/HTTP/CORS/Errors/CORSExternalRedirectNotAllowed
   using winrt::Windows::Web::Http::HttpStatusCode;
   switch (response.StatusCode()) {
@@ -538,37 +515,26 @@ void OriginPolicyHttpFilter::ValidatePreflightResponse(
   // See https://fetch.spec.whatwg.org/#cors-preflight-fetch, section 4.8.7.5
   // Check if the request method is allowed
   bool withCredentials = props.Lookup(L"RequestArgs").as<RequestArgs>()->WithCredentials;
-  bool requestMethodAllowed = false;
-  for (const auto &method : controlValues.AllowedMethods) {
-    if (L"*" == method) {
-      if (!withCredentials) {
-        requestMethodAllowed = true;
-        break;
-      }
-    } else if (boost::iequals(method, request.Method().ToString())) {
-      requestMethodAllowed = true;
-      break;
-    }
-  }
+  const auto method = request.Method().ToString();
+  bool requestMethodAllowed = controlValues.AllowedMethods.contains(method) ||
+      (!withCredentials && controlValues.AllowedMethods.contains(L"*"));
 
   // Preflight should always allow simple CORS methods
-  requestMethodAllowed |= s_simpleCorsMethods.find(request.Method().ToString().c_str()) != s_simpleCorsMethods.cend();
+  requestMethodAllowed |= s_simpleCorsMethods.Contains(method);
 
   if (!requestMethodAllowed)
     throw hresult_error{
         E_INVALIDARG,
-        L"Method [" + request.Method().ToString() +
-            L"] is not allowed by Access-Control-Allow-Methods in preflight response"};
+        L"Method [" + method + L"] is not allowed by Access-Control-Allow-Methods in preflight response"};
 
   // Check if request headers are allowed
   // See https://fetch.spec.whatwg.org/#cors-preflight-fetch, section 4.8.7.6-7
   // Check if the header should be allowed through wildcard, if the request does not have credentials.
   bool requestHeadersAllowed = false;
-  if (!withCredentials && controlValues.AllowedHeaders.find(L"*") != controlValues.AllowedHeaders.cend()) {
+  if (!withCredentials && controlValues.AllowedHeaders.contains(L"*")) {
     // "Authorization" header cannot be allowed through wildcard alone.
     // "Authorization" is the only member of https://fetch.spec.whatwg.org/#cors-non-wildcard-request-header-name.
-    if (request.Headers().HasKey(L"Authorization") &&
-        controlValues.AllowedHeaders.find(L"Authorization") == controlValues.AllowedHeaders.cend())
+    if (request.Headers().HasKey(L"Authorization") && !controlValues.AllowedHeaders.contains(L"Authorization"))
       throw hresult_error{
           E_INVALIDARG,
           L"Request header field [Authorization] is not allowed by Access-Control-Allow-Headers in preflight response"};
@@ -580,7 +546,7 @@ void OriginPolicyHttpFilter::ValidatePreflightResponse(
     // User agents may use these headers internally.
     const set unsafeNotForbiddenHeaderNames = CorsUnsafeNotForbiddenRequestHeaderNames(request.Headers());
     for (const auto name : unsafeNotForbiddenHeaderNames) {
-      if (controlValues.AllowedHeaders.find(name) == controlValues.AllowedHeaders.cend())
+      if (!controlValues.AllowedHeaders.contains(name))
         throw hresult_error{
             E_INVALIDARG,
             L"Request header field [" + to_hstring(name) +
@@ -588,7 +554,33 @@ void OriginPolicyHttpFilter::ValidatePreflightResponse(
     }
   }
 
-  // #9770 - insert into preflight cache
+  // A tainted origin is serialized as "null", which does not identify the entry.
+  if (!m_origin || props.HasKey(L"TaintedOrigin"))
+    return;
+
+  m_preflightCache.Insert(
+      wstring{GetOrigin(m_origin)},
+      wstring{request.RequestUri().AbsoluteUri()},
+      withCredentials,
+      controlValues.MaxAge,
+      std::move(controlValues.AllowedMethods),
+      std::move(controlValues.AllowedHeaders));
+}
+
+bool OriginPolicyHttpFilter::IsPreflightCached(HttpRequestMessage const &request) const {
+  if (!m_origin)
+    return false;
+
+  const auto unsafeNotForbiddenHeaderNames = CorsUnsafeNotForbiddenRequestHeaderNames(request.Headers());
+  const vector<std::wstring_view> headerNames{
+      unsafeNotForbiddenHeaderNames.cbegin(), unsafeNotForbiddenHeaderNames.cend()};
+
+  return m_preflightCache.Matches(
+      wstring{GetOrigin(m_origin)},
+      wstring{request.RequestUri().AbsoluteUri()},
+      request.Properties().Lookup(L"RequestArgs").as<RequestArgs>()->WithCredentials,
+      request.Method().ToString(),
+      headerNames);
 }
 
 // See 10.7.4 of https://fetch.spec.whatwg.org/#http-network-or-cache-fetch
@@ -621,7 +613,7 @@ void OriginPolicyHttpFilter::ValidateResponse(HttpResponseMessage const &respons
       // Filter out response headers that are not in the Simple CORS allowlist
       std::queue<hstring> nonSimpleNames;
       for (const auto &header : response.Headers().GetView()) {
-        if (s_simpleCorsResponseHeaderNames.find(header.Key().c_str()) == s_simpleCorsResponseHeaderNames.cend())
+        if (!s_simpleCorsResponseHeaderNames.Contains(header.Key()))
           nonSimpleNames.push(header.Key());
       }
 
@@ -633,12 +625,12 @@ void OriginPolicyHttpFilter::ValidateResponse(HttpResponseMessage const &respons
       // Filter out response headers that are not simple headers and not in expose list
 
       // Keep simple headers and those found in the expose header list.
-      if (withCredentials || controlValues.ExposedHeaders.find(L"*") == controlValues.ExposedHeaders.cend()) {
+      if (withCredentials || !controlValues.ExposedHeaders.contains(L"*")) {
         std::queue<hstring> nonSimpleNonExposedHeaders;
 
         for (const auto &header : response.Headers().GetView()) {
-          if (s_simpleCorsResponseHeaderNames.find(header.Key().c_str()) == s_simpleCorsResponseHeaderNames.cend() &&
-              controlValues.ExposedHeaders.find(header.Key().c_str()) == controlValues.ExposedHeaders.cend()) {
+          if (!s_simpleCorsResponseHeaderNames.Contains(header.Key()) &&
+              !controlValues.ExposedHeaders.contains(header.Key())) {
             nonSimpleNonExposedHeaders.push(header.Key());
           }
         }
@@ -761,8 +753,8 @@ ResponseOperation OriginPolicyHttpFilter::SendRequestAsync(HttpRequestMessage co
   }
 
   try {
-    // #9770 - Validate preflight cache
-    if (originPolicy == OriginPolicy::CrossOriginResourceSharing) {
+    // Skip the preflight if a previous one, still fresh, allows this request.
+    if (originPolicy == OriginPolicy::CrossOriginResourceSharing && !IsPreflightCached(coRequest)) {
       // If inner filter can AllowRedirect, disable for preflight.
       winrt::impl::com_ref<IHttpBaseProtocolFilter> baseFilter;
       baseFilter = m_innerFilter.try_as<IHttpBaseProtocolFilter>();
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include "CaseInsensitiveNameSet.h"
+#include "CorsPreflightCache.h"
 #include "IRedirectEventSource.h"
 #include "OriginPolicy.h"
 
@@ -28,28 +30,32 @@ class OriginPolicyHttpFilter
   };
 
  private:
-  static std::set<const wchar_t *, CaseInsensitiveComparer> s_forbiddenMethods;
-  static std::set<const wchar_t *, CaseInsensitiveComparer> s_simpleCorsMethods;
-  static std::set<const wchar_t *, CaseInsensitiveComparer> s_simpleCorsRequestHeaderNames;
-  static std::set<const wchar_t *, CaseInsensitiveComparer> s_simpleCorsResponseHeaderNames;
-  static std::set<const wchar_t *, CaseInsensitiveComparer> s_simpleCorsContentTypeValues;
-  static std::set<const wchar_t *, CaseInsensitiveComparer> s_corsForbiddenRequestHeaderNames;
+  static const CaseInsensitiveNameSet s_forbiddenMethods;
+  static const CaseInsensitiveNameSet s_simpleCorsMethods;
+  static const CaseInsensitiveNameSet s_simpleCorsRequestHeaderNames;
+  static const CaseInsensitiveNameSet s_simpleCorsResponseHeaderNames;
+  static const CaseInsensitiveNameSet s_simpleCorsContentTypeValues;
+  static const CaseInsensitiveNameSet s_corsForbiddenRequestHeaderNames;
   static std::set<const wchar_t *, CaseInsensitiveComparer> s_corsForbiddenRequestHeaderNamePrefixes;
-  static std::set<const wchar_t *, CaseInsensitiveComparer> s_cookieSettingResponseHeaders;
+  static const CaseInsensitiveNameSet s_cookieSettingResponseHeaders;
 
   struct AccessControlValues {
     winrt::hstring AllowedOrigin;
     winrt::hstring AllowedCredentials;
-    std::set<std::wstring, CaseInsensitiveComparer> AllowedHeaders;
-    std::set<std::wstring> AllowedMethods;
-    std::set<std::wstring, CaseInsensitiveComparer> ExposedHeaders;
-    size_t MaxAge;
+    CaseInsensitiveNames AllowedHeaders;
+    CaseInsensitiveNames AllowedMethods;
+    CaseInsensitiveNames ExposedHeaders;
+
+    // Seconds. See https://fetch.spec.whatwg.org/#http-access-control-max-age.
+    int64_t MaxAge{5};
   };
 
   winrt::Windows::Foundation::Uri m_origin;
 
   winrt::Windows::Web::Http::Filters::IHttpFilter m_innerFilter;
 
+  CorsPreflightCache m_preflightCache;
+
  public:
   static bool IsSameOrigin(
       winrt::Windows::Foundation::Uri const &u1,
@@ -83,9 +89,12 @@ class OriginPolicyHttpFilter
 
   OriginPolicy ValidateRequest(winrt::Windows::Web::Http::HttpRequestMessage const &request);
 
+  // Stores the allowed methods and headers in the preflight cache when the response is valid.
   void ValidatePreflightResponse(
       winrt::Windows::Web::Http::HttpRequestMessage const &request,
-      winrt::Windows::Web::Http::HttpResponseMessage const &response) const;
+      winrt::Windows::Web::Http::HttpResponseMessage const &response);
+
+  bool IsPreflightCached(winrt::Windows::Web::Http::HttpRequestMessage const &request) const;
 
   void ValidateResponse(
       winrt::Windows::Web::Http::HttpResponseMessage const &response,
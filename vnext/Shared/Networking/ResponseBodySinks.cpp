@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "ResponseBodySinks.h"
+
+// Standard Library
+#include <algorithm>
+#include <string_view>
+#include <vector>
+
+using std::shared_ptr;
+using std::string;
+using std::string_view;
+using std::vector;
+
+namespace Microsoft::React::Networking {
+
+uint32_t ResponseSegmentSize(uint32_t maxSize, std::optional<uint64_t> contentLength, bool isContentEncoded) noexcept {
+  if (!contentLength || isContentEncoded) {
+    return maxSize;
+  }
+
+  // Do not allocate more than the whole body
+  return static_cast<uint32_t>(std::clamp<uint64_t>(*contentLength, 1, maxSize));
+}
+
+#pragma region TextResponseBodySink
+
+TextResponseBodySink::TextResponseBodySink(IncrementalDataCallback onIncrementalData) noexcept
+    : m_onIncrementalData{std::move(onIncrementalData)} {}
+
+void TextResponseBodySink::Write(const uint8_t *data, size_t size) /*override*/ {
+  auto chars = reinterpret_cast<const char *>(data);
+  if (m_onIncrementalData) {
+    m_onIncrementalData(string{chars, size});
+  } else {
+    m_text.append(chars, size);
+  }
+}
+
+string TextResponseBodySink::TakeText() noexcept {
+  return std::move(m_text);
+}
+
+#pragma endregion TextResponseBodySink
+
+#pragma region Base64ResponseBodySink
+
+void Base64ResponseBodySink::Write(const uint8_t *data, size_t size) /*override*/ {
+  m_encoder.Update(string_view{reinterpret_cast<const char *>(data), size}, m_base64);
+}
+
+string Base64ResponseBodySink::TakeBase64() {
+  m_encoder.Finish(m_base64);
+  return std::move(m_base64);
+}
+
+#pragma endregion Base64ResponseBodySink
+
+#pragma region BlobResponseBodySink
+
+BlobResponseBodySink::BlobResponseBodySink(shared_ptr<IBlobPersistor> blobPersistor) noexcept
+    : m_blobPersistor{std::move(blobPersistor)} {}
+
+void BlobResponseBodySink::Write(const uint8_t *data, size_t size) /*override*/ {
+  m_body.Append(m_blobPersistor->MakeView(vector<uint8_t>(data, data + size)));
+}
+
+size_t BlobResponseBodySink::Size() const noexcept {
+  return m_body.Size();
+}
+
+string BlobResponseBodySink::Store() noexcept {
+  return m_blobPersistor->StoreView(std::move(m_body));
+}
+
+#pragma endregion BlobResponseBodySink
+
+} // namespace Microsoft::React::Networking
@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <Base64.h>
+#include <IBlobPersistor.h>
+#include <Modules/IResponseBodySink.h>
+
+// Standard Library
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace Microsoft::React::Networking {
+
+/// <summary>
+/// The size of the segments a response body is read in: maxSize, or the
+/// Content-Length when it is smaller. The Content-Length of a content-encoded
+/// body is its encoded size, while reads return it decompressed, so it does
+/// not bound those segments.
+/// </summary>
+uint32_t ResponseSegmentSize(uint32_t maxSize, std::optional<uint64_t> contentLength, bool isContentEncoded) noexcept;
+
+/// <summary>
+/// Gathers the response body as text, or passes each chunk on as it arrives
+/// when the request asked for incremental updates.
+/// </summary>
+class TextResponseBodySink final : public IResponseBodySink {
+ public:
+  using IncrementalDataCallback = std::function<void(std::string &&data)>;
+
+  TextResponseBodySink() noexcept = default;
+
+  explicit TextResponseBodySink(IncrementalDataCallback onIncrementalData) noexcept;
+
+  void Write(const uint8_t *data, size_t size) override;
+
+  // The gathered text. Empty when passing chunks on.
+  std::string TakeText() noexcept;
+
+ private:
+  IncrementalDataCallback m_onIncrementalData;
+  std::string m_text;
+};
+
+/// <summary>
+/// Encodes the response body in base64 as it arrives. Chunks that do not end
+/// on a 3 byte boundary carry their last bytes over to the next one, so the
+/// encoding is the one of the whole body.
+/// </summary>
+class Base64ResponseBodySink final : public IResponseBodySink {
+ public:
+  void Write(const uint8_t *data, size_t size) override;
+
+  // Completes the encoding and returns it.
+  std::string TakeBase64();
+
+ private:
+  Utilities::Base64Encoder m_encoder;
+  std::string m_base64;
+};
+
+/// <summary>
+/// Stores the response body as a blob made of one chunk per write, rather
+/// than gathering the body before storing it.
+/// </summary>
+class BlobResponseBodySink final : public IResponseBodySink {
+ public:
+  BlobResponseBodySink(std::shared_ptr<IBlobPersistor> blobPersistor) noexcept;
+
+  void Write(const uint8_t *data, size_t size) override;
+
+  size_t Size() const noexcept;
+
+  // Stores the blob and returns its id.
+  std::string Store() noexcept;
+
+ private:
+  std::shared_ptr<IBlobPersistor> m_blobPersistor;
+  BlobView m_body;
+};
+
+} // namespace Microsoft::React::Networking
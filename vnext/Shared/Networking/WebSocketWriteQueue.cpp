@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "WebSocketWriteQueue.h"
+
+// Standard Library
+#include <algorithm>
+
+using std::scoped_lock;
+
+namespace Microsoft::React::Networking {
+
+WebSocketWriteQueue::WebSocketWriteQueue() noexcept : WebSocketWriteQueue(Options{}) {}
+
+WebSocketWriteQueue::WebSocketWriteQueue(Options options) noexcept : m_options{std::move(options)} {
+  m_options.LowWatermark = std::min(m_options.LowWatermark, m_options.HighWatermark);
+}
+
+WebSocketWriteQueue::Update WebSocketWriteQueue::Push(Message &&message) noexcept {
+  scoped_lock lock{m_mutex};
+  m_bufferedAmount += message.Size();
+  m_queue.push_back(std::move(message));
+
+  return Next();
+}
+
+WebSocketWriteQueue::Update WebSocketWriteQueue::Complete() noexcept {
+  scoped_lock lock{m_mutex};
+  m_bufferedAmount -= m_writingSize;
+  m_writingSize = 0;
+  m_isWriting = false;
+
+  return Next();
+}
+
+WebSocketWriteQueue::Update WebSocketWriteQueue::Clear() noexcept {
+  scoped_lock lock{m_mutex};
+  m_queue.clear();
+  m_bufferedAmount = m_writingSize;
+
+  return Next();
+}
+
+size_t WebSocketWriteQueue::BufferedAmount() const noexcept {
+  scoped_lock lock{m_mutex};
+  return m_bufferedAmount;
+}
+
+bool WebSocketWriteQueue::IsUnderBackpressure() const noexcept {
+  scoped_lock lock{m_mutex};
+  return m_isUnderBackpressure;
+}
+
+WebSocketWriteQueue::Update WebSocketWriteQueue::Next() noexcept {
+  Update update;
+  if (!m_isUnderBackpressure && m_bufferedAmount > m_options.HighWatermark) {
+    m_isUnderBackpressure = true;
+    update.Backpressure = true;
+  } else if (m_isUnderBackpressure && m_bufferedAmount <= m_options.LowWatermark) {
+    m_isUnderBackpressure = false;
+    update.Backpressure = false;
+  }
+
+  if (m_isWriting) {
+    return update;
+  }
+
+  while (!m_queue.empty() && (update.Batch.empty() || m_writingSize < m_options.MaxBatchSize)) {
+    m_writingSize += m_queue.front().Size();
+    update.Batch.push_back(std::move(m_queue.front()));
+    m_queue.pop_front();
+  }
+  m_isWriting = !update.Batch.empty();
+
+  return update;
+}
+
+} // namespace Microsoft::React::Networking
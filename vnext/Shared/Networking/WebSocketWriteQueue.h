@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Standard Library
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Microsoft::React::Networking {
+
+/// <summary>
+/// Orders the messages sent by a WebSocket, and gathers those queued while a
+/// write is in progress into batches written one after the other.
+///
+/// The queue does not write anything itself. Push and Complete return the next
+/// batch to write, if the socket is not writing one already, so that at most
+/// one batch is written at a time. The buffered amount counts the bytes of the
+/// messages pushed and not written yet. Once it exceeds HighWatermark, the
+/// queue reports backpressure until it drops to LowWatermark.
+/// </summary>
+class WebSocketWriteQueue final {
+ public:
+  struct Options {
+    // Batches are closed once they reach this many bytes. A batch holds at least one message.
+    size_t MaxBatchSize{64 * 1024};
+
+    size_t HighWatermark{8 * 1024 * 1024};
+    size_t LowWatermark{2 * 1024 * 1024};
+  };
+
+  struct Message {
+    bool IsBinary{false};
+    std::string Text;
+    std::vector<uint8_t> Bytes;
+
+    size_t Size() const noexcept {
+      return IsBinary ? Bytes.size() : Text.size();
+    }
+  };
+
+  struct Update {
+    // Messages to write now, in order. Empty if there is nothing to write, or a write is in progress.
+    std::vector<Message> Batch;
+
+    // Set when backpressure started (true) or stopped (false).
+    std::optional<bool> Backpressure;
+  };
+
+  WebSocketWriteQueue() noexcept;
+
+  WebSocketWriteQueue(Options options) noexcept;
+
+  Update Push(Message &&message) noexcept;
+
+  /// <summary>
+  /// To call once the last batch returned was written (or failed).
+  /// </summary>
+  Update Complete() noexcept;
+
+  /// <summary>
+  /// Drops the messages not written yet (ex: when the socket closes).
+  /// </summary>
+  Update Clear() noexcept;
+
+  size_t BufferedAmount() const noexcept;
+
+  bool IsUnderBackpressure() const noexcept;
+
+ private:
+  // Must be called with the lock held.
+  Update Next() noexcept;
+
+  Options m_options;
+
+  mutable std::mutex m_mutex;
+  std::deque<Message> m_queue;
+  size_t m_bufferedAmount{0};
+  size_t m_writingSize{0};
+  bool m_isWriting{false};
+  bool m_isUnderBackpressure{false};
+};
+
+} // namespace Microsoft::React::Networking
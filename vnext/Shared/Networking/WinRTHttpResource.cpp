@@ -7,15 +7,18 @@
 
 #include "HttpSettings.g.cpp"
 #include <CppRuntimeOptions.h>
+#include <MemoryMappedBuffer.h>
 #include <Networking/IBlobResource.h>
 #include <ReactPropertyBag.h>
 #include <Utils/CppWinrtLessExceptions.h>
 #include <Utils/WinRTConversions.h>
 #include <utilities.h>
+#include "DiskHttpCacheStore.h"
 #include "IRedirectEventSource.h"
 #include "Networking/NetworkPropertyIds.h"
 #include "OriginPolicyHttpFilter.h"
 #include "RedirectHttpFilter.h"
+#include "ResponseBodySinks.h"
 
 // Boost Libraries
 #include <boost/algorithm/string.hpp>
@@ -24,8 +27,13 @@
 #include <winrt/Windows.Foundation.Collections.h>
 #include <winrt/Windows.Security.Cryptography.h>
 #include <winrt/Windows.Storage.Streams.h>
+#include <winrt/Windows.Web.Http.Filters.h>
 #include <winrt/Windows.Web.Http.Headers.h>
 
+// Standard Library
+#include <algorithm>
+#include <filesystem>
+
 using std::function;
 using std::scoped_lock;
 using std::shared_ptr;
@@ -42,11 +50,13 @@ using winrt::Windows::Foundation::IInspectable;
 using winrt::Windows::Foundation::Uri;
 using winrt::Windows::Security::Cryptography::CryptographicBuffer;
 using winrt::Windows::Storage::StorageFile;
-using winrt::Windows::Storage::Streams::DataReader;
-using winrt::Windows::Storage::Streams::UnicodeEncoding;
+using winrt::Windows::Storage::Streams::Buffer;
+using winrt::Windows::Storage::Streams::InputStreamOptions;
 using winrt::Windows::Web::Http::HttpBufferContent;
+using winrt::Windows::Web::Http::HttpCompletionOption;
 using winrt::Windows::Web::Http::HttpMethod;
 using winrt::Windows::Web::Http::HttpRequestMessage;
+using winrt::Windows::Web::Http::HttpResponseMessage;
 using winrt::Windows::Web::Http::HttpStreamContent;
 using winrt::Windows::Web::Http::HttpStringContent;
 using winrt::Windows::Web::Http::IHttpClient;
@@ -63,10 +73,69 @@ constexpr uint32_t operator""_MiB(unsigned long long int x) {
   return static_cast<uint32_t>(1024_KiB * x);
 }
 
+// A client that only opens connections: without cookies, redirects, cache or the origin policy filter, a preconnect
+// has no effect a server can see beyond the HEAD request itself, and cross-origin preconnects are not blocked.
+IHttpClient CreatePreconnectClient() {
+  using namespace winrt::Windows::Web::Http::Filters;
+
+  HttpBaseProtocolFilter filter;
+  filter.AllowAutoRedirect(false);
+  filter.AllowUI(false);
+  filter.CookieUsageBehavior(HttpCookieUsageBehavior::NoCookies);
+  filter.CacheControl().ReadBehavior(HttpCacheReadBehavior::NoCache);
+  filter.CacheControl().WriteBehavior(HttpCacheWriteBehavior::NoCache);
+
+  return winrt::Windows::Web::Http::HttpClient{filter};
+}
+
+// See ResponseSegmentSize.
+uint32_t SegmentSize(IHttpContent const &content, uint32_t maxSize) {
+  auto headers = content.Headers();
+  std::optional<uint64_t> contentLength;
+  if (auto length = headers.ContentLength()) {
+    contentLength = length.Value();
+  }
+
+  return Microsoft::React::Networking::ResponseSegmentSize(
+      maxSize, contentLength, headers.ContentEncoding().Size() > 0);
+}
+
 constexpr char responseTypeText[] = "text";
 constexpr char responseTypeBase64[] = "base64";
 constexpr char responseTypeBlob[] = "blob";
 
+// Gathers headers for both the response content and the response itself
+// See Invoke-WebRequest PowerShell cmdlet or Chromium response handling
+Microsoft::React::Networking::IHttpResource::Headers GatherHeaders(HttpResponseMessage const &response) {
+  Microsoft::React::Networking::IHttpResource::Headers headers;
+  for (auto header : response.Headers()) {
+    headers.emplace(winrt::to_string(header.Key()), winrt::to_string(header.Value()));
+  }
+  if (response.Content()) {
+    for (auto header : response.Content().Headers()) {
+      headers.emplace(winrt::to_string(header.Key()), winrt::to_string(header.Value()));
+    }
+  }
+
+  return headers;
+}
+
+// Bytes of a memory mapped file of the HTTP cache.
+class MappedFileChunk final : public Microsoft::React::BlobChunk {
+  std::unique_ptr<facebook::jsi::Buffer> m_buffer;
+
+ public:
+  MappedFileChunk(std::unique_ptr<facebook::jsi::Buffer> buffer) noexcept : m_buffer{std::move(buffer)} {}
+
+  const uint8_t *Data() const noexcept override {
+    return m_buffer->data();
+  }
+
+  size_t Size() const noexcept override {
+    return m_buffer->size();
+  }
+};
+
 } // namespace
 namespace Microsoft::React::Networking {
 
@@ -100,10 +169,22 @@ void AttachMultipartHeaders(IHttpContent content, const JSValueObject &headers)
 
 #pragma region WinRTHttpResource
 
-WinRTHttpResource::WinRTHttpResource(IHttpClient &&client) noexcept : m_client{std::move(client)} {}
+WinRTHttpResource::WinRTHttpResource(IHttpClient &&client) noexcept
+    : m_client{std::move(client)},
+      m_preconnector{[this](const string &origin, function<void(bool)> &&done) {
+        PerformPreconnect(origin, std::move(done));
+      }} {}
 
 WinRTHttpResource::WinRTHttpResource() noexcept : WinRTHttpResource(winrt::Windows::Web::Http::HttpClient{}) {}
 
+void WinRTHttpResource::SetCache(shared_ptr<HttpCache> cache) noexcept {
+  m_cache = std::move(cache);
+}
+
+shared_ptr<HttpCache> WinRTHttpResource::Cache() const noexcept {
+  return m_cache;
+}
+
 #pragma region IWinRTHttpRequestFactory
 
 IAsyncOperation<HttpRequestMessage> WinRTHttpResource::CreateRequest(
@@ -268,6 +349,36 @@ IAsyncOperation<HttpRequestMessage> WinRTHttpResource::CreateRequest(
 
 #pragma endregion IWinRTHttpRequestFactory
 
+#pragma region IHttpCacheTransport
+
+void WinRTHttpResource::Send(
+    HttpCacheRequest &&request,
+    function<void(HttpCacheResponse &&response)> &&onResponse,
+    function<void(string &&errorMessage)> &&onError) noexcept /*override*/ {
+  PerformCacheTransportSend(std::move(request), std::move(onResponse), std::move(onError));
+}
+
+void WinRTHttpResource::Cancel(int64_t requestId) noexcept /*override*/ {
+  ResponseOperation request{nullptr};
+
+  {
+    scoped_lock lock{m_mutex};
+    auto iter = m_responses.find(requestId);
+    if (iter == std::end(m_responses)) {
+      return;
+    }
+    request = iter->second;
+  }
+
+  try {
+    request.Cancel();
+  } catch (hresult_error const &) {
+    // The request fails with the cancellation error, or completes.
+  }
+}
+
+#pragma endregion IHttpCacheTransport
+
 #pragma region IHttpResource
 
 void WinRTHttpResource::SendRequest(
@@ -288,7 +399,13 @@ void WinRTHttpResource::SendRequest(
     callback(requestId);
   }
 
+  m_preconnector.NoteRequest(url);
+
   try {
+    // Requests that cannot time out or stream their response may be served by the cache.
+    auto isCacheable =
+        m_cache && boost::iequals(method, "GET") && data.empty() && !useIncrementalUpdates && timeout == 0;
+
     HttpMethod httpMethod{to_hstring(std::move(method))};
     Uri uri{to_hstring(std::move(url))};
 
@@ -302,6 +419,11 @@ void WinRTHttpResource::SendRequest(
     reqArgs->ResponseType = std::move(responseType);
     reqArgs->Timeout = timeout;
 
+    if (isCacheable && (boost::iequals(uri.SchemeName(), L"http") || boost::iequals(uri.SchemeName(), L"https"))) {
+      SendCachedRequest(std::move(reqArgs), to_string(uri.AbsoluteUri()));
+      return;
+    }
+
     PerformSendRequest(std::move(httpMethod), std::move(uri), iReqArgs);
   } catch (std::exception const &e) {
     if (m_onError) {
@@ -319,6 +441,11 @@ void WinRTHttpResource::SendRequest(
 }
 
 void WinRTHttpResource::AbortRequest(int64_t requestId) noexcept /*override*/ {
+  // Requests waiting for the network through the cache may share their network request with others.
+  if (m_cache && m_cache->Abort(requestId)) {
+    return;
+  }
+
   ResponseOperation request{nullptr};
 
   {
@@ -344,6 +471,14 @@ void WinRTHttpResource::ClearCookies() noexcept /*override*/ {
   // NOT IMPLEMENTED
 }
 
+void WinRTHttpResource::Preconnect(vector<string> &&urls) noexcept /*override*/ {
+  m_preconnector.Preconnect(urls);
+}
+
+HttpConnectionMetrics WinRTHttpResource::GetConnectionMetrics() const noexcept /*override*/ {
+  return m_preconnector.Metrics();
+}
+
 void WinRTHttpResource::SetOnRequestSuccess(function<void(int64_t requestId)> &&handler) noexcept /*override*/ {
   m_onRequestSuccess = std::move(handler);
 }
@@ -498,105 +633,87 @@ WinRTHttpResource::PerformSendRequest(HttpMethod &&method, Uri &&rtUri, IInspect
 
     auto response = sendRequestOp.GetResults();
     if (response) {
+      // Successful unsafe requests make the cached response stale (RFC 9111 section 4.4).
+      auto statusCode = static_cast<int32_t>(response.StatusCode());
+      auto methodName = coRequest.Method().Method();
+      if (self->m_cache && statusCode < 400 && !boost::iequals(methodName, L"GET") &&
+          !boost::iequals(methodName, L"HEAD") && !boost::iequals(methodName, L"OPTIONS")) {
+        self->m_cache->Invalidate(to_string(coRequest.RequestUri().AbsoluteUri()));
+      }
+
       if (self->m_onResponse) {
         auto url = to_string(response.RequestMessage().RequestUri().AbsoluteUri());
 
-        // Gather headers for both the response content and the response itself
-        // See Invoke-WebRequest PowerShell cmdlet or Chromium response handling
-        Headers responseHeaders;
-        for (auto header : response.Headers()) {
-          responseHeaders.emplace(to_string(header.Key()), to_string(header.Value()));
-        }
-        for (auto header : response.Content().Headers()) {
-          responseHeaders.emplace(to_string(header.Key()), to_string(header.Value()));
-        }
-
-        self->m_onResponse(
-            reqArgs->RequestId,
-            {static_cast<int32_t>(response.StatusCode()), std::move(url), std::move(responseHeaders)});
+        self->m_onResponse(reqArgs->RequestId, {statusCode, std::move(url), GatherHeaders(response)});
       }
     }
 
     // #9534 - Support HTTP incremental updates
     if (response && response.Content()) {
       auto inputStream = co_await response.Content().ReadAsInputStreamAsync();
-      auto reader = DataReader{inputStream};
 
-      // Accumulate all incoming request data in 8MB chunks
+      // Read incoming response data in chunks of up to 8MB
       // Note, the minimum apparent valid chunk size is 128 KB
       // Apple's implementation appears to grab 5-8 KB chunks
-      const uint32_t segmentSize = reqArgs->IncrementalUpdates ? 128_KiB : 8_MiB;
+      uint32_t segmentSize = SegmentSize(response.Content(), reqArgs->IncrementalUpdates ? 128_KiB : 8_MiB);
 
       // Let response handler take over, if set
+      std::unique_ptr<IResponseDataSink> dataSink;
       if (auto responseHandler = self->m_responseHandler.lock()) {
         if (responseHandler->Supports(reqArgs->ResponseType)) {
-          vector<uint8_t> responseData{};
-          while (auto loaded = co_await reader.LoadAsync(segmentSize)) {
-            auto length = reader.UnconsumedBufferLength();
-            auto data = vector<uint8_t>(length);
-            reader.ReadBytes(data);
-
-            responseData.insert(responseData.cend(), data.cbegin(), data.cend());
-          }
-
-          auto blob = responseHandler->ToResponseData(std::move(responseData));
-
-          if (self->m_onDataObject && self->m_onRequestSuccess) {
-            self->m_onDataObject(reqArgs->RequestId, std::move(blob));
-            self->m_onRequestSuccess(reqArgs->RequestId);
-          }
+          dataSink = responseHandler->CreateResponseDataSink();
+        }
+      }
 
-          if (self->m_onComplete) {
-            self->m_onComplete(reqArgs->RequestId);
+      int64_t receivedBytes = 0;
+      auto isIncrementalText = isText && reqArgs->IncrementalUpdates;
+      // #9534 - Send incremental updates.
+      // See https://github.com/facebook/react-native/blob/v0.70.6/Libraries/Network/RCTNetworking.mm#L561
+      TextResponseBodySink textSink;
+      if (isIncrementalText) {
+        textSink = TextResponseBodySink{[self, reqArgs, &receivedBytes](string &&data) {
+          if (self->m_onIncrementalData) {
+            // For total, see #10849
+            self->m_onIncrementalData(reqArgs->RequestId, std::move(data), receivedBytes, 0 /*total*/);
           }
-          co_return self->UntrackResponse(reqArgs->RequestId);
-        }
+        }};
       }
+      Base64ResponseBodySink base64Sink;
 
-      if (isText) {
-        reader.UnicodeEncoding(UnicodeEncoding::Utf8);
+      IResponseBodySink *sink = &base64Sink;
+      if (dataSink) {
+        sink = dataSink.get();
+      } else if (isText) {
+        sink = &textSink;
       }
 
-      int64_t receivedBytes = 0;
-      string responseData;
-      winrt::Windows::Storage::Streams::IBuffer buffer;
-      while (auto loaded = co_await reader.LoadAsync(segmentSize)) {
-        auto length = reader.UnconsumedBufferLength();
-        receivedBytes += length;
-
-        if (isText) {
-          auto data = vector<uint8_t>(length);
-          reader.ReadBytes(data);
-
-          auto incrementData = string(Common::Utilities::CheckedReinterpretCast<char *>(data.data()), data.size());
-          // #9534 - Send incremental updates.
-          // See https://github.com/facebook/react-native/blob/v0.70.6/Libraries/Network/RCTNetworking.mm#L561
-          if (reqArgs->IncrementalUpdates) {
-            responseData = std::move(incrementData);
-
-            if (self->m_onIncrementalData) {
-              // For total, see #10849
-              self->m_onIncrementalData(reqArgs->RequestId, std::move(responseData), receivedBytes, 0 /*total*/);
-            }
-          } else {
-            responseData += std::move(incrementData);
-          }
-        } else {
-          buffer = reader.ReadBuffer(length);
-          auto data = CryptographicBuffer::EncodeToBase64String(buffer);
+      // Each chunk is read into the same buffer and copied once, straight into its destination.
+      auto buffer = Buffer{segmentSize};
+      while (true) {
+        auto chunk = co_await inputStream.ReadAsync(buffer, segmentSize, InputStreamOptions::None);
+        if (chunk.Length() == 0) {
+          break;
+        }
+        receivedBytes += chunk.Length();
 
-          responseData += winrt::to_string(std::wstring_view(data));
+        sink->Write(chunk.data(), chunk.Length());
 
-          if (self->m_onDataProgress) {
-            // For total, see #10849
-            self->m_onDataProgress(reqArgs->RequestId, receivedBytes, 0 /*total*/);
-          }
+        if (!dataSink && !isText && self->m_onDataProgress) {
+          // For total, see #10849
+          self->m_onDataProgress(reqArgs->RequestId, receivedBytes, 0 /*total*/);
         }
       }
 
-      // If dealing with text-incremental response data, use m_onIncrementalData instead
-      if (self->m_onData && !(reqArgs->IncrementalUpdates && isText)) {
-        self->m_onData(reqArgs->RequestId, std::move(responseData));
+      if (dataSink) {
+        auto blob = dataSink->ToResponseData();
+
+        if (self->m_onDataObject && self->m_onRequestSuccess) {
+          self->m_onDataObject(reqArgs->RequestId, std::move(blob));
+          self->m_onRequestSuccess(reqArgs->RequestId);
+        }
+      } else if (self->m_onData && !isIncrementalText) {
+        // If dealing with text-incremental response data, use m_onIncrementalData instead
+        self->m_onData(reqArgs->RequestId, isText ? textSink.TakeText() : base64Sink.TakeBase64());
       }
 
       if (self->m_onComplete) {
@@ -624,6 +741,206 @@ WinRTHttpResource::PerformSendRequest(HttpMethod &&method, Uri &&rtUri, IInspect
   self->UntrackResponse(reqArgs->RequestId);
 } // PerformSendRequest
 
+fire_and_forget WinRTHttpResource::PerformCacheTransportSend(
+    HttpCacheRequest request,
+    function<void(HttpCacheResponse &&response)> onResponse,
+    function<void(string &&errorMessage)> onError) noexcept {
+  // Keep references after coroutine suspension.
+  auto self = shared_from_this();
+  auto requestId = request.Id;
+
+  // Ensure background thread
+  co_await winrt::resume_background();
+
+  HttpCacheResponse result;
+  string errorMessage;
+  try {
+    auto iReqArgs = winrt::make<RequestArgs>();
+    auto reqArgs = iReqArgs.as<RequestArgs>();
+    reqArgs->RequestId = requestId;
+    reqArgs->Headers = std::move(request.Headers);
+    reqArgs->IncrementalUpdates = false;
+    reqArgs->WithCredentials = request.WithCredentials;
+    reqArgs->ResponseType = responseTypeBase64;
+    reqArgs->Timeout = 0;
+
+    auto props = winrt::single_threaded_map<winrt::hstring, IInspectable>();
+    props.Insert(L"RequestArgs", iReqArgs);
+
+    auto coRequest =
+        co_await self->CreateRequest(HttpMethod{to_hstring(request.Method)}, Uri{to_hstring(request.Url)}, props);
+    if (!coRequest) {
+      co_return onError("Failed to create request");
+    }
+
+    auto sendRequestOp = self->m_client.SendRequestAsync(coRequest);
+    self->TrackResponse(requestId, sendRequestOp);
+    co_await lessthrow_await_adapter<ResponseOperation>{sendRequestOp};
+
+    auto hr = sendRequestOp.ErrorCode();
+    if (hr < 0) {
+      self->UntrackResponse(requestId);
+      co_return onError(Utilities::HResultToString(std::move(hr)));
+    }
+
+    auto response = sendRequestOp.GetResults();
+    result.StatusCode = static_cast<int64_t>(response.StatusCode());
+    result.Url = to_string(response.RequestMessage().RequestUri().AbsoluteUri());
+    result.Headers = GatherHeaders(response);
+
+    if (response.Content()) {
+      auto inputStream = co_await response.Content().ReadAsInputStreamAsync();
+
+      uint32_t segmentSize = SegmentSize(response.Content(), 8_MiB);
+
+      // Each chunk becomes a chunk of the body, which the cache stores and serves without gathering it.
+      auto buffer = Buffer{segmentSize};
+      while (true) {
+        auto chunk = co_await inputStream.ReadAsync(buffer, segmentSize, InputStreamOptions::None);
+        if (chunk.Length() == 0) {
+          break;
+        }
+        result.Body.Append(BlobView::FromBytes(vector<uint8_t>(chunk.data(), chunk.data() + chunk.Length())));
+      }
+    }
+  } catch (hresult_error const &e) {
+    errorMessage = Utilities::HResultToString(e);
+  } catch (std::exception const &e) {
+    errorMessage = e.what();
+  }
+
+  self->UntrackResponse(requestId);
+  if (!errorMessage.empty()) {
+    co_return onError(std::move(errorMessage));
+  }
+
+  onResponse(std::move(result));
+}
+
+fire_and_forget WinRTHttpResource::PerformPreconnect(string origin, function<void(bool)> done) noexcept {
+  // Keep references after coroutine suspension.
+  auto self = shared_from_this();
+
+  // Ensure background thread
+  co_await winrt::resume_background();
+
+  // A HEAD request resolves the host, and opens a connection and its TLS session, which the requests that follow
+  // reuse. Any response, whatever its status, means the connection was made.
+  auto succeeded = false;
+  try {
+    IHttpClient client{nullptr};
+    {
+      scoped_lock lock{self->m_mutex};
+      if (!self->m_preconnectClient) {
+        self->m_preconnectClient = CreatePreconnectClient();
+      }
+      client = self->m_preconnectClient;
+    }
+
+    auto request = HttpRequestMessage{HttpMethod::Head(), Uri{to_hstring(origin)}};
+    auto sendRequestOp = client.SendRequestAsync(request, HttpCompletionOption::ResponseHeadersRead);
+
+    // An unresponsive origin must not hold its preconnect slot until the client gives up on it.
+    auto timedOut = std::make_shared<bool>(false);
+    auto sendRequestTimeout = [](auto timedOut, auto milliseconds) -> ResponseOperation {
+      // Convert milliseconds to "ticks" (10^-7 seconds)
+      co_await winrt::resume_after(winrt::Windows::Foundation::TimeSpan{milliseconds * 10000});
+      *timedOut = true;
+      co_return nullptr;
+    }(timedOut, PreconnectTimeout);
+
+    co_await lessthrow_await_adapter<ResponseOperation>{winrt::when_any(sendRequestOp, sendRequestTimeout)};
+
+    // Cancel either still unfinished coroutine.
+    sendRequestTimeout.Cancel();
+    sendRequestOp.Cancel();
+
+    succeeded = !*timedOut && sendRequestOp.ErrorCode() >= 0;
+    if (succeeded) {
+      sendRequestOp.GetResults().Close();
+    }
+  } catch (hresult_error const &) {
+    succeeded = false;
+  } catch (std::exception const &) {
+    succeeded = false;
+  }
+
+  done(succeeded);
+}
+
+winrt::fire_and_forget WinRTHttpResource::SendCachedRequest(winrt::com_ptr<RequestArgs> reqArgs, string url) noexcept {
+  auto self = shared_from_this();
+
+  // The cache reads stored responses from disk, and serves hits without a network request.
+  co_await winrt::resume_background();
+
+  auto request =
+      HttpCacheRequest{reqArgs->RequestId, "GET", std::move(url), reqArgs->Headers, reqArgs->WithCredentials};
+
+  self->m_cache->Send(
+      std::move(request),
+      [self, reqArgs](HttpCacheResponse &&response) { self->DeliverCachedResponse(reqArgs, std::move(response)); },
+      [self, reqArgs](string &&errorMessage) {
+        if (self->m_onError) {
+          self->m_onError(reqArgs->RequestId, std::move(errorMessage), false);
+        }
+      });
+}
+
+void WinRTHttpResource::DeliverCachedResponse(
+    winrt::com_ptr<RequestArgs> const &reqArgs,
+    HttpCacheResponse &&response) noexcept {
+  auto body = std::move(response.Body);
+  auto writeBody = [&body](IResponseBodySink &sink) {
+    for (const auto &segment : body.Segments()) {
+      sink.Write(segment.Data(), segment.Size);
+    }
+  };
+
+  try {
+    if (m_onResponse) {
+      m_onResponse(reqArgs->RequestId, {response.StatusCode, std::move(response.Url), std::move(response.Headers)});
+    }
+
+    // Let response handler take over, if set
+    auto responseHandler = m_responseHandler.lock();
+    if (responseHandler && responseHandler->Supports(reqArgs->ResponseType)) {
+      auto dataSink = responseHandler->CreateResponseDataSink();
+      writeBody(*dataSink);
+      auto blob = dataSink->ToResponseData();
+
+      if (m_onDataObject && m_onRequestSuccess) {
+        m_onDataObject(reqArgs->RequestId, std::move(blob));
+        m_onRequestSuccess(reqArgs->RequestId);
+      }
+    } else if (reqArgs->ResponseType == responseTypeText) {
+      TextResponseBodySink textSink;
+      writeBody(textSink);
+      if (m_onData) {
+        m_onData(reqArgs->RequestId, textSink.TakeText());
+      }
+    } else {
+      Base64ResponseBodySink base64Sink;
+      writeBody(base64Sink);
+      if (m_onDataProgress) {
+        // For total, see #10849
+        m_onDataProgress(reqArgs->RequestId, static_cast<int64_t>(body.Size()), 0 /*total*/);
+      }
+      if (m_onData) {
+        m_onData(reqArgs->RequestId, base64Sink.TakeBase64());
+      }
+    }
+
+    if (m_onComplete) {
+      m_onComplete(reqArgs->RequestId);
+    }
+  } catch (std::exception const &e) {
+    if (m_onError) {
+      m_onError(reqArgs->RequestId, e.what(), false);
+    }
+  }
+}
+
 #pragma region IHttpModuleProxy
 
 void WinRTHttpResource::AddUriHandler(shared_ptr<IUriHandler> /*uriHandler*/) noexcept /*override*/
@@ -679,6 +996,23 @@ void WinRTHttpResource::AddResponseHandler(shared_ptr<IResponseHandler> response
 
   auto result = std::make_shared<WinRTHttpResource>(std::move(client));
 
+  // Keep GET responses in an on-disk cache, if the app provides a directory for it.
+  auto cacheDirectory = GetRuntimeOptionString("Http.CacheDirectory");
+  if (cacheDirectory.size() > 0) {
+    DiskHttpCacheStore::Options storeOptions;
+    storeOptions.Directory = std::filesystem::path{std::wstring_view{to_hstring(cacheDirectory)}};
+    if (auto maxSize = GetRuntimeOptionInt("Http.CacheMaxSize"); maxSize > 0) {
+      storeOptions.MaxSize = static_cast<size_t>(maxSize);
+    }
+    storeOptions.ReadFile = [](const std::filesystem::path &path) {
+      auto buffer = Microsoft::JSI::MakeMemoryMappedBuffer(path.c_str());
+      return BlobView::FromChunk(std::make_shared<MappedFileChunk>(std::move(buffer)));
+    };
+
+    auto store = std::make_shared<DiskHttpCacheStore>(std::move(storeOptions));
+    result->SetCache(std::make_shared<HttpCache>(weak_ptr<IHttpCacheTransport>{result}, std::move(store)));
+  }
+
   // Allow redirect filter to create requests based on the resource's state
   redirFilter.as<RedirectHttpFilter>()->SetRequestFactory(weak_ptr<IWinRTHttpRequestFactory>{result});
 
@@ -7,6 +7,8 @@
 
 #include "HttpSettings.g.h"
 #include <Modules/IHttpModuleProxy.h>
+#include "HttpCache.h"
+#include "HttpPreconnector.h"
 #include "IWinRTHttpRequestFactory.h"
 #include "WinRTTypes.h"
 
@@ -21,6 +23,7 @@ namespace Microsoft::React::Networking {
 class WinRTHttpResource : public IHttpResource,
                           public IHttpModuleProxy,
                           public IWinRTHttpRequestFactory,
+                          public IHttpCacheTransport,
                           public std::enable_shared_from_this<WinRTHttpResource> {
   winrt::Windows::Web::Http::IHttpClient m_client;
   std::mutex m_mutex;
@@ -41,6 +44,13 @@ class WinRTHttpResource : public IHttpResource,
   std::weak_ptr<IRequestBodyHandler> m_requestBodyHandler;
   std::weak_ptr<IResponseHandler> m_responseHandler;
 
+  std::shared_ptr<HttpCache> m_cache;
+  HttpPreconnector m_preconnector;
+  winrt::Windows::Web::Http::IHttpClient m_preconnectClient{nullptr}; // Created on the first preconnect
+
+  // Milliseconds a preconnect may take before it is canceled and counted as failed.
+  static constexpr int64_t PreconnectTimeout = 10 * 1000;
+
   void TrackResponse(int64_t requestId, ResponseOperation response) noexcept;
 
   void UntrackResponse(int64_t requestId) noexcept;
@@ -50,11 +60,27 @@ class WinRTHttpResource : public IHttpResource,
       winrt::Windows::Foundation::Uri &&uri,
       winrt::Windows::Foundation::IInspectable const &args) noexcept;
 
+  winrt::fire_and_forget PerformCacheTransportSend(
+      HttpCacheRequest request,
+      std::function<void(HttpCacheResponse &&response)> onResponse,
+      std::function<void(std::string &&errorMessage)> onError) noexcept;
+
+  winrt::fire_and_forget PerformPreconnect(std::string origin, std::function<void(bool)> done) noexcept;
+
+  winrt::fire_and_forget SendCachedRequest(winrt::com_ptr<RequestArgs> reqArgs, std::string url) noexcept;
+
+  void DeliverCachedResponse(winrt::com_ptr<RequestArgs> const &reqArgs, HttpCacheResponse &&response) noexcept;
+
  public:
   WinRTHttpResource() noexcept;
 
   WinRTHttpResource(winrt::Windows::Web::Http::IHttpClient &&client) noexcept;
 
+  // GET requests without a body go through cache, when set.
+  void SetCache(std::shared_ptr<HttpCache> cache) noexcept;
+
+  std::shared_ptr<HttpCache> Cache() const noexcept;
+
 #pragma region IWinRTHttpRequestFactory
 
   winrt::Windows::Foundation::IAsyncOperation<winrt::Windows::Web::Http::HttpRequestMessage> CreateRequest(
@@ -65,6 +91,17 @@ class WinRTHttpResource : public IHttpResource,
 
 #pragma endregion IWinRTHttpRequestFactory
 
+#pragma region IHttpCacheTransport
+
+  void Send(
+      HttpCacheRequest &&request,
+      std::function<void(HttpCacheResponse &&response)> &&onResponse,
+      std::function<void(std::string &&errorMessage)> &&onError) noexcept override;
+
+  void Cancel(int64_t requestId) noexcept override;
+
+#pragma endregion IHttpCacheTransport
+
 #pragma region IHttpResource
 
   void SendRequest(
@@ -80,6 +117,8 @@ class WinRTHttpResource : public IHttpResource,
       std::function<void(int64_t)> &&callback) noexcept override;
   void AbortRequest(int64_t requestId) noexcept override;
   void ClearCookies() noexcept override;
+  void Preconnect(std::vector<std::string> &&urls) noexcept override;
+  HttpConnectionMetrics GetConnectionMetrics() const noexcept override;
 
   void SetOnRequestSuccess(std::function<void(int64_t requestId)> &&handler) noexcept override;
   void SetOnResponse(std::function<void(int64_t requestId, Response &&response)> &&handler) noexcept override;
@@ -3,6 +3,7 @@
 
 #include "WinRTWebSocketResource.h"
 
+#include <Base64.h>
 #include <Utilities.h>
 #include <Utils/CppWinrtLessExceptions.h>
 #include <Utils/WinRTConversions.h>
@@ -14,6 +15,7 @@
 #include <dispatchQueue/dispatchQueue.h>
 
 // Windows API
+#include <robuffer.h>
 #include <windows.Networking.Sockets.h>
 #include <windows.Storage.Streams.h>
 #include <winrt/Windows.Foundation.Collections.h>
@@ -44,6 +46,7 @@ using winrt::Windows::Security::Cryptography::CryptographicBuffer;
 using winrt::Windows::Security::Cryptography::Certificates::ChainValidationResult;
 using winrt::Windows::Storage::Streams::DataWriter;
 using winrt::Windows::Storage::Streams::DataWriterStoreOperation;
+using winrt::Windows::Storage::Streams::IBuffer;
 using winrt::Windows::Storage::Streams::IDataReader;
 using winrt::Windows::Storage::Streams::IDataWriter;
 using winrt::Windows::Storage::Streams::UnicodeEncoding;
@@ -85,6 +88,36 @@ DispatchQueue GetCurrentOrSerialQueue() noexcept {
 
   return queue;
 }
+
+///
+/// Exposes the bytes of a vector as an IBuffer, so they can be handed to a writer without being copied.
+///
+struct VectorBuffer : winrt::implements<VectorBuffer, IBuffer, ::Windows::Storage::Streams::IBufferByteAccess> {
+  VectorBuffer(vector<uint8_t> &&data) noexcept : m_data{std::move(data)} {}
+
+  uint32_t Capacity() const noexcept {
+    return static_cast<uint32_t>(m_data.size());
+  }
+
+  uint32_t Length() const noexcept {
+    return static_cast<uint32_t>(m_data.size());
+  }
+
+  void Length(uint32_t value) {
+    if (value > m_data.size()) {
+      throw winrt::hresult_invalid_argument();
+    }
+    m_data.resize(value);
+  }
+
+  HRESULT __stdcall Buffer(uint8_t **value) noexcept final {
+    *value = m_data.data();
+    return S_OK;
+  }
+
+ private:
+  vector<uint8_t> m_data;
+};
 } // namespace
 
 namespace Microsoft::React::Networking {
@@ -95,11 +128,13 @@ WinRTWebSocketResource::WinRTWebSocketResource(
     IMessageWebSocket &&socket,
     IDataWriter &&writer,
     vector<ChainValidationResult> &&certExceptions,
-    DispatchQueue callingQueue)
+    DispatchQueue callingQueue,
+    WebSocketWriteQueue::Options writeQueueOptions)
     : m_socket{std::move(socket)},
       m_writer(std::move(writer)),
       m_readyState{ReadyState::Connecting},
-      m_callingQueue{callingQueue} {
+      m_callingQueue{callingQueue},
+      m_writeQueue{std::move(writeQueueOptions)} {
   for (const auto &certException : certExceptions) {
     m_socket.Control().IgnorableServerCertificateErrors().Append(certException);
   }
@@ -108,15 +143,19 @@ WinRTWebSocketResource::WinRTWebSocketResource(
 // private
 WinRTWebSocketResource::WinRTWebSocketResource(
     IMessageWebSocket &&socket,
-    vector<ChainValidationResult> &&certExceptions)
+    vector<ChainValidationResult> &&certExceptions,
+    WebSocketWriteQueue::Options writeQueueOptions)
     : WinRTWebSocketResource(
           std::move(socket),
           DataWriter{socket.OutputStream()},
           std::move(certExceptions),
-          GetCurrentOrSerialQueue()) {}
+          GetCurrentOrSerialQueue(),
+          std::move(writeQueueOptions)) {}
 
-WinRTWebSocketResource::WinRTWebSocketResource(vector<ChainValidationResult> &&certExceptions)
-    : WinRTWebSocketResource(MessageWebSocket{}, std::move(certExceptions)) {}
+WinRTWebSocketResource::WinRTWebSocketResource(
+    vector<ChainValidationResult> &&certExceptions,
+    WebSocketWriteQueue::Options writeQueueOptions)
+    : WinRTWebSocketResource(MessageWebSocket{}, std::move(certExceptions), std::move(writeQueueOptions)) {}
 
 WinRTWebSocketResource::~WinRTWebSocketResource() noexcept /*override*/
 {}
@@ -147,6 +186,7 @@ void WinRTWebSocketResource::OnMessageReceived(
     IMessageWebSocketMessageReceivedEventArgs const &args) {
   auto self = shared_from_this();
   string response;
+  vector<uint8_t> bytes;
 
   IDataReader reader{nullptr};
   // Use WinRT ABI to avoid throwing exceptions on expected code paths
@@ -177,7 +217,10 @@ void WinRTWebSocketResource::OnMessageReceived(
 
   try {
     auto len = reader.UnconsumedBufferLength();
-    if (args.MessageType() == SocketMessageType::Utf8) {
+    if (args.MessageType() == SocketMessageType::Binary && self->m_binaryReadHandler) {
+      bytes.resize(len);
+      reader.ReadBytes(bytes);
+    } else if (args.MessageType() == SocketMessageType::Utf8) {
       reader.UnicodeEncoding(UnicodeEncoding::Utf8);
       vector<uint8_t> data(len);
       reader.ReadBytes(data);
@@ -194,6 +237,14 @@ void WinRTWebSocketResource::OnMessageReceived(
   }
 
   // Posting inside try-catch block causes errors.
+  if (args.MessageType() == SocketMessageType::Binary && self->m_binaryReadHandler) {
+    return self->m_callingQueue.Post([self, bytes = std::move(bytes)]() mutable {
+      if (self->m_binaryReadHandler) {
+        self->m_binaryReadHandler(std::move(bytes));
+      }
+    });
+  }
+
   self->m_callingQueue.Post([self, response = std::move(response), messageType = args.MessageType()]() {
     if (self->m_readHandler) {
       self->m_readHandler(response.length(), response, messageType == SocketMessageType::Binary);
@@ -206,6 +257,9 @@ void WinRTWebSocketResource::OnClosed(IWebSocket const &sender, IWebSocketClosed
 
   self->m_backgroundQueue.Post([self]() { self->m_readyState = ReadyState::Closed; });
 
+  // Messages still queued will not be sent.
+  self->HandleWrites(self->m_writeQueue.Clear());
+
   self->m_callingQueue.Post([self]() {
     if (self->m_closeHandler) {
       self->m_closeHandler(self->m_closeCode, self->m_closeReason);
@@ -270,49 +324,68 @@ fire_and_forget WinRTWebSocketResource::PerformClose() noexcept {
   });
 }
 
-fire_and_forget WinRTWebSocketResource::EnqueueWrite(string &&message, bool isBinary) noexcept {
+void WinRTWebSocketResource::HandleWrites(WebSocketWriteQueue::Update &&update) noexcept {
+  if (update.Backpressure) {
+    m_callingQueue.Post([self = shared_from_this(), isPaused = *update.Backpressure]() {
+      if (self->m_backpressureHandler) {
+        self->m_backpressureHandler(isPaused);
+      }
+    });
+  }
+
+  if (!update.Batch.empty()) {
+    PerformWrites(std::move(update.Batch));
+  }
+}
+
+fire_and_forget WinRTWebSocketResource::PerformWrites(vector<WebSocketWriteQueue::Message> &&batch) noexcept {
   auto self = shared_from_this();
-  string coMessage = std::move(message);
+  auto coBatch = std::move(batch);
 
   co_await resume_in_queue(self->m_backgroundQueue);
 
+  // Each store sends one WebSocket message, so the batch still takes one store per message, but a single task.
   co_await self->m_sequencer.QueueTaskAsync(
-      [self = self->shared_from_this(), message = std::move(coMessage), isBinary]() -> IAsyncAction {
+      [self = self->shared_from_this(), batch = std::move(coBatch)]() mutable -> IAsyncAction {
         auto coSelf = self->shared_from_this();
-        auto coMessage = std::move(message);
+        auto coBatch = std::move(batch);
+
+        for (auto &message : coBatch) {
+          co_await coSelf->PerformWrite(std::move(message));
+        }
 
-        co_await coSelf->PerformWrite(std::move(coMessage), isBinary);
+        coSelf->HandleWrites(coSelf->m_writeQueue.Complete());
       });
 }
 
-IAsyncAction WinRTWebSocketResource::PerformWrite(string &&message, bool isBinary) noexcept {
+IAsyncAction WinRTWebSocketResource::PerformWrite(WebSocketWriteQueue::Message &&message) noexcept {
   auto self = shared_from_this();
 
+  co_await resume_in_queue(self->m_backgroundQueue);
+  // If an exception occurred, abort write process.
+  if (self->m_readyState != ReadyState::Open) {
+    co_return;
+  }
+
   try {
-    if (isBinary) {
+    if (message.IsBinary) {
       self->m_socket.Control().MessageType(SocketMessageType::Binary);
 
-      auto buffer = CryptographicBuffer::DecodeFromBase64String(winrt::to_hstring(message));
-      if (buffer) {
-        self->m_writer.WriteBuffer(buffer);
-      }
+      // The writer takes the buffer over the bytes, rather than a copy of them.
+      self->m_writer.WriteBuffer(winrt::make<VectorBuffer>(std::move(message.Bytes)));
     } else {
       self->m_socket.Control().MessageType(SocketMessageType::Utf8);
 
       winrt::array_view<const uint8_t> view(
-          CheckedReinterpretCast<const uint8_t *>(message.c_str()),
-          CheckedReinterpretCast<const uint8_t *>(message.c_str()) + message.length());
+          CheckedReinterpretCast<const uint8_t *>(message.Text.c_str()),
+          CheckedReinterpretCast<const uint8_t *>(message.Text.c_str()) + message.Text.length());
       self->m_writer.WriteBytes(view);
     }
   } catch (hresult_error const &e) { // TODO: Remove after fixing unit tests exceptions.
     self->Fail(e, ErrorType::Send);
+    co_return;
   } catch (const std::exception &e) {
     self->Fail(e.what(), ErrorType::Send);
-  }
-
-  co_await resume_in_queue(self->m_backgroundQueue);
-  // If an exception occurred, abort write process.
-  if (self->m_readyState != ReadyState::Open) {
     co_return;
   }
 
@@ -384,11 +457,23 @@ void WinRTWebSocketResource::Connect(string &&url, const Protocols &protocols, c
 void WinRTWebSocketResource::Ping() noexcept {}
 
 void WinRTWebSocketResource::Send(string &&message) noexcept {
-  EnqueueWrite(std::move(message), false);
+  HandleWrites(m_writeQueue.Push({false, std::move(message), {}}));
 }
 
 void WinRTWebSocketResource::SendBinary(string &&base64String) noexcept {
-  EnqueueWrite(std::move(base64String), true);
+  // Decode now, so the buffered amount counts the bytes to send.
+  vector<uint8_t> data(Utilities::Base64DecodedMaxSize(base64String.size()));
+  const auto size = Utilities::DecodeBase64Into(base64String, reinterpret_cast<char *>(data.data()));
+  if (!size) {
+    return Fail("Invalid Base64 message", ErrorType::Send);
+  }
+
+  data.resize(*size);
+  SendBytes(std::move(data));
+}
+
+void WinRTWebSocketResource::SendBytes(vector<uint8_t> &&data) noexcept {
+  HandleWrites(m_writeQueue.Push({true, {}, std::move(data)}));
 }
 
 void WinRTWebSocketResource::Close(CloseCode code, const string &reason) noexcept {
@@ -401,6 +486,10 @@ IWebSocketResource::ReadyState WinRTWebSocketResource::GetReadyState() const noe
   return m_readyState;
 }
 
+size_t WinRTWebSocketResource::GetBufferedAmount() const noexcept {
+  return m_writeQueue.BufferedAmount();
+}
+
 void WinRTWebSocketResource::SetOnConnect(function<void()> &&handler) noexcept {
   m_connectHandler = std::move(handler);
 }
@@ -413,6 +502,10 @@ void WinRTWebSocketResource::SetOnMessage(function<void(size_t, const string &,
   m_readHandler = std::move(handler);
 }
 
+void WinRTWebSocketResource::SetOnBinaryMessage(function<void(vector<uint8_t> &&)> &&handler) noexcept {
+  m_binaryReadHandler = std::move(handler);
+}
+
 void WinRTWebSocketResource::SetOnClose(function<void(CloseCode, const string &)> &&handler) noexcept {
   m_closeHandler = std::move(handler);
 }
@@ -421,6 +514,10 @@ void WinRTWebSocketResource::SetOnError(function<void(Error &&)> &&handler) noex
   m_errorHandler = std::move(handler);
 }
 
+void WinRTWebSocketResource::SetOnBackpressure(function<void(bool)> &&handler) noexcept {
+  m_backpressureHandler = std::move(handler);
+}
+
 #pragma endregion IWebSocketResource
 
 #pragma endregion WinRTWebSocketResource
@@ -8,6 +8,7 @@
 #include <winrt/Windows.Networking.Sockets.h>
 #include <winrt/Windows.Storage.Streams.h>
 #include "IWebSocketResource.h"
+#include "WebSocketWriteQueue.h"
 
 namespace Microsoft::React::Networking {
 
@@ -116,10 +117,13 @@ class WinRTWebSocketResource : public IWebSocketResource, public std::enable_sha
 
   std::function<void()> m_connectHandler;
   std::function<void(std::size_t, const std::string &, bool)> m_readHandler;
+  std::function<void(std::vector<uint8_t> &&)> m_binaryReadHandler;
   std::function<void(CloseCode, const std::string &)> m_closeHandler;
   std::function<void(Error &&)> m_errorHandler;
+  std::function<void(bool)> m_backpressureHandler;
 
   winrt::Windows::Storage::Streams::IDataWriter m_writer;
+  WebSocketWriteQueue m_writeQueue;
 
   void Fail(std::string &&message, ErrorType type) noexcept;
   void Fail(winrt::hresult &&e, ErrorType type) noexcept;
@@ -134,23 +138,27 @@ class WinRTWebSocketResource : public IWebSocketResource, public std::enable_sha
       winrt::Windows::Networking::Sockets::IWebSocketClosedEventArgs const &args);
 
   winrt::fire_and_forget PerformConnect(winrt::Windows::Foundation::Uri &&uri) noexcept;
-  winrt::fire_and_forget EnqueueWrite(std::string &&message, bool isBinary) noexcept;
-  winrt::Windows::Foundation::IAsyncAction PerformWrite(std::string &&message, bool isBinary) noexcept;
+  void HandleWrites(WebSocketWriteQueue::Update &&update) noexcept;
+  winrt::fire_and_forget PerformWrites(std::vector<WebSocketWriteQueue::Message> &&batch) noexcept;
+  winrt::Windows::Foundation::IAsyncAction PerformWrite(WebSocketWriteQueue::Message &&message) noexcept;
   winrt::fire_and_forget PerformClose() noexcept;
 
   WinRTWebSocketResource(
       winrt::Windows::Networking::Sockets::IMessageWebSocket &&socket,
-      std::vector<winrt::Windows::Security::Cryptography::Certificates::ChainValidationResult> &&certExceptions);
+      std::vector<winrt::Windows::Security::Cryptography::Certificates::ChainValidationResult> &&certExceptions,
+      WebSocketWriteQueue::Options writeQueueOptions);
 
  public:
   WinRTWebSocketResource(
       winrt::Windows::Networking::Sockets::IMessageWebSocket &&socket,
       winrt::Windows::Storage::Streams::IDataWriter &&writer,
       std::vector<winrt::Windows::Security::Cryptography::Certificates::ChainValidationResult> &&certExceptions,
-      Mso::DispatchQueue callingQueue);
+      Mso::DispatchQueue callingQueue,
+      WebSocketWriteQueue::Options writeQueueOptions = {});
 
   WinRTWebSocketResource(
-      std::vector<winrt::Windows::Security::Cryptography::Certificates::ChainValidationResult> &&certExceptions);
+      std::vector<winrt::Windows::Security::Cryptography::Certificates::ChainValidationResult> &&certExceptions,
+      WebSocketWriteQueue::Options writeQueueOptions = {});
 
   ~WinRTWebSocketResource() noexcept override;
 
@@ -176,6 +184,11 @@ class WinRTWebSocketResource : public IWebSocketResource, public std::enable_sha
   /// </summary>
   void SendBinary(std::string &&base64String) noexcept override;
 
+  /// <summary>
+  /// <see cref="IWebSocketResource::SendBytes" />
+  /// </summary>
+  void SendBytes(std::vector<uint8_t> &&data) noexcept override;
+
   /// <summary>
   /// <see cref="IWebSocketResource::Close" />
   /// </summary>
@@ -183,6 +196,11 @@ class WinRTWebSocketResource : public IWebSocketResource, public std::enable_sha
 
   ReadyState GetReadyState() const noexcept override;
 
+  /// <summary>
+  /// <see cref="IWebSocketResource::GetBufferedAmount" />
+  /// </summary>
+  std::size_t GetBufferedAmount() const noexcept override;
+
   /// <summary>
   /// <see cref="IWebSocketResource::SetOnConnect" />
   /// </summary>
@@ -203,6 +221,11 @@ class WinRTWebSocketResource : public IWebSocketResource, public std::enable_sha
   /// </summary>
   void SetOnMessage(std::function<void(std::size_t, const std::string &, bool isBinary)> &&handler) noexcept override;
 
+  /// <summary>
+  /// <see cref="IWebSocketResource::SetOnBinaryMessage" />
+  /// </summary>
+  void SetOnBinaryMessage(std::function<void(std::vector<uint8_t> &&)> &&handler) noexcept override;
+
   /// <summary>
   /// <see cref="IWebSocketResource::SetOnClose" />
   /// </summary>
@@ -213,6 +236,11 @@ class WinRTWebSocketResource : public IWebSocketResource, public std::enable_sha
   /// </summary>
   void SetOnError(std::function<void(Error &&)> &&handler) noexcept override;
 
+  /// <summary>
+  /// <see cref="IWebSocketResource::SetOnBackpressure" />
+  /// </summary>
+  void SetOnBackpressure(std::function<void(bool)> &&handler) noexcept override;
+
 #pragma endregion IWebSocketResource
 };
 
@@ -17,6 +17,8 @@
 
 #if (defined(_MSC_VER) && (defined(WINRT)))
 #include <Utils/LocalBundleReader.h>
+#include <winrt/Windows.ApplicationModel.h>
+#include <winrt/Windows.Storage.h>
 #endif
 
 #if _MSC_VER
@@ -53,6 +55,7 @@
 #include <react/renderer/runtimescheduler/RuntimeSchedulerBinding.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerCallInvoker.h>
 #include "BaseScriptStoreImpl.h"
+#include "BundleFilePath.h"
 
 #include <tracing/tracing.h>
 namespace fs = std::filesystem;
@@ -348,6 +351,42 @@ std::unique_ptr<const facebook::react::JSBigString> JsBigStringFromPath(
 #endif
 }
 
+std::string BundleFilePath(
+    std::shared_ptr<facebook::react::DevSettings> devSettings,
+    const std::string &jsBundleRelativePath) noexcept {
+#if (defined(_MSC_VER) && !defined(WINRT))
+  return Microsoft::Common::Unicode::Utf16ToUtf8(
+      (fs::u8path(devSettings->bundleRootPath) / jsBundleRelativePath).wstring());
+#else
+  // Resolves ms-appx and ms-appdata roots to the folders they point into. The
+  // getters throw when the application has no package identity.
+  auto rootFolder = BundleRootFolder(devSettings->bundleRootPath, [](ApplicationFolder folder) -> fs::path {
+    try {
+      switch (folder) {
+        case ApplicationFolder::Installed:
+          return std::wstring_view{winrt::Windows::ApplicationModel::Package::Current().InstalledLocation().Path()};
+        case ApplicationFolder::Local:
+          return std::wstring_view{winrt::Windows::Storage::ApplicationData::Current().LocalFolder().Path()};
+        case ApplicationFolder::Roaming:
+          return std::wstring_view{winrt::Windows::Storage::ApplicationData::Current().RoamingFolder().Path()};
+        case ApplicationFolder::Temporary:
+          return std::wstring_view{winrt::Windows::Storage::ApplicationData::Current().TemporaryFolder().Path()};
+      }
+    } catch (const winrt::hresult_error &) {
+    }
+
+    return {};
+  });
+
+  // Not a folder on the filesystem, the bundle is loaded from its uri instead
+  if (rootFolder.empty()) {
+    return {};
+  }
+
+  return Microsoft::Common::Unicode::Utf16ToUtf8((rootFolder / (jsBundleRelativePath + ".bundle")).wstring());
+#endif
+}
+
 } // namespace Microsoft::ReactNative
 
 namespace facebook::react {
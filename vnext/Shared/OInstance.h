@@ -39,4 +39,12 @@ std::unique_ptr<const facebook::react::JSBigString> JsBigStringFromPath(
     std::shared_ptr<facebook::react::DevSettings> devsettings,
     const std::string &jsBundleRelativePath) noexcept;
 
+// The filesystem path of the bundle JsBigStringFromPath loads, with ms-appx and
+// ms-appdata roots resolved to the application folders, or an empty string
+// when the bundle is not a file (embedded resource bundles, or application
+// folders the application does not have).
+std::string BundleFilePath(
+    std::shared_ptr<facebook::react::DevSettings> devsettings,
+    const std::string &jsBundleRelativePath) noexcept;
+
 } // namespace Microsoft::ReactNative
@@ -0,0 +1,274 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "SegmentedBundleRegistry.h"
+
+#include <fmt/format.h>
+#include <MemoryMappedBuffer.h>
+
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+// A range of a segment buffer that keeps the segment alive.
+class SegmentSliceBuffer : public facebook::jsi::Buffer {
+ public:
+  SegmentSliceBuffer(std::shared_ptr<const void> segment, std::string_view slice) noexcept
+      : m_segment(std::move(segment)), m_slice(slice) {}
+
+  size_t size() const override {
+    return m_slice.size();
+  }
+
+  const uint8_t *data() const override {
+    return reinterpret_cast<const uint8_t *>(m_slice.data());
+  }
+
+ private:
+  std::shared_ptr<const void> m_segment;
+  std::string_view m_slice;
+};
+
+// The startup code of a main segment, the slice is followed by a null
+// terminator as JSBigString requires.
+class SegmentSliceBigString : public facebook::react::JSBigString {
+ public:
+  SegmentSliceBigString(std::shared_ptr<const void> segment, std::string_view slice) noexcept
+      : m_segment(std::move(segment)), m_slice(slice) {}
+
+  bool isAscii() const override {
+    return false;
+  }
+
+  const char *c_str() const override {
+    return m_slice.data();
+  }
+
+  size_t size() const override {
+    return m_slice.size();
+  }
+
+ private:
+  std::shared_ptr<const void> m_segment;
+  std::string_view m_slice;
+};
+
+} // namespace
+
+SegmentedBundleRegistry::SegmentedBundleRegistry(std::shared_ptr<facebook::jsi::ScriptStore> scriptStore) noexcept
+    : m_scriptStore(std::move(scriptStore)) {}
+
+std::unique_ptr<const facebook::react::JSBigString> SegmentedBundleRegistry::LoadMainSegment(
+    const std::string &url) noexcept {
+  // Check the magic first so that regular bundles are not mapped twice.
+  if (!IsIndexedBundleFile(url)) {
+    return nullptr;
+  }
+
+  try {
+    return AddMainSegment(LoadSegment(0, url), url);
+  } catch (const std::runtime_error &) {
+    return nullptr;
+  }
+}
+
+std::unique_ptr<const facebook::react::JSBigString> SegmentedBundleRegistry::LoadMainSegment(
+    std::shared_ptr<const facebook::jsi::Buffer> bundle,
+    const std::string &url) noexcept {
+  if (!bundle) {
+    return nullptr;
+  }
+
+  auto segment = std::make_shared<Segment>();
+  if (!segment->bundle.Parse(bundle->data(), bundle->size())) {
+    return nullptr;
+  }
+  segment->buffer = std::move(bundle);
+
+  return AddMainSegment(std::move(segment), url);
+}
+
+std::unique_ptr<const facebook::react::JSBigString> SegmentedBundleRegistry::AddMainSegment(
+    std::shared_ptr<Segment> segment,
+    const std::string &url) noexcept {
+  auto startupCode = std::make_unique<SegmentSliceBigString>(segment, segment->bundle.StartupCode());
+
+  std::scoped_lock lock{m_mutex};
+  m_segments[0] = std::move(segment);
+  m_segmentUrls[0] = url;
+  return startupCode;
+}
+
+void SegmentedBundleRegistry::RegisterSegment(uint32_t segmentId, std::string url) noexcept {
+  std::scoped_lock lock{m_mutex};
+  m_segmentUrls[segmentId] = std::move(url);
+}
+
+std::shared_ptr<const facebook::jsi::Buffer> SegmentedBundleRegistry::GetModule(
+    uint32_t segmentId,
+    uint32_t moduleId) {
+  auto segment = GetSegment(segmentId);
+  if (!segment) {
+    return nullptr;
+  }
+
+  auto body = segment->bundle.Module(moduleId);
+  if (!body.empty()) {
+    return std::make_shared<SegmentSliceBuffer>(std::move(segment), body);
+  }
+
+  uint64_t offset;
+  uint32_t length;
+  if (segment->file.empty() || !segment->bundle.ModuleRange(moduleId, offset, length)) {
+    return nullptr;
+  }
+
+  std::shared_ptr<const facebook::jsi::Buffer> window;
+  try {
+    window = Microsoft::JSI::MakeMemoryMappedWindow(segment->file.c_str(), offset, length);
+  } catch (const facebook::jsi::JSINativeException &e) {
+    throw std::runtime_error(fmt::format("Could not load module {} of segment {}: {}", moduleId, segmentId, e.what()));
+  }
+
+  if (window->data()[length - 1] != '\0') {
+    return nullptr;
+  }
+
+  const std::string_view slice{reinterpret_cast<const char *>(window->data()), length - 1u};
+  return std::make_shared<SegmentSliceBuffer>(std::move(window), slice);
+}
+
+std::string SegmentedBundleRegistry::GetModuleSourceUrl(uint32_t segmentId, uint32_t moduleId) {
+  return fmt::format("seg-{}_{}.js", segmentId, moduleId);
+}
+
+std::string SegmentedBundleRegistry::GetDefaultSegmentUrl(const std::string &mainSegmentUrl, uint32_t segmentId) {
+  const auto extension = mainSegmentUrl.find_last_of('.');
+  const auto separator = mainSegmentUrl.find_last_of("/\\");
+  if (extension == std::string::npos || (separator != std::string::npos && extension < separator)) {
+    return fmt::format("{}.{}", mainSegmentUrl, segmentId);
+  }
+
+  return fmt::format("{}.{}{}", mainSegmentUrl.substr(0, extension), segmentId, mainSegmentUrl.substr(extension));
+}
+
+std::shared_ptr<const SegmentedBundleRegistry::Segment> SegmentedBundleRegistry::GetSegment(uint32_t segmentId) {
+  std::string url;
+  {
+    std::scoped_lock lock{m_mutex};
+
+    // Until a main segment is loaded the bundle is a regular bundle, where the
+    // module system reports unknown modules itself.
+    if (m_segments.find(0) == m_segments.end()) {
+      return nullptr;
+    }
+
+    if (auto it = m_segments.find(segmentId); it != m_segments.end()) {
+      return it->second;
+    }
+
+    if (auto it = m_segmentUrls.find(segmentId); it != m_segmentUrls.end()) {
+      url = it->second;
+    } else {
+      url = GetDefaultSegmentUrl(m_segmentUrls[0], segmentId);
+    }
+  }
+
+  // Segments are loaded outside of the lock, they are only required from the
+  // JavaScript thread so the same segment is not loaded concurrently.
+  auto segment = LoadSegment(segmentId, url);
+
+  std::scoped_lock lock{m_mutex};
+  return m_segments.emplace(segmentId, std::move(segment)).first->second;
+}
+
+std::shared_ptr<SegmentedBundleRegistry::Segment> SegmentedBundleRegistry::LoadSegment(
+    uint32_t segmentId,
+    const std::string &url) {
+  auto segment = std::make_shared<Segment>();
+  segment->buffer = m_scriptStore->getVersionedScript(url).buffer;
+  if (segment->buffer) {
+    if (!segment->bundle.Parse(segment->buffer->data(), segment->buffer->size())) {
+      throw std::runtime_error(fmt::format("Segment {} at {} is not an indexed bundle.", segmentId, url));
+    }
+
+    return segment;
+  }
+
+  // The script store does not load files too large for the address space, map
+  // the start of the bundle here, and each module body when it is required.
+  std::error_code ec;
+  const auto path = Utf8ToPath(url);
+  const auto bundleSize = std::filesystem::file_size(path, ec);
+  if (ec || bundleSize < IndexedBundle::HeaderSize) {
+    throw std::runtime_error(fmt::format("Could not load segment {} from {}.", segmentId, url));
+  }
+
+  segment->file = path.wstring();
+  try {
+    const auto header = Microsoft::JSI::MakeMemoryMappedWindow(segment->file.c_str(), 0, IndexedBundle::HeaderSize);
+    const auto prefixSize = IndexedBundle::PrefixSize(header->data());
+    if (!IsIndexedBundle(header->data(), header->size()) || prefixSize > bundleSize ||
+        prefixSize > std::numeric_limits<size_t>::max()) {
+      throw std::runtime_error(fmt::format("Segment {} at {} is not an indexed bundle.", segmentId, url));
+    }
+
+    segment->buffer =
+        Microsoft::JSI::MakeMemoryMappedWindow(segment->file.c_str(), 0, static_cast<size_t>(prefixSize));
+  } catch (const facebook::jsi::JSINativeException &) {
+    throw std::runtime_error(fmt::format("Could not load segment {} from {}.", segmentId, url));
+  }
+
+  if (!segment->bundle.Parse(segment->buffer->data(), segment->buffer->size(), bundleSize)) {
+    throw std::runtime_error(fmt::format("Segment {} at {} is not an indexed bundle.", segmentId, url));
+  }
+
+  return segment;
+}
+
+/*static*/ void SegmentedBundleRegistry::Install(
+    facebook::jsi::Runtime &runtime,
+    std::shared_ptr<SegmentedBundleRegistry> registry) {
+  runtime.global().setProperty(
+      runtime,
+      "nativeRequire",
+      facebook::jsi::Function::createFromHostFunction(
+          runtime,
+          facebook::jsi::PropNameID::forAscii(runtime, "nativeRequire"),
+          2,
+          [registry = std::move(registry)](
+              facebook::jsi::Runtime &runtime,
+              const facebook::jsi::Value &,
+              const facebook::jsi::Value *args,
+              size_t count) -> facebook::jsi::Value {
+            if (count < 1 || !args[0].isNumber()) {
+              throw facebook::jsi::JSError(runtime, "nativeRequire expects a module id.");
+            }
+
+            const auto moduleId = static_cast<uint32_t>(args[0].getNumber());
+            const auto segmentId = count >= 2 && args[1].isNumber() ? static_cast<uint32_t>(args[1].getNumber()) : 0;
+
+            std::shared_ptr<const facebook::jsi::Buffer> body;
+            try {
+              body = registry->GetModule(segmentId, moduleId);
+            } catch (const std::runtime_error &e) {
+              throw facebook::jsi::JSError(runtime, e.what());
+            }
+
+            // The module body calls __d to define the module, the module system
+            // reports the module as unknown if there is no body.
+            if (body) {
+              runtime.evaluateJavaScript(body, GetModuleSourceUrl(segmentId, moduleId));
+            }
+
+            return facebook::jsi::Value::undefined();
+          }));
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <JSI/ScriptStore.h>
+#include <cxxreact/JSBigString.h>
+#include <jsi/jsi.h>
+#include "IndexedBundle.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace Microsoft::ReactNative {
+
+/// <summary>
+/// Loads the modules of indexed bundles (see IndexedBundle) on demand.
+///
+/// Only the startup code of the main bundle (segment 0) is evaluated when the
+/// bundle is loaded. Install defines the global.nativeRequire(moduleId,
+/// segmentId) hook of the Metro module system, which is called the first time
+/// a module that was not defined yet is required, and evaluates the body of
+/// that module. Segments other than the main bundle are loaded the first time
+/// one of their modules is required, from the url they were registered with,
+/// or else from next to the main bundle: segment N of index.bundle is
+/// index.N.bundle.
+///
+/// Segments are loaded through the script store, so the bundle files are
+/// memory mapped and module bodies are only paged in when they are evaluated.
+/// Bundle files the script store does not load because they are too large for
+/// the address space (over 4 GB in 32-bit processes) are mapped one window at
+/// a time instead: a window over their header, module table and startup code,
+/// and a window over each module body when it is required.
+/// </summary>
+class SegmentedBundleRegistry {
+ public:
+  SegmentedBundleRegistry(std::shared_ptr<facebook::jsi::ScriptStore> scriptStore) noexcept;
+
+  // Loads the main bundle from url. Returns its startup code, or nullptr when
+  // url is not an indexed bundle, in which case the bundle is to be loaded as
+  // a regular bundle.
+  std::unique_ptr<const facebook::react::JSBigString> LoadMainSegment(const std::string &url) noexcept;
+
+  // Same as above for a bundle that is already in memory.
+  std::unique_ptr<const facebook::react::JSBigString> LoadMainSegment(
+      std::shared_ptr<const facebook::jsi::Buffer> bundle,
+      const std::string &url) noexcept;
+
+  void RegisterSegment(uint32_t segmentId, std::string url) noexcept;
+
+  // The body of a module, nullptr when the segment has no module with that id.
+  // Throws a std::runtime_error when the segment cannot be loaded.
+  std::shared_ptr<const facebook::jsi::Buffer> GetModule(uint32_t segmentId, uint32_t moduleId);
+
+  // The source url modules are evaluated with.
+  static std::string GetModuleSourceUrl(uint32_t segmentId, uint32_t moduleId);
+
+  // The url of a segment that was not registered.
+  static std::string GetDefaultSegmentUrl(const std::string &mainSegmentUrl, uint32_t segmentId);
+
+  // Defines global.nativeRequire. It does nothing until a main segment is
+  // loaded, so it can be installed before knowing the bundle format.
+  static void Install(facebook::jsi::Runtime &runtime, std::shared_ptr<SegmentedBundleRegistry> registry);
+
+ private:
+  struct Segment {
+    std::shared_ptr<const facebook::jsi::Buffer> buffer;
+    IndexedBundle bundle;
+    // The file module bodies are mapped from when buffer only holds the start
+    // of the bundle, empty otherwise.
+    std::wstring file;
+  };
+
+  std::shared_ptr<const Segment> GetSegment(uint32_t segmentId);
+
+  // Throws a std::runtime_error when the segment cannot be loaded.
+  std::shared_ptr<Segment> LoadSegment(uint32_t segmentId, const std::string &url);
+  std::unique_ptr<const facebook::react::JSBigString> AddMainSegment(
+      std::shared_ptr<Segment> segment,
+      const std::string &url) noexcept;
+
+  std::shared_ptr<facebook::jsi::ScriptStore> m_scriptStore;
+
+  std::mutex m_mutex;
+  std::unordered_map<uint32_t, std::shared_ptr<const Segment>> m_segments;
+  std::unordered_map<uint32_t, std::string> m_segmentUrls;
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,193 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "StartupTimeline.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <thread>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+#ifdef _WIN32
+double ToMs(const FILETIME &kernelTime, const FILETIME &userTime) noexcept {
+  const auto ticks = (static_cast<uint64_t>(kernelTime.dwHighDateTime) << 32 | kernelTime.dwLowDateTime) +
+      (static_cast<uint64_t>(userTime.dwHighDateTime) << 32 | userTime.dwLowDateTime);
+  return ticks / 10000.0; // 100ns ticks
+}
+#else
+double ClockMs(clockid_t clock) noexcept {
+  timespec time{};
+  clock_gettime(clock, &time);
+  return time.tv_sec * 1000.0 + time.tv_nsec / 1000000.0;
+}
+#endif
+
+double ThreadCpuTimeMs() noexcept {
+#ifdef _WIN32
+  FILETIME creationTime, exitTime, kernelTime, userTime;
+  return GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime)
+      ? ToMs(kernelTime, userTime)
+      : 0;
+#else
+  return ClockMs(CLOCK_THREAD_CPUTIME_ID);
+#endif
+}
+
+double ProcessCpuTimeMs() noexcept {
+#ifdef _WIN32
+  FILETIME creationTime, exitTime, kernelTime, userTime;
+  return GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime)
+      ? ToMs(kernelTime, userTime)
+      : 0;
+#else
+  return ClockMs(CLOCK_PROCESS_CPUTIME_ID);
+#endif
+}
+
+uint64_t CurrentThreadId() noexcept {
+#ifdef _WIN32
+  return GetCurrentThreadId();
+#else
+  // Kept to 32 bits so that trace viewers do not round it.
+  return std::hash<std::thread::id>{}(std::this_thread::get_id()) & 0xFFFFFFFF;
+#endif
+}
+
+uint64_t CurrentProcessId() noexcept {
+#ifdef _WIN32
+  return GetCurrentProcessId();
+#else
+  return static_cast<uint64_t>(getpid());
+#endif
+}
+
+void AppendJsonString(std::string &json, std::string_view value) noexcept {
+  json += '"';
+  for (const auto c : value) {
+    if (c == '"' || c == '\\') {
+      json += '\\';
+      json += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char escaped[8];
+      std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+      json += escaped;
+    } else {
+      json += c;
+    }
+  }
+  json += '"';
+}
+
+std::string FormatNumber(double value) noexcept {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.3f", value);
+  return buffer;
+}
+
+} // namespace
+
+StartupTimeline::StartupTimeline() noexcept : m_origin(std::chrono::steady_clock::now()) {}
+
+double StartupTimeline::SinceOriginMs(std::chrono::steady_clock::time_point time) const noexcept {
+  return std::chrono::duration<double, std::milli>(time - m_origin).count();
+}
+
+void StartupTimeline::BeginPhase(std::string_view name) noexcept {
+  OpenPhase phase{
+      std::string{name}, std::chrono::steady_clock::now(), ThreadCpuTimeMs(), ProcessCpuTimeMs(), CurrentThreadId()};
+
+  std::scoped_lock lock{m_mutex};
+  m_openPhases.push_back(std::move(phase));
+}
+
+void StartupTimeline::EndPhase(std::string_view name) noexcept {
+  const auto end = std::chrono::steady_clock::now();
+  const auto threadCpuTimeMs = ThreadCpuTimeMs();
+  const auto processCpuTimeMs = ProcessCpuTimeMs();
+  const auto threadId = CurrentThreadId();
+
+  std::scoped_lock lock{m_mutex};
+  auto it = std::find_if(
+      m_openPhases.rbegin(), m_openPhases.rend(), [name](const OpenPhase &phase) { return phase.name == name; });
+  if (it == m_openPhases.rend()) {
+    return;
+  }
+
+  StartupPhase phase;
+  phase.name = std::move(it->name);
+  phase.startMs = SinceOriginMs(it->start);
+  phase.wallTimeMs = std::chrono::duration<double, std::milli>(end - it->start).count();
+  phase.threadId = it->threadId;
+  phase.spansThreads = threadId != it->threadId;
+  phase.cpuTimeMs =
+      phase.spansThreads ? processCpuTimeMs - it->processCpuTimeMs : threadCpuTimeMs - it->threadCpuTimeMs;
+  m_openPhases.erase(std::next(it).base());
+  m_phases.push_back(std::move(phase));
+}
+
+void StartupTimeline::Mark(std::string_view name) noexcept {
+  StartupPhase marker;
+  marker.name = std::string{name};
+  marker.startMs = SinceOriginMs(std::chrono::steady_clock::now());
+  marker.threadId = CurrentThreadId();
+  marker.isMarker = true;
+
+  std::scoped_lock lock{m_mutex};
+  m_phases.push_back(std::move(marker));
+}
+
+std::vector<StartupPhase> StartupTimeline::Phases() const noexcept {
+  std::vector<StartupPhase> phases;
+  {
+    std::scoped_lock lock{m_mutex};
+    phases = m_phases;
+  }
+
+  std::stable_sort(phases.begin(), phases.end(), [](const StartupPhase &left, const StartupPhase &right) {
+    return left.startMs < right.startMs;
+  });
+  return phases;
+}
+
+std::string StartupTimeline::ToChromeTraceJson() const noexcept {
+  const auto processId = std::to_string(CurrentProcessId());
+
+  std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  auto first = true;
+  for (const auto &phase : Phases()) {
+    if (!first) {
+      json += ',';
+    }
+    first = false;
+
+    // Trace event timestamps and durations are in microseconds.
+    json += "{\"name\":";
+    AppendJsonString(json, phase.name);
+    json += ",\"cat\":\"startup\",\"pid\":" + processId + ",\"tid\":" + std::to_string(phase.threadId) +
+        ",\"ts\":" + FormatNumber(phase.startMs * 1000);
+    if (phase.isMarker) {
+      json += ",\"ph\":\"i\",\"s\":\"p\"}";
+    } else {
+      json += ",\"ph\":\"X\",\"dur\":" + FormatNumber(phase.wallTimeMs * 1000) +
+          ",\"args\":{\"cpuTimeMs\":" + FormatNumber(phase.cpuTimeMs) +
+          ",\"spansThreads\":" + (phase.spansThreads ? "true" : "false") + "}}";
+    }
+  }
+  json += "]}";
+  return json;
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,94 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+struct StartupPhase {
+  std::string name;
+  double startMs{0}; // Since the timeline was created
+  double wallTimeMs{0};
+  // CPU time of the thread that ran the phase, or of the whole process when
+  // the phase ended on another thread than the one it began on.
+  double cpuTimeMs{0};
+  uint64_t threadId{0}; // Thread the phase began on
+  bool spansThreads{false};
+  bool isMarker{false}; // A point in time rather than a phase
+};
+
+/// <summary>
+/// Records where the time goes while a React instance starts.
+///
+/// Phases are named spans of time, begun and ended on any thread: startup
+/// hops between the UI thread, the native queue and the JavaScript thread, so
+/// a phase may begin on one and end on another. Markers are named points in
+/// time. The completed phases can be read back as StartupPhase values or
+/// exported in the Chrome trace event format, which chrome://tracing and
+/// https://ui.perfetto.dev can load.
+/// </summary>
+class StartupTimeline {
+ public:
+  StartupTimeline() noexcept;
+
+  void BeginPhase(std::string_view name) noexcept;
+
+  // Ends the most recently begun phase with that name, does nothing if there
+  // is none.
+  void EndPhase(std::string_view name) noexcept;
+
+  void Mark(std::string_view name) noexcept;
+
+  // The completed phases and markers, in the order they started.
+  std::vector<StartupPhase> Phases() const noexcept;
+
+  std::string ToChromeTraceJson() const noexcept;
+
+  // Begins a phase that ends with the scope, or right away if timeline is null.
+  class Scope {
+   public:
+    Scope(StartupTimeline *timeline, std::string_view name) noexcept : m_timeline(timeline), m_name(name) {
+      if (m_timeline) {
+        m_timeline->BeginPhase(m_name);
+      }
+    }
+
+    ~Scope() noexcept {
+      if (m_timeline) {
+        m_timeline->EndPhase(m_name);
+      }
+    }
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+   private:
+    StartupTimeline *m_timeline;
+    std::string_view m_name;
+  };
+
+ private:
+  struct OpenPhase {
+    std::string name;
+    std::chrono::steady_clock::time_point start;
+    double threadCpuTimeMs;
+    double processCpuTimeMs;
+    uint64_t threadId;
+  };
+
+  double SinceOriginMs(std::chrono::steady_clock::time_point time) const noexcept;
+
+  const std::chrono::steady_clock::time_point m_origin;
+  mutable std::mutex m_mutex;
+  std::vector<OpenPhase> m_openPhases;
+  std::vector<StartupPhase> m_phases;
+};
+
+} // namespace Microsoft::ReactNative
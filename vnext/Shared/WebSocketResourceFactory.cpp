@@ -21,7 +21,16 @@ shared_ptr<IWebSocketResource> IWebSocketResource::Make() {
     certExceptions.emplace_back(ChainValidationResult::InvalidName);
   }
 
-  return std::make_shared<WinRTWebSocketResource>(std::move(certExceptions));
+  // Watermarks are in bytes.
+  WebSocketWriteQueue::Options writeQueueOptions;
+  if (auto highWatermark = GetRuntimeOptionInt("WebSocket.SendHighWatermark"); highWatermark > 0) {
+    writeQueueOptions.HighWatermark = static_cast<size_t>(highWatermark);
+  }
+  if (auto lowWatermark = GetRuntimeOptionInt("WebSocket.SendLowWatermark"); lowWatermark > 0) {
+    writeQueueOptions.LowWatermark = static_cast<size_t>(lowWatermark);
+  }
+
+  return std::make_shared<WinRTWebSocketResource>(std::move(certExceptions), std::move(writeQueueOptions));
 }
 
 #pragma endregion IWebSocketResource static members
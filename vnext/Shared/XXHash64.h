@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Microsoft::ReactNative {
+
+namespace Detail {
+
+constexpr uint64_t XXH64Prime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t XXH64Prime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t XXH64Prime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t XXH64Prime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t XXH64Prime5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t XXH64RotateLeft(uint64_t value, int bits) noexcept {
+  return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t XXH64Read64(const uint8_t *p) noexcept {
+  uint64_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+inline uint32_t XXH64Read32(const uint8_t *p) noexcept {
+  uint32_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+inline uint64_t XXH64Round(uint64_t accumulator, uint64_t input) noexcept {
+  accumulator += input * XXH64Prime2;
+  accumulator = XXH64RotateLeft(accumulator, 31);
+  return accumulator * XXH64Prime1;
+}
+
+inline uint64_t XXH64MergeRound(uint64_t accumulator, uint64_t value) noexcept {
+  accumulator ^= XXH64Round(0, value);
+  return accumulator * XXH64Prime1 + XXH64Prime4;
+}
+
+} // namespace Detail
+
+/// <summary>
+/// The 64-bit xxHash (XXH64) of a buffer, as specified at
+/// https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md.
+/// A non-cryptographic hash that runs at memory bandwidth, used to detect
+/// corruption of cached data where a SHA-256 over the whole buffer would
+/// dominate the load time. Assumes a little endian platform.
+/// </summary>
+inline uint64_t XXHash64(const void *data, size_t size, uint64_t seed = 0) noexcept {
+  using namespace Detail;
+
+  auto p = static_cast<const uint8_t *>(data);
+  const auto end = p + size;
+  uint64_t hash;
+
+  if (size >= 32) {
+    auto v1 = seed + XXH64Prime1 + XXH64Prime2;
+    auto v2 = seed + XXH64Prime2;
+    auto v3 = seed;
+    auto v4 = seed - XXH64Prime1;
+    const auto limit = end - 32;
+    do {
+      v1 = XXH64Round(v1, XXH64Read64(p));
+      v2 = XXH64Round(v2, XXH64Read64(p + 8));
+      v3 = XXH64Round(v3, XXH64Read64(p + 16));
+      v4 = XXH64Round(v4, XXH64Read64(p + 24));
+      p += 32;
+    } while (p <= limit);
+
+    hash = XXH64RotateLeft(v1, 1) + XXH64RotateLeft(v2, 7) + XXH64RotateLeft(v3, 12) + XXH64RotateLeft(v4, 18);
+    hash = XXH64MergeRound(hash, v1);
+    hash = XXH64MergeRound(hash, v2);
+    hash = XXH64MergeRound(hash, v3);
+    hash = XXH64MergeRound(hash, v4);
+  } else {
+    hash = seed + XXH64Prime5;
+  }
+
+  hash += static_cast<uint64_t>(size);
+
+  for (; p + 8 <= end; p += 8) {
+    hash ^= XXH64Round(0, XXH64Read64(p));
+    hash = XXH64RotateLeft(hash, 27) * XXH64Prime1 + XXH64Prime4;
+  }
+
+  if (p + 4 <= end) {
+    hash ^= static_cast<uint64_t>(XXH64Read32(p)) * XXH64Prime1;
+    hash = XXH64RotateLeft(hash, 23) * XXH64Prime2 + XXH64Prime3;
+    p += 4;
+  }
+
+  for (; p < end; p++) {
+    hash ^= static_cast<uint64_t>(*p) * XXH64Prime5;
+    hash = XXH64RotateLeft(hash, 11) * XXH64Prime1;
+  }
+
+  hash ^= hash >> 33;
+  hash *= XXH64Prime2;
+  hash ^= hash >> 29;
+  hash *= XXH64Prime3;
+  hash ^= hash >> 32;
+  return hash;
+}
+
+} // namespace Microsoft::ReactNative